@@ -0,0 +1,332 @@
+#include "stdafx.h"
+#include "adjustment_chain.h"
+#include "color_converter.h"
+#include "..\utils\parallel.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+	//! Multiplies two 3x4 affine matrices, the result applies first and then second.
+	std::array<float, 12> concatenate(const std::array<float, 12>& first, const std::array<float, 12>& second)
+	{
+		std::array<float, 12> result;
+		for (int row = 0; row < 3; ++row)
+		{
+			for (int column = 0; column < 4; ++column)
+			{
+				float value = column == 3 ? second[row * 4 + 3] : 0.f;
+				for (int k = 0; k < 3; ++k) value += second[row * 4 + k] * first[k * 4 + column];
+				result[row * 4 + column] = value;
+			}
+		}
+		return result;
+	}
+
+	//! Creates a 3x4 affine matrix from a 3x3 matrix without offset.
+	std::array<float, 12> linear_part(const matrix<float>& mat)
+	{
+		return { mat(0, 0), mat(0, 1), mat(0, 2), 0.f, mat(1, 0), mat(1, 1), mat(1, 2), 0.f, mat(2, 0), mat(2, 1), mat(2, 2), 0.f };
+	}
+
+	//! Applies a gamma function point symmetric, so values below 0 left by earlier steps stay defined.
+	template<typename F>
+	inline float symmetric(float value, F function)
+	{
+		return value < 0.f ? -function(-value) : function(value);
+	}
+}
+
+const size_t color_manipulation::adjustment_chain::curve_samples;
+
+color_manipulation::color_lut::color_lut(color_space::rgb_color_space_definition * rgb_color_space, size_t size, const std::function<void(const float* rgb, float* result)>& function)
+	: m_rgb_color_space(rgb_color_space), m_size(size)
+{
+	if (size < 2) throw new std::invalid_argument("A color lookup table needs at least 2 samples per axis.");
+
+	m_table.resize(size * size * size * 3);
+	const float step = 1.f / (size - 1);
+	parallel::for_each_chunk(size, 1, [&](size_t chunk, size_t begin, size_t end)
+	{
+		for (size_t b = begin; b < end; ++b)
+		{
+			for (size_t g = 0; g < size; ++g)
+			{
+				for (size_t r = 0; r < size; ++r)
+				{
+					const float rgb[3] = { r * step, g * step, b * step };
+					function(rgb, m_table.data() + ((b * size + g) * size + r) * 3);
+				}
+			}
+		}
+	});
+}
+
+void color_manipulation::color_lut::lookup(const float * rgb, float * result) const
+{
+	size_t index[3];
+	float fraction[3];
+	for (int i = 0; i < 3; ++i)
+	{
+		const float position = std::min(std::max(rgb[i], 0.f), 1.f) * (m_size - 1);
+		index[i] = std::min((size_t)position, m_size - 2);
+		fraction[i] = position - index[i];
+	}
+
+	const size_t stride_g = m_size * 3, stride_b = m_size * m_size * 3;
+	const float* base = m_table.data() + index[2] * stride_b + index[1] * stride_g + index[0] * 3;
+	for (int c = 0; c < 3; ++c)
+	{
+		const float* p = base + c;
+		const float c00 = p[0] + (p[3] - p[0]) * fraction[0];
+		const float c10 = p[stride_g] + (p[stride_g + 3] - p[stride_g]) * fraction[0];
+		const float c01 = p[stride_b] + (p[stride_b + 3] - p[stride_b]) * fraction[0];
+		const float c11 = p[stride_b + stride_g] + (p[stride_b + stride_g + 3] - p[stride_b + stride_g]) * fraction[0];
+		const float c0 = c00 + (c10 - c00) * fraction[1];
+		const float c1 = c01 + (c11 - c01) * fraction[1];
+		result[c] = c0 + (c1 - c0) * fraction[2];
+	}
+}
+
+color_space::color_base * color_manipulation::color_lut::apply(color_space::color_base * color) const
+{
+	auto rgb_d = color_manipulation::color_converter::to_rgb_deep(*color);
+	float rgb[3];
+	lookup(rgb_d.get_components().data(), rgb);
+	return color_manipulation::color_converter::create_converted(color_space::rgb_deepcolor(rgb[0], rgb[1], rgb[2], rgb_d.alpha(), color->get_rgb_color_space()), color->get_color_type());
+}
+
+color_buffer color_manipulation::color_lut::apply(const color_buffer & colors) const
+{
+	const color_type type = colors.get_color_type();
+	color_buffer result(type, colors.get_rgb_color_space(), colors.size());
+	parallel::for_each_chunk(colors.size(), 4096, [&](size_t chunk, size_t begin, size_t end)
+	{
+		float rgb[4];
+		for (size_t i = begin; i < end; ++i)
+		{
+			color_manipulation::color_converter::convert_values(type, colors.pixel(i), colors.get_rgb_color_space(), color_type::RGB_DEEP, rgb);
+			lookup(rgb, rgb);
+			color_manipulation::color_converter::convert_values(color_type::RGB_DEEP, rgb, colors.get_rgb_color_space(), type, result.pixel(i));
+		}
+	});
+	return result;
+}
+
+color_manipulation::adjustment_chain::adjustment_chain(color_space::rgb_color_space_definition * rgb_color_space)
+	: m_rgb_color_space(rgb_color_space), m_linear(false)
+{
+}
+
+color_manipulation::adjustment_chain & color_manipulation::adjustment_chain::saturation(float percentage)
+{
+	// c' = c - p * (L - c) with L = 0.299 r + 0.587 g + 0.114 b
+	const float weights[3] = { 0.299f, 0.587f, 0.114f };
+	std::array<float, 12> mat;
+	for (int row = 0; row < 3; ++row)
+	{
+		for (int column = 0; column < 3; ++column)
+		{
+			mat[row * 4 + column] = (row == column ? 1.f + percentage : 0.f) - percentage * weights[column];
+		}
+		mat[row * 4 + 3] = 0.f;
+	}
+	add_affine(mat, false);
+	return *this;
+}
+
+color_manipulation::adjustment_chain & color_manipulation::adjustment_chain::lightness(float percentage)
+{
+	const float factor = 1.f + percentage;
+	add_affine({ factor, 0.f, 0.f, 0.f, 0.f, factor, 0.f, 0.f, 0.f, 0.f, factor, 0.f }, false);
+	return *this;
+}
+
+color_manipulation::adjustment_chain & color_manipulation::adjustment_chain::exposure(float stops)
+{
+	const float factor = std::pow(2.f, stops);
+	add_affine({ factor, 0.f, 0.f, 0.f, 0.f, factor, 0.f, 0.f, 0.f, 0.f, factor, 0.f }, true);
+	return *this;
+}
+
+color_manipulation::adjustment_chain & color_manipulation::adjustment_chain::contrast(float percentage, float pivot)
+{
+	const float factor = 1.f + percentage, offset = pivot * (1.f - factor);
+	add_affine({ factor, 0.f, 0.f, offset, 0.f, factor, 0.f, offset, 0.f, 0.f, factor, offset }, false);
+	return *this;
+}
+
+color_manipulation::adjustment_chain & color_manipulation::adjustment_chain::hue_shift(float degrees)
+{
+	// Rodrigues rotation around the unit vector (1,1,1)/sqrt(3)
+	const float angle = degrees * (float)M_PI / 180.f;
+	const float c = std::cos(angle), s = std::sin(angle) / std::sqrt(3.f), k = (1.f - c) / 3.f;
+	add_affine({ c + k, k - s, k + s, 0.f, k + s, c + k, k - s, 0.f, k - s, k + s, c + k, 0.f }, false);
+	return *this;
+}
+
+color_manipulation::adjustment_chain & color_manipulation::adjustment_chain::curve(const std::function<float(float)>& curve)
+{
+	std::vector<float> table(curve_samples);
+	for (size_t i = 0; i < curve_samples; ++i) table[i] = curve((float)i / (curve_samples - 1));
+
+	switch_domain(false);
+	if (!m_operations.empty() && m_operations.back().kind == CURVE)
+	{
+		for (float& value : m_operations.back().table) value = evaluate_curve(table, value);
+		return *this;
+	}
+
+	operation op;
+	op.kind = CURVE;
+	op.table = std::move(table);
+	m_operations.push_back(std::move(op));
+	return *this;
+}
+
+color_manipulation::adjustment_chain & color_manipulation::adjustment_chain::white_balance(color_space::white_point * target_white_point, adaptation_method method)
+{
+	if (target_white_point == m_rgb_color_space->get_white_point()) return *this;
+
+	// Linear rgb -> xyz -> adapted xyz -> linear rgb of the adapted definition
+	color_space::rgb_color_space_definition adapted(*m_rgb_color_space);
+	adapted.set_white_point(target_white_point);
+	auto adaptation = chromatic_adaptation::adaptation_matrix(m_rgb_color_space->get_white_point(), target_white_point, method);
+	add_affine(linear_part(adapted.get_inverse_transform_matrix() * adaptation * m_rgb_color_space->get_transform_matrix()), true);
+	return *this;
+}
+
+size_t color_manipulation::adjustment_chain::operation_count() const
+{
+	return m_operations.size() + (m_linear ? 1 : 0);
+}
+
+void color_manipulation::adjustment_chain::apply_rgb(const float * rgb, float * result) const
+{
+	auto gamma = m_rgb_color_space->get_gamma_curve();
+	float values[3] = { rgb[0], rgb[1], rgb[2] };
+	for (const operation& op : m_operations)
+	{
+		switch (op.kind)
+		{
+		case AFFINE:
+		{
+			const float* m = op.matrix.data();
+			const float r = values[0], g = values[1], b = values[2];
+			values[0] = m[0] * r + m[1] * g + m[2] * b + m[3];
+			values[1] = m[4] * r + m[5] * g + m[6] * b + m[7];
+			values[2] = m[8] * r + m[9] * g + m[10] * b + m[11];
+			break;
+		}
+		case CURVE:
+			for (float& value : values) value = evaluate_curve(op.table, value);
+			break;
+		case TO_LINEAR:
+			for (float& value : values) value = symmetric(value, [gamma](float v) { return gamma->inverse_gamma_correction(v); });
+			break;
+		case TO_GAMMA:
+			for (float& value : values) value = symmetric(value, [gamma](float v) { return gamma->gamma_correction(v); });
+			break;
+		}
+	}
+
+	for (int i = 0; i < 3; ++i)
+	{
+		float value = values[i];
+		if (m_linear) value = symmetric(value, [gamma](float v) { return gamma->gamma_correction(v); });
+		result[i] = std::min(std::max(value, 0.f), 1.f);
+	}
+}
+
+color_space::color_base * color_manipulation::adjustment_chain::apply(color_space::color_base * color) const
+{
+	auto rgb_d = color_manipulation::color_converter::to_rgb_deep(*color);
+	float rgb[3];
+	apply_rgb(rgb_d.get_components().data(), rgb);
+	return color_manipulation::color_converter::create_converted(color_space::rgb_deepcolor(rgb[0], rgb[1], rgb[2], rgb_d.alpha(), color->get_rgb_color_space()), color->get_color_type());
+}
+
+color_buffer color_manipulation::adjustment_chain::apply(const color_buffer & colors) const
+{
+	const color_type type = colors.get_color_type();
+	color_buffer result(type, colors.get_rgb_color_space(), colors.size());
+	parallel::for_each_chunk(colors.size(), 4096, [&](size_t chunk, size_t begin, size_t end)
+	{
+		float rgb[4];
+		for (size_t i = begin; i < end; ++i)
+		{
+			color_manipulation::color_converter::convert_values(type, colors.pixel(i), colors.get_rgb_color_space(), color_type::RGB_DEEP, rgb);
+			apply_rgb(rgb, rgb);
+			color_manipulation::color_converter::convert_values(color_type::RGB_DEEP, rgb, colors.get_rgb_color_space(), type, result.pixel(i));
+		}
+	});
+	return result;
+}
+
+half_buffer color_manipulation::adjustment_chain::apply(const half_buffer & colors) const
+{
+	const color_type type = colors.get_color_type();
+	const size_t channels = colors.channels();
+	half_buffer result(type, colors.get_rgb_color_space(), colors.size());
+	parallel::for_each_chunk(colors.size(), half_buffer::chunk_size, [&](size_t chunk, size_t begin, size_t end)
+	{
+		std::vector<float> values((end - begin) * channels);
+		colors.load(begin, end - begin, values.data());
+		float rgb[4];
+		for (size_t i = 0; i < end - begin; ++i)
+		{
+			color_manipulation::color_converter::convert_values(type, values.data() + i * channels, colors.get_rgb_color_space(), color_type::RGB_DEEP, rgb);
+			apply_rgb(rgb, rgb);
+			color_manipulation::color_converter::convert_values(color_type::RGB_DEEP, rgb, colors.get_rgb_color_space(), type, values.data() + i * channels);
+		}
+		result.store(begin, end - begin, values.data());
+	});
+	return result;
+}
+
+color_manipulation::color_lut color_manipulation::adjustment_chain::bake(size_t size) const
+{
+	return color_lut(m_rgb_color_space, size, [this](const float* rgb, float* result) { apply_rgb(rgb, result); });
+}
+
+void color_manipulation::adjustment_chain::add_affine(const std::array<float, 12>& matrix, bool linear)
+{
+	switch_domain(linear);
+	if (!m_operations.empty() && m_operations.back().kind == AFFINE)
+	{
+		m_operations.back().matrix = concatenate(m_operations.back().matrix, matrix);
+		return;
+	}
+
+	operation op;
+	op.kind = AFFINE;
+	op.matrix = matrix;
+	m_operations.push_back(std::move(op));
+}
+
+void color_manipulation::adjustment_chain::switch_domain(bool linear)
+{
+	if (m_linear == linear) return;
+	m_linear = linear;
+
+	// A transition right after the opposite transition cancels it, so the operations around both can merge.
+	const operation_kind kind = linear ? TO_LINEAR : TO_GAMMA;
+	const operation_kind opposite = linear ? TO_GAMMA : TO_LINEAR;
+	if (!m_operations.empty() && m_operations.back().kind == opposite)
+	{
+		m_operations.pop_back();
+		return;
+	}
+
+	operation op;
+	op.kind = kind;
+	m_operations.push_back(std::move(op));
+}
+
+float color_manipulation::adjustment_chain::evaluate_curve(const std::vector<float>& table, float value) const
+{
+	const float position = std::min(std::max(value, 0.f), 1.f) * (curve_samples - 1);
+	const size_t index = std::min((size_t)position, curve_samples - 2);
+	return table[index] + (table[index + 1] - table[index]) * (position - index);
+}
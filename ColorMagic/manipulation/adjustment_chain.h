@@ -0,0 +1,211 @@
+/// Copyright Martin Ruehlicke, 2019
+/// Use, modification and distribution are subject to the
+/// MIT Software License, Version 1.0.
+/// See accompanying file LICENSE.txt
+
+#pragma once
+
+#include "chromatic_adaptation.h"
+#include "..\spaces\color_base.h"
+#include "..\spaces\rgb_color_space_definition.h"
+#include "..\utils\color_buffer.h"
+#include "..\utils\half_buffer.h"
+
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+namespace color_manipulation
+{
+	//! Three dimensional lookup table of rgb deep colors.
+	/*!
+	* Created by adjustment_chain::bake(). The table samples a function of the gamma corrected rgb values on a regular
+	* grid over [0,1]^3 and interpolates trilinearly between the samples, so every color costs eight table reads no
+	* matter how many adjustments were baked into it.
+	*/
+	class color_lut
+	{
+	public:
+		//! Default constructor.
+		/*!
+		* \param rgb_color_space The rgb color space definition of the sampled rgb values.
+		* \param size The number of samples per axis, at least 2.
+		* \param function Called with the rgb values of every grid point, writes the rgb values of the table entry.
+		*/
+		color_lut(color_space::rgb_color_space_definition* rgb_color_space, size_t size, const std::function<void(const float* rgb, float* result)>& function);
+
+		//! Returns the number of samples per axis.
+		size_t size() const { return m_size; }
+
+		//! Returns the rgb color space definition of the sampled rgb values.
+		color_space::rgb_color_space_definition* get_rgb_color_space() const { return m_rgb_color_space; }
+
+		//! Interpolates the table at one rgb color.
+		/*!
+		* \param rgb The rgb values, they are clamped to [0,1].
+		* \param result Receives the interpolated rgb values.
+		*/
+		void lookup(const float* rgb, float* result) const;
+
+		//! Applies the table to one color.
+		/*!
+		* \return The color in the same color type as the input color. The color is a new object owned by the caller.
+		*/
+		color_space::color_base* apply(color_space::color_base* color) const;
+
+		//! Applies the table to a buffer of colors.
+		/*!
+		* The buffer is processed in chunks on all cores, alpha is kept.
+		* \return A new buffer with the color type and the rgb color space definition of the input buffer.
+		*/
+		color_buffer apply(const color_buffer& colors) const;
+
+	private:
+		color_space::rgb_color_space_definition* m_rgb_color_space;
+		size_t m_size;
+		std::vector<float> m_table;
+	};
+
+	//! Composable chain of color adjustments that runs as a single pass.
+	/*!
+	* The adjustments are added with the builder functions and applied in the order they were added. While building, the
+	* chain is compiled into as few operations as possible: consecutive linear adjustments are multiplied into one 3x4
+	* matrix, consecutive curves are composed into one table and the gamma curve is only applied when the chain switches
+	* between gamma corrected and linear rgb values. Between the steps the values stay in rgb deep without clamping or
+	* conversions, they are clamped to [0,1] once at the end.
+	*
+	* Saturation and lightness match color_adjustments::saturate_in_rgb_space() and
+	* color_adjustments::luminate_in_rgb_space() as long as no intermediate value leaves [0,1].
+	*/
+	class adjustment_chain
+	{
+	public:
+		//! Default constructor.
+		/*!
+		* \param rgb_color_space The rgb color space definition in which the adjustments are computed.
+		*/
+		adjustment_chain(color_space::rgb_color_space_definition* rgb_color_space);
+
+		//! Increases or decreases the saturation like color_adjustments::saturate_in_rgb_space().
+		/*!
+		* \param percentage Values between 0 and 1 increase the saturation and values between 0 and -1 decrease it.
+		*/
+		adjustment_chain& saturation(float percentage);
+
+		//! Increases or decreases the lightness like color_adjustments::luminate_in_rgb_space().
+		/*!
+		* \param percentage Values between 0 and 1 increase the lightness and values between 0 and -1 decrease it.
+		*/
+		adjustment_chain& lightness(float percentage);
+
+		//! Changes the exposure, computed on linear rgb values.
+		/*!
+		* \param stops The number of stops, every stop doubles the light.
+		*/
+		adjustment_chain& exposure(float stops);
+
+		//! Increases or decreases the contrast around a pivot.
+		/*!
+		* \param percentage Values above 0 increase the contrast and values between 0 and -1 decrease it.
+		* \param pivot The gamma corrected value that is kept.
+		*/
+		adjustment_chain& contrast(float percentage, float pivot = 0.5f);
+
+		//! Rotates the hue around the grey axis of the rgb cube.
+		/*!
+		* Unlike a rotation in hsl the rotation is a matrix, so it can be merged with the other linear adjustments.
+		* \param degrees The angle, 120 degrees turn red into green.
+		*/
+		adjustment_chain& hue_shift(float degrees);
+
+		//! Applies a tone curve to every rgb channel.
+		/*!
+		* The curve is sampled into a table of curve_samples values and interpolated linearly.
+		* \param curve Maps a gamma corrected value in [0,1] to its new value, inputs outside of [0,1] are clamped.
+		*/
+		adjustment_chain& curve(const std::function<float(float)>& curve);
+
+		//! Adapts the colors from the white point of the rgb color space definition to a target white point.
+		/*!
+		* The adaptation is the linear rgb matrix of chromatic_adaptation::adaptation_matrix(), the results are the rgb
+		* values of the adapted definition like the ones of the chromatic_adaptation functions.
+		* \param target_white_point The target white point.
+		* \param method The adaptation method.
+		*/
+		adjustment_chain& white_balance(color_space::white_point* target_white_point, adaptation_method method = BRADFORD_ADAPTATION);
+
+		//! Returns the number of operations the chain was compiled into.
+		/*!
+		* Matrices, curve tables and gamma curve transitions count as one operation each.
+		*/
+		size_t operation_count() const;
+
+		//! Returns the rgb color space definition in which the adjustments are computed.
+		color_space::rgb_color_space_definition* get_rgb_color_space() const { return m_rgb_color_space; }
+
+		//! Applies the chain to rgb deep values.
+		/*!
+		* \param rgb The gamma corrected rgb values.
+		* \param result Receives the adjusted rgb values in the range [0,1], may be the same as rgb.
+		*/
+		void apply_rgb(const float* rgb, float* result) const;
+
+		//! Applies the chain to one color.
+		/*!
+		* \return The adjusted color in the same color type as the input color. The color is a new object owned by the caller.
+		*/
+		color_space::color_base* apply(color_space::color_base* color) const;
+
+		//! Applies the chain to a buffer of colors.
+		/*!
+		* The colors are converted to rgb deep, adjusted by the fused operations and converted back in one pass per
+		* color. The buffer is processed in chunks on all cores, alpha is kept.
+		* \return A new buffer with the color type and the rgb color space definition of the input buffer.
+		*/
+		color_buffer apply(const color_buffer& colors) const;
+
+		//! Applies the chain to a buffer of half precision colors.
+		/*!
+		* Like apply() for color buffers, the values are loaded as floats and stored as half floats chunk by chunk.
+		* \return A new buffer with the color type and the rgb color space definition of the input buffer.
+		*/
+		half_buffer apply(const half_buffer& colors) const;
+
+		//! Bakes the chain into a three dimensional lookup table.
+		/*!
+		* \param size The number of samples per axis, at least 2.
+		* \return The table, it applies the chain approximately at a constant cost.
+		*/
+		color_lut bake(size_t size = 33) const;
+
+		//! Number of samples of a curve table.
+		static const size_t curve_samples = 4096;
+
+	private:
+		//! Enum that defines the kind of a compiled operation.
+		enum operation_kind
+		{
+			AFFINE = 0, /*!< AFFINE - 3x4 matrix, the last column is the offset */
+			CURVE, /*!< CURVE - table of curve_samples values applied to every channel */
+			TO_LINEAR, /*!< TO_LINEAR - inverse gamma correction */
+			TO_GAMMA /*!< TO_GAMMA - gamma correction */
+		};
+
+		//! A compiled operation.
+		struct operation
+		{
+			operation_kind kind;
+			std::array<float, 12> matrix;
+			std::vector<float> table;
+		};
+
+		void add_affine(const std::array<float, 12>& matrix, bool linear);
+		void switch_domain(bool linear);
+		float evaluate_curve(const std::vector<float>& table, float value) const;
+
+		color_space::rgb_color_space_definition* m_rgb_color_space;
+		std::vector<operation> m_operations;
+		bool m_linear;
+	};
+}
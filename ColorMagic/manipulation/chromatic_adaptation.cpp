@@ -1,5 +1,11 @@
 #include "stdafx.h"
 #include "chromatic_adaptation.h"
+#include "..\utils\instrumentation.h"
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <tuple>
 
 matrix<float> color_manipulation::chromatic_adaptation::m_von_kries = matrix<float>(3, 3, std::vector<float>
 {
@@ -101,9 +107,11 @@ matrix<float> color_manipulation::chromatic_adaptation::m_inverted_cat02 = matri
 
 color_space::color_base * color_manipulation::chromatic_adaptation::von_kries_adaptation(color_space::color_base * color, color_space::white_point * target_white_point)
 {
+	COLORMAGIC_INSTRUMENT("chromatic_adaptation::von_kries_adaptation");
+
 	if (color->get_rgb_color_space()->get_white_point() == target_white_point)
 	{
-		return color;
+		return color_manipulation::color_converter::create_converted(*color, color->get_color_type());
 	}
 
 	return do_adaption(color, target_white_point, m_von_kries, m_inverted_von_kries);
@@ -111,17 +119,19 @@ color_space::color_base * color_manipulation::chromatic_adaptation::von_kries_ad
 
 color_space::color_base * color_manipulation::chromatic_adaptation::bradford_adaptation(color_space::color_base * color, color_space::white_point * target_white_point)
 {
+	COLORMAGIC_INSTRUMENT("chromatic_adaptation::bradford_adaptation");
+
 	if (color->get_rgb_color_space()->get_white_point() == target_white_point)
 	{
-		return color;
+		return color_manipulation::color_converter::create_converted(*color, color->get_color_type());
 	}
 
 	// Convert to XYZ space and transform using bradford matrix (incl. normalization)
-	auto tmp_color = color_manipulation::color_converter::to_xyz(color);
-	auto rgb_comp = m_bradford * tmp_color->get_component_vector();
-	rgb_comp[0] /= color->get_component_vector()[1];
-	rgb_comp[1] /= color->get_component_vector()[1];
-	rgb_comp[2] /= color->get_component_vector()[1];
+	auto tmp_color = color_manipulation::color_converter::to_xyz(*color);
+	auto rgb_comp = m_bradford * tmp_color.get_components();
+	rgb_comp[0] /= color->get_components()[1];
+	rgb_comp[1] /= color->get_components()[1];
+	rgb_comp[2] /= color->get_components()[1];
 
 	// Create scaled white point vectors (incl. normalization)
 	std::vector<float> source_wp = std::vector<float>();
@@ -140,27 +150,28 @@ color_space::color_base * color_manipulation::chromatic_adaptation::bradford_ada
 	// Adapt color (incl. undo of normalization)
 	auto p = powf(scaled_source_wp[2] / scaled_dest_wp[2], 0.0834f);
 	std::vector<float> tmp_rgb_comp;
-	tmp_rgb_comp.push_back((scaled_dest_wp[0] * (rgb_comp[0] / scaled_source_wp[0])) * color->get_component_vector()[1]);
-	tmp_rgb_comp.push_back((scaled_dest_wp[1] * (rgb_comp[1] / scaled_source_wp[1])) * color->get_component_vector()[1]);
+	tmp_rgb_comp.push_back((scaled_dest_wp[0] * (rgb_comp[0] / scaled_source_wp[0])) * color->get_components()[1]);
+	tmp_rgb_comp.push_back((scaled_dest_wp[1] * (rgb_comp[1] / scaled_source_wp[1])) * color->get_components()[1]);
 
 	float div = rgb_comp[2] / scaled_source_wp[2];
-	tmp_rgb_comp.push_back((scaled_dest_wp[2] * powf(fabsf(div), p)) * color->get_component_vector()[1]); // avoid overflow of float
+	tmp_rgb_comp.push_back((scaled_dest_wp[2] * powf(fabsf(div), p)) * color->get_components()[1]); // avoid overflow of float
 	if (div < 0.f) tmp_rgb_comp[2] *= -1.f;
 
 	auto transformed_components = m_inverted_bradford * tmp_rgb_comp;
-	auto rgb_def = new color_space::rgb_color_space_definition(*color->get_rgb_color_space());
-	rgb_def->set_white_point(target_white_point);
-	auto tmp_trans_color = new color_space::xyz(transformed_components[0], transformed_components[1], transformed_components[2], tmp_color->alpha(), rgb_def);
+	auto rgb_def = adapted_definition(color->get_rgb_color_space(), target_white_point);
+	color_space::xyz tmp_trans_color(transformed_components[0], transformed_components[1], transformed_components[2], tmp_color.alpha(), rgb_def);
 
 	// Convert transformed color back to input color space
-	return color_manipulation::color_converter::convertTo(tmp_trans_color, color->get_color_type());
+	return color_manipulation::color_converter::create_converted(tmp_trans_color, color->get_color_type());
 }
 
 color_space::color_base * color_manipulation::chromatic_adaptation::bradford_adaptation_simplified(color_space::color_base * color, color_space::white_point * target_white_point)
 {
+	COLORMAGIC_INSTRUMENT("chromatic_adaptation::bradford_adaptation_simplified");
+
 	if (color->get_rgb_color_space()->get_white_point() == target_white_point)
 	{
-		return color;
+		return color_manipulation::color_converter::create_converted(*color, color->get_color_type());
 	}
 
 	return do_adaption(color, target_white_point, m_bradford, m_inverted_bradford);
@@ -168,9 +179,11 @@ color_space::color_base * color_manipulation::chromatic_adaptation::bradford_ada
 
 color_space::color_base * color_manipulation::chromatic_adaptation::xyz_scale_adaptation(color_space::color_base * color, color_space::white_point * target_white_point)
 {
+	COLORMAGIC_INSTRUMENT("chromatic_adaptation::xyz_scale_adaptation");
+
 	if (color->get_rgb_color_space()->get_white_point() == target_white_point)
 	{
-		return color;
+		return color_manipulation::color_converter::create_converted(*color, color->get_color_type());
 	}
 
 	return do_adaption(color, target_white_point, m_xyz_scale, m_inverted_xyz_scale);
@@ -178,9 +191,11 @@ color_space::color_base * color_manipulation::chromatic_adaptation::xyz_scale_ad
 
 color_space::color_base * color_manipulation::chromatic_adaptation::sharp_adaptation(color_space::color_base * color, color_space::white_point * target_white_point)
 {
+	COLORMAGIC_INSTRUMENT("chromatic_adaptation::sharp_adaptation");
+
 	if (color->get_rgb_color_space()->get_white_point() == target_white_point)
 	{
-		return color;
+		return color_manipulation::color_converter::create_converted(*color, color->get_color_type());
 	}
 
 	return do_adaption(color, target_white_point, m_sharp, m_inverted_sharp);
@@ -188,9 +203,11 @@ color_space::color_base * color_manipulation::chromatic_adaptation::sharp_adapta
 
 color_space::color_base * color_manipulation::chromatic_adaptation::cmccat97_adaptation_simplified(color_space::color_base * color, color_space::white_point * target_white_point)
 {
+	COLORMAGIC_INSTRUMENT("chromatic_adaptation::cmccat97_adaptation_simplified");
+
 	if (color->get_rgb_color_space()->get_white_point() == target_white_point)
 	{
-		return color;
+		return color_manipulation::color_converter::create_converted(*color, color->get_color_type());
 	}
 
 	return do_adaption(color, target_white_point, m_cmccat97, m_inverted_cmccat97);
@@ -198,17 +215,19 @@ color_space::color_base * color_manipulation::chromatic_adaptation::cmccat97_ada
 
 color_space::color_base * color_manipulation::chromatic_adaptation::cmccat97_adaptation(color_space::color_base * color, color_space::white_point * target_white_point, float f, float adapting_field_luminance)
 {
+	COLORMAGIC_INSTRUMENT("chromatic_adaptation::cmccat97_adaptation");
+
 	if (color->get_rgb_color_space()->get_white_point() == target_white_point)
 	{
-		return color;
+		return color_manipulation::color_converter::create_converted(*color, color->get_color_type());
 	}
 
 	// Convert to XYZ space and transform using cmccat97 matrix (incl. normalization)
-	auto tmp_color = color_manipulation::color_converter::to_xyz(color);
-	auto rgb_comp = m_cmccat97 * tmp_color->get_component_vector();
-	rgb_comp[0] /= color->get_component_vector()[1];
-	rgb_comp[1] /= color->get_component_vector()[1];
-	rgb_comp[2] /= color->get_component_vector()[1];
+	auto tmp_color = color_manipulation::color_converter::to_xyz(*color);
+	auto rgb_comp = m_cmccat97 * tmp_color.get_components();
+	rgb_comp[0] /= color->get_components()[1];
+	rgb_comp[1] /= color->get_components()[1];
+	rgb_comp[2] /= color->get_components()[1];
 
 	// Create scaled white point vectors (incl. normalization)
 	std::vector<float> source_wp = std::vector<float>();
@@ -232,26 +251,27 @@ color_space::color_base * color_manipulation::chromatic_adaptation::cmccat97_ada
 	// Adapt color (incl. undo of normalization)
 	auto p = powf(scaled_source_wp[2] / scaled_dest_wp[2], 0.0834f);
 	std::vector<float> rgbc;
-	rgbc.push_back(color->get_component_vector()[1] * (rgb_comp[0] * (d * (scaled_dest_wp[0] / scaled_source_wp[0]) + 1.f - d)));
-	rgbc.push_back(color->get_component_vector()[1] * (rgb_comp[1] * (d * (scaled_dest_wp[1] / scaled_source_wp[1]) + 1.f - d)));
-	rgbc.push_back(color->get_component_vector()[1] * (powf(fabsf(rgb_comp[2]), p) * (d * (scaled_dest_wp[2] / powf(scaled_source_wp[2], p)) + 1.f - d)));
+	rgbc.push_back(color->get_components()[1] * (rgb_comp[0] * (d * (scaled_dest_wp[0] / scaled_source_wp[0]) + 1.f - d)));
+	rgbc.push_back(color->get_components()[1] * (rgb_comp[1] * (d * (scaled_dest_wp[1] / scaled_source_wp[1]) + 1.f - d)));
+	rgbc.push_back(color->get_components()[1] * (powf(fabsf(rgb_comp[2]), p) * (d * (scaled_dest_wp[2] / powf(scaled_source_wp[2], p)) + 1.f - d)));
 
 	if (rgb_comp[2] < 0.f) rgbc[2] *= -1.f;
 
 	auto transformed_components = m_inverted_cmccat97 * rgbc;
-	auto rgb_def = new color_space::rgb_color_space_definition(*color->get_rgb_color_space());
-	rgb_def->set_white_point(target_white_point);
-	auto tmp_trans_color = new color_space::xyz(transformed_components[0], transformed_components[1], transformed_components[2], tmp_color->alpha(), rgb_def);
+	auto rgb_def = adapted_definition(color->get_rgb_color_space(), target_white_point);
+	color_space::xyz tmp_trans_color(transformed_components[0], transformed_components[1], transformed_components[2], tmp_color.alpha(), rgb_def);
 
 	// Convert transformed color back to input color space
-	return color_manipulation::color_converter::convertTo(tmp_trans_color, color->get_color_type());
+	return color_manipulation::color_converter::create_converted(tmp_trans_color, color->get_color_type());
 }
 
 color_space::color_base * color_manipulation::chromatic_adaptation::cmccat2000_adaptation_simplified(color_space::color_base * color, color_space::white_point * target_white_point)
 {
+	COLORMAGIC_INSTRUMENT("chromatic_adaptation::cmccat2000_adaptation_simplified");
+
 	if (color->get_rgb_color_space()->get_white_point() == target_white_point)
 	{
-		return color;
+		return color_manipulation::color_converter::create_converted(*color, color->get_color_type());
 	}
 
 	return do_adaption(color, target_white_point, m_cmccat2000, m_inverted_cmccat2000);
@@ -259,14 +279,16 @@ color_space::color_base * color_manipulation::chromatic_adaptation::cmccat2000_a
 
 color_space::color_base * color_manipulation::chromatic_adaptation::cmccat2000_adaptation(color_space::color_base * color, color_space::white_point * target_white_point, float f, float adapting_field_luminance, float reference_field_luminance)
 {
+	COLORMAGIC_INSTRUMENT("chromatic_adaptation::cmccat2000_adaptation");
+
 	if (color->get_rgb_color_space()->get_white_point() == target_white_point)
 	{
-		return color;
+		return color_manipulation::color_converter::create_converted(*color, color->get_color_type());
 	}
 
 	// Convert to XYZ space and transform using cmccat2000 matrix
-	auto tmp_color = color_manipulation::color_converter::to_xyz(color);
-	auto rgb_comp = m_cmccat2000 * tmp_color->get_component_vector();
+	auto tmp_color = color_manipulation::color_converter::to_xyz(*color);
+	auto rgb_comp = m_cmccat2000 * tmp_color.get_components();
 	
 	// Create scaled white point vectors
 	std::vector<float> source_wp = std::vector<float>();
@@ -296,19 +318,20 @@ color_space::color_base * color_manipulation::chromatic_adaptation::cmccat2000_a
 	rgbc.push_back((wp_y_factor * (scaled_dest_wp[2] / scaled_source_wp[2]) + 1.f - d) * rgb_comp[2]);
 
 	auto transformed_components = m_inverted_cmccat2000 * rgbc;
-	auto rgb_def = new color_space::rgb_color_space_definition(*color->get_rgb_color_space());
-	rgb_def->set_white_point(target_white_point);
-	auto tmp_trans_color = new color_space::xyz(transformed_components[0], transformed_components[1], transformed_components[2], tmp_color->alpha(), rgb_def);
+	auto rgb_def = adapted_definition(color->get_rgb_color_space(), target_white_point);
+	color_space::xyz tmp_trans_color(transformed_components[0], transformed_components[1], transformed_components[2], tmp_color.alpha(), rgb_def);
 
 	// Convert transformed color back to input color space
-	return color_manipulation::color_converter::convertTo(tmp_trans_color, color->get_color_type());
+	return color_manipulation::color_converter::create_converted(tmp_trans_color, color->get_color_type());
 }
 
 color_space::color_base * color_manipulation::chromatic_adaptation::cat02_adaptation_simplified(color_space::color_base * color, color_space::white_point * target_white_point)
 {
+	COLORMAGIC_INSTRUMENT("chromatic_adaptation::cat02_adaptation_simplified");
+
 	if (color->get_rgb_color_space()->get_white_point() == target_white_point)
 	{
-		return color;
+		return color_manipulation::color_converter::create_converted(*color, color->get_color_type());
 	}
 
 	return do_adaption(color, target_white_point, m_cat02, m_inverted_cat02);
@@ -316,14 +339,16 @@ color_space::color_base * color_manipulation::chromatic_adaptation::cat02_adapta
 
 color_space::color_base * color_manipulation::chromatic_adaptation::cat02_adaptation(color_space::color_base * color, color_space::white_point * target_white_point, float f, float adapting_field_luminance)
 {
+	COLORMAGIC_INSTRUMENT("chromatic_adaptation::cat02_adaptation");
+
 	if (color->get_rgb_color_space()->get_white_point() == target_white_point)
 	{
-		return color;
+		return color_manipulation::color_converter::create_converted(*color, color->get_color_type());
 	}
 
 	// Convert to XYZ space and transform using cmccat2000 matrix
-	auto tmp_color = color_manipulation::color_converter::to_xyz(color);
-	auto rgb_comp = m_cat02 * tmp_color->get_component_vector();
+	auto tmp_color = color_manipulation::color_converter::to_xyz(*color);
+	auto rgb_comp = m_cat02 * tmp_color.get_components();
 
 	// Create scaled white point vectors
 	std::vector<float> source_wp = std::vector<float>();
@@ -353,24 +378,35 @@ color_space::color_base * color_manipulation::chromatic_adaptation::cat02_adapta
 	rgbc.push_back(rgb_comp[2] * (d * (scaled_dest_wp[2] / scaled_source_wp[2]) + 1.f - d));
 
 	auto transformed_components = m_inverted_cat02 * rgbc;
-	auto rgb_def = new color_space::rgb_color_space_definition(*color->get_rgb_color_space());
-	rgb_def->set_white_point(target_white_point);
-	auto tmp_trans_color = new color_space::xyz(transformed_components[0], transformed_components[1], transformed_components[2], tmp_color->alpha(), rgb_def);
+	auto rgb_def = adapted_definition(color->get_rgb_color_space(), target_white_point);
+	color_space::xyz tmp_trans_color(transformed_components[0], transformed_components[1], transformed_components[2], tmp_color.alpha(), rgb_def);
 
 	// Convert transformed color back to input color space
-	return color_manipulation::color_converter::convertTo(tmp_trans_color, color->get_color_type());
+	return color_manipulation::color_converter::create_converted(tmp_trans_color, color->get_color_type());
 }
 
-color_space::color_base * color_manipulation::chromatic_adaptation::do_adaption(color_space::color_base * color, color_space::white_point * target_white_point, matrix<float> mat, matrix<float> inverted_mat)
+matrix<float> color_manipulation::chromatic_adaptation::adaptation_matrix(color_space::white_point * source_white_point, color_space::white_point * target_white_point, adaptation_method method)
 {
-	// Convert to XYZ space
-	auto tmp_color = color_manipulation::color_converter::to_xyz(color);
+	switch (method)
+	{
+	case VON_KRIES_ADAPTATION: return adaptation_matrix(source_white_point, target_white_point, m_von_kries, m_inverted_von_kries);
+	case BRADFORD_ADAPTATION: return adaptation_matrix(source_white_point, target_white_point, m_bradford, m_inverted_bradford);
+	case XYZ_SCALE_ADAPTATION: return adaptation_matrix(source_white_point, target_white_point, m_xyz_scale, m_inverted_xyz_scale);
+	case SHARP_ADAPTATION: return adaptation_matrix(source_white_point, target_white_point, m_sharp, m_inverted_sharp);
+	case CMCCAT97_ADAPTATION: return adaptation_matrix(source_white_point, target_white_point, m_cmccat97, m_inverted_cmccat97);
+	case CMCCAT2000_ADAPTATION: return adaptation_matrix(source_white_point, target_white_point, m_cmccat2000, m_inverted_cmccat2000);
+	case CAT02_ADAPTATION: return adaptation_matrix(source_white_point, target_white_point, m_cat02, m_inverted_cat02);
+	default: throw new std::invalid_argument("Unknown adaptation method.");
+	}
+}
 
+matrix<float> color_manipulation::chromatic_adaptation::adaptation_matrix(color_space::white_point * source_white_point, color_space::white_point * target_white_point, matrix<float> mat, matrix<float> inverted_mat)
+{
 	// Create scaled white point vectors
 	std::vector<float> source_wp = std::vector<float>();
-	source_wp.push_back(color->get_rgb_color_space()->get_white_point()->get_tristimulus()[0]);
-	source_wp.push_back(color->get_rgb_color_space()->get_white_point()->get_tristimulus()[1]);
-	source_wp.push_back(color->get_rgb_color_space()->get_white_point()->get_tristimulus()[2]);
+	source_wp.push_back(source_white_point->get_tristimulus()[0]);
+	source_wp.push_back(source_white_point->get_tristimulus()[1]);
+	source_wp.push_back(source_white_point->get_tristimulus()[2]);
 
 	std::vector<float> dest_wp = std::vector<float>();
 	dest_wp.push_back(target_white_point->get_tristimulus()[0]);
@@ -388,12 +424,41 @@ color_space::color_base * color_manipulation::chromatic_adaptation::do_adaption(
 		0.f, 0.f, scaled_dest_wp[2] / scaled_source_wp[2]
 	});
 
+	return inverted_mat * wp_matrix * mat;
+}
+
+color_space::color_base * color_manipulation::chromatic_adaptation::do_adaption(color_space::color_base * color, color_space::white_point * target_white_point, matrix<float> mat, matrix<float> inverted_mat)
+{
+	// Convert to XYZ space
+	auto tmp_color = color_manipulation::color_converter::to_xyz(*color);
+
 	// Transform the input color and create a new xyz space object
-	auto transformed_components = (inverted_mat * wp_matrix * mat) * tmp_color->get_component_vector();
-	auto rgb_def = new color_space::rgb_color_space_definition(*color->get_rgb_color_space());
-	rgb_def->set_white_point(target_white_point);
-	auto tmp_trans_color = new color_space::xyz(transformed_components[0], transformed_components[1], transformed_components[2], tmp_color->alpha(), rgb_def);
+	auto transformed_components = adaptation_matrix(color->get_rgb_color_space()->get_white_point(), target_white_point, mat, inverted_mat) * tmp_color.get_components();
+	auto rgb_def = adapted_definition(color->get_rgb_color_space(), target_white_point);
+	color_space::xyz tmp_trans_color(transformed_components[0], transformed_components[1], transformed_components[2], tmp_color.alpha(), rgb_def);
 
 	// Convert transformed color back to input color space
-	return color_manipulation::color_converter::convertTo(tmp_trans_color, color->get_color_type());
+	return color_manipulation::color_converter::create_converted(tmp_trans_color, color->get_color_type());
+}
+
+color_space::rgb_color_space_definition * color_manipulation::chromatic_adaptation::adapted_definition(color_space::rgb_color_space_definition * definition, color_space::white_point * target_white_point)
+{
+	// The primaries and the target white point describe the adapted definition completely, the white point and gamma objects are referenced by pointer.
+	typedef std::tuple<std::array<float, 3>, std::array<float, 3>, std::array<float, 3>, color_space::gamma*, color_space::white_point*, std::array<float, 3>> definition_key;
+
+	static std::mutex cache_mutex;
+	static std::map<definition_key, std::unique_ptr<color_space::rgb_color_space_definition>> cache;
+
+	definition_key key(definition->get_red_chromaticity_coordinate(), definition->get_green_chromaticity_coordinate(), definition->get_blue_chromaticity_coordinate(),
+		definition->get_gamma_curve(), target_white_point, target_white_point->get_tristimulus());
+
+	std::lock_guard<std::mutex> lock(cache_mutex);
+	auto& adapted = cache[key];
+	if (!adapted)
+	{
+		adapted.reset(new color_space::rgb_color_space_definition(*definition));
+		adapted->set_white_point(target_white_point);
+	}
+
+	return adapted.get();
 }
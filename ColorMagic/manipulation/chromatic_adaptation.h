@@ -13,6 +13,18 @@
 
 namespace color_manipulation
 {
+	//! Enum that defines the linear chromatic adaptation methods.
+	enum adaptation_method
+	{
+		VON_KRIES_ADAPTATION = 0, /*!< VON_KRIES_ADAPTATION - von Kries, \sa chromatic_adaptation::von_kries_adaptation() */
+		BRADFORD_ADAPTATION, /*!< BRADFORD_ADAPTATION - Bradford without the non-linear blue correction, \sa chromatic_adaptation::bradford_adaptation_simplified() */
+		XYZ_SCALE_ADAPTATION, /*!< XYZ_SCALE_ADAPTATION - XYZ Scale, \sa chromatic_adaptation::xyz_scale_adaptation() */
+		SHARP_ADAPTATION, /*!< SHARP_ADAPTATION - Sharp, \sa chromatic_adaptation::sharp_adaptation() */
+		CMCCAT97_ADAPTATION, /*!< CMCCAT97_ADAPTATION - CMCCAT97 without the degree of adaption, \sa chromatic_adaptation::cmccat97_adaptation_simplified() */
+		CMCCAT2000_ADAPTATION, /*!< CMCCAT2000_ADAPTATION - CMCCAT2000 without the degree of adaption, \sa chromatic_adaptation::cmccat2000_adaptation_simplified() */
+		CAT02_ADAPTATION /*!< CAT02_ADAPTATION - CAT02 without the degree of adaption, \sa chromatic_adaptation::cat02_adaptation_simplified() */
+	};
+
 	//! Static class for chromatic adaptation.
 	/*!
 	* This static class implements von Kries, Bradford, XYZ Scaling and CMCCAT2000 as chromatic adaptation methods.
@@ -27,7 +39,7 @@ namespace color_manipulation
 		* input color space.
 		* \param color The color to convert. If the color is not in xyz space it will be converted first.
 		* \param target_white_point The target white point.
-		* \return The transformed color in the input color space.
+		* \return The transformed color in the input color space. The color is a new object owned by the caller.
 		*/
 		static color_space::color_base* von_kries_adaptation(color_space::color_base* color, color_space::white_point* target_white_point);
 
@@ -38,7 +50,7 @@ namespace color_manipulation
 		* input color space.
 		* \param color The color to convert. If the color is not in xyz space it will be converted first.
 		* \param target_white_point The target white point.
-		* \return The transformed color in the input color space.
+		* \return The transformed color in the input color space. The color is a new object owned by the caller.
 		*/
 		static color_space::color_base* bradford_adaptation(color_space::color_base* color, color_space::white_point* target_white_point);
 
@@ -49,7 +61,7 @@ namespace color_manipulation
 		* input color space. This version of Bradford igonores the non-linear correction in the blue area. 
 		* \param color The color to convert. If the color is not in xyz space it will be converted first.
 		* \param target_white_point The target white point.
-		* \return The transformed color in the input color space.
+		* \return The transformed color in the input color space. The color is a new object owned by the caller.
 		*/
 		static color_space::color_base* bradford_adaptation_simplified(color_space::color_base* color, color_space::white_point* target_white_point);
 
@@ -60,7 +72,7 @@ namespace color_manipulation
 		* input color space.
 		* \param color The color to convert. If the color is not in xyz space it will be converted first.
 		* \param target_white_point The target white point.
-		* \return The transformed color in the input color space.
+		* \return The transformed color in the input color space. The color is a new object owned by the caller.
 		*/
 		static color_space::color_base* xyz_scale_adaptation(color_space::color_base* color, color_space::white_point* target_white_point);
 
@@ -71,7 +83,7 @@ namespace color_manipulation
 		* input color space.
 		* \param color The color to convert. If the color is not in xyz space it will be converted first.
 		* \param target_white_point The target white point.
-		* \return The transformed color in the input color space.
+		* \return The transformed color in the input color space. The color is a new object owned by the caller.
 		*/
 		static color_space::color_base* sharp_adaptation(color_space::color_base* color, color_space::white_point* target_white_point);
 
@@ -82,7 +94,7 @@ namespace color_manipulation
 		* input color space. This version of CMCCAT97 igonores the degree of adaption.
 		* \param color The color to convert. If the color is not in xyz space it will be converted first.
 		* \param target_white_point The target white point.
-		* \return The transformed color in the input color space.
+		* \return The transformed color in the input color space. The color is a new object owned by the caller.
 		*/
 		static color_space::color_base* cmccat97_adaptation_simplified(color_space::color_base* color, color_space::white_point* target_white_point);
 
@@ -95,7 +107,7 @@ namespace color_manipulation
 		* \param target_white_point The target white point.
 		* \param f Defines the surrounding conditions. Use 1.f for normal, 0.9f for dim and 0.8f for dark conditions.
 		* \param adapting_field_luminance The luminance of the adapting field (\sa calculate_adapting_luminance()). Default value = 100
-		* \return The transformed color in the input color space.
+		* \return The transformed color in the input color space. The color is a new object owned by the caller.
 		*/
 		static color_space::color_base* cmccat97_adaptation(color_space::color_base* color, color_space::white_point* target_white_point, float f, float adapting_field_luminance = 100.f);
 
@@ -106,7 +118,7 @@ namespace color_manipulation
 		* input color space. This version of CMCCAT2000 igonores the degree of adaption. 
 		* \param color The color to convert. If the color is not in xyz space it will be converted first.
 		* \param target_white_point The target white point.
-		* \return The transformed color in the input color space.
+		* \return The transformed color in the input color space. The color is a new object owned by the caller.
 		*/
 		static color_space::color_base* cmccat2000_adaptation_simplified(color_space::color_base* color, color_space::white_point* target_white_point);
 
@@ -120,7 +132,7 @@ namespace color_manipulation
 		* \param f Defines the surrounding conditions. Use 1.f for normal, 0.9f for dim and 0.8f for dark conditions.
 		* \param adapting_field_luminance The luminance of the adapting field (\sa calculate_adapting_luminance()). Default value = 100 
 		* \param reference_field_luminance The luminance of the reference field. Default value = 100
-		* \return The transformed color in the input color space.
+		* \return The transformed color in the input color space. The color is a new object owned by the caller.
 		*/
 		static color_space::color_base* cmccat2000_adaptation(color_space::color_base* color, color_space::white_point* target_white_point, float f, float adapting_field_luminance = 100.f, float reference_field_luminance = 100.f);
 
@@ -131,7 +143,7 @@ namespace color_manipulation
 		* input color space. This version of CAT02 igonores the degree of adaption.
 		* \param color The color to convert. If the color is not in xyz space it will be converted first.
 		* \param target_white_point The target white point.
-		* \return The transformed color in the input color space.
+		* \return The transformed color in the input color space. The color is a new object owned by the caller.
 		*/
 		static color_space::color_base* cat02_adaptation_simplified(color_space::color_base* color, color_space::white_point* target_white_point);
 
@@ -144,7 +156,7 @@ namespace color_manipulation
 		* \param target_white_point The target white point.
 		* \param f Defines the surrounding conditions. Use 1.f for normal, 0.9f for dim and 0.8f for dark conditions.
 		* \param adapting_field_luminance The luminance of the adapting field (\sa calculate_adapting_luminance()). Default value = 100
-		* \return The transformed color in the input color space.
+		* \return The transformed color in the input color space. The color is a new object owned by the caller.
 		*/
 		static color_space::color_base* cat02_adaptation(color_space::color_base* color, color_space::white_point* target_white_point, float f, float adapting_field_luminance = 100.f);
 
@@ -161,8 +173,22 @@ namespace color_manipulation
 			return luminance * bg_luminance_factor / 100.f;
 		}
 
+		//! Returns the xyz to xyz matrix of a linear adaptation method.
+		/*!
+		* The matrix is the one applied by the adaptation functions of the method, so it can be combined with other
+		* linear transformations instead of adapting every color on its own.
+		* \param source_white_point The white point of the colors.
+		* \param target_white_point The target white point.
+		* \param method The adaptation method.
+		* \return The 3x3 matrix that transforms xyz values from the source to the target white point.
+		*/
+		static matrix<float> adaptation_matrix(color_space::white_point* source_white_point, color_space::white_point* target_white_point, adaptation_method method = BRADFORD_ADAPTATION);
+
 	protected:
 
+		//! Helper method that calculates the adaptation matrix from the matrices of a method.
+		static matrix<float> adaptation_matrix(color_space::white_point* source_white_point, color_space::white_point* target_white_point, matrix<float> mat, matrix<float> inverted_mat);
+
 		//! Helper method that actually does the transformation while the public methods are just container functions.
 		/*!
 		* Helper method that calculates the transformation matrix.
@@ -170,10 +196,20 @@ namespace color_manipulation
 		* \param target_color_space The target color space definition containing the target white point definition.
 		* \param mat The adaptation matrix of the chosen method.
 		* \param inverted_mat The inverted adaptation matrix of the chosen method.
-		* \return The transformed color in the input color space.
+		* \return The transformed color in the input color space. The color is a new object owned by the caller.
 		*/
 		static color_space::color_base* do_adaption(color_space::color_base* color, color_space::white_point* target_white_point, matrix<float> mat, matrix<float> inverted_mat);
 
+		//! Helper method that returns the color space definition of the adapted colors.
+		/*!
+		* Returns a copy of the given definition using the target white point. The copies are cached, so every combination of
+		* definition and target white point is created only once and lives until the end of the program.
+		* \param definition The color space definition of the input color.
+		* \param target_white_point The target white point.
+		* \return The adapted color space definition, owned by the cache.
+		*/
+		static color_space::rgb_color_space_definition* adapted_definition(color_space::rgb_color_space_definition* definition, color_space::white_point* target_white_point);
+
 		//! Adaptation matrix of the von Kries method.
 		/*!
 		* Adaptation matrix of the von Kries method.
@@ -0,0 +1,160 @@
+#include "stdafx.h"
+#include "color_accumulator.h"
+
+#include <memory>
+
+color_manipulation::color_accumulator::color_accumulator(color_type type, color_space::rgb_color_space_definition * rgb_color_space)
+	: m_type(type), m_rgb_color_space(rgb_color_space), m_channels(color_buffer::component_count(type) + 1), m_hue(color_buffer::hue_component(type))
+{
+	if (type == color_type::UNDEFINED) throw new std::invalid_argument("A color accumulator needs a defined color type.");
+	clear();
+}
+
+void color_manipulation::color_accumulator::add(const color_space::color_base & color, double weight)
+{
+	float values[5];
+	if (color.get_color_type() == m_type)
+	{
+		std::copy(color.get_components().begin(), color.get_components().end(), values);
+		values[m_channels - 1] = color.alpha();
+	}
+	else
+	{
+		std::unique_ptr<color_space::color_base> converted(color_converter::create_converted(color, m_type));
+		std::copy(converted->get_components().begin(), converted->get_components().end(), values);
+		values[m_channels - 1] = converted->alpha();
+	}
+
+	add(values, weight);
+}
+
+void color_manipulation::color_accumulator::add(const float * values, double weight)
+{
+	if (weight <= 0.0) throw new std::invalid_argument("The weight of a color has to be greater than 0.");
+
+	++m_count;
+	update(values, weight);
+}
+
+void color_manipulation::color_accumulator::add(const color_buffer & colors)
+{
+	if (colors.get_color_type() != m_type) throw new std::invalid_argument("The color type of the buffer does not match the color type of the accumulator.");
+
+	for (size_t i = 0; i < colors.size(); ++i)
+	{
+		add(colors.pixel(i));
+	}
+}
+
+void color_manipulation::color_accumulator::remove(const color_space::color_base & color, double weight)
+{
+	if (color.get_color_type() != m_type)
+	{
+		std::unique_ptr<color_space::color_base> converted(color_converter::create_converted(color, m_type));
+		remove(*converted, weight);
+		return;
+	}
+
+	float values[5];
+	std::copy(color.get_components().begin(), color.get_components().end(), values);
+	values[m_channels - 1] = color.alpha();
+	remove(values, weight);
+}
+
+void color_manipulation::color_accumulator::remove(const float * values, double weight)
+{
+	if (weight <= 0.0) throw new std::invalid_argument("The weight of a color has to be greater than 0.");
+	if (m_count == 0) throw new std::invalid_argument("Can not remove a color from an empty accumulator.");
+	if (m_count > 1 && m_weight - weight <= 0.0) throw new std::invalid_argument("The weight is greater than the weight of the remaining colors.");
+
+	if (--m_count == 0)
+	{
+		clear();
+		return;
+	}
+
+	update(values, -weight);
+}
+
+void color_manipulation::color_accumulator::merge(const color_accumulator & other)
+{
+	if (other.m_type != m_type) throw new std::invalid_argument("Only accumulators of the same color type can be merged.");
+	if (other.m_count == 0) return;
+
+	double weight = m_weight + other.m_weight;
+	for (size_t c = 0; c < m_channels; ++c)
+	{
+		double delta = other.m_mean[c] - m_mean[c];
+		m_mean[c] += delta * other.m_weight / weight;
+		m_m2[c] += other.m_m2[c] + delta * delta * m_weight * other.m_weight / weight;
+	}
+
+	m_hue_sin += other.m_hue_sin;
+	m_hue_cos += other.m_hue_cos;
+	m_weight = weight;
+	m_count += other.m_count;
+}
+
+void color_manipulation::color_accumulator::clear()
+{
+	m_count = 0;
+	m_weight = 0.0;
+	m_hue_sin = 0.0;
+	m_hue_cos = 0.0;
+	std::fill(m_mean, m_mean + 5, 0.0);
+	std::fill(m_m2, m_m2 + 5, 0.0);
+}
+
+color_space::color_base * color_manipulation::color_accumulator::mean() const
+{
+	if (m_count == 0) throw new std::invalid_argument("An empty accumulator has no mean color.");
+
+	color_buffer result(m_type, m_rgb_color_space, 1);
+	float* values = result.pixel(0);
+	for (size_t c = 0; c < m_channels; ++c) values[c] = (float)m_mean[c];
+
+	if (m_hue >= 0)
+	{
+		double angle = std::atan2(m_hue_sin, m_hue_cos) * 180.0 / M_PI;
+		values[m_hue] = (float)(angle < 0.0 ? angle + 360.0 : angle);
+	}
+
+	return result.create_color(0);
+}
+
+std::vector<float> color_manipulation::color_accumulator::variance() const
+{
+	std::vector<float> result(m_channels, 0.f);
+	if (m_count == 0) return result;
+
+	for (size_t c = 0; c < m_channels; ++c) result[c] = (float)std::fmax(m_m2[c] / m_weight, 0.0);
+
+	if (m_hue >= 0)
+	{
+		double length = std::sqrt(m_hue_sin * m_hue_sin + m_hue_cos * m_hue_cos) / m_weight;
+		result[m_hue] = (float)std::fmin(std::fmax(1.0 - length, 0.0), 1.0);
+	}
+
+	return result;
+}
+
+void color_manipulation::color_accumulator::update(const float * values, double weight)
+{
+	// Welford's update, a negative weight removes a color.
+	double new_weight = m_weight + weight;
+	for (size_t c = 0; c < m_channels; ++c)
+	{
+		double delta = values[c] - m_mean[c];
+		m_mean[c] += delta * weight / new_weight;
+		m_m2[c] += weight * delta * (values[c] - m_mean[c]);
+	}
+
+	if (m_hue >= 0)
+	{
+		double angle = values[m_hue] * M_PI / 180.0;
+		m_hue_sin += weight * std::sin(angle);
+		m_hue_cos += weight * std::cos(angle);
+	}
+
+	m_weight = new_weight;
+}
@@ -0,0 +1,102 @@
+/// Copyright Martin Ruehlicke, 2019
+/// Use, modification and distribution are subject to the
+/// MIT Software License, Version 1.0.
+/// See accompanying file LICENSE.txt
+
+#pragma once
+
+#include "..\spaces\color_base.h"
+#include "..\utils\color_buffer.h"
+#include "color_converter.h"
+
+namespace color_manipulation
+{
+	//! Running mean and variance of a stream of colors.
+	/*!
+	* Colors can be added and removed in O(1) without keeping them, which makes the accumulator suitable for sliding
+	* windows over video frames or moving regions. Accumulators filled on different threads can be merged.
+	* The mean and variance are updated with Welford's algorithm in double precision. Hue components (hsi, hsv, hsl, hcy,
+	* lch_ab and lch_uv) are accumulated as unit vectors, so their mean is the circular mean.
+	*/
+	class color_accumulator
+	{
+	public:
+		//! Default constructor.
+		/*!
+		* \param type The color type in which the colors are accumulated.
+		* \param rgb_color_space The rgb color space definition of the mean color.
+		*/
+		color_accumulator(color_type type, color_space::rgb_color_space_definition* rgb_color_space);
+
+		//! Adds a color.
+		/*!
+		* Colors of another color type are converted first.
+		* \param color The color to add.
+		* \param weight The weight of the color.
+		*/
+		void add(const color_space::color_base& color, double weight = 1.0);
+
+		//! Adds a color given as components followed by alpha (the layout of color_buffer).
+		/*!
+		* \param values The values of the color in the color type of the accumulator.
+		* \param weight The weight of the color.
+		*/
+		void add(const float* values, double weight = 1.0);
+
+		//! Adds all colors of a buffer of the same color type.
+		void add(const color_buffer& colors);
+
+		//! Removes a color that was added before.
+		/*!
+		* \param color The color to remove.
+		* \param weight The weight the color was added with.
+		*/
+		void remove(const color_space::color_base& color, double weight = 1.0);
+
+		//! Removes a color given as components followed by alpha that was added before.
+		void remove(const float* values, double weight = 1.0);
+
+		//! Adds all colors of another accumulator of the same color type.
+		void merge(const color_accumulator& other);
+
+		//! Removes all colors.
+		void clear();
+
+		//! Returns the number of colors currently accumulated.
+		size_t count() const { return m_count; }
+
+		//! Returns the sum of the weights of the colors currently accumulated.
+		double total_weight() const { return m_weight; }
+
+		//! Returns the color type of the accumulator.
+		color_type get_color_type() const { return m_type; }
+
+		//! Returns the mean color.
+		/*!
+		* \return A new color object owned by the caller.
+		*/
+		color_space::color_base* mean() const;
+
+		//! Returns the variance of every component followed by the variance of alpha.
+		/*!
+		* The variance is the population variance. For hue components the circular variance in the range [0,1] is returned,
+		* 0 means that all hues are equal.
+		*/
+		std::vector<float> variance() const;
+
+	private:
+		void update(const float* values, double weight);
+
+		color_type m_type;
+		color_space::rgb_color_space_definition* m_rgb_color_space;
+		size_t m_channels;
+		int m_hue;
+
+		size_t m_count;
+		double m_weight;
+		double m_mean[5];
+		double m_m2[5];
+		double m_hue_sin;
+		double m_hue_cos;
+	};
+}
@@ -1,70 +1,76 @@
 #include "stdafx.h"
 #include "color_adjustments.h"
 
+#include <memory>
+
 void color_manipulation::color_adjustments::saturate_in_rgb_space(color_space::color_base &color, float percentage)
 {
-	color = *saturate_in_rgb_space(&color, percentage);
+	std::unique_ptr<color_space::color_base> result(saturate_in_rgb_space(&color, percentage));
+	color = *result;
 }
 
 color_space::color_base * color_manipulation::color_adjustments::saturate_in_rgb_space(color_space::color_base* color, float percentage)
 {
-	auto color_rgb_d = static_cast<color_space::rgb_deepcolor*>(color_manipulation::color_converter::convertTo(color, color_type::RGB_DEEP));
+	auto color_rgb_d = color_manipulation::color_converter::to_rgb_deep(*color);
 
-	auto L = 0.299f * color_rgb_d->red() + 0.587f * color_rgb_d->green() + 0.114f * color_rgb_d->blue();
-	auto new_r = color_rgb_d->red() - percentage * (L - color_rgb_d->red());
-	auto new_g = color_rgb_d->green() - percentage * (L - color_rgb_d->green());
-	auto new_b = color_rgb_d->blue() - percentage * (L - color_rgb_d->blue());
+	auto L = 0.299f * color_rgb_d.red() + 0.587f * color_rgb_d.green() + 0.114f * color_rgb_d.blue();
+	auto new_r = color_rgb_d.red() - percentage * (L - color_rgb_d.red());
+	auto new_g = color_rgb_d.green() - percentage * (L - color_rgb_d.green());
+	auto new_b = color_rgb_d.blue() - percentage * (L - color_rgb_d.blue());
 
-	return color_manipulation::color_converter::convertTo(new color_space::rgb_deepcolor(new_r, new_g, new_b, color_rgb_d->alpha(), color->get_rgb_color_space()), color->get_color_type());
+	return color_manipulation::color_converter::create_converted(color_space::rgb_deepcolor(new_r, new_g, new_b, color_rgb_d.alpha(), color->get_rgb_color_space()), color->get_color_type());
 }
 
 void color_manipulation::color_adjustments::saturate_in_hsl_space(color_space::color_base & color, float percentage)
 {
-	color = *saturate_in_hsl_space(&color, percentage);
+	std::unique_ptr<color_space::color_base> result(saturate_in_hsl_space(&color, percentage));
+	color = *result;
 }
 
 color_space::color_base * color_manipulation::color_adjustments::saturate_in_hsl_space(color_space::color_base * color, float percentage)
 {
-	if (percentage == 0.f) return color;
+	if (percentage == 0.f) return color_manipulation::color_converter::create_converted(*color, color->get_color_type());
 
-	auto color_hsl = static_cast<color_space::hsl*>(color_manipulation::color_converter::convertTo(color, color_type::HSL));
+	auto color_hsl = color_manipulation::color_converter::to_hsl(*color);
 
 	auto factor = 1.f + percentage;
-	color_hsl->saturation(color_hsl->saturation() * factor);
+	color_hsl.saturation(color_hsl.saturation() * factor);
 
-	return color_manipulation::color_converter::convertTo(color_hsl, color->get_color_type());
+	return color_manipulation::color_converter::create_converted(color_hsl, color->get_color_type());
 }
 
 void color_manipulation::color_adjustments::luminate_in_rgb_space(color_space::color_base & color, float percentage)
 {
-	color = *luminate_in_rgb_space(&color, percentage);
+	std::unique_ptr<color_space::color_base> result(luminate_in_rgb_space(&color, percentage));
+	color = *result;
 }
 
 color_space::color_base * color_manipulation::color_adjustments::luminate_in_rgb_space(color_space::color_base * color, float percentage)
 {
-	auto color_rgb_d = static_cast<color_space::rgb_deepcolor*>(color_manipulation::color_converter::convertTo(color, color_type::RGB_DEEP));
+	auto color_rgb_d = color_manipulation::color_converter::to_rgb_deep(*color);
 
 	auto factor = 1.f + percentage;
-	auto new_r = color_rgb_d->red() * factor;
-	auto new_g = color_rgb_d->green() * factor;
-	auto new_b = color_rgb_d->blue() * factor;
+	auto new_r = color_rgb_d.red() * factor;
+	auto new_g = color_rgb_d.green() * factor;
+	auto new_b = color_rgb_d.blue() * factor;
 
-	return color_manipulation::color_converter::convertTo(new color_space::rgb_deepcolor(new_r, new_g, new_b, color_rgb_d->alpha(), color->get_rgb_color_space()), color->get_color_type());
+	return color_manipulation::color_converter::create_converted(color_space::rgb_deepcolor(new_r, new_g, new_b, color_rgb_d.alpha(), color->get_rgb_color_space()), color->get_color_type());
 }
 
 void color_manipulation::color_adjustments::luminate_in_hsl_space(color_space::color_base & color, float percentage)
 {
-	color = *luminate_in_hsl_space(&color, percentage);
+	std::unique_ptr<color_space::color_base> result(luminate_in_hsl_space(&color, percentage));
+	color = *result;
 }
 
 color_space::color_base * color_manipulation::color_adjustments::luminate_in_hsl_space(color_space::color_base * color, float percentage)
 {
-	if (percentage == 0.f) return color;
+	if (percentage == 0.f) return color_manipulation::color_converter::create_converted(*color, color->get_color_type());
 
-	auto color_hsl = static_cast<color_space::hsl*>(color_manipulation::color_converter::convertTo(color, color_type::HSL));
+	auto color_hsl = color_manipulation::color_converter::to_hsl(*color);
 
 	auto factor = 1.f + percentage;
-	color_hsl->lightness(color_hsl->lightness() * factor);
+	color_hsl.lightness(color_hsl.lightness() * factor);
 
-	return color_manipulation::color_converter::convertTo(color_hsl, color->get_color_type());
+	return color_manipulation::color_converter::create_converted(color_hsl, color->get_color_type());
 }
@@ -38,7 +38,7 @@ namespace color_manipulation
 		* \param color The color to manipulate.
 		* \param percentage The amount by which to adjust the saturation. Values between 0 and 1
 		* increase the saturation and values between 0 and -1 decrease it.
-		* \return The modified color in the same color space like the input color.
+		* \return The modified color in the same color space like the input color. The color is a new object owned by the caller.
 		*/
 		static color_space::color_base* saturate_in_rgb_space(color_space::color_base* color, float percentage);
 
@@ -63,7 +63,7 @@ namespace color_manipulation
 		* \param color The color to manipulate.
 		* \param percentage The amount by which to adjust the saturation. Values between 0 and 1
 		* increase the saturation and values between 0 and -1 decrease it.
-		* \return The modified color in the same color space like the input color.
+		* \return The modified color in the same color space like the input color. The color is a new object owned by the caller.
 		*/
 		static color_space::color_base* saturate_in_hsl_space(color_space::color_base* color, float percentage);
 
@@ -88,7 +88,7 @@ namespace color_manipulation
 		* \param color The color to manipulate.
 		* \param percentage The amount by which to adjust the saturation. Values between 0 and 1
 		* increase the saturation and values between 0 and -1 decrease it.
-		* \return The modified color in the same color space like the input color.
+		* \return The modified color in the same color space like the input color. The color is a new object owned by the caller.
 		*/
 		static color_space::color_base* luminate_in_rgb_space(color_space::color_base* color, float percentage);
 
@@ -113,7 +113,7 @@ namespace color_manipulation
 		* \param color The color to manipulate.
 		* \param percentage The amount by which to adjust the saturation. Values between 0 and 1
 		* increase the saturation and values between 0 and -1 decrease it.
-		* \return The modified color in the same color space like the input color.
+		* \return The modified color in the same color space like the input color. The color is a new object owned by the caller.
 		*/
 		static color_space::color_base* luminate_in_hsl_space(color_space::color_base* color, float percentage);
 	};
@@ -1,17 +1,290 @@
 #include "stdafx.h"
 #include "color_blend.h"
+#include "..\utils\instrumentation.h"
+#include "..\utils\parallel.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+	//! Enum that defines the non-separable blend modes.
+	enum non_separable_mode
+	{
+		HUE_MODE = 0, /*!< HUE_MODE - hue of the source, saturation and luminosity of the destination */
+		SATURATION_MODE, /*!< SATURATION_MODE - saturation of the source, hue and luminosity of the destination */
+		COLOR_MODE, /*!< COLOR_MODE - hue and saturation of the source, luminosity of the destination */
+		LUMINOSITY_MODE /*!< LUMINOSITY_MODE - luminosity of the source, hue and saturation of the destination */
+	};
+
+	//! Number of colors that are blended together as structure of arrays.
+	const size_t block_size = 64;
+
+	//! Red, green, blue and alpha of a block of colors, one array per channel.
+	typedef float block[4][block_size];
+
+	//! Lum() of the W3C compositing specification.
+	inline float lum(float r, float g, float b)
+	{
+		return 0.3f * r + 0.59f * g + 0.11f * b;
+	}
+
+	//! Sat() of the W3C compositing specification.
+	inline float sat(float r, float g, float b)
+	{
+		return std::max(std::max(r, g), b) - std::min(std::min(r, g), b);
+	}
+
+	//! SetLum() and ClipColor() of the W3C compositing specification.
+	/*!
+	* Both scalings of ClipColor() are around the luminosity, so they are applied as one factor which is 1 if a
+	* scaling is not needed. There are no branches, only selects.
+	*/
+	inline void set_lum(float& r, float& g, float& b, float l)
+	{
+		const float d = l - lum(r, g, b);
+		r += d;
+		g += d;
+		b += d;
+
+		const float n = std::min(std::min(r, g), b), x = std::max(std::max(r, g), b);
+		const float low = n < 0.f ? l / (l - n) : 1.f;
+		const float high = x > 1.f ? (1.f - l) / (x - l) : 1.f;
+		const float factor = low * high;
+		r = l + (r - l) * factor;
+		g = l + (g - l) * factor;
+		b = l + (b - l) * factor;
+	}
+
+	//! SetSat() of the W3C compositing specification.
+	/*!
+	* Maximum, mid and minimum are not sorted: every channel is moved to (c - min) * s / (max - min), which maps the
+	* maximum to s, the minimum to 0 and scales the mid value in between.
+	*/
+	inline void set_sat(float& r, float& g, float& b, float s)
+	{
+		const float n = std::min(std::min(r, g), b), x = std::max(std::max(r, g), b);
+		const float factor = x > n ? s / (x - n) : 0.f;
+		r = (r - n) * factor;
+		g = (g - n) * factor;
+		b = (b - n) * factor;
+	}
+
+	//! Composites the blended color of a block entry like base_color_blend::general_porter_duff().
+	inline void composite(const block& source, const block& destination, size_t i, float r, float g, float b, float use_source, float use_destination, block& result)
+	{
+		const float sa = source[3][i], da = destination[3][i];
+		const float src_area = sa * (1.f - da) * use_source;
+		const float dest_area = da * (1.f - sa) * use_destination;
+		const float both_area = sa * da;
+		const float alpha = src_area + dest_area + both_area;
+		const float divisor = alpha > 0.f ? alpha : 1.f;
+
+		result[0][i] = (src_area * source[0][i] + dest_area * destination[0][i] + both_area * r) / divisor;
+		result[1][i] = (src_area * source[1][i] + dest_area * destination[1][i] + both_area * g) / divisor;
+		result[2][i] = (src_area * source[2][i] + dest_area * destination[2][i] + both_area * b) / divisor;
+		result[3][i] = alpha;
+	}
+
+	//! Blends a block of rgb deep colors and composites the result like base_color_blend::general_porter_duff().
+	template<int Mode>
+	void blend_block(size_t count, const block& source, const block& destination, float use_source, float use_destination, block& result)
+	{
+		for (size_t i = 0; i < count; ++i)
+		{
+			const float sr = source[0][i], sg = source[1][i], sb = source[2][i];
+			const float dr = destination[0][i], dg = destination[1][i], db = destination[2][i];
+
+			// Mode is a constant, the switch is resolved at compile time.
+			float r, g, b;
+			switch (Mode)
+			{
+			case HUE_MODE:
+				r = sr; g = sg; b = sb;
+				set_sat(r, g, b, sat(dr, dg, db));
+				set_lum(r, g, b, lum(dr, dg, db));
+				break;
+			case SATURATION_MODE:
+				r = dr; g = dg; b = db;
+				set_sat(r, g, b, sat(sr, sg, sb));
+				set_lum(r, g, b, lum(dr, dg, db));
+				break;
+			case COLOR_MODE:
+				r = sr; g = sg; b = sb;
+				set_lum(r, g, b, lum(dr, dg, db));
+				break;
+			default:
+				r = dr; g = dg; b = db;
+				set_lum(r, g, b, lum(sr, sg, sb));
+				break;
+			}
+
+			composite(source, destination, i, r, g, b, use_source, use_destination, result);
+		}
+	}
+
+	//! Selects the instance of blend_block() for a mode.
+	void blend_block(non_separable_mode mode, size_t count, const block& source, const block& destination, bool use_source_region, bool use_destination_region, block& result)
+	{
+		const float use_source = use_source_region ? 1.f : 0.f, use_destination = use_destination_region ? 1.f : 0.f;
+		switch (mode)
+		{
+		case HUE_MODE: blend_block<HUE_MODE>(count, source, destination, use_source, use_destination, result); break;
+		case SATURATION_MODE: blend_block<SATURATION_MODE>(count, source, destination, use_source, use_destination, result); break;
+		case COLOR_MODE: blend_block<COLOR_MODE>(count, source, destination, use_source, use_destination, result); break;
+		default: blend_block<LUMINOSITY_MODE>(count, source, destination, use_source, use_destination, result); break;
+		}
+	}
+
+	//! Dissolves a block of rgb deep colors at consecutive positions of an image row by row and composites the result.
+	/*!
+	* The overlapping area takes the color with the greater alpha if the noise of the pixel is in the upper 3/4 of its
+	* range and the other color otherwise. The decision is made once per pixel, so all channels come from one color.
+	*/
+	void dissolve_block(size_t first, size_t count, size_t width, uint32_t seed, uint32_t origin_x, uint32_t origin_y, const block& source, const block& destination, bool use_source_region, bool use_destination_region, block& result)
+	{
+		const float use_source = use_source_region ? 1.f : 0.f, use_destination = use_destination_region ? 1.f : 0.f;
+		const uint32_t threshold = 0x40000000u;
+		for (size_t i = 0; i < count; ++i)
+		{
+			const size_t index = first + i;
+			const uint32_t noise = color_manipulation::color_blend::dissolve_noise(origin_x + (uint32_t)(index % width), origin_y + (uint32_t)(index / width), seed);
+			const bool take_source = (source[3][i] > destination[3][i]) == (noise >= threshold);
+			const float pick = take_source ? 1.f : 0.f;
+
+			composite(source, destination, i,
+				destination[0][i] + (source[0][i] - destination[0][i]) * pick,
+				destination[1][i] + (source[1][i] - destination[1][i]) * pick,
+				destination[2][i] + (source[2][i] - destination[2][i]) * pick,
+				use_source, use_destination, result);
+		}
+	}
+
+	//! Blends premultiplied colors and composites the result in place of the destination.
+	/*!
+	* With premultiplied colors s = Cs * as and d = Cd * ad the blended overlapping area as * ad * B(Cs, Cd) is written
+	* in s, d, as and ad only, e.g. as * ad * Cs * Cd = s * d.
+	*/
+	template<int Mode>
+	void blend_premultiplied(const float* source, float* destination, size_t count, float use_source, float use_destination)
+	{
+		for (size_t i = 0; i < count; ++i, source += 4, destination += 4)
+		{
+			const float as = source[3], ad = destination[3];
+			const float source_factor = use_source * (1.f - ad), destination_factor = use_destination * (1.f - as);
+			for (size_t c = 0; c < 3; ++c)
+			{
+				const float s = source[c], d = destination[c];
+
+				// Mode is a constant, the switch is resolved at compile time.
+				float both;
+				switch (Mode)
+				{
+				case color_manipulation::NORMAL_BLEND: both = ad * s; break;
+				case color_manipulation::MULTIPLY_BLEND: both = s * d; break;
+				case color_manipulation::SCREEN_BLEND: both = ad * s + as * d - s * d; break;
+				case color_manipulation::DARKEN_BLEND: both = std::min(ad * s, as * d); break;
+				case color_manipulation::LIGHTEN_BLEND: both = std::max(ad * s, as * d); break;
+				case color_manipulation::LINEAR_DODGE_BLEND: both = std::min(ad * s + as * d, as * ad); break;
+				case color_manipulation::LINEAR_BURN_BLEND: both = std::max(ad * s + as * d - as * ad, 0.f); break;
+				case color_manipulation::DIFFERENCE_BLEND: both = std::abs(as * d - ad * s); break;
+				case color_manipulation::SUBTRACT_BLEND: both = std::max(ad * s - as * d, 0.f); break;
+				default: both = ad * s + as * d - 2.f * s * d; break;
+				}
+
+				destination[c] = s * source_factor + d * destination_factor + both;
+			}
+			destination[3] = as * source_factor + ad * destination_factor + as * ad;
+		}
+	}
+
+	//! Blends two colors of any color type as a block of one color.
+	/*!
+	* \param blend Called with the source block, the destination block and the result block.
+	*/
+	template<typename Blend>
+	color_space::color_base* blend_colors(color_space::color_base* source, color_space::color_base* destination, Blend blend)
+	{
+		// Check input params
+		if (source == nullptr) throw new std::invalid_argument("source color is null.");
+		if (destination == nullptr) throw new std::invalid_argument("destination color is null.");
+		if (source->get_rgb_color_space() != destination->get_rgb_color_space()) throw new std::invalid_argument("The rgb color space definitions of both colors do not match.");
+
+		auto s_rgb = color_manipulation::color_converter::to_rgb_deep(*source);
+		auto d_rgb = color_manipulation::color_converter::to_rgb_deep(*destination);
+
+		block s_block, d_block, result;
+		for (size_t c = 0; c < 3; ++c)
+		{
+			s_block[c][0] = s_rgb.get_components()[c];
+			d_block[c][0] = d_rgb.get_components()[c];
+		}
+		s_block[3][0] = s_rgb.alpha();
+		d_block[3][0] = d_rgb.alpha();
+
+		blend(s_block, d_block, result);
+		return color_manipulation::color_converter::create_converted(color_space::rgb_deepcolor(result[0][0], result[1][0], result[2][0], result[3][0], source->get_rgb_color_space()), source->get_color_type());
+	}
+
+	//! Blends two buffers of any color type block by block.
+	/*!
+	* \param blend Called with the index of the first color, the number of colors, the source block, the destination
+	* block and the result block.
+	*/
+	template<typename Blend>
+	color_buffer blend_buffers(const color_buffer& source, const color_buffer& destination, Blend blend)
+	{
+		// Check input params
+		if (source.size() != destination.size()) throw new std::invalid_argument("The buffers do not contain the same number of colors.");
+		if (source.get_rgb_color_space() != destination.get_rgb_color_space()) throw new std::invalid_argument("The rgb color space definitions of both buffers do not match.");
+
+		const color_type type = source.get_color_type();
+		color_space::rgb_color_space_definition* rgb_color_space = source.get_rgb_color_space();
+		color_buffer result(type, rgb_color_space, source.size());
+		parallel::for_each_chunk(source.size(), 4096, [&](size_t chunk, size_t begin, size_t end)
+		{
+			block s_block, d_block, r_block;
+			float rgba[5];
+			for (size_t first = begin; first < end; first += block_size)
+			{
+				const size_t count = std::min(block_size, end - first);
+
+				// Gather into one array per channel
+				for (size_t i = 0; i < count; ++i)
+				{
+					color_manipulation::color_converter::convert_values(type, source.pixel(first + i), rgb_color_space, color_type::RGB_DEEP, rgba);
+					for (size_t c = 0; c < 4; ++c) s_block[c][i] = rgba[c];
+					color_manipulation::color_converter::convert_values(destination.get_color_type(), destination.pixel(first + i), rgb_color_space, color_type::RGB_DEEP, rgba);
+					for (size_t c = 0; c < 4; ++c) d_block[c][i] = rgba[c];
+				}
+
+				blend(first, count, s_block, d_block, r_block);
+
+				// Scatter back into the color type of the source
+				for (size_t i = 0; i < count; ++i)
+				{
+					for (size_t c = 0; c < 4; ++c) rgba[c] = r_block[c][i];
+					color_manipulation::color_converter::convert_values(color_type::RGB_DEEP, rgba, rgb_color_space, type, result.pixel(first + i));
+				}
+			}
+		});
+		return result;
+	}
+}
 
 color_space::color_base * color_manipulation::color_blend::normal(color_space::color_base * source, color_space::color_base * destination, bool use_source_region, bool use_destination_region)
 {
+	COLORMAGIC_INSTRUMENT("color_blend::normal");
+
 	// Check input params
 	if (source == nullptr) throw new std::invalid_argument("source color is null.");
 	if (destination == nullptr) throw new std::invalid_argument("destination color is null.");
 	if (source->get_rgb_color_space() != destination->get_rgb_color_space()) throw new std::invalid_argument("The rgb color space definitions of both colors do not match.");
 
-	return color_converter::convertTo(
-		(new color_blend())->general_porter_duff(
-			color_converter::to_rgb_deep(source),
-			color_converter::to_rgb_deep(destination),
+	return color_converter::create_converted(
+		color_blend().general_porter_duff(
+			color_converter::to_rgb_deep(*source),
+			color_converter::to_rgb_deep(*destination),
 			use_source_region,
 			use_destination_region,
 			true,
@@ -19,36 +292,46 @@ color_space::color_base * color_manipulation::color_blend::normal(color_space::c
 		source->get_color_type());
 }
 
+color_space::color_base * color_manipulation::color_blend::dissolve(color_space::color_base * source, color_space::color_base * destination, uint32_t x, uint32_t y, uint32_t seed, bool use_source_region, bool use_destination_region)
+{
+	COLORMAGIC_INSTRUMENT("color_blend::dissolve");
+
+	return blend_colors(source, destination, [=](const block& s_block, const block& d_block, block& result)
+	{
+		dissolve_block(0, 1, 1, seed, x, y, s_block, d_block, use_source_region, use_destination_region, result);
+	});
+}
+
 color_space::color_base * color_manipulation::color_blend::dissolve(color_space::color_base * source, color_space::color_base * destination, bool use_source_region, bool use_destination_region)
 {
-	// Check input params
-	if (source == nullptr) throw new std::invalid_argument("source color is null.");
-	if (destination == nullptr) throw new std::invalid_argument("destination color is null.");
-	if (source->get_rgb_color_space() != destination->get_rgb_color_space()) throw new std::invalid_argument("The rgb color space definitions of both colors do not match.");
+	return dissolve(source, destination, 0, 0, 0, use_source_region, use_destination_region);
+}
 
-	float source_dest_alpha_diff = source->alpha() - destination->alpha();
-	return color_converter::convertTo(
-		(new color_blend())->general_porter_duff(
-			color_converter::to_rgb_deep(source),
-			color_converter::to_rgb_deep(destination),
-			use_source_region,
-			use_destination_region,
-			true,
-			[source_dest_alpha_diff](float s_component, float d_component) { return dissolve_func(s_component, d_component, source_dest_alpha_diff); }),
-		source->get_color_type());
+color_buffer color_manipulation::color_blend::dissolve(const color_buffer & source, const color_buffer & destination, size_t width, uint32_t seed, uint32_t origin_x, uint32_t origin_y, bool use_source_region, bool use_destination_region)
+{
+	COLORMAGIC_INSTRUMENT("color_blend::dissolve");
+
+	if (width == 0) throw new std::invalid_argument("The width has to be greater than 0.");
+
+	return blend_buffers(source, destination, [=](size_t first, size_t count, const block& s_block, const block& d_block, block& r_block)
+	{
+		dissolve_block(first, count, width, seed, origin_x, origin_y, s_block, d_block, use_source_region, use_destination_region, r_block);
+	});
 }
 
 color_space::color_base * color_manipulation::color_blend::multiply(color_space::color_base * source, color_space::color_base * destination, bool use_source_region, bool use_destination_region)
 {
+	COLORMAGIC_INSTRUMENT("color_blend::multiply");
+
 	// Check input params
 	if (source == nullptr) throw new std::invalid_argument("source color is null.");
 	if (destination == nullptr) throw new std::invalid_argument("destination color is null.");
 	if (source->get_rgb_color_space() != destination->get_rgb_color_space()) throw new std::invalid_argument("The rgb color space definitions of both colors do not match.");
 
-	return color_converter::convertTo(
-		(new color_blend())->general_porter_duff(
-			color_converter::to_rgb_deep(source),
-			color_converter::to_rgb_deep(destination),
+	return color_converter::create_converted(
+		color_blend().general_porter_duff(
+			color_converter::to_rgb_deep(*source),
+			color_converter::to_rgb_deep(*destination),
 			use_source_region,
 			use_destination_region,
 			true,
@@ -58,15 +341,17 @@ color_space::color_base * color_manipulation::color_blend::multiply(color_space:
 
 color_space::color_base * color_manipulation::color_blend::screen(color_space::color_base * source, color_space::color_base * destination, bool use_source_region, bool use_destination_region)
 {
+	COLORMAGIC_INSTRUMENT("color_blend::screen");
+
 	// Check input params
 	if (source == nullptr) throw new std::invalid_argument("source color is null.");
 	if (destination == nullptr) throw new std::invalid_argument("destination color is null.");
 	if (source->get_rgb_color_space() != destination->get_rgb_color_space()) throw new std::invalid_argument("The rgb color space definitions of both colors do not match.");
 
-	return color_converter::convertTo(
-		(new color_blend())->general_porter_duff(
-			color_converter::to_rgb_deep(source),
-			color_converter::to_rgb_deep(destination),
+	return color_converter::create_converted(
+		color_blend().general_porter_duff(
+			color_converter::to_rgb_deep(*source),
+			color_converter::to_rgb_deep(*destination),
 			use_source_region,
 			use_destination_region,
 			true,
@@ -79,15 +364,17 @@ color_space::color_base * color_manipulation::color_blend::screen(color_space::c
 
 color_space::color_base * color_manipulation::color_blend::overlay(color_space::color_base * source, color_space::color_base * destination, bool use_source_region, bool use_destination_region)
 {
+	COLORMAGIC_INSTRUMENT("color_blend::overlay");
+
 	// Check input params
 	if (source == nullptr) throw new std::invalid_argument("source color is null.");
 	if (destination == nullptr) throw new std::invalid_argument("destination color is null.");
 	if (source->get_rgb_color_space() != destination->get_rgb_color_space()) throw new std::invalid_argument("The rgb color space definitions of both colors do not match.");
 
-	return color_converter::convertTo(
-		(new color_blend())->general_porter_duff(
-			color_converter::to_rgb_deep(source),
-			color_converter::to_rgb_deep(destination),
+	return color_converter::create_converted(
+		color_blend().general_porter_duff(
+			color_converter::to_rgb_deep(*source),
+			color_converter::to_rgb_deep(*destination),
 			use_source_region,
 			use_destination_region,
 			true,
@@ -100,15 +387,17 @@ color_space::color_base * color_manipulation::color_blend::overlay(color_space::
 
 color_space::color_base * color_manipulation::color_blend::darken(color_space::color_base * source, color_space::color_base * destination, bool use_source_region, bool use_destination_region)
 {
+	COLORMAGIC_INSTRUMENT("color_blend::darken");
+
 	// Check input params
 	if (source == nullptr) throw new std::invalid_argument("source color is null.");
 	if (destination == nullptr) throw new std::invalid_argument("destination color is null.");
 	if (source->get_rgb_color_space() != destination->get_rgb_color_space()) throw new std::invalid_argument("The rgb color space definitions of both colors do not match.");
 
-	return color_converter::convertTo(
-		(new color_blend())->general_porter_duff(
-			color_converter::to_rgb_deep(source),
-			color_converter::to_rgb_deep(destination),
+	return color_converter::create_converted(
+		color_blend().general_porter_duff(
+			color_converter::to_rgb_deep(*source),
+			color_converter::to_rgb_deep(*destination),
 			use_source_region,
 			use_destination_region,
 			true,
@@ -118,15 +407,17 @@ color_space::color_base * color_manipulation::color_blend::darken(color_space::c
 
 color_space::color_base * color_manipulation::color_blend::lighten(color_space::color_base * source, color_space::color_base * destination, bool use_source_region, bool use_destination_region)
 {
+	COLORMAGIC_INSTRUMENT("color_blend::lighten");
+
 	// Check input params
 	if (source == nullptr) throw new std::invalid_argument("source color is null.");
 	if (destination == nullptr) throw new std::invalid_argument("destination color is null.");
 	if (source->get_rgb_color_space() != destination->get_rgb_color_space()) throw new std::invalid_argument("The rgb color space definitions of both colors do not match.");
 
-	return color_converter::convertTo(
-		(new color_blend())->general_porter_duff(
-			color_converter::to_rgb_deep(source),
-			color_converter::to_rgb_deep(destination),
+	return color_converter::create_converted(
+		color_blend().general_porter_duff(
+			color_converter::to_rgb_deep(*source),
+			color_converter::to_rgb_deep(*destination),
 			use_source_region,
 			use_destination_region,
 			true,
@@ -136,15 +427,17 @@ color_space::color_base * color_manipulation::color_blend::lighten(color_space::
 
 color_space::color_base * color_manipulation::color_blend::color_dodge(color_space::color_base * source, color_space::color_base * destination, bool use_source_region, bool use_destination_region)
 {
+	COLORMAGIC_INSTRUMENT("color_blend::color_dodge");
+
 	// Check input params
 	if (source == nullptr) throw new std::invalid_argument("source color is null.");
 	if (destination == nullptr) throw new std::invalid_argument("destination color is null.");
 	if (source->get_rgb_color_space() != destination->get_rgb_color_space()) throw new std::invalid_argument("The rgb color space definitions of both colors do not match.");
 
-	return color_converter::convertTo(
-		(new color_blend())->general_porter_duff(
-			color_converter::to_rgb_deep(source),
-			color_converter::to_rgb_deep(destination),
+	return color_converter::create_converted(
+		color_blend().general_porter_duff(
+			color_converter::to_rgb_deep(*source),
+			color_converter::to_rgb_deep(*destination),
 			use_source_region,
 			use_destination_region,
 			true,
@@ -154,15 +447,17 @@ color_space::color_base * color_manipulation::color_blend::color_dodge(color_spa
 
 color_space::color_base * color_manipulation::color_blend::linear_dodge(color_space::color_base * source, color_space::color_base * destination, bool use_source_region, bool use_destination_region)
 {
+	COLORMAGIC_INSTRUMENT("color_blend::linear_dodge");
+
 	// Check input params
 	if (source == nullptr) throw new std::invalid_argument("source color is null.");
 	if (destination == nullptr) throw new std::invalid_argument("destination color is null.");
 	if (source->get_rgb_color_space() != destination->get_rgb_color_space()) throw new std::invalid_argument("The rgb color space definitions of both colors do not match.");
 
-	return color_converter::convertTo(
-		(new color_blend())->general_porter_duff(
-			color_converter::to_rgb_deep(source),
-			color_converter::to_rgb_deep(destination),
+	return color_converter::create_converted(
+		color_blend().general_porter_duff(
+			color_converter::to_rgb_deep(*source),
+			color_converter::to_rgb_deep(*destination),
 			use_source_region,
 			use_destination_region,
 			true,
@@ -172,15 +467,17 @@ color_space::color_base * color_manipulation::color_blend::linear_dodge(color_sp
 
 color_space::color_base * color_manipulation::color_blend::color_burn(color_space::color_base * source, color_space::color_base * destination, bool use_source_region, bool use_destination_region)
 {
+	COLORMAGIC_INSTRUMENT("color_blend::color_burn");
+
 	// Check input params
 	if (source == nullptr) throw new std::invalid_argument("source color is null.");
 	if (destination == nullptr) throw new std::invalid_argument("destination color is null.");
 	if (source->get_rgb_color_space() != destination->get_rgb_color_space()) throw new std::invalid_argument("The rgb color space definitions of both colors do not match.");
 
-	return color_converter::convertTo(
-		(new color_blend())->general_porter_duff(
-			color_converter::to_rgb_deep(source),
-			color_converter::to_rgb_deep(destination),
+	return color_converter::create_converted(
+		color_blend().general_porter_duff(
+			color_converter::to_rgb_deep(*source),
+			color_converter::to_rgb_deep(*destination),
 			use_source_region,
 			use_destination_region,
 			true,
@@ -190,15 +487,17 @@ color_space::color_base * color_manipulation::color_blend::color_burn(color_spac
 
 color_space::color_base * color_manipulation::color_blend::linear_burn(color_space::color_base * source, color_space::color_base * destination, bool use_source_region, bool use_destination_region)
 {
+	COLORMAGIC_INSTRUMENT("color_blend::linear_burn");
+
 	// Check input params
 	if (source == nullptr) throw new std::invalid_argument("source color is null.");
 	if (destination == nullptr) throw new std::invalid_argument("destination color is null.");
 	if (source->get_rgb_color_space() != destination->get_rgb_color_space()) throw new std::invalid_argument("The rgb color space definitions of both colors do not match.");
 
-	return color_converter::convertTo(
-		(new color_blend())->general_porter_duff(
-			color_converter::to_rgb_deep(source),
-			color_converter::to_rgb_deep(destination),
+	return color_converter::create_converted(
+		color_blend().general_porter_duff(
+			color_converter::to_rgb_deep(*source),
+			color_converter::to_rgb_deep(*destination),
 			use_source_region,
 			use_destination_region,
 			true,
@@ -208,15 +507,17 @@ color_space::color_base * color_manipulation::color_blend::linear_burn(color_spa
 
 color_space::color_base * color_manipulation::color_blend::hard_light(color_space::color_base * source, color_space::color_base * destination, bool use_source_region, bool use_destination_region)
 {
+	COLORMAGIC_INSTRUMENT("color_blend::hard_light");
+
 	// Check input params
 	if (source == nullptr) throw new std::invalid_argument("source color is null.");
 	if (destination == nullptr) throw new std::invalid_argument("destination color is null.");
 	if (source->get_rgb_color_space() != destination->get_rgb_color_space()) throw new std::invalid_argument("The rgb color space definitions of both colors do not match.");
 
-	return color_converter::convertTo(
-		(new color_blend())->general_porter_duff(
-			color_converter::to_rgb_deep(source),
-			color_converter::to_rgb_deep(destination),
+	return color_converter::create_converted(
+		color_blend().general_porter_duff(
+			color_converter::to_rgb_deep(*source),
+			color_converter::to_rgb_deep(*destination),
 			use_source_region,
 			use_destination_region,
 			true,
@@ -226,15 +527,17 @@ color_space::color_base * color_manipulation::color_blend::hard_light(color_spac
 
 color_space::color_base * color_manipulation::color_blend::soft_light(color_space::color_base * source, color_space::color_base * destination, bool use_source_region, bool use_destination_region)
 {
+	COLORMAGIC_INSTRUMENT("color_blend::soft_light");
+
 	// Check input params
 	if (source == nullptr) throw new std::invalid_argument("source color is null.");
 	if (destination == nullptr) throw new std::invalid_argument("destination color is null.");
 	if (source->get_rgb_color_space() != destination->get_rgb_color_space()) throw new std::invalid_argument("The rgb color space definitions of both colors do not match.");
 
-	return color_converter::convertTo(
-		(new color_blend())->general_porter_duff(
-			color_converter::to_rgb_deep(source),
-			color_converter::to_rgb_deep(destination),
+	return color_converter::create_converted(
+		color_blend().general_porter_duff(
+			color_converter::to_rgb_deep(*source),
+			color_converter::to_rgb_deep(*destination),
 			use_source_region,
 			use_destination_region,
 			true,
@@ -244,15 +547,17 @@ color_space::color_base * color_manipulation::color_blend::soft_light(color_spac
 
 color_space::color_base * color_manipulation::color_blend::vivid_light(color_space::color_base * source, color_space::color_base * destination, bool use_source_region, bool use_destination_region)
 {
+	COLORMAGIC_INSTRUMENT("color_blend::vivid_light");
+
 	// Check input params
 	if (source == nullptr) throw new std::invalid_argument("source color is null.");
 	if (destination == nullptr) throw new std::invalid_argument("destination color is null.");
 	if (source->get_rgb_color_space() != destination->get_rgb_color_space()) throw new std::invalid_argument("The rgb color space definitions of both colors do not match.");
 
-	return color_converter::convertTo(
-		(new color_blend())->general_porter_duff(
-			color_converter::to_rgb_deep(source),
-			color_converter::to_rgb_deep(destination),
+	return color_converter::create_converted(
+		color_blend().general_porter_duff(
+			color_converter::to_rgb_deep(*source),
+			color_converter::to_rgb_deep(*destination),
 			use_source_region,
 			use_destination_region,
 			true,
@@ -262,15 +567,17 @@ color_space::color_base * color_manipulation::color_blend::vivid_light(color_spa
 
 color_space::color_base * color_manipulation::color_blend::linear_light(color_space::color_base * source, color_space::color_base * destination, bool use_source_region, bool use_destination_region)
 {
+	COLORMAGIC_INSTRUMENT("color_blend::linear_light");
+
 	// Check input params
 	if (source == nullptr) throw new std::invalid_argument("source color is null.");
 	if (destination == nullptr) throw new std::invalid_argument("destination color is null.");
 	if (source->get_rgb_color_space() != destination->get_rgb_color_space()) throw new std::invalid_argument("The rgb color space definitions of both colors do not match.");
 
-	return color_converter::convertTo(
-		(new color_blend())->general_porter_duff(
-			color_converter::to_rgb_deep(source),
-			color_converter::to_rgb_deep(destination),
+	return color_converter::create_converted(
+		color_blend().general_porter_duff(
+			color_converter::to_rgb_deep(*source),
+			color_converter::to_rgb_deep(*destination),
 			use_source_region,
 			use_destination_region,
 			true,
@@ -280,15 +587,17 @@ color_space::color_base * color_manipulation::color_blend::linear_light(color_sp
 
 color_space::color_base* color_manipulation::color_blend::pin_light(color_space::color_base* source, color_space::color_base* destination, bool use_source_region, bool use_destination_region)
 {
+	COLORMAGIC_INSTRUMENT("color_blend::pin_light");
+
 	// Check input params
 	if (source == nullptr) throw new std::invalid_argument("source color is null.");
 	if (destination == nullptr) throw new std::invalid_argument("destination color is null.");
 	if (source->get_rgb_color_space() != destination->get_rgb_color_space()) throw new std::invalid_argument("The rgb color space definitions of both colors do not match.");
 
-	return color_converter::convertTo(
-		(new color_blend())->general_porter_duff(
-			color_converter::to_rgb_deep(source),
-			color_converter::to_rgb_deep(destination),
+	return color_converter::create_converted(
+		color_blend().general_porter_duff(
+			color_converter::to_rgb_deep(*source),
+			color_converter::to_rgb_deep(*destination),
 			use_source_region,
 			use_destination_region,
 			true,
@@ -298,15 +607,17 @@ color_space::color_base* color_manipulation::color_blend::pin_light(color_space:
 
 color_space::color_base* color_manipulation::color_blend::hard_mix(color_space::color_base* source, color_space::color_base* destination, bool use_source_region, bool use_destination_region)
 {
+	COLORMAGIC_INSTRUMENT("color_blend::hard_mix");
+
 	// Check input params
 	if (source == nullptr) throw new std::invalid_argument("source color is null.");
 	if (destination == nullptr) throw new std::invalid_argument("destination color is null.");
 	if (source->get_rgb_color_space() != destination->get_rgb_color_space()) throw new std::invalid_argument("The rgb color space definitions of both colors do not match.");
 
-	return color_converter::convertTo(
-		(new color_blend())->general_porter_duff(
-			color_converter::to_rgb_deep(source),
-			color_converter::to_rgb_deep(destination),
+	return color_converter::create_converted(
+		color_blend().general_porter_duff(
+			color_converter::to_rgb_deep(*source),
+			color_converter::to_rgb_deep(*destination),
 			use_source_region,
 			use_destination_region,
 			true,
@@ -316,15 +627,17 @@ color_space::color_base* color_manipulation::color_blend::hard_mix(color_space::
 
 color_space::color_base * color_manipulation::color_blend::difference(color_space::color_base * source, color_space::color_base * destination, bool use_source_region, bool use_destination_region)
 {
+	COLORMAGIC_INSTRUMENT("color_blend::difference");
+
 	// Check input params
 	if (source == nullptr) throw new std::invalid_argument("source color is null.");
 	if (destination == nullptr) throw new std::invalid_argument("destination color is null.");
 	if (source->get_rgb_color_space() != destination->get_rgb_color_space()) throw new std::invalid_argument("The rgb color space definitions of both colors do not match.");
 
-	return color_converter::convertTo(
-		(new color_blend())->general_porter_duff(
-			color_converter::to_rgb_deep(source),
-			color_converter::to_rgb_deep(destination),
+	return color_converter::create_converted(
+		color_blend().general_porter_duff(
+			color_converter::to_rgb_deep(*source),
+			color_converter::to_rgb_deep(*destination),
 			use_source_region,
 			use_destination_region,
 			true,
@@ -334,15 +647,17 @@ color_space::color_base * color_manipulation::color_blend::difference(color_spac
 
 color_space::color_base * color_manipulation::color_blend::subtract(color_space::color_base * source, color_space::color_base * destination, bool use_source_region, bool use_destination_region)
 {
+	COLORMAGIC_INSTRUMENT("color_blend::subtract");
+
 	// Check input params
 	if (source == nullptr) throw new std::invalid_argument("source color is null.");
 	if (destination == nullptr) throw new std::invalid_argument("destination color is null.");
 	if (source->get_rgb_color_space() != destination->get_rgb_color_space()) throw new std::invalid_argument("The rgb color space definitions of both colors do not match.");
 
-	return color_converter::convertTo(
-		(new color_blend())->general_porter_duff(
-			color_converter::to_rgb_deep(source),
-			color_converter::to_rgb_deep(destination),
+	return color_converter::create_converted(
+		color_blend().general_porter_duff(
+			color_converter::to_rgb_deep(*source),
+			color_converter::to_rgb_deep(*destination),
 			use_source_region,
 			use_destination_region,
 			true,
@@ -352,15 +667,17 @@ color_space::color_base * color_manipulation::color_blend::subtract(color_space:
 
 color_space::color_base * color_manipulation::color_blend::divide(color_space::color_base * source, color_space::color_base * destination, bool use_source_region, bool use_destination_region)
 {
+	COLORMAGIC_INSTRUMENT("color_blend::divide");
+
 	// Check input params
 	if (source == nullptr) throw new std::invalid_argument("source color is null.");
 	if (destination == nullptr) throw new std::invalid_argument("destination color is null.");
 	if (source->get_rgb_color_space() != destination->get_rgb_color_space()) throw new std::invalid_argument("The rgb color space definitions of both colors do not match.");
 
-	return color_converter::convertTo(
-		(new color_blend())->general_porter_duff(
-			color_converter::to_rgb_deep(source),
-			color_converter::to_rgb_deep(destination),
+	return color_converter::create_converted(
+		color_blend().general_porter_duff(
+			color_converter::to_rgb_deep(*source),
+			color_converter::to_rgb_deep(*destination),
 			use_source_region,
 			use_destination_region,
 			true,
@@ -370,15 +687,17 @@ color_space::color_base * color_manipulation::color_blend::divide(color_space::c
 
 color_space::color_base * color_manipulation::color_blend::plus_lighter(color_space::color_base * source, color_space::color_base * destination, bool use_source_region, bool use_destination_region)
 {
+	COLORMAGIC_INSTRUMENT("color_blend::plus_lighter");
+
 	// Check input params
 	if (source == nullptr) throw new std::invalid_argument("source color is null.");
 	if (destination == nullptr) throw new std::invalid_argument("destination color is null.");
 	if (source->get_rgb_color_space() != destination->get_rgb_color_space()) throw new std::invalid_argument("The rgb color space definitions of both colors do not match.");
 
-	return color_converter::convertTo(
-		(new color_blend())->general_porter_duff(
-			color_converter::to_rgb_deep(source),
-			color_converter::to_rgb_deep(destination),
+	return color_converter::create_converted(
+		color_blend().general_porter_duff(
+			color_converter::to_rgb_deep(*source),
+			color_converter::to_rgb_deep(*destination),
 			use_source_region,
 			use_destination_region,
 			true,
@@ -388,15 +707,17 @@ color_space::color_base * color_manipulation::color_blend::plus_lighter(color_sp
 
 color_space::color_base * color_manipulation::color_blend::plus_darker(color_space::color_base * source, color_space::color_base * destination, bool use_source_region, bool use_destination_region)
 {
+	COLORMAGIC_INSTRUMENT("color_blend::plus_darker");
+
 	// Check input params
 	if (source == nullptr) throw new std::invalid_argument("source color is null.");
 	if (destination == nullptr) throw new std::invalid_argument("destination color is null.");
 	if (source->get_rgb_color_space() != destination->get_rgb_color_space()) throw new std::invalid_argument("The rgb color space definitions of both colors do not match.");
 
-	return color_converter::convertTo(
-		(new color_blend())->general_porter_duff(
-			color_converter::to_rgb_deep(source),
-			color_converter::to_rgb_deep(destination),
+	return color_converter::create_converted(
+		color_blend().general_porter_duff(
+			color_converter::to_rgb_deep(*source),
+			color_converter::to_rgb_deep(*destination),
 			use_source_region,
 			use_destination_region,
 			true,
@@ -406,15 +727,17 @@ color_space::color_base * color_manipulation::color_blend::plus_darker(color_spa
 
 color_space::color_base * color_manipulation::color_blend::exclusion(color_space::color_base * source, color_space::color_base * destination, bool use_source_region, bool use_destination_region)
 {
+	COLORMAGIC_INSTRUMENT("color_blend::exclusion");
+
 	// Check input params
 	if (source == nullptr) throw new std::invalid_argument("source color is null.");
 	if (destination == nullptr) throw new std::invalid_argument("destination color is null.");
 	if (source->get_rgb_color_space() != destination->get_rgb_color_space()) throw new std::invalid_argument("The rgb color space definitions of both colors do not match.");
 
-	return color_converter::convertTo(
-		(new color_blend())->general_porter_duff(
-			color_converter::to_rgb_deep(source),
-			color_converter::to_rgb_deep(destination),
+	return color_converter::create_converted(
+		color_blend().general_porter_duff(
+			color_converter::to_rgb_deep(*source),
+			color_converter::to_rgb_deep(*destination),
 			use_source_region,
 			use_destination_region,
 			true,
@@ -424,15 +747,17 @@ color_space::color_base * color_manipulation::color_blend::exclusion(color_space
 
 color_space::color_base * color_manipulation::color_blend::custom_componentwise_blend(color_space::color_base * source, color_space::color_base * destination, bool use_source_region, bool use_destination_region, std::function<float(float, float)> blend_function)
 {
+	COLORMAGIC_INSTRUMENT("color_blend::custom_componentwise_blend");
+
 	// Check input params
 	if (source == nullptr) throw new std::invalid_argument("source color is null.");
 	if (destination == nullptr) throw new std::invalid_argument("destination color is null.");
 	if (source->get_rgb_color_space() != destination->get_rgb_color_space()) throw new std::invalid_argument("The rgb color space definitions of both colors do not match.");
 
-	return color_converter::convertTo(
-		(new color_blend())->general_porter_duff(
-			color_converter::to_rgb_deep(source),
-			color_converter::to_rgb_deep(destination),
+	return color_converter::create_converted(
+		color_blend().general_porter_duff(
+			color_converter::to_rgb_deep(*source),
+			color_converter::to_rgb_deep(*destination),
 			use_source_region,
 			use_destination_region,
 			true,
@@ -442,32 +767,106 @@ color_space::color_base * color_manipulation::color_blend::custom_componentwise_
 
 color_space::color_base * color_manipulation::color_blend::hue(color_space::color_base * source, color_space::color_base * destination, bool use_source_region, bool use_destination_region)
 {
-	color_space::hcy* s_hcy = color_manipulation::color_converter::to_hcy(source);
-	color_space::hcy* d_hcy = color_manipulation::color_converter::to_hcy(destination);
-	color_space::hcy* result = new color_space::hcy(s_hcy->hue(), d_hcy->chroma(), d_hcy->luma(), s_hcy->alpha(), s_hcy->get_rgb_color_space());
-	return color_manipulation::color_converter::convertTo(result, source->get_color_type());
+	COLORMAGIC_INSTRUMENT("color_blend::hue");
+
+	return blend_colors(source, destination, [=](const block& s_block, const block& d_block, block& result)
+	{
+		blend_block(HUE_MODE, 1, s_block, d_block, use_source_region, use_destination_region, result);
+	});
+}
+
+color_buffer color_manipulation::color_blend::hue(const color_buffer & source, const color_buffer & destination, bool use_source_region, bool use_destination_region)
+{
+	COLORMAGIC_INSTRUMENT("color_blend::hue");
+
+	return blend_buffers(source, destination, [=](size_t first, size_t count, const block& s_block, const block& d_block, block& r_block)
+	{
+		blend_block(HUE_MODE, count, s_block, d_block, use_source_region, use_destination_region, r_block);
+	});
 }
 
 color_space::color_base * color_manipulation::color_blend::saturation(color_space::color_base * source, color_space::color_base * destination, bool use_source_region, bool use_destination_region)
 {
-	color_space::hcy* s_hcy = color_manipulation::color_converter::to_hcy(source);
-	color_space::hcy* d_hcy = color_manipulation::color_converter::to_hcy(destination);
-	color_space::hcy* result = new color_space::hcy(d_hcy->hue(), s_hcy->chroma(), d_hcy->luma(), s_hcy->alpha(), s_hcy->get_rgb_color_space());
-	return color_manipulation::color_converter::convertTo(result, source->get_color_type());
+	COLORMAGIC_INSTRUMENT("color_blend::saturation");
+
+	return blend_colors(source, destination, [=](const block& s_block, const block& d_block, block& result)
+	{
+		blend_block(SATURATION_MODE, 1, s_block, d_block, use_source_region, use_destination_region, result);
+	});
+}
+
+color_buffer color_manipulation::color_blend::saturation(const color_buffer & source, const color_buffer & destination, bool use_source_region, bool use_destination_region)
+{
+	COLORMAGIC_INSTRUMENT("color_blend::saturation");
+
+	return blend_buffers(source, destination, [=](size_t first, size_t count, const block& s_block, const block& d_block, block& r_block)
+	{
+		blend_block(SATURATION_MODE, count, s_block, d_block, use_source_region, use_destination_region, r_block);
+	});
 }
 
 color_space::color_base * color_manipulation::color_blend::color(color_space::color_base * source, color_space::color_base * destination, bool use_source_region, bool use_destination_region)
 {
-	color_space::hcy* s_hcy = color_manipulation::color_converter::to_hcy(source);
-	color_space::hcy* d_hcy = color_manipulation::color_converter::to_hcy(destination);
-	color_space::hcy* result = new color_space::hcy(s_hcy->hue(), s_hcy->chroma(), d_hcy->luma(), s_hcy->alpha(), s_hcy->get_rgb_color_space());
-	return color_manipulation::color_converter::convertTo(result, source->get_color_type());
+	COLORMAGIC_INSTRUMENT("color_blend::color");
+
+	return blend_colors(source, destination, [=](const block& s_block, const block& d_block, block& result)
+	{
+		blend_block(COLOR_MODE, 1, s_block, d_block, use_source_region, use_destination_region, result);
+	});
+}
+
+color_buffer color_manipulation::color_blend::color(const color_buffer & source, const color_buffer & destination, bool use_source_region, bool use_destination_region)
+{
+	COLORMAGIC_INSTRUMENT("color_blend::color");
+
+	return blend_buffers(source, destination, [=](size_t first, size_t count, const block& s_block, const block& d_block, block& r_block)
+	{
+		blend_block(COLOR_MODE, count, s_block, d_block, use_source_region, use_destination_region, r_block);
+	});
 }
 
 color_space::color_base * color_manipulation::color_blend::luminosity(color_space::color_base * source, color_space::color_base * destination, bool use_source_region, bool use_destination_region)
 {
-	color_space::hcy* s_hcy = color_manipulation::color_converter::to_hcy(source);
-	color_space::hcy* d_hcy = color_manipulation::color_converter::to_hcy(destination);
-	color_space::hcy* result = new color_space::hcy(d_hcy->hue(), d_hcy->chroma(), s_hcy->luma(), s_hcy->alpha(), s_hcy->get_rgb_color_space());
-	return color_manipulation::color_converter::convertTo(result, source->get_color_type());
-}
\ No newline at end of file
+	COLORMAGIC_INSTRUMENT("color_blend::luminosity");
+
+	return blend_colors(source, destination, [=](const block& s_block, const block& d_block, block& result)
+	{
+		blend_block(LUMINOSITY_MODE, 1, s_block, d_block, use_source_region, use_destination_region, result);
+	});
+}
+
+color_buffer color_manipulation::color_blend::luminosity(const color_buffer & source, const color_buffer & destination, bool use_source_region, bool use_destination_region)
+{
+	COLORMAGIC_INSTRUMENT("color_blend::luminosity");
+
+	return blend_buffers(source, destination, [=](size_t first, size_t count, const block& s_block, const block& d_block, block& r_block)
+	{
+		blend_block(LUMINOSITY_MODE, count, s_block, d_block, use_source_region, use_destination_region, r_block);
+	});
+}
+
+void color_manipulation::color_blend::blend(const premultiplied_buffer & source, premultiplied_buffer & destination, premultiplied_blend_mode mode, bool use_source_region, bool use_destination_region)
+{
+	COLORMAGIC_INSTRUMENT("color_blend::blend");
+
+	// Check input params
+	if (source.size() != destination.size()) throw new std::invalid_argument("The buffers do not contain the same number of colors.");
+	if (source.get_rgb_color_space() != destination.get_rgb_color_space()) throw new std::invalid_argument("The rgb color space definitions of both buffers do not match.");
+
+	typedef void(*kernel)(const float*, float*, size_t, float, float);
+	static const kernel kernels[] =
+	{
+		blend_premultiplied<NORMAL_BLEND>, blend_premultiplied<MULTIPLY_BLEND>, blend_premultiplied<SCREEN_BLEND>,
+		blend_premultiplied<DARKEN_BLEND>, blend_premultiplied<LIGHTEN_BLEND>, blend_premultiplied<LINEAR_DODGE_BLEND>,
+		blend_premultiplied<LINEAR_BURN_BLEND>, blend_premultiplied<DIFFERENCE_BLEND>, blend_premultiplied<SUBTRACT_BLEND>,
+		blend_premultiplied<EXCLUSION_BLEND>
+	};
+	if (mode < NORMAL_BLEND || mode > EXCLUSION_BLEND) throw new std::invalid_argument("Unknown blend mode.");
+
+	const kernel blend_kernel = kernels[mode];
+	const float use_source = use_source_region ? 1.f : 0.f, use_destination = use_destination_region ? 1.f : 0.f;
+	parallel::for_each_chunk(source.size(), 4096, [&](size_t chunk, size_t begin, size_t end)
+	{
+		blend_kernel(source.pixel(begin), destination.pixel(begin), end - begin, use_source, use_destination);
+	});
+}
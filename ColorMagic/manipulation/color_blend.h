@@ -7,10 +7,33 @@
 
 #include "base_color_blend.h"
 #include "..\spaces\color_base.h"
+#include "..\utils\color_buffer.h"
+#include "..\utils\premultiplied_buffer.h"
 #include "color_converter.h"
 
+#include <cstdint>
+
 namespace color_manipulation
 {
+	//! Enum that defines the blend modes of color_blend::blend() on premultiplied colors.
+	/*!
+	* These are the modes whose blended overlapping area can be computed from premultiplied colors without dividing
+	* by alpha.
+	*/
+	enum premultiplied_blend_mode
+	{
+		NORMAL_BLEND = 0, /*!< NORMAL_BLEND - \sa color_blend::normal() */
+		MULTIPLY_BLEND, /*!< MULTIPLY_BLEND - \sa color_blend::multiply() */
+		SCREEN_BLEND, /*!< SCREEN_BLEND - \sa color_blend::screen() */
+		DARKEN_BLEND, /*!< DARKEN_BLEND - \sa color_blend::darken() */
+		LIGHTEN_BLEND, /*!< LIGHTEN_BLEND - \sa color_blend::lighten() */
+		LINEAR_DODGE_BLEND, /*!< LINEAR_DODGE_BLEND - \sa color_blend::linear_dodge(), the sum is limited to 1 */
+		LINEAR_BURN_BLEND, /*!< LINEAR_BURN_BLEND - \sa color_blend::linear_burn(), the result is limited to 0 */
+		DIFFERENCE_BLEND, /*!< DIFFERENCE_BLEND - \sa color_blend::difference() */
+		SUBTRACT_BLEND, /*!< SUBTRACT_BLEND - \sa color_blend::subtract(), the result is limited to 0 */
+		EXCLUSION_BLEND /*!< EXCLUSION_BLEND - \sa color_blend::exclusion() */
+	};
+
 	//! Static class for color blending operations
 	/*!
 	* This static class implements 25 different color blending operations.
@@ -43,7 +66,10 @@ namespace color_manipulation
 		/*!
 		* Static function that does dissolve blending. In its default configuration
 		* (use source and destination region) it will produce the same result like the porter
-		* duff over operator with the overlapping area being dissolve componentwise.
+		* duff over operator with the overlapping area being dissolved: the overlapping area takes
+		* all components of the color with the greater alpha in 3/4 of the pixels and the other
+		* color in the rest. Which pixels take which color is decided by dissolve_noise() of the
+		* pixel position, so the result does not depend on the order or the thread of the calls.
 		* Only source and only destination equals porter duffs' source respectively destination
 		* operators (plus dissolve). Neither source and destination will produce something simular
 		* to porter duffs in operator with dissolve.
@@ -53,6 +79,23 @@ namespace color_manipulation
 		* the same space like source color.
 		* \param source The source color of the operation.
 		* \param destination The destination color of the operation.
+		* \param x The column of the pixel.
+		* \param y The row of the pixel.
+		* \param seed Selects another noise pattern.
+		* \param use_source_region Whether the source region of the resulting pixel will be blank
+		* or not.
+		* \param use_destination_region Whether the destination region of the resulting pixel will
+		* be blank or not.
+		* \return the combination of source and destination calculated with dissolve blending.
+		*/
+		static color_space::color_base* dissolve(color_space::color_base* source, color_space::color_base* destination, uint32_t x, uint32_t y, uint32_t seed = 0, bool use_source_region = true, bool use_destination_region = true);
+
+		//! Static function that does dissolve blending.
+		/*!
+		* Dissolve blending of the pixel at column 0 and row 0 with seed 0.
+		* \sa dissolve(color_space::color_base*, color_space::color_base*, uint32_t, uint32_t, uint32_t, bool, bool)
+		* \param source The source color of the operation.
+		* \param destination The destination color of the operation.
 		* \param use_source_region Whether the source region of the resulting pixel will be blank
 		* or not.
 		* \param use_destination_region Whether the destination region of the resulting pixel will
@@ -61,6 +104,56 @@ namespace color_manipulation
 		*/
 		static color_space::color_base* dissolve(color_space::color_base* source, color_space::color_base* destination, bool use_source_region = true, bool use_destination_region = true);
 
+		//! Static function that does dissolve blending of two images.
+		/*!
+		* The buffers hold the pixels of an image or of a tile of an image row by row. Every pixel is
+		* dissolved like dissolve(color_space::color_base*, color_space::color_base*, uint32_t, uint32_t, uint32_t, bool, bool)
+		* at its position in the image, so the result is bit identical no matter how the image is split
+		* into tiles or threads. The buffers are processed in chunks on all cores.
+		* \param source The source colors of the operation.
+		* \param destination The destination colors of the operation, the same number of colors and the
+		* same rgb color space definition like the source colors.
+		* \param width The number of pixels per row of the buffers.
+		* \param seed Selects another noise pattern.
+		* \param origin_x The column of the first pixel of the buffers in the image.
+		* \param origin_y The row of the first pixel of the buffers in the image.
+		* \param use_source_region Whether the source region of the resulting pixels will be blank
+		* or not.
+		* \param use_destination_region Whether the destination region of the resulting pixels will
+		* be blank or not.
+		* \return A new buffer in the color type of the source colors.
+		*/
+		static color_buffer dissolve(const color_buffer& source, const color_buffer& destination, size_t width, uint32_t seed = 0, uint32_t origin_x = 0, uint32_t origin_y = 0, bool use_source_region = true, bool use_destination_region = true);
+
+		//! Static function that blends two buffers of premultiplied colors.
+		/*!
+		* Every color of the source buffer is blended with the color at the same index of the destination
+		* buffer like the function of the mode. The blend functions are rewritten for premultiplied
+		* values, e.g. multiply becomes s * d, so no color is divided by alpha. The result replaces the
+		* destination, which makes it the destination of the next layer of a compositing chain.
+		* The buffers are processed in chunks on all cores.
+		* \param source The source colors of the operation.
+		* \param destination The destination colors of the operation, the same number of colors and the
+		* same rgb color space definition like the source colors. Receives the result.
+		* \param mode The blend mode.
+		* \param use_source_region Whether the source region of the resulting pixels will be blank
+		* or not.
+		* \param use_destination_region Whether the destination region of the resulting pixels will
+		* be blank or not.
+		*/
+		static void blend(const premultiplied_buffer& source, premultiplied_buffer& destination, premultiplied_blend_mode mode, bool use_source_region = true, bool use_destination_region = true);
+
+		//! Counter based noise of the dissolve blending.
+		/*!
+		* A hash of the pixel position and the seed built from the PCG hash (a permuted
+		* linear congruential step), so it needs no state and every pixel can be computed on its own.
+		* \return A uniformly distributed 32 bit value.
+		*/
+		static uint32_t dissolve_noise(uint32_t x, uint32_t y, uint32_t seed)
+		{
+			return pcg_hash(x + pcg_hash(y + pcg_hash(seed)));
+		}
+
 		//! Static function that does multiply blending.
 		/*!
 		* Static function that does multiply blending. In its default configuration
@@ -556,9 +649,10 @@ namespace color_manipulation
 		* operators (plus hue blending). Neither source and destination will produce something
 		* simular to porter duffs in operator with hue blending.
 		* Note that this blend operator does not work componentwise but consider all components
-		* in a combination.
-		* Since the operation is done in hsl space a conversion will be done first. Therefore
-		* source and destination do not need to have the same color type. However the
+		* in a combination. It follows the W3C compositing specification (SetLum, SetSat and
+		* ClipColor in rgb deep color space).
+		* Since the operation is done in rgb deep color space a conversion will be done first.
+		* Therefore source and destination do not need to have the same color type. However the
 		* rgb color space definitions of both colors must match. The resulting color will be in
 		* the same space like source color.
 		* \param source The source color of the operation.
@@ -571,6 +665,24 @@ namespace color_manipulation
 		*/
 		static color_space::color_base* hue(color_space::color_base* source, color_space::color_base* destination, bool use_source_region = true, bool use_destination_region = true);
 
+		//! Static function that does hue blending of two buffers.
+		/*!
+		* Blends every color of the source buffer with the color at the same index of the destination
+		* buffer like hue(color_space::color_base*, color_space::color_base*, bool, bool): the overlapping
+		* area gets the hue of the source with the saturation and luminosity of the destination.
+		* The colors are converted to rgb deep in blocks and blended without branches, so the inner
+		* loops can be vectorized. The buffers are processed in chunks on all cores.
+		* \param source The source colors of the operation.
+		* \param destination The destination colors of the operation, the same number of colors and the
+		* same rgb color space definition like the source colors.
+		* \param use_source_region Whether the source region of the resulting pixels will be blank
+		* or not.
+		* \param use_destination_region Whether the destination region of the resulting pixels will
+		* be blank or not.
+		* \return A new buffer in the color type of the source colors.
+		*/
+		static color_buffer hue(const color_buffer& source, const color_buffer& destination, bool use_source_region = true, bool use_destination_region = true);
+
 		//! Static function that does saturation blending.
 		/*!
 		* Static function that does saturation blending. In its default configuration
@@ -580,9 +692,10 @@ namespace color_manipulation
 		* operators (plus saturation blending). Neither source and destination will produce something
 		* simular to porter duffs in operator with saturation blending.
 		* Note that this blend operator does not work componentwise but consider all components
-		* in a combination.
-		* Since the operation is done in hsl space a conversion will be done first. Therefore
-		* source and destination do not need to have the same color type. However the
+		* in a combination. It follows the W3C compositing specification (SetLum, SetSat and
+		* ClipColor in rgb deep color space).
+		* Since the operation is done in rgb deep color space a conversion will be done first.
+		* Therefore source and destination do not need to have the same color type. However the
 		* rgb color space definitions of both colors must match. The resulting color will be in
 		* the same space like source color.
 		* \param source The source color of the operation.
@@ -595,6 +708,24 @@ namespace color_manipulation
 		*/
 		static color_space::color_base* saturation(color_space::color_base* source, color_space::color_base* destination, bool use_source_region = true, bool use_destination_region = true);
 
+		//! Static function that does saturation blending of two buffers.
+		/*!
+		* Blends every color of the source buffer with the color at the same index of the destination
+		* buffer like saturation(color_space::color_base*, color_space::color_base*, bool, bool): the overlapping
+		* area gets the saturation of the source with the hue and luminosity of the destination.
+		* The colors are converted to rgb deep in blocks and blended without branches, so the inner
+		* loops can be vectorized. The buffers are processed in chunks on all cores.
+		* \param source The source colors of the operation.
+		* \param destination The destination colors of the operation, the same number of colors and the
+		* same rgb color space definition like the source colors.
+		* \param use_source_region Whether the source region of the resulting pixels will be blank
+		* or not.
+		* \param use_destination_region Whether the destination region of the resulting pixels will
+		* be blank or not.
+		* \return A new buffer in the color type of the source colors.
+		*/
+		static color_buffer saturation(const color_buffer& source, const color_buffer& destination, bool use_source_region = true, bool use_destination_region = true);
+
 		//! Static function that does color blending.
 		/*!
 		* Static function that does color blending. In its default configuration
@@ -604,9 +735,10 @@ namespace color_manipulation
 		* operators (plus color blending). Neither source and destination will produce something
 		* simular to porter duffs in operator with color blending.
 		* Note that this blend operator does not work componentwise but consider all components
-		* in a combination.
-		* Since the operation is done in hsl space a conversion will be done first. Therefore
-		* source and destination do not need to have the same color type. However the
+		* in a combination. It follows the W3C compositing specification (SetLum, SetSat and
+		* ClipColor in rgb deep color space).
+		* Since the operation is done in rgb deep color space a conversion will be done first.
+		* Therefore source and destination do not need to have the same color type. However the
 		* rgb color space definitions of both colors must match. The resulting color will be in
 		* the same space like source color.
 		* \param source The source color of the operation.
@@ -619,6 +751,24 @@ namespace color_manipulation
 		*/
 		static color_space::color_base* color(color_space::color_base* source, color_space::color_base* destination, bool use_source_region = true, bool use_destination_region = true);
 
+		//! Static function that does color blending of two buffers.
+		/*!
+		* Blends every color of the source buffer with the color at the same index of the destination
+		* buffer like color(color_space::color_base*, color_space::color_base*, bool, bool): the overlapping
+		* area gets the hue and saturation of the source with the luminosity of the destination.
+		* The colors are converted to rgb deep in blocks and blended without branches, so the inner
+		* loops can be vectorized. The buffers are processed in chunks on all cores.
+		* \param source The source colors of the operation.
+		* \param destination The destination colors of the operation, the same number of colors and the
+		* same rgb color space definition like the source colors.
+		* \param use_source_region Whether the source region of the resulting pixels will be blank
+		* or not.
+		* \param use_destination_region Whether the destination region of the resulting pixels will
+		* be blank or not.
+		* \return A new buffer in the color type of the source colors.
+		*/
+		static color_buffer color(const color_buffer& source, const color_buffer& destination, bool use_source_region = true, bool use_destination_region = true);
+
 		//! Static function that does luminosity blending.
 		/*!
 		* Static function that does luminosity blending. In its default configuration
@@ -628,9 +778,10 @@ namespace color_manipulation
 		* operators (plus luminosity blending). Neither source and destination will produce something
 		* simular to porter duffs in operator with luminosity blending.
 		* Note that this blend operator does not work componentwise but consider all components
-		* in a combination.
-		* Since the operation is done in hsl space a conversion will be done first. Therefore
-		* source and destination do not need to have the same color type. However the
+		* in a combination. It follows the W3C compositing specification (SetLum, SetSat and
+		* ClipColor in rgb deep color space).
+		* Since the operation is done in rgb deep color space a conversion will be done first.
+		* Therefore source and destination do not need to have the same color type. However the
 		* rgb color space definitions of both colors must match. The resulting color will be in
 		* the same space like source color.
 		* \param source The source color of the operation.
@@ -643,20 +794,31 @@ namespace color_manipulation
 		*/
 		static color_space::color_base* luminosity(color_space::color_base* source, color_space::color_base* destination, bool use_source_region = true, bool use_destination_region = true);
 
+		//! Static function that does luminosity blending of two buffers.
+		/*!
+		* Blends every color of the source buffer with the color at the same index of the destination
+		* buffer like luminosity(color_space::color_base*, color_space::color_base*, bool, bool): the overlapping
+		* area gets the luminosity of the source with the hue and saturation of the destination.
+		* The colors are converted to rgb deep in blocks and blended without branches, so the inner
+		* loops can be vectorized. The buffers are processed in chunks on all cores.
+		* \param source The source colors of the operation.
+		* \param destination The destination colors of the operation, the same number of colors and the
+		* same rgb color space definition like the source colors.
+		* \param use_source_region Whether the source region of the resulting pixels will be blank
+		* or not.
+		* \param use_destination_region Whether the destination region of the resulting pixels will
+		* be blank or not.
+		* \return A new buffer in the color type of the source colors.
+		*/
+		static color_buffer luminosity(const color_buffer& source, const color_buffer& destination, bool use_source_region = true, bool use_destination_region = true);
+
 	protected:
-		static float dissolve_func(float s, float d, float alpha_diff)
+		//! PCG hash: one step of a linear congruential generator followed by the PCG output permutation.
+		static uint32_t pcg_hash(uint32_t value)
 		{
-			float rand_val = rand() % 101; // generate a random number in the range 0 - 100
-			float threshold = 25.f; // threshold of random number that defines whether to return s or d
-			if (alpha_diff > 0.f) // source alpha is greater
-			{
-				return (rand_val >= threshold) ? s : d; // return s in 3/4 of the cases
-			}
-			else // destination alpha is greater
-			{
-				return (rand_val >= threshold) ? d : s; // return d in 3/4 of the cases
-			}
-			return 0;
+			uint32_t state = value * 747796405u + 2891336453u;
+			uint32_t word = ((state >> ((state >> 28u) + 4u)) ^ state) * 277803737u;
+			return (word >> 22u) ^ word;
 		}
 
 		static float multiply_func(float s, float d)
@@ -1,5 +1,8 @@
 #include "stdafx.h"
 #include "color_calculation.h"
+#include "..\utils\parallel.h"
+
+#include <memory>
 
 color_space::color_base * color_manipulation::color_calculation::add(color_space::color_base * color1, color_space::color_base * color2, float weight1, float weight2, bool include_alpha)
 {
@@ -523,7 +526,7 @@ color_space::rgb_truecolor * color_manipulation::color_calculation::average_rgb_
 {
 	if (colors.empty()) throw new std::invalid_argument("Parameter colors cannot be empty.");
 
-	auto sum = new float[4]{ (unsigned int)0, (unsigned int)0, (unsigned int)0, (unsigned int)0 };
+	float sum[4] = { 0.f, 0.f, 0.f, 0.f };
 	for (unsigned int i = 0; i < colors.size(); ++i)
 	{
 		sum[0] += colors[i]->red();
@@ -538,7 +541,7 @@ color_space::rgb_deepcolor * color_manipulation::color_calculation::average_rgb_
 {
 	if (colors.empty()) throw new std::invalid_argument("Parameter colors cannot be empty.");
 
-	auto sum = new float[4]{ 0.f, 0.f, 0.f, 0.f };
+	float sum[4] = { 0.f, 0.f, 0.f, 0.f };
 	for (unsigned int i = 0; i < colors.size(); ++i)
 	{
 		sum[0] += colors[i]->red();
@@ -553,7 +556,7 @@ color_space::grey_truecolor * color_manipulation::color_calculation::average_gre
 {
 	if (colors.empty()) throw new std::invalid_argument("Parameter colors cannot be empty.");
 
-	auto sum = new float[2]{ (unsigned int)0, (unsigned int)0 };
+	float sum[2] = { 0.f, 0.f };
 	for (unsigned int i = 0; i < colors.size(); ++i)
 	{
 		sum[0] += colors[i]->grey();
@@ -566,7 +569,7 @@ color_space::grey_deepcolor * color_manipulation::color_calculation::average_gre
 {
 	if (colors.empty()) throw new std::invalid_argument("Parameter colors cannot be empty.");
 
-	auto sum = new float[2]{ 0.f, 0.f };
+	float sum[2] = { 0.f, 0.f };
 	for (unsigned int i = 0; i < colors.size(); ++i)
 	{
 		sum[0] += colors[i]->grey();
@@ -579,7 +582,7 @@ color_space::cmyk * color_manipulation::color_calculation::average_cmyk(std::vec
 {
 	if (colors.empty()) throw new std::invalid_argument("Parameter colors cannot be empty.");
 
-	auto sum = new float[5]{ 0.f, 0.f, 0.f, 0.f, 0.f};
+	float sum[5] = { 0.f, 0.f, 0.f, 0.f, 0.f };
 	for (unsigned int i = 0; i < colors.size(); ++i)
 	{
 		sum[0] += colors[i]->cyan();
@@ -595,7 +598,7 @@ color_space::hsi * color_manipulation::color_calculation::average_hsi(std::vecto
 {
 	if (colors.empty()) throw new std::invalid_argument("Parameter colors cannot be empty.");
 
-	auto sum = new float[4]{ 0.f, 0.f, 0.f, 0.f };
+	float sum[4] = { 0.f, 0.f, 0.f, 0.f };
 	for (unsigned int i = 0; i < colors.size(); ++i)
 	{
 		sum[0] += colors[i]->hue();
@@ -610,7 +613,7 @@ color_space::hsv * color_manipulation::color_calculation::average_hsv(std::vecto
 {
 	if (colors.empty()) throw new std::invalid_argument("Parameter colors cannot be empty.");
 
-	auto sum = new float[4]{ 0.f, 0.f, 0.f, 0.f };
+	float sum[4] = { 0.f, 0.f, 0.f, 0.f };
 	for (unsigned int i = 0; i < colors.size(); ++i)
 	{
 		sum[0] += colors[i]->hue();
@@ -625,7 +628,7 @@ color_space::hsl * color_manipulation::color_calculation::average_hsl(std::vecto
 {
 	if (colors.empty()) throw new std::invalid_argument("Parameter colors cannot be empty.");
 
-	auto sum = new float[4]{ 0.f, 0.f, 0.f, 0.f };
+	float sum[4] = { 0.f, 0.f, 0.f, 0.f };
 	for (unsigned int i = 0; i < colors.size(); ++i)
 	{
 		sum[0] += colors[i]->hue();
@@ -640,7 +643,7 @@ color_space::hcy * color_manipulation::color_calculation::average_hcy(std::vecto
 {
 	if (colors.empty()) throw new std::invalid_argument("Parameter colors cannot be empty.");
 
-	auto sum = new float[4]{ 0.f, 0.f, 0.f, 0.f };
+	float sum[4] = { 0.f, 0.f, 0.f, 0.f };
 	for (unsigned int i = 0; i < colors.size(); ++i)
 	{
 		sum[0] += colors[i]->hue();
@@ -655,7 +658,7 @@ color_space::xyz * color_manipulation::color_calculation::average_xyz(std::vecto
 {
 	if (colors.empty()) throw new std::invalid_argument("Parameter colors cannot be empty.");
 
-	auto sum = new float[4]{ 0.f, 0.f, 0.f, 0.f };
+	float sum[4] = { 0.f, 0.f, 0.f, 0.f };
 	for (unsigned int i = 0; i < colors.size(); ++i)
 	{
 		sum[0] += colors[i]->x();
@@ -670,7 +673,7 @@ color_space::xyy * color_manipulation::color_calculation::average_xyy(std::vecto
 {
 	if (colors.empty()) throw new std::invalid_argument("Parameter colors cannot be empty.");
 
-	auto sum = new float[4]{ 0.f, 0.f, 0.f, 0.f };
+	float sum[4] = { 0.f, 0.f, 0.f, 0.f };
 	for (unsigned int i = 0; i < colors.size(); ++i)
 	{
 		sum[0] += colors[i]->x();
@@ -685,7 +688,7 @@ color_space::cieluv * color_manipulation::color_calculation::average_cieluv(std:
 {
 	if (colors.empty()) throw new std::invalid_argument("Parameter colors cannot be empty.");
 
-	auto sum = new float[4]{ 0.f, 0.f, 0.f, 0.f };
+	float sum[4] = { 0.f, 0.f, 0.f, 0.f };
 	for (unsigned int i = 0; i < colors.size(); ++i)
 	{
 		sum[0] += colors[i]->L();
@@ -700,7 +703,7 @@ color_space::lab * color_manipulation::color_calculation::average_lab(std::vecto
 {
 	if (colors.empty()) throw new std::invalid_argument("Parameter colors cannot be empty.");
 
-	auto sum = new float[4]{ 0.f, 0.f, 0.f, 0.f };
+	float sum[4] = { 0.f, 0.f, 0.f, 0.f };
 	for (unsigned int i = 0; i < colors.size(); ++i)
 	{
 		sum[0] += colors[i]->luminance();
@@ -715,7 +718,7 @@ color_space::lch_ab * color_manipulation::color_calculation::average_lch_ab(std:
 {
 	if (colors.empty()) throw new std::invalid_argument("Parameter colors cannot be empty.");
 
-	auto sum = new float[4]{ 0.f, 0.f, 0.f, 0.f };
+	float sum[4] = { 0.f, 0.f, 0.f, 0.f };
 	for (unsigned int i = 0; i < colors.size(); ++i)
 	{
 		sum[0] += colors[i]->luminance();
@@ -730,7 +733,7 @@ color_space::lch_uv * color_manipulation::color_calculation::average_lch_uv(std:
 {
 	if (colors.empty()) throw new std::invalid_argument("Parameter colors cannot be empty.");
 
-	auto sum = new float[4]{ 0.f, 0.f, 0.f, 0.f };
+	float sum[4] = { 0.f, 0.f, 0.f, 0.f };
 	for (unsigned int i = 0; i < colors.size(); ++i)
 	{
 		sum[0] += colors[i]->luminance();
@@ -756,4 +759,87 @@ float * color_manipulation::color_calculation::convert_from_vector(float * color
 	auto y = std::sqrtf(std::powf(color[0], 2.f) + std::powf(color[1], 2.f));
 	auto z = color[2];
 	return new float[3]{ (float)x, (float)y, (float)z };
-}
\ No newline at end of file
+}
+color_space::color_base * color_manipulation::color_calculation::average(const color_buffer & colors, bool include_alpha)
+{
+	return reduce_average(colors, nullptr, include_alpha);
+}
+
+color_space::color_base * color_manipulation::color_calculation::weighted_average(const color_buffer & colors, const std::vector<float>& weights, bool include_alpha)
+{
+	if (weights.size() != colors.size()) throw new std::invalid_argument("Parameter weights needs one weight per color.");
+
+	return reduce_average(colors, weights.data(), include_alpha);
+}
+
+color_space::color_base * color_manipulation::color_calculation::reduce_average(const color_buffer & colors, const float * weights, bool include_alpha)
+{
+	if (colors.empty()) throw new std::invalid_argument("Parameter colors cannot be empty.");
+
+	// Sums per chunk: one per channel, the sine and cosine of the hue and the total weight.
+	const size_t chunk_size = 16384;
+	const size_t channels = colors.channels();
+	const size_t sin_index = channels, cos_index = channels + 1, weight_index = channels + 2, sum_count = channels + 3;
+	const int hue = color_buffer::hue_component(colors.get_color_type());
+
+	std::vector<double> partial_sums(parallel::chunk_count(colors.size(), chunk_size) * sum_count, 0.0);
+	parallel::for_each_chunk(colors.size(), chunk_size, [&](size_t chunk, size_t begin, size_t end)
+	{
+		double sum[8] = { 0.0 }, compensation[8] = { 0.0 }, value[8];
+		for (size_t i = begin; i < end; ++i)
+		{
+			const float* pixel = colors.pixel(i);
+			double weight = weights == nullptr ? 1.0 : weights[i];
+			if (weight < 0.0) throw new std::invalid_argument("Parameter weights cannot contain negative weights.");
+
+			for (size_t c = 0; c < channels; ++c) value[c] = weight * pixel[c];
+			if (hue >= 0)
+			{
+				double angle = pixel[hue] * M_PI / 180.0;
+				value[sin_index] = weight * std::sin(angle);
+				value[cos_index] = weight * std::cos(angle);
+			}
+			else
+			{
+				value[sin_index] = value[cos_index] = 0.0;
+			}
+			value[weight_index] = weight;
+
+			for (size_t s = 0; s < sum_count; ++s)
+			{
+				double y = value[s] - compensation[s];
+				double t = sum[s] + y;
+				compensation[s] = (t - sum[s]) - y;
+				sum[s] = t;
+			}
+		}
+
+		std::copy(sum, sum + sum_count, partial_sums.begin() + chunk * sum_count);
+	});
+
+	// Pairwise combination of the chunk sums in a fixed order.
+	for (size_t step = 1; step * sum_count < partial_sums.size(); step *= 2)
+	{
+		for (size_t left = 0; (left + step) * sum_count < partial_sums.size(); left += 2 * step)
+		{
+			for (size_t s = 0; s < sum_count; ++s) partial_sums[left * sum_count + s] += partial_sums[(left + step) * sum_count + s];
+		}
+	}
+
+	double total_weight = partial_sums[weight_index];
+	if (total_weight <= 0.0) throw new std::invalid_argument("Parameter weights cannot be all 0.");
+
+	color_buffer result(colors.get_color_type(), colors.get_rgb_color_space(), 1);
+	float* mean = result.pixel(0);
+	for (size_t c = 0; c < channels; ++c) mean[c] = (float)(partial_sums[c] / total_weight);
+
+	if (hue >= 0)
+	{
+		double angle = std::atan2(partial_sums[sin_index], partial_sums[cos_index]) * 180.0 / M_PI;
+		mean[hue] = (float)(angle < 0.0 ? angle + 360.0 : angle);
+	}
+
+	if (!include_alpha) mean[result.alpha_channel()] = colors.pixel(0)[colors.alpha_channel()];
+
+	return result.create_color(0);
+}
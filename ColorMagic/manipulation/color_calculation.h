@@ -6,6 +6,7 @@
 #pragma once
 
 #include "..\spaces\color_base.h"
+#include "..\utils\color_buffer.h"
 #include "color_converter.h"
 
 namespace color_manipulation
@@ -717,6 +718,27 @@ namespace color_manipulation
 		*/
 		static color_space::lch_uv* average_lch_uv(std::vector<color_space::lch_uv*> colors, bool include_alpha = false);
 
+		//! Static function that averages a buffer of colors of any color type.
+		/*!
+		* Hue components (hsi, hsv, hsl, hcy, lch_ab and lch_uv) are averaged as angles, so 350 and 10 degrees average to 0 degrees.
+		* The buffer is summed in chunks of a fixed size on all cores using Kahan summation in double precision. The chunk sums are
+		* combined pairwise in chunk order, so the result does not depend on the number of threads.
+		* \param colors The colors to average.
+		* \param include_alpha Whether alpha should be included in the calculation or not.
+		* \return a new color object of the buffers color type with the resulting color of this calculation.
+		*/
+		static color_space::color_base* average(const color_buffer& colors, bool include_alpha = false);
+
+		//! Static function that computes the weighted average of a buffer of colors of any color type.
+		/*!
+		* Works like average() but every color contributes according to its weight.
+		* \param colors The colors to average.
+		* \param weights One weight >= 0 per color, the weights must not all be 0.
+		* \param include_alpha Whether alpha should be included in the calculation or not.
+		* \return a new color object of the buffers color type with the resulting color of this calculation.
+		*/
+		static color_space::color_base* weighted_average(const color_buffer& colors, const std::vector<float>& weights, bool include_alpha = false);
+
 	private:
 		//! Converts a hsl or hsv color to a vector.
 		/*!
@@ -733,5 +755,8 @@ namespace color_manipulation
 		* \return The hsl or hsv color as float array.
 		*/
 		static float* convert_from_vector(float* color);
+
+		//! Averages a buffer of colors, weights may be nullptr to weight all colors equally.
+		static color_space::color_base* reduce_average(const color_buffer& colors, const float* weights, bool include_alpha);
 	};
 }
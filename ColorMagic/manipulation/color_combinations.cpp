@@ -1,9 +1,16 @@
 #include "stdafx.h"
 #include "color_combinations.h"
+#include "..\utils\parallel.h"
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
 
 color_space::color_base * color_manipulation::color_combinations::create_complimentary(color_space::color_base * color)
 {
-	return create_combination(color, 2)[1];
+	auto combination = create_combination(color, 2);
+	delete combination[0];
+	return combination[1];
 }
 
 std::vector<color_space::color_base*> color_manipulation::color_combinations::create_triplet(color_space::color_base * color)
@@ -23,21 +30,19 @@ std::vector<color_space::color_base*> color_manipulation::color_combinations::cr
 
 std::vector<color_space::color_base*> color_manipulation::color_combinations::create_combination(color_space::color_base * color, int number_of_colors)
 {
-	if (number_of_colors == 0) throw new std::invalid_argument("A color combination with 0 colors in it is invalid. Chose a color count >= 2");
-	if (number_of_colors == 1) throw new std::invalid_argument("A color combination with 1 colors in it is invalid since it would just return the input color. Chose a color count >= 2");
-	if (number_of_colors > 360) throw new std::invalid_argument("A color combination with more than 360 colors is invalid.");
+	check_combination(number_of_colors);
 
 	std::vector<color_space::color_base*> combination;
-	combination.push_back(color);
+	combination.push_back(color_manipulation::color_converter::create_converted(*color, color->get_color_type()));
 
 	//number_of_colors = max(min(360, number_of_colors), 2); // Using exceptions instead of clamp. Maybe change back to clamp? I am unsure
 	auto degrees = 360.f / number_of_colors;
-	auto color_hsl = static_cast<color_space::hsl*>(color_manipulation::color_converter::convertTo(color, color_type::HSL));
+	auto color_hsl = color_manipulation::color_converter::to_hsl(*color);
 
 	for (auto i = 1; i <= number_of_colors - 1; ++i)
 	{
-		auto new_color = new color_space::hsl(color_hsl->hue() + (i * degrees), color_hsl->saturation(), color_hsl->lightness(), color->alpha(), color->get_rgb_color_space());
-		combination.push_back(color_manipulation::color_converter::convertTo(new_color, color->get_color_type()));
+		color_space::hsl new_color(color_hsl.hue() + (i * degrees), color_hsl.saturation(), color_hsl.lightness(), color->alpha(), color->get_rgb_color_space());
+		combination.push_back(color_manipulation::color_converter::create_converted(new_color, color->get_color_type()));
 	}
 
 	return combination;
@@ -45,47 +50,31 @@ std::vector<color_space::color_base*> color_manipulation::color_combinations::cr
 
 std::vector<color_space::color_base*> color_manipulation::color_combinations::create_analogous(color_space::color_base * base_color, float distance_between)
 {
-	if (distance_between == 0.f) throw new std::invalid_argument("The distance between the analogous color can not be 0.");
-	if (distance_between > 360.f / 3.f) throw new std::invalid_argument("The distance can not be greater than 120 degrees.");
+	check_analogous(distance_between);
 
 	std::vector<color_space::color_base*> triplet;
-	auto color_hsl = static_cast<color_space::hsl*>(color_manipulation::color_converter::convertTo(base_color, color_type::HSL));
+	auto color_hsl = color_manipulation::color_converter::to_hsl(*base_color);
 
-	triplet.push_back(color_manipulation::color_converter::convertTo(new color_space::hsl(color_hsl->hue() - distance_between, color_hsl->saturation(), color_hsl->lightness(), base_color->alpha(), base_color->get_rgb_color_space()), base_color->get_color_type()));
-	triplet.push_back(base_color);
-	triplet.push_back(color_manipulation::color_converter::convertTo(new color_space::hsl(color_hsl->hue() + distance_between, color_hsl->saturation(), color_hsl->lightness(), base_color->alpha(), base_color->get_rgb_color_space()), base_color->get_color_type()));
+	triplet.push_back(color_manipulation::color_converter::create_converted(color_space::hsl(color_hsl.hue() - distance_between, color_hsl.saturation(), color_hsl.lightness(), base_color->alpha(), base_color->get_rgb_color_space()), base_color->get_color_type()));
+	triplet.push_back(color_manipulation::color_converter::create_converted(*base_color, base_color->get_color_type()));
+	triplet.push_back(color_manipulation::color_converter::create_converted(color_space::hsl(color_hsl.hue() + distance_between, color_hsl.saturation(), color_hsl.lightness(), base_color->alpha(), base_color->get_rgb_color_space()), base_color->get_color_type()));
 
 	return triplet;
 }
 
 std::vector<color_space::color_base*> color_manipulation::color_combinations::create_monochromatic(color_space::color_base * base_color, int mode, float amount, int color_count)
 {
-	if (amount < 0.f) throw new std::invalid_argument("The amount of saturation/lightness in percent between two resulting colors can not be less than 0.");
-	if (amount > 1.f) throw new std::invalid_argument("The amount of saturation/lightness in percent between two resulting colors can not be greater than 1.");
-	if (color_count <= 0) throw new std::invalid_argument("The number of resulting colors must be greater than 0.");
+	const auto factors = monochromatic_factors(mode, amount, color_count);
 
 	std::vector<color_space::color_base*> combination;
-	combination.push_back(base_color);
-	auto in_color_type = base_color->get_color_type();
+	combination.push_back(color_manipulation::color_converter::create_converted(*base_color, base_color->get_color_type()));
 
-	amount *= -1.f; // negative amounts decrease saturation/lightness of colors by using saturate/luminate functions.
-	for (int i = 0; i < color_count - 1; ++i) // -1 because the first color is the input color
+	// Step i scales the base saturation and/or lightness by (1 - amount)^i.
+	auto color_hsl = color_manipulation::color_converter::to_hsl(*base_color);
+	for (int i = 1; i < color_count; ++i)
 	{
-		auto last_hsl = static_cast<color_space::hsl*>(color_manipulation::color_converter::convertTo(combination[combination.size() - 1], color_type::HSL));
-		switch (mode)
-		{
-		case 0:
-			combination.push_back(color_converter::convertTo(color_adjustments::saturate_in_hsl_space(new color_space::hsl(last_hsl->hue(), last_hsl->saturation(), last_hsl->lightness(), base_color->alpha(), base_color->get_rgb_color_space()), amount), in_color_type));
-			break;
-		case 1:
-			combination.push_back(color_converter::convertTo(color_adjustments::luminate_in_hsl_space(new color_space::hsl(last_hsl->hue(), last_hsl->saturation(), last_hsl->lightness(), base_color->alpha(), base_color->get_rgb_color_space()), amount), in_color_type));
-			break;
-		case 2:
-			combination.push_back(color_converter::convertTo(color_adjustments::luminate_in_hsl_space(color_adjustments::saturate_in_hsl_space(new color_space::hsl(last_hsl->hue(), last_hsl->saturation(), last_hsl->lightness(), base_color->alpha(), base_color->get_rgb_color_space()), amount), amount), in_color_type));
-			break;
-		default:
-			throw new std::invalid_argument("Invalid mode.");;
-		}
+		color_space::hsl next_hsl(color_hsl.hue(), color_hsl.saturation() * factors[i].first, color_hsl.lightness() * factors[i].second, base_color->alpha(), base_color->get_rgb_color_space());
+		combination.push_back(color_converter::create_converted(next_hsl, base_color->get_color_type()));
 	}
 
 	return combination;
@@ -93,14 +82,175 @@ std::vector<color_space::color_base*> color_manipulation::color_combinations::cr
 
 std::vector<color_space::color_base*> color_manipulation::color_combinations::create_complimentary_split(color_space::color_base * base_color, float amount)
 {
+	check_analogous(amount);
+
 	std::vector<color_space::color_base*> complimentary;
-	auto color_hsl = static_cast<color_space::hsl*>(color_manipulation::color_converter::convertTo(base_color, color_type::HSL));
+	auto color_hsl = color_manipulation::color_converter::to_hsl(*base_color);
 
-	auto complimentary_color = color_manipulation::color_combinations::create_complimentary(base_color);
-	auto analogous_colors = color_manipulation::color_combinations::create_analogous(complimentary_color, amount);
-	complimentary.push_back(analogous_colors[0]);
-	complimentary.push_back(base_color);
-	complimentary.push_back(analogous_colors[2]);
+	complimentary.push_back(color_manipulation::color_converter::create_converted(color_space::hsl(color_hsl.hue() + 180.f - amount, color_hsl.saturation(), color_hsl.lightness(), base_color->alpha(), base_color->get_rgb_color_space()), base_color->get_color_type()));
+	complimentary.push_back(color_manipulation::color_converter::create_converted(*base_color, base_color->get_color_type()));
+	complimentary.push_back(color_manipulation::color_converter::create_converted(color_space::hsl(color_hsl.hue() + 180.f + amount, color_hsl.saturation(), color_hsl.lightness(), base_color->alpha(), base_color->get_rgb_color_space()), base_color->get_color_type()));
 
 	return complimentary;
 }
+
+void color_manipulation::color_combinations::create_harmonies(const color_buffer & base_colors, const std::vector<float>& hue_offsets, color_buffer & result, harmony_space space)
+{
+	const size_t count = hue_offsets.size();
+	if (result.size() != base_colors.size() * count) throw new std::invalid_argument("The result buffer must have room for all colors of all harmonies.");
+	if (space != HARMONY_HSL && space != HARMONY_LCH_AB) throw new std::invalid_argument("The harmony space is not defined.");
+
+	const color_type base_type = base_colors.get_color_type(), result_type = result.get_color_type();
+	const color_type hue_type = space == HARMONY_HSL ? color_type::HSL : color_type::LAB;
+	auto rgb_color_space = base_colors.get_rgb_color_space();
+
+	// A hue rotation in lch_ab is a rotation of a and b.
+	std::vector<float> cosines(count), sines(count);
+	for (size_t j = 0; j < count; ++j)
+	{
+		const float angle = hue_offsets[j] * (float)M_PI / 180.f;
+		cosines[j] = std::cos(angle);
+		sines[j] = std::sin(angle);
+	}
+
+	parallel::for_each_chunk(base_colors.size(), 4096, [&](size_t chunk, size_t begin, size_t end)
+	{
+		float base[5], rotated[5];
+		for (size_t i = begin; i < end; ++i)
+		{
+			const float* color = base_colors.pixel(i);
+			color_converter::convert_values(base_type, color, rgb_color_space, hue_type, base);
+
+			for (size_t j = 0; j < count; ++j)
+			{
+				float* out = result.pixel(i * count + j);
+				if (hue_offsets[j] == 0.f)
+				{
+					color_converter::convert_values(base_type, color, rgb_color_space, result_type, out);
+					continue;
+				}
+
+				std::copy(base, base + 4, rotated);
+				if (space == HARMONY_HSL)
+				{
+					rotated[0] += hue_offsets[j];
+				}
+				else
+				{
+					rotated[1] = base[1] * cosines[j] - base[2] * sines[j];
+					rotated[2] = base[1] * sines[j] + base[2] * cosines[j];
+				}
+				color_converter::convert_values(hue_type, rotated, rgb_color_space, result_type, out);
+			}
+		}
+	});
+}
+
+void color_manipulation::color_combinations::create_monochromatic(const color_buffer & base_colors, int mode, float amount, int color_count, color_buffer & result, harmony_space space)
+{
+	const auto factors = monochromatic_factors(mode, amount, color_count);
+	const size_t count = factors.size();
+	if (result.size() != base_colors.size() * count) throw new std::invalid_argument("The result buffer must have room for all colors of all monochromatic sets.");
+	if (space != HARMONY_HSL && space != HARMONY_LCH_AB) throw new std::invalid_argument("The harmony space is not defined.");
+
+	// In lch_ab the chroma takes the place of the saturation, scaling it scales a and b.
+	const color_type base_type = base_colors.get_color_type(), result_type = result.get_color_type();
+	const color_type step_type = space == HARMONY_HSL ? color_type::HSL : color_type::LAB;
+	auto rgb_color_space = base_colors.get_rgb_color_space();
+
+	parallel::for_each_chunk(base_colors.size(), 4096, [&](size_t chunk, size_t begin, size_t end)
+	{
+		float base[5], step[5];
+		for (size_t i = begin; i < end; ++i)
+		{
+			const float* color = base_colors.pixel(i);
+			color_converter::convert_values(base_type, color, rgb_color_space, result_type, result.pixel(i * count));
+			color_converter::convert_values(base_type, color, rgb_color_space, step_type, base);
+
+			for (size_t j = 1; j < count; ++j)
+			{
+				const float saturation = factors[j].first, lightness = factors[j].second;
+				if (space == HARMONY_HSL)
+				{
+					step[0] = base[0];
+					step[1] = base[1] * saturation;
+					step[2] = base[2] * lightness;
+				}
+				else
+				{
+					step[0] = base[0] * lightness;
+					step[1] = base[1] * saturation;
+					step[2] = base[2] * saturation;
+				}
+				step[3] = base[3];
+				color_converter::convert_values(step_type, step, rgb_color_space, result_type, result.pixel(i * count + j));
+			}
+		}
+	});
+}
+
+void color_manipulation::color_combinations::create_combination(const color_buffer & base_colors, int number_of_colors, color_buffer & result, harmony_space space)
+{
+	create_harmonies(base_colors, combination_offsets(number_of_colors), result, space);
+}
+
+void color_manipulation::color_combinations::create_analogous(const color_buffer & base_colors, float distance_between, color_buffer & result, harmony_space space)
+{
+	create_harmonies(base_colors, analogous_offsets(distance_between), result, space);
+}
+
+void color_manipulation::color_combinations::create_complimentary_split(const color_buffer & base_colors, float amount, color_buffer & result, harmony_space space)
+{
+	create_harmonies(base_colors, complimentary_split_offsets(amount), result, space);
+}
+
+std::vector<float> color_manipulation::color_combinations::combination_offsets(int number_of_colors)
+{
+	check_combination(number_of_colors);
+
+	std::vector<float> offsets;
+	const float degrees = 360.f / number_of_colors;
+	for (int i = 0; i < number_of_colors; ++i) offsets.push_back(i * degrees);
+	return offsets;
+}
+
+std::vector<float> color_manipulation::color_combinations::analogous_offsets(float distance_between)
+{
+	check_analogous(distance_between);
+	return { -distance_between, 0.f, distance_between };
+}
+
+std::vector<float> color_manipulation::color_combinations::complimentary_split_offsets(float amount)
+{
+	check_analogous(amount);
+	return { 180.f - amount, 0.f, 180.f + amount };
+}
+
+void color_manipulation::color_combinations::check_combination(int number_of_colors)
+{
+	if (number_of_colors == 0) throw new std::invalid_argument("A color combination with 0 colors in it is invalid. Chose a color count >= 2");
+	if (number_of_colors == 1) throw new std::invalid_argument("A color combination with 1 colors in it is invalid since it would just return the input color. Chose a color count >= 2");
+	if (number_of_colors > 360) throw new std::invalid_argument("A color combination with more than 360 colors is invalid.");
+}
+
+std::vector<std::pair<float, float>> color_manipulation::color_combinations::monochromatic_factors(int mode, float amount, int color_count)
+{
+	if (amount < 0.f) throw new std::invalid_argument("The amount of saturation/lightness in percent between two resulting colors can not be less than 0.");
+	if (amount > 1.f) throw new std::invalid_argument("The amount of saturation/lightness in percent between two resulting colors can not be greater than 1.");
+	if (color_count <= 0) throw new std::invalid_argument("The number of resulting colors must be greater than 0.");
+	if (mode < 0 || mode > 2) throw new std::invalid_argument("Invalid mode.");
+
+	std::vector<std::pair<float, float>> factors;
+	for (int i = 0; i < color_count; ++i)
+	{
+		const float factor = std::pow(1.f - amount, (float)i);
+		factors.push_back(std::make_pair(mode != 1 ? factor : 1.f, mode != 0 ? factor : 1.f));
+	}
+	return factors;
+}
+
+void color_manipulation::color_combinations::check_analogous(float distance_between)
+{
+	if (distance_between == 0.f) throw new std::invalid_argument("The distance between the analogous color can not be 0.");
+	if (distance_between > 360.f / 3.f) throw new std::invalid_argument("The distance can not be greater than 120 degrees.");
+}
@@ -8,10 +8,19 @@
 #include "..\spaces\color_base.h"
 #include "color_converter.h"
 #include "color_adjustments.h"
+#include "..\utils\color_buffer.h"
+#include <utility>
 #include <vector>
 
 namespace color_manipulation
 {
+	//! Enum that defines the color space in which the batch functions of color_combinations rotate the hue.
+	enum harmony_space
+	{
+		HARMONY_HSL = 0, /*!< HARMONY_HSL - rotates the hue in hsl like the functions for single colors */
+		HARMONY_LCH_AB /*!< HARMONY_LCH_AB - rotates the hue in lch_ab, which keeps lightness and chroma and gives perceptually even steps */
+	};
+
 	//! Static class for creating color combinations.
 		/*!
 		* This static class implements various functions that create sets of colors.
@@ -24,7 +33,7 @@ namespace color_manipulation
 		* This function converts the given color to hsl space and adds 180 degress to its hue. 
 		* Afterwards it converts the new color back to input color space.
 		* \param color The color to create the opposite of.
-		* \return The complimentary color.
+		* \return The complimentary color. The color is a new object owned by the caller.
 		*/
 		static color_space::color_base* create_complimentary(color_space::color_base* color);
 
@@ -33,7 +42,7 @@ namespace color_manipulation
 		* This function converts the given color to hsl space and adds two times 120 degrees to its hue.
 		* Afterwards it converts the new colors back to input color space.
 		* \param color The base color for the triplet.
-		* \return A vector containing all three colors. The input color is at index 0.
+		* \return A vector containing all three colors. A copy of the input color is at index 0. All colors are new objects owned by the caller.
 		*/
 		static std::vector<color_space::color_base*> create_triplet(color_space::color_base* color);
 
@@ -42,7 +51,7 @@ namespace color_manipulation
 		* This function converts the given color to hsl space and adds three times 90 degrees to its hue.
 		* Afterwards it converts the new colors back to input color space.
 		* \param color The base color for the triplet.
-		* \return A vector containing all four colors. The input color is at index 0.
+		* \return A vector containing all four colors. A copy of the input color is at index 0. All colors are new objects owned by the caller.
 		*/
 		static std::vector<color_space::color_base*> create_quartet(color_space::color_base* color);
 
@@ -51,7 +60,7 @@ namespace color_manipulation
 		* This function converts the given color to hsl space and adds four times 72 degrees to its hue.
 		* Afterwards it converts the new colors back to input color space.
 		* \param color The base color for the triplet.
-		* \return A vector containing all five colors. The input color is at index 0.
+		* \return A vector containing all five colors. A copy of the input color is at index 0. All colors are new objects owned by the caller.
 		*/
 		static std::vector<color_space::color_base*> create_quintet(color_space::color_base* color);
 
@@ -61,7 +70,7 @@ namespace color_manipulation
 		* Afterwards it converts the new colors back to input color space.
 		* \param color The base color for the triplet.
 		* \param number_of_elements The number of colors in the combination to create.
-		* \return A vector containing all colors. The input color is at index 0.
+		* \return A vector containing all colors. A copy of the input color is at index 0. All colors are new objects owned by the caller.
 		*/
 		static std::vector<color_space::color_base*> create_combination(color_space::color_base* color, int number_of_elements);
 
@@ -71,30 +80,91 @@ namespace color_manipulation
 		* Afterwards it converts the new colors back to input color space.
 		* \param color The base color for the triplet (will be the second color in the result vector).
 		* \param distance_between The hue distance in degrees between the three analogous colors.
-		* \return A vector containing all three colors. The input color is at index 1.
+		* \return A vector containing all three colors. A copy of the input color is at index 1. All colors are new objects owned by the caller.
 		*/
 		static std::vector<color_space::color_base*> create_analogous(color_space::color_base* base_color, float distance_between);
 
 		//! Static function that returns an set of monochromatic colors.
 		/*!
 		* This function converts the given color to hsl space and calculates the desired amount of monochromatic colors.
+		* Color i scales the saturation and/or lightness of the base color by (1 - amount)^i.
 		* Afterwards it converts the new colors back to input color space.
 		* \param base_color The base color for the monochromatic set (will be the first color in the result vector).
 		* \param mode The mode to use. 0 for saturation only, 1 for lightness only and 2 for both.
 		* \param amount The distance in percent between two colors (use positive numbers between 0 and 1).
 		* \param color_count The number of colors to create (including the input color).
-		* \return A vector containing all colors. The input color is at index 0.
+		* \return A vector containing all colors. A copy of the input color is at index 0. All colors are new objects owned by the caller.
 		*/
 		static std::vector<color_space::color_base*> create_monochromatic(color_space::color_base* base_color, int mode, float amount, int color_count);
 
 		//! Static function that returns an set by creating a combination of complimentary and analogous colors.
 		/*!
-		* This function converts the given color to hsl space and first calculates the complimentary color. Then the 
-		* two analogous colors are created. Afterwards the analogous colors are converted back to input color space.
+		* This function converts the given color to hsl space and calculates the two analogous colors of the complimentary
+		* color. Afterwards the analogous colors are converted back to input color space.
 		* \param base_color The base color for the complimentary split (will be the second color in the result vector).
 		* \param amount The hue distance in degrees between the analogous colors
-		* \return A vector containing the three colors. The input color is at index 1.
+		* \return A vector containing the three colors. A copy of the input color is at index 1. All colors are new objects owned by the caller.
 		*/
 		static std::vector<color_space::color_base*> create_complimentary_split(color_space::color_base* base_color, float amount);
+
+		//! Static function that creates color harmonies for many base colors at once.
+		/*!
+		* Every base color is converted once to hsl (or lab), all hue rotations are applied and the results are converted
+		* directly into the result buffer. The base colors are processed in chunks on all cores, no color object is allocated.
+		* In HARMONY_LCH_AB the rotation turns a and b of lab, so no trigonometric function is evaluated per color.
+		* \param base_colors The base colors, any color type.
+		* \param hue_offsets The hue offsets in degrees of the colors of one harmony, an offset of 0 copies the base color.
+		* \param result Receives the harmonies one after another, hue_offsets.size() colors per base color. The buffer must have
+		* this size, its color type is the type of the created colors and can differ from the type of the base colors.
+		* \param space The color space in which the hue is rotated.
+		*/
+		static void create_harmonies(const color_buffer& base_colors, const std::vector<float>& hue_offsets, color_buffer& result, harmony_space space = HARMONY_HSL);
+
+		//! Static function that creates a color combination for many base colors at once.
+		/*!
+		* The batch version of create_combination(), see create_harmonies().
+		*/
+		static void create_combination(const color_buffer& base_colors, int number_of_colors, color_buffer& result, harmony_space space = HARMONY_HSL);
+
+		//! Static function that creates sets of monochromatic colors for many base colors at once.
+		/*!
+		* The batch version of create_monochromatic(). Every step is computed directly from the base color, step i scales
+		* the saturation and/or lightness by (1 - amount)^i. The base colors are converted once and processed in chunks on
+		* all cores, no color object is allocated.
+		* \param base_colors The base colors, any color type.
+		* \param mode 0 for saturation only, 1 for lightness only and 2 for both.
+		* \param amount The distance in percent between two colors (use positive numbers between 0 and 1).
+		* \param color_count The number of colors per set (including the base color).
+		* \param result Receives the sets one after another, color_count colors per base color. The buffer must have this
+		* size, its color type is the type of the created colors.
+		* \param space HARMONY_HSL scales saturation and lightness, HARMONY_LCH_AB scales chroma and L*.
+		*/
+		static void create_monochromatic(const color_buffer& base_colors, int mode, float amount, int color_count, color_buffer& result, harmony_space space = HARMONY_HSL);
+
+		//! Static function that creates analogous color triplets for many base colors at once.
+		/*!
+		* The batch version of create_analogous(), see create_harmonies(). The base color is the second color of each triplet.
+		*/
+		static void create_analogous(const color_buffer& base_colors, float distance_between, color_buffer& result, harmony_space space = HARMONY_HSL);
+
+		//! Static function that creates complimentary splits for many base colors at once.
+		/*!
+		* The batch version of create_complimentary_split(), see create_harmonies(). The base color is the second color of each triplet.
+		*/
+		static void create_complimentary_split(const color_buffer& base_colors, float amount, color_buffer& result, harmony_space space = HARMONY_HSL);
+
+		//! Returns the hue offsets of create_combination().
+		static std::vector<float> combination_offsets(int number_of_colors);
+
+		//! Returns the hue offsets of create_analogous().
+		static std::vector<float> analogous_offsets(float distance_between);
+
+		//! Returns the hue offsets of create_complimentary_split().
+		static std::vector<float> complimentary_split_offsets(float amount);
+
+	private:
+		static void check_combination(int number_of_colors);
+		static void check_analogous(float distance_between);
+		static std::vector<std::pair<float, float>> monochromatic_factors(int mode, float amount, int color_count);
 	};
 }
\ No newline at end of file
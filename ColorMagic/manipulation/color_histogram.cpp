@@ -0,0 +1,208 @@
+#include "stdafx.h"
+#include "color_histogram.h"
+#include "..\utils\parallel.h"
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <mutex>
+
+namespace
+{
+	void default_range(color_type type, size_t component, float& minimum, float& maximum)
+	{
+		minimum = 0.f;
+		maximum = 1.f;
+		switch (type)
+		{
+		case color_type::RGB_TRUE:
+		case color_type::GREY_TRUE:
+			maximum = 255.f;
+			break;
+		case color_type::RGB_DEEP:
+		case color_type::GREY_DEEP:
+		case color_type::CMYK:
+			break;
+		case color_type::HSI:
+		case color_type::HSV:
+		case color_type::HSL:
+		case color_type::HCY:
+			if (component == 0) maximum = 360.f;
+			break;
+		case color_type::LAB:
+			if (component == 0) maximum = 100.f;
+			else { minimum = -128.f; maximum = 128.f; }
+			break;
+		case color_type::LCH_AB:
+		case color_type::LCH_UV:
+			maximum = component == 2 ? 360.f : 100.f;
+			break;
+		default:
+			throw new std::invalid_argument("The color type has no default histogram range, explicit ranges are needed.");
+		}
+	}
+}
+
+color_manipulation::color_histogram::color_histogram(color_type type, const std::vector<size_t>& bins, color_space::rgb_color_space_definition * rgb_color_space)
+	: color_histogram(type, bins, std::vector<float>(), std::vector<float>(), rgb_color_space)
+{
+}
+
+color_manipulation::color_histogram::color_histogram(color_type type, const std::vector<size_t>& bins, const std::vector<float>& minimum, const std::vector<float>& maximum, color_space::rgb_color_space_definition * rgb_color_space)
+	: m_type(type), m_rgb_color_space(rgb_color_space), m_components(color_buffer::component_count(type)), m_hue(color_buffer::hue_component(type)), m_bins(bins), m_minimum(minimum), m_maximum(maximum), m_total(0)
+{
+	if (type == color_type::UNDEFINED) throw new std::invalid_argument("A color histogram needs a defined color type.");
+	if (bins.size() != m_components) throw new std::invalid_argument("The number of bins has to be given for every component of the color type.");
+
+	if (m_minimum.empty() && m_maximum.empty())
+	{
+		m_minimum.resize(m_components);
+		m_maximum.resize(m_components);
+		for (size_t c = 0; c < m_components; ++c) default_range(type, c, m_minimum[c], m_maximum[c]);
+	}
+	if (m_minimum.size() != m_components || m_maximum.size() != m_components) throw new std::invalid_argument("The range has to be given for every component of the color type.");
+
+	size_t size = 1;
+	for (size_t c = 0; c < m_components; ++c)
+	{
+		if (m_bins[c] == 0) throw new std::invalid_argument("Every component needs at least one bin.");
+		if (!(m_maximum[c] > m_minimum[c])) throw new std::invalid_argument("The maximum of a component has to be greater than its minimum.");
+		size *= m_bins[c];
+	}
+	m_counts.assign(size, 0);
+}
+
+void color_manipulation::color_histogram::add(const color_space::color_base & color)
+{
+	float values[5];
+	if (color.get_color_type() == m_type)
+	{
+		std::copy(color.get_components().begin(), color.get_components().end(), values);
+	}
+	else
+	{
+		std::unique_ptr<color_space::color_base> converted(color_converter::create_converted(color, m_type));
+		std::copy(converted->get_components().begin(), converted->get_components().end(), values);
+	}
+
+	++m_counts[bin_index(values)];
+	++m_total;
+}
+
+void color_manipulation::color_histogram::add(const color_buffer & colors)
+{
+	const color_type in_type = colors.get_color_type();
+	const bool convert = in_type != m_type;
+	std::mutex merge_mutex;
+
+	parallel::for_each_chunk(colors.size(), 65536, [&](size_t chunk, size_t begin, size_t end)
+	{
+		// Private histogram of the chunk, merged once at the end.
+		std::vector<uint64_t> counts(m_counts.size(), 0);
+		float values[5];
+		for (size_t i = begin; i < end; ++i)
+		{
+			if (convert)
+			{
+				color_converter::convert_values(in_type, colors.pixel(i), colors.get_rgb_color_space(), m_type, values);
+				++counts[bin_index(values)];
+			}
+			else
+			{
+				++counts[bin_index(colors.pixel(i))];
+			}
+		}
+
+		std::lock_guard<std::mutex> lock(merge_mutex);
+		for (size_t b = 0; b < counts.size(); ++b) m_counts[b] += counts[b];
+	});
+
+	m_total += colors.size();
+}
+
+void color_manipulation::color_histogram::merge(const color_histogram & other)
+{
+	check_compatible(other);
+
+	for (size_t b = 0; b < m_counts.size(); ++b) m_counts[b] += other.m_counts[b];
+	m_total += other.m_total;
+}
+
+void color_manipulation::color_histogram::clear()
+{
+	std::fill(m_counts.begin(), m_counts.end(), 0);
+	m_total = 0;
+}
+
+size_t color_manipulation::color_histogram::bin_index(const float * values) const
+{
+	size_t index = 0;
+	for (size_t c = 0; c < m_components; ++c)
+	{
+		const float range = m_maximum[c] - m_minimum[c];
+		float position = (values[c] - m_minimum[c]) / range;
+		if ((int)c == m_hue) position -= std::floor(position);
+
+		long long bin = (long long)(position * m_bins[c]);
+		if (bin < 0 || position != position) bin = 0;
+		if (bin >= (long long)m_bins[c]) bin = m_bins[c] - 1;
+
+		index = index * m_bins[c] + (size_t)bin;
+	}
+	return index;
+}
+
+color_space::color_base * color_manipulation::color_histogram::bin_center(size_t bin) const
+{
+	if (bin >= m_counts.size()) throw new std::out_of_range("The bin index is out of range.");
+
+	color_buffer result(m_type, m_rgb_color_space, 1);
+	float* values = result.pixel(0);
+	for (size_t c = m_components; c-- > 0;)
+	{
+		const size_t component_bin = bin % m_bins[c];
+		bin /= m_bins[c];
+		values[c] = m_minimum[c] + (component_bin + 0.5f) * (m_maximum[c] - m_minimum[c]) / m_bins[c];
+	}
+	values[m_components] = (m_type == color_type::RGB_TRUE || m_type == color_type::GREY_TRUE) ? 255.f : 1.f;
+
+	return result.create_color(0);
+}
+
+std::vector<size_t> color_manipulation::color_histogram::dominant_bins(size_t count) const
+{
+	std::vector<size_t> bins;
+	for (size_t b = 0; b < m_counts.size(); ++b)
+	{
+		if (m_counts[b] > 0) bins.push_back(b);
+	}
+
+	count = std::min(count, bins.size());
+	std::partial_sort(bins.begin(), bins.begin() + count, bins.end(), [this](size_t a, size_t b)
+	{
+		return m_counts[a] != m_counts[b] ? m_counts[a] > m_counts[b] : a < b;
+	});
+	bins.resize(count);
+	return bins;
+}
+
+float color_manipulation::color_histogram::intersection(const color_histogram & first, const color_histogram & second)
+{
+	first.check_compatible(second);
+	if (first.m_total == 0 || second.m_total == 0) return 0.f;
+
+	double sum = 0.0;
+	for (size_t b = 0; b < first.m_counts.size(); ++b)
+	{
+		sum += std::min(first.m_counts[b] / (double)first.m_total, second.m_counts[b] / (double)second.m_total);
+	}
+	return (float)sum;
+}
+
+void color_manipulation::color_histogram::check_compatible(const color_histogram & other) const
+{
+	if (other.m_type != m_type || other.m_bins != m_bins || other.m_minimum != m_minimum || other.m_maximum != m_maximum)
+	{
+		throw new std::invalid_argument("Only histograms with the same color type, bins and ranges can be combined.");
+	}
+}
@@ -0,0 +1,129 @@
+/// Copyright Martin Ruehlicke, 2019
+/// Use, modification and distribution are subject to the
+/// MIT Software License, Version 1.0.
+/// See accompanying file LICENSE.txt
+
+#pragma once
+
+#include "..\spaces\color_base.h"
+#include "..\utils\color_buffer.h"
+#include "color_converter.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace color_manipulation
+{
+	//! Multi-dimensional histogram of colors in an arbitrary color type.
+	/*!
+	* Every component axis of the color type is split into a configurable number of equally sized bins, alpha is not binned.
+	* Buffers are binned on all cores with one private histogram per chunk, the private histograms are merged at the end.
+	* Buffers of another color type are converted pixel by pixel while binning, the converted buffer is never stored.
+	* Hue components wrap around, all other values outside of the range are counted in the first or last bin.
+	*/
+	class color_histogram
+	{
+	public:
+		//! Constructor with the default range of every component.
+		/*!
+		* The default ranges are 0-255 for rgb/grey true color, 0-360 for hues, 0-100 for L and C of lab, lch_ab and
+		* lch_uv, -128-128 for a and b of lab and 0-1 for all other components of rgb/grey deep color, cmyk, hsi, hsv,
+		* hsl and hcy. Other color types need explicit ranges.
+		* \param type The color type in which the colors are binned.
+		* \param bins The number of bins of every component.
+		* \param rgb_color_space The rgb color space definition of the binned colors.
+		*/
+		color_histogram(color_type type, const std::vector<size_t>& bins, color_space::rgb_color_space_definition* rgb_color_space);
+
+		//! Constructor with explicit ranges.
+		/*!
+		* \param type The color type in which the colors are binned.
+		* \param bins The number of bins of every component.
+		* \param minimum The lower bound of every component.
+		* \param maximum The upper bound of every component.
+		* \param rgb_color_space The rgb color space definition of the binned colors.
+		*/
+		color_histogram(color_type type, const std::vector<size_t>& bins, const std::vector<float>& minimum, const std::vector<float>& maximum, color_space::rgb_color_space_definition* rgb_color_space);
+
+		//! Adds a color.
+		/*!
+		* Colors of another color type are converted first.
+		*/
+		void add(const color_space::color_base& color);
+
+		//! Adds all colors of a buffer.
+		/*!
+		* Buffers of another color type are converted while binning.
+		*/
+		void add(const color_buffer& colors);
+
+		//! Adds the counts of another histogram with the same color type, bins and ranges.
+		void merge(const color_histogram& other);
+
+		//! Sets all counts to 0.
+		void clear();
+
+		//! Returns the color type of the histogram.
+		color_type get_color_type() const { return m_type; }
+
+		//! Returns the number of bins of every component.
+		const std::vector<size_t>& get_bins() const { return m_bins; }
+
+		//! Returns the lower bound of every component.
+		const std::vector<float>& get_minimum() const { return m_minimum; }
+
+		//! Returns the upper bound of every component.
+		const std::vector<float>& get_maximum() const { return m_maximum; }
+
+		//! Returns the rgb color space definition of the binned colors.
+		color_space::rgb_color_space_definition* get_rgb_color_space() const { return m_rgb_color_space; }
+
+		//! Returns the total number of bins.
+		size_t bin_count() const { return m_counts.size(); }
+
+		//! Returns the count of a bin.
+		uint64_t count(size_t bin) const { return m_counts[bin]; }
+
+		//! Returns the counts of all bins, the last component changes fastest.
+		const std::vector<uint64_t>& counts() const { return m_counts; }
+
+		//! Returns the number of binned colors.
+		uint64_t total() const { return m_total; }
+
+		//! Returns the bin of a color given as components in the color type of the histogram.
+		size_t bin_index(const float* values) const;
+
+		//! Returns the color at the center of a bin.
+		/*!
+		* \param bin The index of the bin.
+		* \return A new opaque color object owned by the caller.
+		*/
+		color_space::color_base* bin_center(size_t bin) const;
+
+		//! Returns the indices of the fullest bins, fullest first.
+		/*!
+		* Empty bins are not returned.
+		* \param count The maximum number of bins to return.
+		*/
+		std::vector<size_t> dominant_bins(size_t count) const;
+
+		//! Returns the normalized histogram intersection of two histograms.
+		/*!
+		* \return 1 for identical distributions and 0 for distributions without common bins.
+		*/
+		static float intersection(const color_histogram& first, const color_histogram& second);
+
+	private:
+		void check_compatible(const color_histogram& other) const;
+
+		color_type m_type;
+		color_space::rgb_color_space_definition* m_rgb_color_space;
+		size_t m_components;
+		int m_hue;
+		std::vector<size_t> m_bins;
+		std::vector<float> m_minimum;
+		std::vector<float> m_maximum;
+		std::vector<uint64_t> m_counts;
+		uint64_t m_total;
+	};
+}
@@ -0,0 +1,533 @@
+#include "stdafx.h"
+#include "color_quantization.h"
+#include "..\utils\parallel.h"
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <random>
+
+namespace
+{
+	const size_t k_chunk_size = 16384;
+
+	//! Samples in lab, stored as separate arrays so the distance loops vectorize.
+	struct lab_samples
+	{
+		std::vector<float> L, a, b, weight;
+
+		size_t size() const { return L.size(); }
+
+		void resize(size_t size)
+		{
+			L.resize(size);
+			a.resize(size);
+			b.resize(size);
+			weight.resize(size);
+		}
+	};
+
+	//! Returns the index of the nearest centroid by squared delta E (CIE76).
+	inline size_t nearest(const lab_samples& centroids, float L, float a, float b, float& distance)
+	{
+		size_t best = 0;
+		distance = std::numeric_limits<float>::max();
+		for (size_t c = 0; c < centroids.size(); ++c)
+		{
+			const float dL = centroids.L[c] - L, da = centroids.a[c] - a, db = centroids.b[c] - b;
+			const float d = dL * dL + da * da + db * db;
+			if (d < distance)
+			{
+				distance = d;
+				best = c;
+			}
+		}
+		return best;
+	}
+
+	void add_centroid(lab_samples& centroids, const lab_samples& samples, size_t index)
+	{
+		centroids.L.push_back(samples.L[index]);
+		centroids.a.push_back(samples.a[index]);
+		centroids.b.push_back(samples.b[index]);
+		centroids.weight.push_back(0.f);
+	}
+
+	//! Picks an index with a probability proportional to the given values.
+	size_t pick(const std::vector<double>& values, double total, std::mt19937& random)
+	{
+		double target = std::uniform_real_distribution<double>(0.0, total)(random);
+		for (size_t i = 0; i < values.size(); ++i)
+		{
+			target -= values[i];
+			if (target < 0.0 && values[i] > 0.0) return i;
+		}
+		for (size_t i = values.size(); i-- > 0;)
+		{
+			if (values[i] > 0.0) return i;
+		}
+		return 0;
+	}
+
+	lab_samples initialize(const lab_samples& samples, size_t count, std::mt19937& random)
+	{
+		lab_samples centroids;
+		std::vector<double> d2(samples.weight.begin(), samples.weight.end());
+		double total = std::accumulate(d2.begin(), d2.end(), 0.0);
+
+		// k-means++: every further centroid is picked with a probability proportional to weight * squared distance.
+		while (centroids.size() < count && total > 0.0)
+		{
+			add_centroid(centroids, samples, pick(d2, total, random));
+
+			const size_t c = centroids.size() - 1;
+			total = 0.0;
+			for (size_t i = 0; i < samples.size(); ++i)
+			{
+				const float dL = centroids.L[c] - samples.L[i], da = centroids.a[c] - samples.a[i], db = centroids.b[c] - samples.b[i];
+				const double d = samples.weight[i] * (double)(dL * dL + da * da + db * db);
+				if (c == 0 || d < d2[i]) d2[i] = d;
+				total += d2[i];
+			}
+		}
+		return centroids;
+	}
+
+	//! Assigns all samples to their nearest centroid and returns the weighted sums of L, a and b and the weight per centroid.
+	std::vector<double> assign(const lab_samples& samples, const lab_samples& centroids)
+	{
+		const size_t k = centroids.size();
+		const size_t chunks = parallel::chunk_count(samples.size(), k_chunk_size);
+		std::vector<double> partials(chunks * k * 4, 0.0);
+
+		parallel::for_each_chunk(samples.size(), k_chunk_size, [&](size_t chunk, size_t begin, size_t end)
+		{
+			double* sums = partials.data() + chunk * k * 4;
+			float distance;
+			for (size_t i = begin; i < end; ++i)
+			{
+				const size_t c = nearest(centroids, samples.L[i], samples.a[i], samples.b[i], distance);
+				const double w = samples.weight[i];
+				sums[c * 4 + 0] += w * samples.L[i];
+				sums[c * 4 + 1] += w * samples.a[i];
+				sums[c * 4 + 2] += w * samples.b[i];
+				sums[c * 4 + 3] += w;
+			}
+		});
+
+		// Combined in chunk order, so the result does not depend on the number of threads.
+		std::vector<double> sums(k * 4, 0.0);
+		for (size_t chunk = 0; chunk < chunks; ++chunk)
+		{
+			for (size_t j = 0; j < sums.size(); ++j) sums[j] += partials[chunk * k * 4 + j];
+		}
+		return sums;
+	}
+
+	void lloyd(const lab_samples& samples, lab_samples& centroids, const color_manipulation::k_means_settings& settings)
+	{
+		for (size_t iteration = 0; iteration < settings.max_iterations; ++iteration)
+		{
+			const std::vector<double> sums = assign(samples, centroids);
+
+			float movement = 0.f;
+			for (size_t c = 0; c < centroids.size(); ++c)
+			{
+				const double w = sums[c * 4 + 3];
+				if (w <= 0.0) continue;
+
+				const float L = (float)(sums[c * 4 + 0] / w), a = (float)(sums[c * 4 + 1] / w), b = (float)(sums[c * 4 + 2] / w);
+				const float dL = L - centroids.L[c], da = a - centroids.a[c], db = b - centroids.b[c];
+				movement = std::max(movement, dL * dL + da * da + db * db);
+				centroids.L[c] = L;
+				centroids.a[c] = a;
+				centroids.b[c] = b;
+			}
+
+			if (movement <= settings.tolerance * settings.tolerance) break;
+		}
+	}
+
+	void mini_batch(const lab_samples& samples, lab_samples& centroids, const color_manipulation::k_means_settings& settings, std::mt19937& random)
+	{
+		std::uniform_int_distribution<size_t> index(0, samples.size() - 1);
+		std::vector<double> counts(centroids.size(), 0.0);
+		std::vector<size_t> batch(settings.batch_size);
+		std::vector<size_t> assignment(settings.batch_size);
+
+		for (size_t iteration = 0; iteration < settings.max_iterations; ++iteration)
+		{
+			float distance;
+			for (size_t j = 0; j < batch.size(); ++j)
+			{
+				batch[j] = index(random);
+				assignment[j] = nearest(centroids, samples.L[batch[j]], samples.a[batch[j]], samples.b[batch[j]], distance);
+			}
+
+			float movement = 0.f;
+			for (size_t j = 0; j < batch.size(); ++j)
+			{
+				const size_t i = batch[j], c = assignment[j];
+				if (samples.weight[i] <= 0.f) continue;
+
+				// Per centroid learning rate, the centroid converges to the mean of its samples.
+				counts[c] += samples.weight[i];
+				const float rate = (float)(samples.weight[i] / counts[c]);
+				const float dL = rate * (samples.L[i] - centroids.L[c]), da = rate * (samples.a[i] - centroids.a[c]), db = rate * (samples.b[i] - centroids.b[c]);
+				movement = std::max(movement, dL * dL + da * da + db * db);
+				centroids.L[c] += dL;
+				centroids.a[c] += da;
+				centroids.b[c] += db;
+			}
+
+			if (movement <= settings.tolerance * settings.tolerance) break;
+		}
+	}
+
+	std::vector<color_space::lab*> cluster(const lab_samples& samples, size_t count, const color_manipulation::k_means_settings& settings, color_space::rgb_color_space_definition* rgb_color_space, std::vector<float>* shares)
+	{
+		if (count == 0) throw new std::invalid_argument("The palette needs at least one color.");
+
+		std::mt19937 random(settings.seed);
+		lab_samples centroids = initialize(samples, count, random);
+		if (centroids.size() == 0) throw new std::invalid_argument("Parameter colors cannot be empty.");
+
+		if (settings.batch_size > 0) mini_batch(samples, centroids, settings, random);
+		else lloyd(samples, centroids, settings);
+
+		const std::vector<double> sums = assign(samples, centroids);
+		double total = 0.0;
+		std::vector<size_t> order(centroids.size());
+		for (size_t c = 0; c < centroids.size(); ++c)
+		{
+			order[c] = c;
+			total += sums[c * 4 + 3];
+		}
+		std::stable_sort(order.begin(), order.end(), [&sums](size_t x, size_t y) { return sums[x * 4 + 3] > sums[y * 4 + 3]; });
+
+		std::vector<color_space::lab*> palette;
+		if (shares != nullptr) shares->clear();
+		for (size_t c : order)
+		{
+			palette.push_back(new color_space::lab(centroids.L[c], centroids.a[c], centroids.b[c], 1.f, rgb_color_space));
+			if (shares != nullptr) shares->push_back((float)(sums[c * 4 + 3] / total));
+		}
+		return palette;
+	}
+
+	//! A non-empty bin of a histogram with the bin index of every component.
+	struct histogram_entry
+	{
+		unsigned short bin[4];
+		uint64_t count;
+	};
+
+	std::vector<histogram_entry> histogram_entries(const color_manipulation::color_histogram& histogram)
+	{
+		const auto& bins = histogram.get_bins();
+		std::vector<histogram_entry> entries;
+		for (size_t index = 0; index < histogram.bin_count(); ++index)
+		{
+			if (histogram.count(index) == 0) continue;
+
+			histogram_entry entry = {};
+			size_t rest = index;
+			for (size_t c = bins.size(); c-- > 0;)
+			{
+				entry.bin[c] = (unsigned short)(rest % bins[c]);
+				rest /= bins[c];
+			}
+			entry.count = histogram.count(index);
+			entries.push_back(entry);
+		}
+		return entries;
+	}
+
+	//! A palette color as the pixel weighted sum of the bin centers it covers.
+	struct palette_sum
+	{
+		double values[4];
+		uint64_t count;
+	};
+
+	void add_entry(palette_sum& sum, const histogram_entry& entry, const color_manipulation::color_histogram& histogram)
+	{
+		for (size_t c = 0; c < histogram.get_bins().size(); ++c)
+		{
+			const float width = (histogram.get_maximum()[c] - histogram.get_minimum()[c]) / histogram.get_bins()[c];
+			sum.values[c] += entry.count * (histogram.get_minimum()[c] + (entry.bin[c] + 0.5f) * width);
+		}
+		sum.count += entry.count;
+	}
+
+	std::vector<color_space::color_base*> create_palette(std::vector<palette_sum>& sums, const color_manipulation::color_histogram& histogram, std::vector<float>* shares)
+	{
+		std::stable_sort(sums.begin(), sums.end(), [](const palette_sum& x, const palette_sum& y) { return x.count > y.count; });
+
+		const color_type type = histogram.get_color_type();
+		const size_t components = histogram.get_bins().size();
+		std::vector<color_space::color_base*> palette;
+		if (shares != nullptr) shares->clear();
+		for (const auto& sum : sums)
+		{
+			color_buffer color(type, histogram.get_rgb_color_space(), 1);
+			float* values = color.pixel(0);
+			for (size_t c = 0; c < components; ++c) values[c] = (float)(sum.values[c] / sum.count);
+			values[components] = (type == color_type::RGB_TRUE || type == color_type::GREY_TRUE) ? 255.f : 1.f;
+
+			palette.push_back(color.create_color(0));
+			if (shares != nullptr) shares->push_back((float)((double)sum.count / histogram.total()));
+		}
+		return palette;
+	}
+
+	//! A box of histogram entries for the median cut.
+	struct median_box
+	{
+		size_t begin, end;
+		uint64_t count;
+		int axis;
+	};
+
+	//! Returns the axis with the largest extent or -1 if the box contains a single bin.
+	int longest_axis(const std::vector<histogram_entry>& entries, const median_box& box, const color_manipulation::color_histogram& histogram)
+	{
+		int axis = -1;
+		float longest = 0.f;
+		for (size_t c = 0; c < histogram.get_bins().size(); ++c)
+		{
+			unsigned short low = entries[box.begin].bin[c], high = low;
+			for (size_t i = box.begin; i < box.end; ++i)
+			{
+				low = std::min(low, entries[i].bin[c]);
+				high = std::max(high, entries[i].bin[c]);
+			}
+
+			const float extent = (high - low) * (histogram.get_maximum()[c] - histogram.get_minimum()[c]) / histogram.get_bins()[c];
+			if (extent > longest)
+			{
+				longest = extent;
+				axis = (int)c;
+			}
+		}
+		return axis;
+	}
+
+	//! A node of the octree, the children are indices into the node array or -1.
+	struct octree_node
+	{
+		palette_sum sum;
+		int children[8];
+		int level;
+		bool leaf;
+		bool merged;
+	};
+}
+
+std::vector<color_space::lab*> color_manipulation::color_quantization::k_means(const color_buffer & colors, size_t count, const k_means_settings & settings, std::vector<float>* shares)
+{
+	const size_t stride = settings.max_samples > 0 && colors.size() > settings.max_samples ? (colors.size() + settings.max_samples - 1) / settings.max_samples : 1;
+	const size_t size = (colors.size() + stride - 1) / stride;
+
+	lab_samples samples;
+	samples.resize(size);
+	parallel::for_each_chunk(size, k_chunk_size, [&](size_t chunk, size_t begin, size_t end)
+	{
+		float values[5];
+		for (size_t i = begin; i < end; ++i)
+		{
+			color_converter::convert_values(colors.get_color_type(), colors.pixel(i * stride), colors.get_rgb_color_space(), color_type::LAB, values);
+			samples.L[i] = values[0];
+			samples.a[i] = values[1];
+			samples.b[i] = values[2];
+			samples.weight[i] = 1.f;
+		}
+	});
+
+	return cluster(samples, count, settings, colors.get_rgb_color_space(), shares);
+}
+
+std::vector<color_space::lab*> color_manipulation::color_quantization::k_means(const color_histogram & histogram, size_t count, const k_means_settings & settings, std::vector<float>* shares)
+{
+	lab_samples samples;
+	for (size_t bin = 0; bin < histogram.bin_count(); ++bin)
+	{
+		if (histogram.count(bin) == 0) continue;
+
+		std::unique_ptr<color_space::color_base> center(histogram.bin_center(bin));
+		color_space::lab color = color_converter::to_lab(*center);
+		samples.L.push_back(color.luminance());
+		samples.a.push_back(color.a());
+		samples.b.push_back(color.b());
+		samples.weight.push_back((float)histogram.count(bin));
+	}
+
+	return cluster(samples, count, settings, histogram.get_rgb_color_space(), shares);
+}
+
+std::vector<color_space::color_base*> color_manipulation::color_quantization::median_cut(const color_buffer & colors, size_t count, color_type type, std::vector<float>* shares)
+{
+	return median_cut(create_histogram(colors, type), count, shares);
+}
+
+std::vector<color_space::color_base*> color_manipulation::color_quantization::median_cut(const color_histogram & histogram, size_t count, std::vector<float>* shares)
+{
+	if (count == 0) throw new std::invalid_argument("The palette needs at least one color.");
+
+	std::vector<histogram_entry> entries = histogram_entries(histogram);
+	if (entries.empty()) throw new std::invalid_argument("Parameter colors cannot be empty.");
+
+	std::vector<median_box> boxes(1, median_box{ 0, entries.size(), histogram.total(), -1 });
+	boxes[0].axis = longest_axis(entries, boxes[0], histogram);
+	while (boxes.size() < count)
+	{
+		// Split the box with the most pixels that still covers more than one bin.
+		int index = -1;
+		for (size_t b = 0; b < boxes.size(); ++b)
+		{
+			if (boxes[b].axis >= 0 && (index < 0 || boxes[b].count > boxes[index].count)) index = (int)b;
+		}
+		if (index < 0) break;
+
+		median_box& box = boxes[index];
+		const int axis = box.axis;
+		std::sort(entries.begin() + box.begin, entries.begin() + box.end, [axis](const histogram_entry& x, const histogram_entry& y)
+		{
+			if (x.bin[axis] != y.bin[axis]) return x.bin[axis] < y.bin[axis];
+			return std::lexicographical_compare(x.bin, x.bin + 4, y.bin, y.bin + 4);
+		});
+
+		// Split behind the bin value that contains the median pixel, so both boxes keep distinct values.
+		uint64_t below = 0;
+		size_t median = box.begin;
+		while (median < box.end && (below += entries[median].count) * 2 < box.count) ++median;
+		const unsigned short value = entries[std::min(median, box.end - 1)].bin[axis];
+
+		size_t split = box.begin;
+		while (split < box.end && entries[split].bin[axis] <= value) ++split;
+		if (split == box.end)
+		{
+			split = box.begin;
+			while (entries[split].bin[axis] < value) ++split;
+		}
+
+		uint64_t first = 0;
+		for (size_t i = box.begin; i < split; ++i) first += entries[i].count;
+
+		median_box second{ split, box.end, box.count - first, -1 };
+		box.end = split;
+		box.count = first;
+		box.axis = longest_axis(entries, box, histogram);
+		second.axis = longest_axis(entries, second, histogram);
+		boxes.push_back(second);
+	}
+
+	std::vector<palette_sum> sums;
+	for (const auto& box : boxes)
+	{
+		palette_sum sum = {};
+		for (size_t i = box.begin; i < box.end; ++i) add_entry(sum, entries[i], histogram);
+		sums.push_back(sum);
+	}
+	return create_palette(sums, histogram, shares);
+}
+
+std::vector<color_space::color_base*> color_manipulation::color_quantization::octree(const color_buffer & colors, size_t count, color_type type, std::vector<float>* shares)
+{
+	return octree(create_histogram(colors, type), count, shares);
+}
+
+std::vector<color_space::color_base*> color_manipulation::color_quantization::octree(const color_histogram & histogram, size_t count, std::vector<float>* shares)
+{
+	if (count == 0) throw new std::invalid_argument("The palette needs at least one color.");
+
+	const auto& bins = histogram.get_bins();
+	if (bins.size() != 3 || bins[0] != bins[1] || bins[0] != bins[2] || bins[0] > 256 || (bins[0] & (bins[0] - 1)) != 0)
+	{
+		throw new std::invalid_argument("An octree needs a histogram with three components and the same power of two bins each.");
+	}
+
+	int depth = 0;
+	while (((size_t)1 << depth) < bins[0]) ++depth;
+
+	std::vector<histogram_entry> entries = histogram_entries(histogram);
+	if (entries.empty()) throw new std::invalid_argument("Parameter colors cannot be empty.");
+
+	octree_node empty = {};
+	std::fill(empty.children, empty.children + 8, -1);
+
+	std::vector<octree_node> nodes(1, empty);
+	size_t leaves = 0;
+	for (const auto& entry : entries)
+	{
+		int node = 0;
+		for (int level = 0; level < depth; ++level)
+		{
+			const int shift = depth - 1 - level;
+			const int child = (((entry.bin[0] >> shift) & 1) << 2) | (((entry.bin[1] >> shift) & 1) << 1) | ((entry.bin[2] >> shift) & 1);
+			if (nodes[node].children[child] < 0)
+			{
+				nodes[node].children[child] = (int)nodes.size();
+				nodes.push_back(empty);
+				nodes.back().level = level + 1;
+			}
+			node = nodes[node].children[child];
+		}
+
+		add_entry(nodes[node].sum, entry, histogram);
+		if (!nodes[node].leaf) ++leaves;
+		nodes[node].leaf = true;
+	}
+
+	// Merge the leaves level by level from the bottom, the nodes with the fewest pixels first.
+	for (int level = depth - 1; level >= 0 && leaves > count; --level)
+	{
+		std::vector<int> candidates;
+		for (size_t n = 0; n < nodes.size(); ++n)
+		{
+			if (nodes[n].level != level || nodes[n].leaf) continue;
+
+			candidates.push_back((int)n);
+			for (int child : nodes[n].children)
+			{
+				if (child >= 0) nodes[n].sum.count += nodes[child].sum.count;
+			}
+		}
+		std::stable_sort(candidates.begin(), candidates.end(), [&nodes](int x, int y) { return nodes[x].sum.count < nodes[y].sum.count; });
+
+		for (size_t i = 0; i < candidates.size() && leaves > count; ++i)
+		{
+			octree_node& node = nodes[candidates[i]];
+			node.sum.count = 0;
+			for (int child : node.children)
+			{
+				if (child < 0) continue;
+
+				for (size_t c = 0; c < 3; ++c) node.sum.values[c] += nodes[child].sum.values[c];
+				node.sum.count += nodes[child].sum.count;
+				nodes[child].merged = true;
+				--leaves;
+			}
+			node.leaf = true;
+			++leaves;
+		}
+	}
+
+	std::vector<palette_sum> sums;
+	for (const auto& node : nodes)
+	{
+		if (node.leaf && !node.merged) sums.push_back(node.sum);
+	}
+	return create_palette(sums, histogram, shares);
+}
+
+color_manipulation::color_histogram color_manipulation::color_quantization::create_histogram(const color_buffer & colors, color_type type)
+{
+	const size_t components = color_buffer::component_count(type);
+	const size_t bins = components == 1 ? 256 : components == 4 ? 16 : 32;
+
+	color_histogram histogram(type, std::vector<size_t>(components, bins), colors.get_rgb_color_space());
+	histogram.add(colors);
+	return histogram;
+}
@@ -0,0 +1,116 @@
+/// Copyright Martin Ruehlicke, 2019
+/// Use, modification and distribution are subject to the
+/// MIT Software License, Version 1.0.
+/// See accompanying file LICENSE.txt
+
+#pragma once
+
+#include "..\spaces\color_base.h"
+#include "..\spaces\lab.h"
+#include "..\utils\color_buffer.h"
+#include "color_converter.h"
+#include "color_histogram.h"
+
+#include <vector>
+
+namespace color_manipulation
+{
+	//! Settings of the k-means palette extraction.
+	struct k_means_settings
+	{
+		//! The maximum number of iterations (or mini-batches).
+		size_t max_iterations = 30;
+
+		//! The iterations stop as soon as no centroid moves further than this delta E (CIE76).
+		float tolerance = 0.1f;
+
+		//! The number of samples per mini-batch, 0 runs full iterations over all samples.
+		size_t batch_size = 0;
+
+		//! The maximum number of pixels taken from a buffer, 0 uses every pixel. Pixels are taken with a fixed stride.
+		size_t max_samples = 0;
+
+		//! The seed of the random generator used for the k-means++ initialization and the mini-batches.
+		unsigned int seed = 5489u;
+	};
+
+	//! Static class for palette extraction and color quantization.
+	/*!
+	* This static class reduces many colors to a small palette of representative colors.
+	*/
+	class color_quantization
+	{
+	public:
+		//! Static function that extracts the dominant colors of a buffer with k-means clustering in lab.
+		/*!
+		* The pixels are converted to lab and clustered by their delta E (CIE76). The centroids are initialized with
+		* k-means++ and updated like color_calculation::average_lab(), i.e. as the arithmetic mean of L, a and b.
+		* The assignment of the pixels is done on all cores and gives the same result for every number of threads.
+		* \param colors The colors to cluster, any color type.
+		* \param count The number of palette colors.
+		* \param settings The iteration, mini-batch and subsampling settings.
+		* \param shares If not null receives the share of the pixels belonging to every palette color.
+		* \return The palette sorted by share, fewer colors if the input has fewer distinct colors. All colors are new objects owned by the caller.
+		*/
+		static std::vector<color_space::lab*> k_means(const color_buffer& colors, size_t count, const k_means_settings& settings = k_means_settings(), std::vector<float>* shares = nullptr);
+
+		//! Static function that extracts the dominant colors of a histogram with k-means clustering in lab.
+		/*!
+		* Works like k_means() for buffers, but clusters the centers of the bins weighted by their counts. This is much
+		* faster for large images.
+		* \param histogram The histogram to cluster.
+		* \param count The number of palette colors.
+		* \param settings The iteration and mini-batch settings, max_samples is ignored.
+		* \param shares If not null receives the share of the pixels belonging to every palette color.
+		* \return The palette sorted by share, all colors are new objects owned by the caller.
+		*/
+		static std::vector<color_space::lab*> k_means(const color_histogram& histogram, size_t count, const k_means_settings& settings = k_means_settings(), std::vector<float>* shares = nullptr);
+
+		//! Static function that quantizes a buffer with the median cut algorithm.
+		/*!
+		* The pixels are binned into a histogram with 32 bins per component in the given color type (256 for grey, 16 for cmyk),
+		* so the memory does not depend on the size of the image. Then the box with the most pixels is repeatedly split at
+		* the median of its longest axis. The result is deterministic.
+		* \param colors The colors to quantize, any color type.
+		* \param count The number of palette colors, e.g. 256 for 8-bit indexed images.
+		* \param type The color type in which the colors are quantized, usually rgb deep color or lab.
+		* \param shares If not null receives the share of the pixels belonging to every palette color.
+		* \return The palette in the given color type sorted by share, fewer colors if the input has fewer distinct colors. All colors are new objects owned by the caller.
+		*/
+		static std::vector<color_space::color_base*> median_cut(const color_buffer& colors, size_t count, color_type type = color_type::RGB_DEEP, std::vector<float>* shares = nullptr);
+
+		//! Static function that quantizes the colors of a histogram with the median cut algorithm.
+		/*!
+		* \param histogram The histogram to quantize, the palette has its color type.
+		* \param count The number of palette colors.
+		* \param shares If not null receives the share of the pixels belonging to every palette color.
+		* \return The palette sorted by share, all colors are new objects owned by the caller.
+		*/
+		static std::vector<color_space::color_base*> median_cut(const color_histogram& histogram, size_t count, std::vector<float>* shares = nullptr);
+
+		//! Static function that quantizes a buffer with an octree.
+		/*!
+		* The pixels are binned into a histogram with 32 bins per component in the given color type which is then inserted
+		* into an octree of depth 5. The leaves with the fewest pixels are merged into their parents until at most count
+		* leaves remain. The result is deterministic.
+		* \param colors The colors to quantize, any color type.
+		* \param count The maximum number of palette colors, e.g. 256 for 8-bit indexed images.
+		* \param type The color type in which the colors are quantized, it needs three components, usually rgb deep color or lab.
+		* \param shares If not null receives the share of the pixels belonging to every palette color.
+		* \return The palette in the given color type sorted by share. All colors are new objects owned by the caller.
+		*/
+		static std::vector<color_space::color_base*> octree(const color_buffer& colors, size_t count, color_type type = color_type::RGB_DEEP, std::vector<float>* shares = nullptr);
+
+		//! Static function that quantizes the colors of a histogram with an octree.
+		/*!
+		* \param histogram The histogram to quantize, it needs three components with the same power of two bins each.
+		* \param count The maximum number of palette colors.
+		* \param shares If not null receives the share of the pixels belonging to every palette color.
+		* \return The palette sorted by share, all colors are new objects owned by the caller.
+		*/
+		static std::vector<color_space::color_base*> octree(const color_histogram& histogram, size_t count, std::vector<float>* shares = nullptr);
+
+	private:
+		static color_histogram create_histogram(const color_buffer& colors, color_type type);
+	};
+}
@@ -0,0 +1,91 @@
+#include "stdafx.h"
+#include "error_diffusion.h"
+#include "color_converter.h"
+
+#include <algorithm>
+
+color_manipulation::error_diffusion::error_diffusion(const palette_search & palette, size_t width, diffusion_kernel kernel, bool serpentine)
+	: m_palette(palette), m_width(width), m_serpentine(serpentine), m_row(0)
+{
+	if (palette.size() > 256) throw new std::invalid_argument("Error diffusion supports palettes of at most 256 colors.");
+
+	switch (kernel)
+	{
+	case FLOYD_STEINBERG:
+		m_kernel = { { 1, 0, 7.f / 16.f }, { -1, 1, 3.f / 16.f }, { 0, 1, 5.f / 16.f }, { 1, 1, 1.f / 16.f } };
+		break;
+	case SIERRA:
+		m_kernel = { { 1, 0, 5.f / 32.f }, { 2, 0, 3.f / 32.f },
+			{ -2, 1, 2.f / 32.f }, { -1, 1, 4.f / 32.f }, { 0, 1, 5.f / 32.f }, { 1, 1, 4.f / 32.f }, { 2, 1, 2.f / 32.f },
+			{ -1, 2, 2.f / 32.f }, { 0, 2, 3.f / 32.f }, { 1, 2, 2.f / 32.f } };
+		break;
+	case SIERRA_LITE:
+		m_kernel = { { 1, 0, 2.f / 4.f }, { -1, 1, 1.f / 4.f }, { 0, 1, 1.f / 4.f } };
+		break;
+	case ATKINSON:
+		m_kernel = { { 1, 0, 1.f / 8.f }, { 2, 0, 1.f / 8.f }, { -1, 1, 1.f / 8.f }, { 0, 1, 1.f / 8.f }, { 1, 1, 1.f / 8.f }, { 0, 2, 1.f / 8.f } };
+		break;
+	default:
+		throw new std::invalid_argument("The error diffusion kernel is not defined.");
+	}
+
+	int rows = 0;
+	for (const auto& weight : m_kernel) rows = std::max(rows, weight.dy);
+	m_errors.assign(rows + 1, std::vector<float>((m_width + 2 * padding) * 3, 0.f));
+}
+
+void color_manipulation::error_diffusion::dither_row(const color_buffer & colors, size_t first, uint8_t * indices)
+{
+	if (first + m_width > colors.size()) throw new std::out_of_range("The row is outside of the buffer.");
+
+	const size_t rows = m_errors.size();
+	const bool reverse = m_serpentine && (m_row % 2) == 1;
+	const int direction = reverse ? -1 : 1;
+	float* current = m_errors[m_row % rows].data();
+
+	float values[5];
+	for (size_t step = 0; step < m_width; ++step)
+	{
+		const size_t x = reverse ? m_width - 1 - step : step;
+		const float* pixel = colors.pixel(first + x);
+		if (colors.get_color_type() == color_type::RGB_DEEP) std::copy(pixel, pixel + 3, values);
+		else color_converter::convert_values(colors.get_color_type(), pixel, colors.get_rgb_color_space(), color_type::RGB_DEEP, values);
+
+		float* error = current + (x + padding) * 3;
+		for (size_t c = 0; c < 3; ++c) values[c] = std::min(std::max(values[c] + error[c], 0.f), 1.f);
+
+		const size_t index = m_palette.nearest_rgb(values);
+		indices[x] = (uint8_t)index;
+
+		const auto& chosen = m_palette.rgb(index);
+		const float difference[3] = { values[0] - chosen.red(), values[1] - chosen.green(), values[2] - chosen.blue() };
+		for (const auto& weight : m_kernel)
+		{
+			float* target = m_errors[(m_row + weight.dy) % rows].data() + (x + padding + direction * weight.dx) * 3;
+			for (size_t c = 0; c < 3; ++c) target[c] += difference[c] * weight.weight;
+		}
+	}
+
+	// The current row is free and becomes the last row of the ring.
+	std::fill(m_errors[m_row % rows].begin(), m_errors[m_row % rows].end(), 0.f);
+	++m_row;
+}
+
+void color_manipulation::error_diffusion::reset()
+{
+	m_row = 0;
+	for (auto& row : m_errors) std::fill(row.begin(), row.end(), 0.f);
+}
+
+std::vector<uint8_t> color_manipulation::error_diffusion::dither(const color_buffer & image, size_t width, const palette_search & palette, diffusion_kernel kernel, bool serpentine)
+{
+	if (width == 0 || image.size() % width != 0) throw new std::invalid_argument("The size of the image has to be a multiple of its width.");
+
+	error_diffusion diffusion(palette, width, kernel, serpentine);
+	std::vector<uint8_t> indices(image.size());
+	for (size_t first = 0; first < image.size(); first += width)
+	{
+		diffusion.dither_row(image, first, indices.data() + first);
+	}
+	return indices;
+}
@@ -0,0 +1,85 @@
+/// Copyright Martin Ruehlicke, 2019
+/// Use, modification and distribution are subject to the
+/// MIT Software License, Version 1.0.
+/// See accompanying file LICENSE.txt
+
+#pragma once
+
+#include "..\utils\color_buffer.h"
+#include "palette_search.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace color_manipulation
+{
+	//! Enum that defines the error diffusion kernels.
+	enum diffusion_kernel
+	{
+		FLOYD_STEINBERG = 0, /*!< FLOYD_STEINBERG - 4 neighbours in two rows */
+		SIERRA, /*!< SIERRA - 10 neighbours in three rows */
+		SIERRA_LITE, /*!< SIERRA_LITE - 3 neighbours in two rows */
+		ATKINSON /*!< ATKINSON - 6 neighbours in three rows, diffuses only 3/4 of the error */
+	};
+
+	//! Error diffusion dithering of images to a palette.
+	/*!
+	* The image is processed row by row, so it can be streamed. Only one row of errors per kernel row is kept in memory,
+	* two for FLOYD_STEINBERG and SIERRA_LITE, three for SIERRA and ATKINSON. The errors are diffused in rgb deep color
+	* and the nearest palette color is found with a palette_search, so any of its distance metrics can be used.
+	* With serpentine scanning every second row is processed from right to left, which avoids directional artifacts.
+	*/
+	class error_diffusion
+	{
+	public:
+		//! Default constructor.
+		/*!
+		* \param palette The palette, at most 256 colors.
+		* \param width The number of pixels per row.
+		* \param kernel The error diffusion kernel.
+		* \param serpentine Whether every second row is processed from right to left.
+		*/
+		error_diffusion(const palette_search& palette, size_t width, diffusion_kernel kernel = FLOYD_STEINBERG, bool serpentine = true);
+
+		//! Dithers the next row of the image.
+		/*!
+		* \param colors The buffer containing the row, any color type.
+		* \param first The index of the first pixel of the row in the buffer.
+		* \param indices Receives the palette index of every pixel of the row.
+		*/
+		void dither_row(const color_buffer& colors, size_t first, uint8_t* indices);
+
+		//! Discards the errors of the previous rows to start a new image.
+		void reset();
+
+		//! Static function that dithers a whole image.
+		/*!
+		* \param image The pixels of the image row by row, any color type.
+		* \param width The number of pixels per row.
+		* \param palette The palette, at most 256 colors.
+		* \param kernel The error diffusion kernel.
+		* \param serpentine Whether every second row is processed from right to left.
+		* \return The palette index of every pixel.
+		*/
+		static std::vector<uint8_t> dither(const color_buffer& image, size_t width, const palette_search& palette, diffusion_kernel kernel = FLOYD_STEINBERG, bool serpentine = true);
+
+	private:
+		//! A weight of the kernel for the neighbour at dx, dy.
+		struct kernel_weight
+		{
+			int dx, dy;
+			float weight;
+		};
+
+		static const size_t padding = 2;
+
+		const palette_search& m_palette;
+		size_t m_width;
+		bool m_serpentine;
+		std::vector<kernel_weight> m_kernel;
+
+		size_t m_row;
+		// Ring of error rows, row r of the image uses m_errors[r % m_errors.size()].
+		std::vector<std::vector<float>> m_errors;
+	};
+}
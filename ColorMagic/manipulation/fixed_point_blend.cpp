@@ -0,0 +1,135 @@
+#include "stdafx.h"
+#include "fixed_point_blend.h"
+#include "..\utils\instrumentation.h"
+#include "..\utils\parallel.h"
+
+#include <algorithm>
+#include <cstdlib>
+
+namespace
+{
+	//! Blend function of two 8 bit channels in units of 1 / (255 * 255), e.g. multiply is s * d.
+	/*!
+	* The limited modes are not limited here, the result channel is clamped like the one of general_porter_duff().
+	*/
+	template<int Mode>
+	inline int32_t blend_value(int32_t s, int32_t d)
+	{
+		// Mode is a constant, the switch is resolved at compile time.
+		switch (Mode)
+		{
+		case color_manipulation::NORMAL_BLEND: return 255 * s;
+		case color_manipulation::MULTIPLY_BLEND: return s * d;
+		case color_manipulation::SCREEN_BLEND: return 255 * (s + d) - s * d;
+		case color_manipulation::DARKEN_BLEND: return 255 * std::min(s, d);
+		case color_manipulation::LIGHTEN_BLEND: return 255 * std::max(s, d);
+		case color_manipulation::LINEAR_DODGE_BLEND: return 255 * (s + d);
+		case color_manipulation::LINEAR_BURN_BLEND: return 255 * (s + d - 255);
+		case color_manipulation::DIFFERENCE_BLEND: return 255 * std::abs(d - s);
+		case color_manipulation::SUBTRACT_BLEND: return 255 * (s - d);
+		default: return 255 * (s + d) - 2 * s * d;
+		}
+	}
+
+	//! Blends 8 bit colors like general_porter_duff() with the blend function as color of the region of both.
+	/*!
+	* The region areas are products of two alpha values, so the weighted sum of a channel is exact and the division by
+	* the resulting alpha is the only rounding.
+	*/
+	template<int Mode>
+	void blend_kernel(const uint8_t* source, const uint8_t* destination, uint8_t* result, size_t count, uint32_t use_source, uint32_t use_destination)
+	{
+		for (size_t i = 0; i < count; ++i, source += 4, destination += 4, result += 4)
+		{
+			const uint32_t sa = source[3], da = destination[3];
+			const uint32_t source_area = use_source * sa * (255 - da);
+			const uint32_t destination_area = use_destination * da * (255 - sa);
+			const uint32_t both_area = sa * da;
+			const uint32_t area = source_area + destination_area + both_area;
+			const int64_t divisor = 255 * (int64_t)area;
+
+			int64_t sum[3];
+			for (size_t c = 0; c < 3; ++c)
+			{
+				sum[c] = 255 * ((int64_t)source_area * source[c] + (int64_t)destination_area * destination[c]) + (int64_t)both_area * blend_value<Mode>(source[c], destination[c]);
+			}
+			for (size_t c = 0; c < 3; ++c) result[c] = sum[c] <= 0 ? 0 : (uint8_t)std::min<int64_t>((sum[c] + divisor / 2) / divisor, 255);
+			result[3] = (uint8_t)color_manipulation::fixed_point_blend::div255(area);
+		}
+	}
+}
+
+void color_manipulation::fixed_point_blend::composite(const uint8_t * source, const uint8_t * destination, uint8_t * result, size_t count, porter_duff_operator op)
+{
+	COLORMAGIC_INSTRUMENT("fixed_point_blend::composite");
+
+	// Check input params
+	if (count > 0 && (source == nullptr || destination == nullptr || result == nullptr)) throw new std::invalid_argument("A buffer is null.");
+
+	// Whether the operator uses the source region, the destination region and which color fills the region of both,
+	// the flags of general_porter_duff() for every operator.
+	static const uint32_t regions[][4] =
+	{
+		{ 1, 0, 1, 0 }, // src
+		{ 0, 1, 0, 1 }, // dest
+		{ 0, 1, 1, 0 }, // atop
+		{ 1, 0, 0, 1 }, // dest_atop
+		{ 1, 1, 1, 0 }, // over
+		{ 1, 1, 0, 1 }, // dest_over
+		{ 0, 0, 1, 0 }, // in
+		{ 0, 0, 0, 1 }, // dest_in
+		{ 1, 0, 0, 0 }, // out
+		{ 0, 1, 0, 0 }, // dest_out
+		{ 1, 1, 0, 0 }, // xor
+		{ 0, 0, 0, 0 } // clear
+	};
+	if (op < SRC_OPERATOR || op > CLEAR_OPERATOR) throw new std::invalid_argument("Unknown porter duff operator.");
+	const uint32_t use_s = regions[op][0], use_d = regions[op][1], both_s = regions[op][2], both_d = regions[op][3];
+
+	// Every result channel is the average of the source and destination channel weighted by the areas they cover, all
+	// weights fit in 16 bits.
+	parallel::for_each_chunk(count, 4096, [&](size_t chunk, size_t begin, size_t end)
+	{
+		const uint8_t* s = source + begin * 4;
+		const uint8_t* d = destination + begin * 4;
+		uint8_t* r = result + begin * 4;
+		for (size_t i = begin; i < end; ++i, s += 4, d += 4, r += 4)
+		{
+			const uint32_t sa = s[3], da = d[3];
+			const uint32_t source_weight = use_s * sa * (255 - da) + both_s * sa * da;
+			const uint32_t destination_weight = use_d * da * (255 - sa) + both_d * sa * da;
+			const uint32_t area = source_weight + destination_weight;
+			const uint32_t half = area / 2;
+
+			uint32_t channels[4];
+			for (size_t c = 0; c < 3; ++c) channels[c] = area == 0 ? 0 : (source_weight * s[c] + destination_weight * d[c] + half) / area;
+			channels[3] = div255(area);
+			for (size_t c = 0; c < 4; ++c) r[c] = (uint8_t)channels[c];
+		}
+	});
+}
+
+void color_manipulation::fixed_point_blend::blend(const uint8_t * source, const uint8_t * destination, uint8_t * result, size_t count, premultiplied_blend_mode mode, bool use_source_region, bool use_destination_region)
+{
+	COLORMAGIC_INSTRUMENT("fixed_point_blend::blend");
+
+	// Check input params
+	if (count > 0 && (source == nullptr || destination == nullptr || result == nullptr)) throw new std::invalid_argument("A buffer is null.");
+
+	typedef void(*kernel)(const uint8_t*, const uint8_t*, uint8_t*, size_t, uint32_t, uint32_t);
+	static const kernel kernels[] =
+	{
+		blend_kernel<NORMAL_BLEND>, blend_kernel<MULTIPLY_BLEND>, blend_kernel<SCREEN_BLEND>,
+		blend_kernel<DARKEN_BLEND>, blend_kernel<LIGHTEN_BLEND>, blend_kernel<LINEAR_DODGE_BLEND>,
+		blend_kernel<LINEAR_BURN_BLEND>, blend_kernel<DIFFERENCE_BLEND>, blend_kernel<SUBTRACT_BLEND>,
+		blend_kernel<EXCLUSION_BLEND>
+	};
+	if (mode < NORMAL_BLEND || mode > EXCLUSION_BLEND) throw new std::invalid_argument("Unknown blend mode.");
+
+	const kernel blend_colors = kernels[mode];
+	const uint32_t use_source = use_source_region ? 1 : 0, use_destination = use_destination_region ? 1 : 0;
+	parallel::for_each_chunk(count, 4096, [&](size_t chunk, size_t begin, size_t end)
+	{
+		blend_colors(source + begin * 4, destination + begin * 4, result + begin * 4, end - begin, use_source, use_destination);
+	});
+}
@@ -0,0 +1,63 @@
+/// Copyright Martin Ruehlicke, 2019
+/// Use, modification and distribution are subject to the
+/// MIT Software License, Version 1.0.
+/// See accompanying file LICENSE.txt
+
+#pragma once
+
+#include "color_blend.h"
+#include "porter_duff.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace color_manipulation
+{
+	//! Static class for porter duff and blend operations on 8 bit colors.
+	/*!
+	* The colors are rgba values with straight alpha and 8 bits per channel, the layout of rgb_truecolor values. The
+	* functions give the results of the porter_duff and color_blend functions on rgb_truecolor objects within one code
+	* value, but compute them with integers only: the area of every region is an exact product of two alpha values and
+	* every result channel is the weighted sum of the channels divided once by the resulting alpha, rounded to nearest.
+	*/
+	class fixed_point_blend
+	{
+	public:
+		//! Static function that combines two buffers of 8 bit colors by using a porter duff operator.
+		/*!
+		* The buffers are processed in chunks on all cores.
+		* \param source The source colors, count * 4 values.
+		* \param destination The destination colors, count * 4 values.
+		* \param result Receives the combined colors, count * 4 values. May be the same as source or destination.
+		* \param count The number of colors.
+		* \param op The porter duff operator.
+		*/
+		static void composite(const uint8_t* source, const uint8_t* destination, uint8_t* result, size_t count, porter_duff_operator op);
+
+		//! Static function that blends two buffers of 8 bit colors.
+		/*!
+		* The buffers are processed in chunks on all cores.
+		* \param source The source colors, count * 4 values.
+		* \param destination The destination colors, count * 4 values.
+		* \param result Receives the blended colors, count * 4 values. May be the same as source or destination.
+		* \param count The number of colors.
+		* \param mode The separable blend mode.
+		* \param use_source_region Whether the source region of the resulting pixels will be blank
+		* or not.
+		* \param use_destination_region Whether the destination region of the resulting pixels will
+		* be blank or not.
+		*/
+		static void blend(const uint8_t* source, const uint8_t* destination, uint8_t* result, size_t count, premultiplied_blend_mode mode, bool use_source_region = true, bool use_destination_region = true);
+
+		//! Divides by 255 and rounds to nearest without a division.
+		/*!
+		* \param value A value up to 65535.
+		* \return The exact result of value / 255 rounded to nearest.
+		*/
+		static uint32_t div255(uint32_t value)
+		{
+			value += 128;
+			return (value + (value >> 8)) >> 8;
+		}
+	};
+}
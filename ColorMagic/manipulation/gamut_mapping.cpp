@@ -0,0 +1,192 @@
+#include "stdafx.h"
+#include "gamut_mapping.h"
+#include "color_converter.h"
+#include "..\utils\parallel.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+	//! Inverse of the lab companding function, see color_converter::lab_to_xyz_helper().
+	inline float lab_f_inverse(float t)
+	{
+		const float epsilon = 216.f / 24389.f, k = 24389.f / 27.f;
+		const float cube = t * t * t;
+		return cube > epsilon ? cube : (116.f * t - 16.f) / k;
+	}
+}
+
+color_manipulation::gamut_boundary::gamut_boundary(color_space::rgb_color_space_definition * rgb_color_space)
+	: m_to_rgb(rgb_color_space->get_inverse_transform_matrix()), m_table(lightness_steps * hue_steps, 0.f)
+{
+	auto white = rgb_color_space->get_white_point();
+	m_white = { white->get_tristimulus_x(), white->get_tristimulus_y(), white->get_tristimulus_z() };
+
+	// Black and white have no chroma, the rows stay 0.
+	parallel::for_each_chunk(lightness_steps - 2, 4, [&](size_t chunk, size_t begin, size_t end)
+	{
+		for (size_t l = begin + 1; l < end + 1; ++l)
+		{
+			for (size_t h = 0; h < hue_steps; ++h)
+			{
+				m_table[l * hue_steps + h] = search_max_chroma((float)l, (float)h * 360.f / hue_steps);
+			}
+		}
+	});
+}
+
+float color_manipulation::gamut_boundary::max_chroma(float luminance, float hue) const
+{
+	const float l = std::min(std::max(luminance, 0.f), 100.f) * (lightness_steps - 1) / 100.f;
+	float h = std::fmod(hue, 360.f) * hue_steps / 360.f;
+	if (h < 0.f) h += hue_steps;
+
+	const size_t l0 = std::min((size_t)l, lightness_steps - 2);
+	const size_t h0 = std::min((size_t)h, hue_steps - 1);
+	const size_t h1 = (h0 + 1) % hue_steps;
+	const float fl = l - l0, fh = h - h0;
+
+	const float* row0 = m_table.data() + l0 * hue_steps;
+	const float* row1 = row0 + hue_steps;
+	const float c0 = row0[h0] + (row0[h1] - row0[h0]) * fh;
+	const float c1 = row1[h0] + (row1[h1] - row1[h0]) * fh;
+	return c0 + (c1 - c0) * fl;
+}
+
+bool color_manipulation::gamut_boundary::contains(float luminance, float a, float b) const
+{
+	const float f_y = (luminance + 16.f) / 116.f;
+	const float xyz[3] = { lab_f_inverse(f_y + a / 500.f) * m_white[0], lab_f_inverse(f_y) * m_white[1], lab_f_inverse(f_y - b / 200.f) * m_white[2] };
+
+	float rgb[3];
+	m_to_rgb.multiply(xyz, rgb);
+
+	const float tolerance = 1e-4f;
+	for (float value : rgb)
+	{
+		if (value < -tolerance || value > 1.f + tolerance) return false;
+	}
+	return true;
+}
+
+std::vector<float> color_manipulation::gamut_boundary::max_chroma(const color_buffer & colors) const
+{
+	std::vector<float> result(colors.size());
+	parallel::for_each_chunk(colors.size(), 4096, [&](size_t chunk, size_t begin, size_t end)
+	{
+		float lab[5];
+		for (size_t i = begin; i < end; ++i)
+		{
+			color_converter::convert_values(colors.get_color_type(), colors.pixel(i), colors.get_rgb_color_space(), color_type::LAB, lab);
+			float hue = std::atan2(lab[2], lab[1]) * 180.f / (float)M_PI;
+			if (hue < 0.f) hue += 360.f;
+			result[i] = max_chroma(lab[0], hue);
+		}
+	});
+	return result;
+}
+
+std::vector<uint8_t> color_manipulation::gamut_boundary::contains(const color_buffer & colors) const
+{
+	std::vector<uint8_t> result(colors.size());
+	parallel::for_each_chunk(colors.size(), 4096, [&](size_t chunk, size_t begin, size_t end)
+	{
+		float lab[5];
+		for (size_t i = begin; i < end; ++i)
+		{
+			color_converter::convert_values(colors.get_color_type(), colors.pixel(i), colors.get_rgb_color_space(), color_type::LAB, lab);
+			result[i] = contains(lab[0], lab[1], lab[2]) ? 1 : 0;
+		}
+	});
+	return result;
+}
+
+float color_manipulation::gamut_boundary::search_max_chroma(float luminance, float hue) const
+{
+	const float angle = hue * (float)M_PI / 180.f;
+	const float cos_h = std::cos(angle), sin_h = std::sin(angle);
+
+	float low = 0.f, high = 200.f;
+	for (int i = 0; i < 20; ++i)
+	{
+		const float chroma = (low + high) / 2.f;
+		if (contains(luminance, chroma * cos_h, chroma * sin_h)) low = chroma;
+		else high = chroma;
+	}
+	return low;
+}
+
+std::shared_ptr<const color_manipulation::gamut_boundary> color_space::rgb_color_space_definition::get_gamut_boundary()
+{
+	auto boundary = std::atomic_load(&m_gamut_boundary);
+	if (boundary) return boundary;
+
+	// The first finished build wins, a concurrent build is discarded.
+	std::shared_ptr<const color_manipulation::gamut_boundary> built = std::make_shared<const color_manipulation::gamut_boundary>(this);
+	if (std::atomic_compare_exchange_strong(&m_gamut_boundary, &boundary, built)) return built;
+	return boundary;
+}
+
+color_manipulation::gamut_mapping::gamut_mapping(color_space::rgb_color_space_definition * rgb_color_space, gamut_mapping_method method, float knee)
+	: m_rgb_color_space(rgb_color_space), m_method(method), m_knee(knee), m_boundary(rgb_color_space->get_gamut_boundary())
+{
+	if (knee < 0.f || knee >= 1.f) throw new std::invalid_argument("The knee has to be in the range [0,1).");
+}
+
+float color_manipulation::gamut_mapping::map_chroma(float luminance, float chroma, float hue) const
+{
+	const float max_chroma = m_boundary->max_chroma(luminance, hue);
+	if (m_method == CLIP_CHROMA) return std::min(chroma, max_chroma);
+
+	// Soft knee: unchanged up to the knee, above it the infinite range is compressed into the rest up to the boundary.
+	const float knee = m_knee * max_chroma;
+	if (chroma <= knee) return chroma;
+
+	const float range = max_chroma - knee;
+	return range > 0.f ? knee + range * std::tanh((chroma - knee) / range) : knee;
+}
+
+color_space::rgb_deepcolor color_manipulation::gamut_mapping::to_rgb_deep(const color_space::color_base & color) const
+{
+	float values[5], rgb[4];
+	std::copy(color.get_components().begin(), color.get_components().end(), values);
+	values[color.get_components().size()] = color.alpha();
+
+	map_values(color.get_color_type(), values, color.get_rgb_color_space(), rgb);
+	return color_space::rgb_deepcolor(rgb[0], rgb[1], rgb[2], rgb[3], m_rgb_color_space);
+}
+
+color_buffer color_manipulation::gamut_mapping::to_rgb_deep(const color_buffer & colors) const
+{
+	color_buffer result(color_type::RGB_DEEP, m_rgb_color_space, colors.size());
+	parallel::for_each_chunk(colors.size(), 4096, [&](size_t chunk, size_t begin, size_t end)
+	{
+		for (size_t i = begin; i < end; ++i)
+		{
+			map_values(colors.get_color_type(), colors.pixel(i), colors.get_rgb_color_space(), result.pixel(i));
+		}
+	});
+	return result;
+}
+
+void color_manipulation::gamut_mapping::map_values(color_type type, const float * values, color_space::rgb_color_space_definition * rgb_color_space, float * rgb) const
+{
+	float lab[5];
+	color_converter::convert_values(type, values, rgb_color_space, color_type::LAB, lab);
+
+	const float chroma = std::sqrt(lab[1] * lab[1] + lab[2] * lab[2]);
+	if (chroma > 0.f)
+	{
+		float hue = std::atan2(lab[2], lab[1]) * 180.f / (float)M_PI;
+		if (hue < 0.f) hue += 360.f;
+
+		const float scale = map_chroma(lab[0], chroma, hue) / chroma;
+		lab[1] *= scale;
+		lab[2] *= scale;
+	}
+
+	auto mapped = color_converter::to_rgb_deep(color_space::lab(lab[0], lab[1], lab[2], lab[3], m_rgb_color_space));
+	std::copy(mapped.get_components().begin(), mapped.get_components().end(), rgb);
+	rgb[3] = mapped.alpha();
+}
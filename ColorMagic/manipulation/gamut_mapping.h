@@ -0,0 +1,129 @@
+/// Copyright Martin Ruehlicke, 2019
+/// Use, modification and distribution are subject to the
+/// MIT Software License, Version 1.0.
+/// See accompanying file LICENSE.txt
+
+#pragma once
+
+#include "..\spaces\color_base.h"
+#include "..\spaces\rgb_deepcolor.h"
+#include "..\spaces\rgb_color_space_definition.h"
+#include "..\utils\color_buffer.h"
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace color_manipulation
+{
+	//! Maximum chroma of an rgb color space per lightness and hue.
+	/*!
+	* The boundary is sampled once for every integer L* in [0,100] and every degree of hue by a binary search along the
+	* chroma axis in lch_ab. Queries interpolate bilinearly between the samples.
+	* Use rgb_color_space_definition::get_gamut_boundary() to share one boundary per rgb color space instead of
+	* sampling it again.
+	*/
+	class gamut_boundary
+	{
+	public:
+		//! Default constructor.
+		/*!
+		* \param rgb_color_space The rgb color space definition whose gamut is sampled.
+		*/
+		gamut_boundary(color_space::rgb_color_space_definition* rgb_color_space);
+
+		//! Returns the maximum chroma (lch_ab) of the rgb color space at a lightness and hue.
+		/*!
+		* \param luminance The L* value in the range [0,100].
+		* \param hue The hue in degrees.
+		*/
+		float max_chroma(float luminance, float hue) const;
+
+		//! Returns whether a lab color lies inside the rgb color space.
+		/*!
+		* Computed exactly from the primaries, without the boundary table.
+		*/
+		bool contains(float luminance, float a, float b) const;
+
+		//! Returns the maximum chroma at the lightness and hue of every color in a buffer.
+		/*!
+		* The colors are converted to lab and processed in chunks on all cores.
+		* Lab values are interpreted relative to the white point of this boundary.
+		*/
+		std::vector<float> max_chroma(const color_buffer& colors) const;
+
+		//! Returns whether every color in a buffer lies inside the rgb color space.
+		/*!
+		* The colors are converted to lab and processed in chunks on all cores.
+		* Lab values are interpreted relative to the white point of this boundary.
+		* \return 1 for every color inside the gamut, 0 otherwise.
+		*/
+		std::vector<uint8_t> contains(const color_buffer& colors) const;
+
+		//! Number of lightness samples.
+		static const size_t lightness_steps = 101;
+
+		//! Number of hue samples.
+		static const size_t hue_steps = 360;
+
+	private:
+		float search_max_chroma(float luminance, float hue) const;
+
+		std::array<float, 3> m_white;
+		matrix<float> m_to_rgb;
+		std::vector<float> m_table;
+	};
+
+	//! Enum that defines how out of gamut colors are brought into the gamut.
+	enum gamut_mapping_method
+	{
+		CLIP_CHROMA = 0, /*!< CLIP_CHROMA - reduces the chroma of out of gamut colors to the boundary, lightness and hue are kept */
+		SOFT_KNEE /*!< SOFT_KNEE - compresses all chroma above a knee smoothly into the remaining range up to the boundary */
+	};
+
+	//! Gamut mapping to an rgb color space.
+	/*!
+	* Instead of clamping every rgb channel like color_converter::xyz_to_rgb_deep(), which shifts the hue of saturated
+	* colors, the colors are mapped in lch_ab towards the L* axis. The gamut boundary is the cached boundary of the rgb
+	* color space, so mapping a color costs a table lookup and an interpolation.
+	*/
+	class gamut_mapping
+	{
+	public:
+		//! Default constructor.
+		/*!
+		* \param rgb_color_space The target rgb color space definition.
+		* \param method The mapping method.
+		* \param knee The fraction of the maximum chroma up to which SOFT_KNEE keeps colors unchanged, in the range [0,1).
+		*/
+		gamut_mapping(color_space::rgb_color_space_definition* rgb_color_space, gamut_mapping_method method = CLIP_CHROMA, float knee = 0.8f);
+
+		//! Returns the mapped chroma of an lch_ab color.
+		float map_chroma(float luminance, float chroma, float hue) const;
+
+		//! Maps a color of any color type into the gamut.
+		/*!
+		* \return The mapped color in the target rgb color space.
+		*/
+		color_space::rgb_deepcolor to_rgb_deep(const color_space::color_base& color) const;
+
+		//! Maps a buffer of colors of any color type into the gamut.
+		/*!
+		* The buffer is processed in chunks on all cores.
+		* \return A new buffer of rgb deep colors in the target rgb color space.
+		*/
+		color_buffer to_rgb_deep(const color_buffer& colors) const;
+
+		//! Returns the gamut boundary of the target rgb color space.
+		const gamut_boundary& get_boundary() const { return *m_boundary; }
+
+	private:
+		void map_values(color_type type, const float* values, color_space::rgb_color_space_definition* rgb_color_space, float* rgb) const;
+
+		color_space::rgb_color_space_definition* m_rgb_color_space;
+		gamut_mapping_method m_method;
+		float m_knee;
+		std::shared_ptr<const gamut_boundary> m_boundary;
+	};
+}
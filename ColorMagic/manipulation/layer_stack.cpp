@@ -0,0 +1,242 @@
+#include "stdafx.h"
+#include "layer_stack.h"
+#include "..\utils\instrumentation.h"
+#include "..\utils\parallel.h"
+
+#include <algorithm>
+
+const size_t color_manipulation::layer_stack::up_to_date;
+
+color_manipulation::layer_stack::layer_stack(color_space::rgb_color_space_definition * rgb_color_space, size_t width, size_t height, size_t tile_size, size_t cache_interval)
+	: m_rgb_color_space(rgb_color_space), m_width(width), m_height(height), m_tile_size(tile_size), m_cache_interval(cache_interval), m_result(rgb_color_space, width * height)
+{
+	// Check input params
+	if (width == 0 || height == 0) throw new std::invalid_argument("The image must not be empty.");
+	if (tile_size == 0) throw new std::invalid_argument("The tile size must be at least 1.");
+	if (cache_interval == 0) throw new std::invalid_argument("The cache interval must be at least 1.");
+
+	m_tiles_x = parallel::chunk_count(width, tile_size);
+	const size_t tiles_y = parallel::chunk_count(height, tile_size);
+	for (size_t ty = 0; ty < tiles_y; ++ty)
+	{
+		for (size_t tx = 0; tx < m_tiles_x; ++tx)
+		{
+			tile t;
+			t.x = tx * tile_size;
+			t.y = ty * tile_size;
+			t.width = std::min(tile_size, width - t.x);
+			t.height = std::min(tile_size, height - t.y);
+			t.dirty_layer = up_to_date;
+			m_tiles.push_back(t);
+		}
+	}
+}
+
+size_t color_manipulation::layer_stack::add_layer(premultiplied_blend_mode mode, float opacity, porter_duff_operator op)
+{
+	layer l;
+	l.mode = mode;
+	l.opacity = std::min(std::max(opacity, 0.f), 1.f);
+	l.op = op;
+	for (const tile& t : m_tiles) l.tiles.push_back(premultiplied_buffer(m_rgb_color_space, t.width * t.height));
+	m_layers.push_back(l);
+
+	// A transparent layer still changes the image for operators like src or clear.
+	const size_t index = m_layers.size() - 1;
+	for (size_t i = 0; i < m_tiles.size(); ++i)
+	{
+		if (m_layers.size() % m_cache_interval == 0) m_tiles[i].cache.push_back(premultiplied_buffer(m_rgb_color_space, m_tiles[i].width * m_tiles[i].height));
+		invalidate_tile(i, index);
+	}
+	return index;
+}
+
+void color_manipulation::layer_stack::remove_layer(size_t layer)
+{
+	check_layer(layer);
+
+	m_layers.erase(m_layers.begin() + layer);
+	for (size_t i = 0; i < m_tiles.size(); ++i)
+	{
+		std::vector<premultiplied_buffer>& cache = m_tiles[i].cache;
+		cache.erase(cache.begin() + m_layers.size() / m_cache_interval, cache.end());
+		invalidate_tile(i, layer);
+	}
+}
+
+color_manipulation::premultiplied_blend_mode color_manipulation::layer_stack::get_blend_mode(size_t layer) const
+{
+	check_layer(layer);
+	return m_layers[layer].mode;
+}
+
+void color_manipulation::layer_stack::set_blend_mode(size_t layer, premultiplied_blend_mode mode)
+{
+	check_layer(layer);
+	if (m_layers[layer].mode == mode) return;
+	m_layers[layer].mode = mode;
+	invalidate(layer, 0, 0, m_width, m_height);
+}
+
+float color_manipulation::layer_stack::get_opacity(size_t layer) const
+{
+	check_layer(layer);
+	return m_layers[layer].opacity;
+}
+
+void color_manipulation::layer_stack::set_opacity(size_t layer, float opacity)
+{
+	check_layer(layer);
+	opacity = std::min(std::max(opacity, 0.f), 1.f);
+	if (m_layers[layer].opacity == opacity) return;
+	m_layers[layer].opacity = opacity;
+	invalidate(layer, 0, 0, m_width, m_height);
+}
+
+color_manipulation::porter_duff_operator color_manipulation::layer_stack::get_operator(size_t layer) const
+{
+	check_layer(layer);
+	return m_layers[layer].op;
+}
+
+void color_manipulation::layer_stack::set_operator(size_t layer, porter_duff_operator op)
+{
+	check_layer(layer);
+	if (m_layers[layer].op == op) return;
+	m_layers[layer].op = op;
+	invalidate(layer, 0, 0, m_width, m_height);
+}
+
+void color_manipulation::layer_stack::set_pixels(size_t layer, size_t x, size_t y, const color_buffer & colors, size_t width)
+{
+	COLORMAGIC_INSTRUMENT("layer_stack::set_pixels");
+
+	// Check input params
+	check_layer(layer);
+	if (width == 0 || colors.size() % width != 0) throw new std::invalid_argument("The number of colors is not a multiple of the width.");
+	if (colors.get_rgb_color_space() != m_rgb_color_space) throw new std::invalid_argument("The rgb color space definitions of the colors and the layer stack do not match.");
+	const size_t height = colors.size() / width;
+	if (x + width > m_width || y + height > m_height) throw new std::invalid_argument("The rectangle exceeds the image.");
+	if (height == 0) return;
+
+	const premultiplied_buffer premultiplied(colors);
+	for (size_t ty = y / m_tile_size; ty <= (y + height - 1) / m_tile_size; ++ty)
+	{
+		for (size_t tx = x / m_tile_size; tx <= (x + width - 1) / m_tile_size; ++tx)
+		{
+			// Copy the rows of the intersection of the rectangle and the tile.
+			const size_t index = ty * m_tiles_x + tx;
+			const tile& t = m_tiles[index];
+			const size_t left = std::max(x, t.x), right = std::min(x + width, t.x + t.width);
+			const size_t top = std::max(y, t.y), bottom = std::min(y + height, t.y + t.height);
+			premultiplied_buffer& pixels = m_layers[layer].tiles[index];
+			for (size_t row = top; row < bottom; ++row)
+			{
+				const float* first = premultiplied.pixel((row - y) * width + left - x);
+				std::copy(first, first + (right - left) * premultiplied_buffer::channels, pixels.pixel((row - t.y) * t.width + left - t.x));
+			}
+			invalidate_tile(index, layer);
+		}
+	}
+}
+
+void color_manipulation::layer_stack::invalidate(size_t layer, size_t x, size_t y, size_t width, size_t height)
+{
+	check_layer(layer);
+
+	// Only the part inside of the image matters.
+	if (x >= m_width || y >= m_height) return;
+	width = std::min(width, m_width - x);
+	height = std::min(height, m_height - y);
+	if (width == 0 || height == 0) return;
+
+	for (size_t ty = y / m_tile_size; ty <= (y + height - 1) / m_tile_size; ++ty)
+	{
+		for (size_t tx = x / m_tile_size; tx <= (x + width - 1) / m_tile_size; ++tx) invalidate_tile(ty * m_tiles_x + tx, layer);
+	}
+}
+
+size_t color_manipulation::layer_stack::dirty_tile_count() const
+{
+	return std::count_if(m_tiles.begin(), m_tiles.end(), [](const tile& t) { return t.dirty_layer != up_to_date; });
+}
+
+const premultiplied_buffer & color_manipulation::layer_stack::evaluate()
+{
+	COLORMAGIC_INSTRUMENT("layer_stack::evaluate");
+
+	std::vector<size_t> dirty;
+	for (size_t i = 0; i < m_tiles.size(); ++i)
+	{
+		if (m_tiles[i].dirty_layer != up_to_date) dirty.push_back(i);
+	}
+
+	// Every tile is an independent job, the buffers of a thread are reused for all of its tiles.
+	parallel::for_each_chunk(dirty.size(), 1, [&](size_t chunk, size_t begin, size_t end)
+	{
+		premultiplied_buffer result(m_rgb_color_space), source(m_rgb_color_space), blended(m_rgb_color_space);
+		for (size_t i = begin; i < end; ++i) composite_tile(dirty[i], result, source, blended);
+	});
+	return m_result;
+}
+
+color_buffer color_manipulation::layer_stack::to_color_buffer(color_type type)
+{
+	return evaluate().to_color_buffer(type);
+}
+
+void color_manipulation::layer_stack::check_layer(size_t layer) const
+{
+	if (layer >= m_layers.size()) throw new std::invalid_argument("The layer does not exist.");
+}
+
+void color_manipulation::layer_stack::invalidate_tile(size_t tile, size_t layer)
+{
+	m_tiles[tile].dirty_layer = std::min(m_tiles[tile].dirty_layer, layer);
+}
+
+void color_manipulation::layer_stack::composite_tile(size_t index, premultiplied_buffer & result, premultiplied_buffer & source, premultiplied_buffer & blended)
+{
+	tile& t = m_tiles[index];
+	const size_t count = t.width * t.height, values = count * premultiplied_buffer::channels;
+
+	// Start with the last cached composite below the lowest changed layer.
+	const size_t cached = std::min(t.dirty_layer, m_layers.size()) / m_cache_interval;
+	result.resize(count);
+	if (cached > 0) std::copy(t.cache[cached - 1].data(), t.cache[cached - 1].data() + values, result.data());
+	else std::fill(result.data(), result.data() + values, 0.f);
+
+	for (size_t l = cached * m_cache_interval; l < m_layers.size(); ++l)
+	{
+		const layer& current = m_layers[l];
+		const premultiplied_buffer* layer_source = &current.tiles[index];
+
+		// The opacity scales all premultiplied values alike.
+		if (current.opacity < 1.f)
+		{
+			source.resize(count);
+			const float* first = layer_source->data();
+			std::transform(first, first + values, source.data(), [&](float value) { return value * current.opacity; });
+			layer_source = &source;
+		}
+
+		// Blending without the regions of both colors gives the blended source color with the source alpha.
+		if (current.mode != NORMAL_BLEND)
+		{
+			blended.resize(count);
+			std::copy(result.data(), result.data() + values, blended.data());
+			color_blend::blend(*layer_source, blended, current.mode, true, false);
+			layer_source = &blended;
+		}
+
+		porter_duff::composite(*layer_source, result, current.op);
+		if ((l + 1) % m_cache_interval == 0) std::copy(result.data(), result.data() + values, t.cache[(l + 1) / m_cache_interval - 1].data());
+	}
+
+	for (size_t row = 0; row < t.height; ++row)
+	{
+		const float* first = result.pixel(row * t.width);
+		std::copy(first, first + t.width * premultiplied_buffer::channels, m_result.pixel((t.y + row) * m_width + t.x));
+	}
+	t.dirty_layer = up_to_date;
+}
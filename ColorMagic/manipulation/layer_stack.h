@@ -0,0 +1,164 @@
+/// Copyright Martin Ruehlicke, 2019
+/// Use, modification and distribution are subject to the
+/// MIT Software License, Version 1.0.
+/// See accompanying file LICENSE.txt
+
+#pragma once
+
+#include "color_blend.h"
+#include "porter_duff.h"
+#include "..\spaces\rgb_color_space_definition.h"
+#include "..\utils\color_buffer.h"
+#include "..\utils\premultiplied_buffer.h"
+
+#include <cstddef>
+#include <vector>
+
+namespace color_manipulation
+{
+	//! Stack of layers that is recomposited incrementally.
+	/*!
+	* Every layer covers the whole image and has a blend mode, an opacity and a porter duff operator. The layers are
+	* composited from the bottom to the top onto a transparent image: the source color of a layer is first blended with
+	* the composite below it like color_blend::blend() and then combined with that composite like
+	* porter_duff::composite().
+	*
+	* The image is divided into square tiles. Per tile the stack remembers the lowest layer that changed since the last
+	* evaluate() and caches the composite of every cache_interval layers. evaluate() therefore only recomposites the
+	* tiles touched by a change, and in every such tile only the layers from the last cached composite below the lowest
+	* changed layer upward. The colors are stored premultiplied, so no step divides by alpha.
+	*/
+	class layer_stack
+	{
+	public:
+		//! Default constructor.
+		/*!
+		* \param rgb_color_space The rgb color space definition of all layers.
+		* \param width The width of the image in pixels.
+		* \param height The height of the image in pixels.
+		* \param tile_size The width and height of a tile in pixels.
+		* \param cache_interval The number of layers between two cached composites, 1 caches the composite after every
+		* layer. Larger values need less memory but recomposite more layers.
+		*/
+		layer_stack(color_space::rgb_color_space_definition* rgb_color_space, size_t width, size_t height, size_t tile_size = 64, size_t cache_interval = 1);
+
+		//! Returns the width of the image in pixels.
+		size_t width() const { return m_width; }
+
+		//! Returns the height of the image in pixels.
+		size_t height() const { return m_height; }
+
+		//! Returns the width and height of a tile in pixels.
+		size_t tile_size() const { return m_tile_size; }
+
+		//! Returns the number of tiles.
+		size_t tile_count() const { return m_tiles.size(); }
+
+		//! Returns the number of layers.
+		size_t layer_count() const { return m_layers.size(); }
+
+		//! Returns the rgb color space definition of all layers.
+		color_space::rgb_color_space_definition* get_rgb_color_space() const { return m_rgb_color_space; }
+
+		//! Adds a transparent layer on top of the stack.
+		/*!
+		* \param mode The blend mode of the layer.
+		* \param opacity The opacity of the layer (0-1).
+		* \param op The porter duff operator of the layer.
+		* \return The index of the new layer, the bottom layer has the index 0.
+		*/
+		size_t add_layer(premultiplied_blend_mode mode = NORMAL_BLEND, float opacity = 1.f, porter_duff_operator op = OVER_OPERATOR);
+
+		//! Removes a layer, the layers above it move down by one index.
+		void remove_layer(size_t layer);
+
+		//! Returns the blend mode of a layer.
+		premultiplied_blend_mode get_blend_mode(size_t layer) const;
+
+		//! Sets the blend mode of a layer.
+		void set_blend_mode(size_t layer, premultiplied_blend_mode mode);
+
+		//! Returns the opacity of a layer.
+		float get_opacity(size_t layer) const;
+
+		//! Sets the opacity (0-1) of a layer.
+		void set_opacity(size_t layer, float opacity);
+
+		//! Returns the porter duff operator of a layer.
+		porter_duff_operator get_operator(size_t layer) const;
+
+		//! Sets the porter duff operator of a layer.
+		void set_operator(size_t layer, porter_duff_operator op);
+
+		//! Replaces the pixels of a rectangle of a layer.
+		/*!
+		* The rectangle is marked as changed.
+		* \param layer The index of the layer.
+		* \param x The left edge of the rectangle.
+		* \param y The top edge of the rectangle.
+		* \param colors The colors of the rectangle row by row, any color type with the rgb color space definition of the
+		* stack.
+		* \param width The width of the rectangle, the height is the number of colors divided by the width.
+		*/
+		void set_pixels(size_t layer, size_t x, size_t y, const color_buffer& colors, size_t width);
+
+		//! Marks a rectangle of a layer as changed.
+		/*!
+		* \param layer The index of the layer.
+		* \param x The left edge of the rectangle.
+		* \param y The top edge of the rectangle.
+		* \param width The width of the rectangle.
+		* \param height The height of the rectangle.
+		*/
+		void invalidate(size_t layer, size_t x, size_t y, size_t width, size_t height);
+
+		//! Returns the number of tiles that will be recomposited by the next evaluate().
+		size_t dirty_tile_count() const;
+
+		//! Recomposites the changed tiles.
+		/*!
+		* The tiles are processed on all cores.
+		* \return The premultiplied composite of all layers, width * height colors row by row.
+		*/
+		const premultiplied_buffer& evaluate();
+
+		//! Returns the composite of all layers as straight alpha colors.
+		/*!
+		* \param type The color type of the result.
+		*/
+		color_buffer to_color_buffer(color_type type = color_type::RGB_DEEP);
+
+	private:
+		//! A layer, its pixels are stored per tile.
+		struct layer
+		{
+			premultiplied_blend_mode mode;
+			float opacity;
+			porter_duff_operator op;
+			std::vector<premultiplied_buffer> tiles;
+		};
+
+		//! A tile of the image.
+		struct tile
+		{
+			size_t x, y, width, height;
+			//! The lowest layer that changed, up_to_date if the tile did not change.
+			size_t dirty_layer;
+			//! The composites of the first (i + 1) * cache_interval layers.
+			std::vector<premultiplied_buffer> cache;
+		};
+
+		//! Marks a tile without changes.
+		static const size_t up_to_date = static_cast<size_t>(-1);
+
+		void check_layer(size_t layer) const;
+		void invalidate_tile(size_t tile, size_t layer);
+		void composite_tile(size_t index, premultiplied_buffer& result, premultiplied_buffer& source, premultiplied_buffer& blended);
+
+		color_space::rgb_color_space_definition* m_rgb_color_space;
+		size_t m_width, m_height, m_tile_size, m_cache_interval, m_tiles_x;
+		std::vector<layer> m_layers;
+		std::vector<tile> m_tiles;
+		premultiplied_buffer m_result;
+	};
+}
@@ -0,0 +1,225 @@
+#include "stdafx.h"
+#include "ordered_dither.h"
+#include "color_converter.h"
+#include "..\utils\parallel.h"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+namespace
+{
+	std::vector<float> bayer_ranks(size_t size)
+	{
+		std::vector<float> ranks(1, 0.f);
+		for (size_t n = 1; n < size; n *= 2)
+		{
+			// M(2n) = [4M, 4M + 2; 4M + 3, 4M + 1]
+			std::vector<float> next(4 * n * n);
+			for (size_t y = 0; y < n; ++y)
+			{
+				for (size_t x = 0; x < n; ++x)
+				{
+					const float value = 4.f * ranks[y * n + x];
+					next[y * 2 * n + x] = value;
+					next[y * 2 * n + x + n] = value + 2.f;
+					next[(y + n) * 2 * n + x] = value + 3.f;
+					next[(y + n) * 2 * n + x + n] = value + 1.f;
+				}
+			}
+			ranks.swap(next);
+		}
+		return ranks;
+	}
+
+	//! Creates the ranks of a blue noise matrix with the void and cluster method (Ulichney 1993).
+	std::vector<float> blue_noise_ranks(size_t size)
+	{
+		const int n = (int)size, radius = 5;
+		const float sigma = 1.5f;
+
+		std::vector<float> gaussian((2 * radius + 1) * (2 * radius + 1));
+		for (int dy = -radius; dy <= radius; ++dy)
+		{
+			for (int dx = -radius; dx <= radius; ++dx)
+			{
+				gaussian[(dy + radius) * (2 * radius + 1) + dx + radius] = std::exp(-(dx * dx + dy * dy) / (2.f * sigma * sigma));
+			}
+		}
+
+		std::vector<char> pattern(n * n, 0);
+		std::vector<float> energy(n * n, 0.f);
+		auto toggle = [&](int index, bool set)
+		{
+			pattern[index] = set ? 1 : 0;
+			const int x = index % n, y = index / n;
+			for (int dy = -radius; dy <= radius; ++dy)
+			{
+				for (int dx = -radius; dx <= radius; ++dx)
+				{
+					const float value = gaussian[(dy + radius) * (2 * radius + 1) + dx + radius];
+					energy[((y + dy + n) % n) * n + (x + dx + n) % n] += set ? value : -value;
+				}
+			}
+		};
+		// The tightest cluster is the set pixel with the highest energy, the largest void the free pixel with the lowest.
+		auto tightest_cluster = [&]()
+		{
+			int best = -1;
+			for (int i = 0; i < n * n; ++i)
+			{
+				if (pattern[i] && (best < 0 || energy[i] > energy[best])) best = i;
+			}
+			return best;
+		};
+		auto largest_void = [&]()
+		{
+			int best = -1;
+			for (int i = 0; i < n * n; ++i)
+			{
+				if (!pattern[i] && (best < 0 || energy[i] < energy[best])) best = i;
+			}
+			return best;
+		};
+
+		// Initial pattern with 10% of the pixels set, relaxed until the tightest cluster is the largest void.
+		std::mt19937 random(1993);
+		const int initial = n * n / 10;
+		for (int set = 0; set < initial;)
+		{
+			const int index = std::uniform_int_distribution<int>(0, n * n - 1)(random);
+			if (!pattern[index])
+			{
+				toggle(index, true);
+				++set;
+			}
+		}
+		for (int iteration = 0; iteration < n * n; ++iteration)
+		{
+			const int cluster = tightest_cluster();
+			toggle(cluster, false);
+			const int gap = largest_void();
+			toggle(gap, true);
+			if (gap == cluster) break;
+		}
+
+		std::vector<float> ranks(n * n, 0.f);
+		const std::vector<char> initial_pattern = pattern;
+		const std::vector<float> initial_energy = energy;
+		for (int rank = initial - 1; rank >= 0; --rank)
+		{
+			const int cluster = tightest_cluster();
+			toggle(cluster, false);
+			ranks[cluster] = (float)rank;
+		}
+
+		pattern = initial_pattern;
+		energy = initial_energy;
+		for (int rank = initial; rank < n * n; ++rank)
+		{
+			const int gap = largest_void();
+			toggle(gap, true);
+			ranks[gap] = (float)rank;
+		}
+		return ranks;
+	}
+
+	const std::vector<float>& blue_noise()
+	{
+		static const std::vector<float> ranks = blue_noise_ranks(64);
+		return ranks;
+	}
+}
+
+color_manipulation::ordered_dither::ordered_dither(dither_matrix matrix)
+{
+	switch (matrix)
+	{
+	case BAYER_2: m_size = 2; m_thresholds = bayer_ranks(2); break;
+	case BAYER_4: m_size = 4; m_thresholds = bayer_ranks(4); break;
+	case BAYER_8: m_size = 8; m_thresholds = bayer_ranks(8); break;
+	case BAYER_16: m_size = 16; m_thresholds = bayer_ranks(16); break;
+	case BLUE_NOISE: m_size = 64; m_thresholds = blue_noise(); break;
+	default: throw new std::invalid_argument("The dither matrix is not defined.");
+	}
+
+	// Ranks to thresholds centered around 0.
+	const float count = (float)m_thresholds.size();
+	for (auto& value : m_thresholds) value = (value + 0.5f) / count - 0.5f;
+}
+
+color_buffer color_manipulation::ordered_dither::to_rgb_true(const color_buffer & colors, size_t width) const
+{
+	std::vector<uint8_t> rgba(colors.size() * 4);
+	dither_8bit(colors, width, rgba.data());
+
+	color_buffer result(color_type::RGB_TRUE, colors.get_rgb_color_space(), colors.size());
+	std::copy(rgba.begin(), rgba.end(), result.data());
+	return result;
+}
+
+void color_manipulation::ordered_dither::to_rgba8(const color_buffer & colors, size_t width, uint8_t * rgba) const
+{
+	dither_8bit(colors, width, rgba);
+}
+
+std::vector<uint8_t> color_manipulation::ordered_dither::to_palette(const color_buffer & colors, size_t width, const palette_search & palette, float spread) const
+{
+	if (width == 0 || colors.size() % width != 0) throw new std::invalid_argument("The size of the image has to be a multiple of its width.");
+	if (palette.size() > 256) throw new std::invalid_argument("Ordered dithering supports palettes of at most 256 colors.");
+
+	// n evenly distributed colors have n^(1/3) levels per channel.
+	if (spread <= 0.f) spread = 1.f / std::max(std::cbrt((float)palette.size()) - 1.f, 1.f);
+
+	std::vector<uint8_t> indices(colors.size());
+	parallel::for_each_chunk(colors.size() / width, 16, [&](size_t chunk, size_t begin, size_t end)
+	{
+		float values[5];
+		for (size_t y = begin; y < end; ++y)
+		{
+			for (size_t x = 0; x < width; ++x)
+			{
+				const size_t i = y * width + x;
+				color_converter::convert_values(colors.get_color_type(), colors.pixel(i), colors.get_rgb_color_space(), color_type::RGB_DEEP, values);
+
+				const float offset = spread * threshold(x, y);
+				for (size_t c = 0; c < 3; ++c) values[c] = std::min(std::max(values[c] + offset, 0.f), 1.f);
+				indices[i] = (uint8_t)palette.nearest_rgb(values);
+			}
+		}
+	});
+	return indices;
+}
+
+void color_manipulation::ordered_dither::dither_8bit(const color_buffer & colors, size_t width, uint8_t * rgba) const
+{
+	if (width == 0 || colors.size() % width != 0) throw new std::invalid_argument("The size of the image has to be a multiple of its width.");
+
+	const bool convert = colors.get_color_type() != color_type::RGB_DEEP;
+	parallel::for_each_chunk(colors.size() / width, 16, [&](size_t chunk, size_t begin, size_t end)
+	{
+		float values[5];
+		for (size_t y = begin; y < end; ++y)
+		{
+			const float* row_thresholds = m_thresholds.data() + (y % m_size) * m_size;
+			for (size_t x = 0; x < width; ++x)
+			{
+				const size_t i = y * width + x;
+				const float* pixel = colors.pixel(i);
+				if (convert)
+				{
+					color_converter::convert_values(colors.get_color_type(), pixel, colors.get_rgb_color_space(), color_type::RGB_DEEP, values);
+					pixel = values;
+				}
+
+				// floor(v * 255 + 0.5 + t) rounds up with a probability equal to the fraction of v * 255 over the tile.
+				const float offset = 0.5f + row_thresholds[x % m_size];
+				for (size_t c = 0; c < 4; ++c)
+				{
+					const float value = std::floor(pixel[c] * 255.f + offset);
+					rgba[i * 4 + c] = (uint8_t)std::min(std::max(value, 0.f), 255.f);
+				}
+			}
+		}
+	});
+}
@@ -0,0 +1,81 @@
+/// Copyright Martin Ruehlicke, 2019
+/// Use, modification and distribution are subject to the
+/// MIT Software License, Version 1.0.
+/// See accompanying file LICENSE.txt
+
+#pragma once
+
+#include "..\utils\color_buffer.h"
+#include "palette_search.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace color_manipulation
+{
+	//! Enum that defines the threshold matrices of the ordered dithering.
+	enum dither_matrix
+	{
+		BAYER_2 = 0, /*!< BAYER_2 - 2x2 Bayer matrix */
+		BAYER_4, /*!< BAYER_4 - 4x4 Bayer matrix */
+		BAYER_8, /*!< BAYER_8 - 8x8 Bayer matrix */
+		BAYER_16, /*!< BAYER_16 - 16x16 Bayer matrix */
+		BLUE_NOISE /*!< BLUE_NOISE - 64x64 blue noise matrix created with the void and cluster method */
+	};
+
+	//! Ordered dithering of float colors to 8 bits or to a palette.
+	/*!
+	* A threshold from a tiled matrix is added to every pixel before it is quantized. The threshold only depends on the
+	* position of the pixel, so all pixels can be processed independently, the rows are processed on all cores.
+	* Compared with rounding (e.g. color_converter::rgb_deep_to_rgb_true()) gradients do not band, the average of
+	* every tile keeps the original value.
+	*/
+	class ordered_dither
+	{
+	public:
+		//! Default constructor.
+		/*!
+		* \param matrix The threshold matrix.
+		*/
+		ordered_dither(dither_matrix matrix = BAYER_8);
+
+		//! Returns the width and height of the threshold matrix.
+		size_t size() const { return m_size; }
+
+		//! Returns the threshold of a pixel in the range (-0.5, 0.5).
+		float threshold(size_t x, size_t y) const { return m_thresholds[(y % m_size) * m_size + x % m_size]; }
+
+		//! Quantizes a buffer to rgb true color.
+		/*!
+		* \param colors The pixels of the image row by row, any color type, they are converted to rgb deep color while dithering.
+		* \param width The number of pixels per row.
+		* \return A buffer of rgb true colors with integer components and alpha.
+		*/
+		color_buffer to_rgb_true(const color_buffer& colors, size_t width) const;
+
+		//! Quantizes a buffer to 8-bit rgba values.
+		/*!
+		* \param colors The pixels of the image row by row, any color type.
+		* \param width The number of pixels per row.
+		* \param rgba Receives 4 bytes per pixel in the order red, green, blue and alpha.
+		*/
+		void to_rgba8(const color_buffer& colors, size_t width, uint8_t* rgba) const;
+
+		//! Maps a buffer to the nearest palette colors.
+		/*!
+		* \param colors The pixels of the image row by row, any color type.
+		* \param width The number of pixels per row.
+		* \param palette The palette, at most 256 colors.
+		* \param spread The amplitude of the thresholds in rgb deep color, 0 uses the mean distance of a palette with this
+		* number of evenly distributed colors.
+		* \return The palette index of every pixel.
+		*/
+		std::vector<uint8_t> to_palette(const color_buffer& colors, size_t width, const palette_search& palette, float spread = 0.f) const;
+
+	private:
+		void dither_8bit(const color_buffer& colors, size_t width, uint8_t* rgba) const;
+
+		size_t m_size;
+		std::vector<float> m_thresholds;
+	};
+}
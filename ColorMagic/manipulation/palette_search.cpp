@@ -0,0 +1,129 @@
+#include "stdafx.h"
+#include "palette_search.h"
+#include "color_converter.h"
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+
+color_manipulation::palette_search::palette_search(const std::vector<color_space::color_base*>& palette, distance_metric metric)
+	: m_metric(metric), m_rgb_color_space(nullptr)
+{
+	if (palette.empty()) throw new std::invalid_argument("Parameter palette cannot be empty.");
+
+	m_rgb_color_space = palette[0]->get_rgb_color_space();
+	for (auto color : palette)
+	{
+		m_rgb.push_back(color_converter::to_rgb_deep(*color));
+		m_lab.push_back(color_converter::to_lab(*color));
+	}
+
+	if (m_metric == EUCLIDEAN_RGB || m_metric == DELTA_E_CIE76)
+	{
+		m_order.resize(palette.size());
+		std::iota(m_order.begin(), m_order.end(), 0);
+
+		auto axis = [this](size_t index, size_t component) { return m_metric == EUCLIDEAN_RGB ? m_rgb[index].get_components()[component] : m_lab[index].get_components()[component]; };
+		std::stable_sort(m_order.begin(), m_order.end(), [&axis](size_t x, size_t y) { return axis(x, 0) < axis(y, 0); });
+		for (size_t index : m_order)
+		{
+			m_axis0.push_back(axis(index, 0));
+			m_axis1.push_back(axis(index, 1));
+			m_axis2.push_back(axis(index, 2));
+		}
+	}
+}
+
+size_t color_manipulation::palette_search::nearest(const color_space::color_base & color) const
+{
+	switch (m_metric)
+	{
+	case EUCLIDEAN_RGB:
+		return nearest_sorted(color_converter::to_rgb_deep(color).get_components().data());
+	case DELTA_E_CIE76:
+		return nearest_sorted(color_converter::to_lab(color).get_components().data());
+	default:
+		return nearest_scan(color);
+	}
+}
+
+size_t color_manipulation::palette_search::nearest_rgb(const float * rgb) const
+{
+	if (m_metric == EUCLIDEAN_RGB) return nearest_sorted(rgb);
+
+	return nearest(color_space::rgb_deepcolor(rgb[0], rgb[1], rgb[2], 1.f, m_rgb_color_space));
+}
+
+size_t color_manipulation::palette_search::nearest_sorted(const float * values) const
+{
+	size_t best = 0;
+	float best_distance = std::numeric_limits<float>::max();
+	auto visit = [&](size_t i)
+	{
+		const float d0 = m_axis0[i] - values[0], d1 = m_axis1[i] - values[1], d2 = m_axis2[i] - values[2];
+		const float d = d0 * d0 + d1 * d1 + d2 * d2;
+		if (d < best_distance || (d == best_distance && m_order[i] < m_order[best]))
+		{
+			best_distance = d;
+			best = i;
+		}
+	};
+
+	// Walk outwards from the position of the color on the first axis.
+	const size_t start = std::lower_bound(m_axis0.begin(), m_axis0.end(), values[0]) - m_axis0.begin();
+	for (size_t i = start; i < m_axis0.size(); ++i)
+	{
+		const float d0 = m_axis0[i] - values[0];
+		if (d0 * d0 > best_distance) break;
+		visit(i);
+	}
+	for (size_t i = start; i-- > 0;)
+	{
+		const float d0 = m_axis0[i] - values[0];
+		if (d0 * d0 > best_distance) break;
+		visit(i);
+	}
+
+	return m_order[best];
+}
+
+size_t color_manipulation::palette_search::nearest_scan(const color_space::color_base & color) const
+{
+	color_space::rgb_deepcolor color_rgb = color_converter::to_rgb_deep(color);
+	color_space::lab color_lab = color_converter::to_lab(color);
+	color_space::color_base* converted = m_metric == EUCLIDEAN_WEIGHTED ? static_cast<color_space::color_base*>(&color_rgb) : &color_lab;
+
+	size_t best = 0;
+	float best_distance = std::numeric_limits<float>::max();
+	for (size_t i = 0; i < m_rgb.size(); ++i)
+	{
+		const float d = distance(converted, i);
+		if (d < best_distance)
+		{
+			best_distance = d;
+			best = i;
+		}
+	}
+	return best;
+}
+
+float color_manipulation::palette_search::distance(color_space::color_base * color, size_t index) const
+{
+	color_space::rgb_deepcolor palette_rgb = m_rgb[index];
+	color_space::lab palette_lab = m_lab[index];
+	switch (m_metric)
+	{
+	case EUCLIDEAN_WEIGHTED:
+		return color_distance::euclidean_distance_weighted(color, &palette_rgb);
+	case DELTA_E_CIE94:
+		return color_distance::cielab_delta_e_cie94(color, &palette_lab);
+	case DELTA_E_CIE00:
+		return color_distance::cielab_delta_e_cie00(color, &palette_lab);
+	case DELTA_E_CMC:
+		return color_distance::cmc_delta_e_lc84(color, &palette_lab);
+	case DELTA_E_CIE76:
+		return color_distance::cielab_delta_e_cie76(color, &palette_lab);
+	default:
+		return color_distance::euclidean_distance(color, &palette_rgb);
+	}
+}
@@ -0,0 +1,74 @@
+/// Copyright Martin Ruehlicke, 2019
+/// Use, modification and distribution are subject to the
+/// MIT Software License, Version 1.0.
+/// See accompanying file LICENSE.txt
+
+#pragma once
+
+#include "..\spaces\color_base.h"
+#include "..\spaces\rgb_deepcolor.h"
+#include "..\spaces\lab.h"
+#include "color_distance.h"
+
+#include <vector>
+
+namespace color_manipulation
+{
+	//! Enum that selects the color_distance function used to compare colors.
+	enum distance_metric
+	{
+		EUCLIDEAN_RGB = 0, /*!< EUCLIDEAN_RGB - color_distance::euclidean_distance() in rgb deep color */
+		EUCLIDEAN_WEIGHTED, /*!< EUCLIDEAN_WEIGHTED - color_distance::euclidean_distance_weighted() */
+		DELTA_E_CIE76, /*!< DELTA_E_CIE76 - color_distance::cielab_delta_e_cie76() */
+		DELTA_E_CIE94, /*!< DELTA_E_CIE94 - color_distance::cielab_delta_e_cie94() */
+		DELTA_E_CIE00, /*!< DELTA_E_CIE00 - color_distance::cielab_delta_e_cie00() */
+		DELTA_E_CMC /*!< DELTA_E_CMC - color_distance::cmc_delta_e_lc84() */
+	};
+
+	//! Nearest color search in a fixed palette.
+	/*!
+	* The palette is converted once to rgb deep color and lab. For EUCLIDEAN_RGB and DELTA_E_CIE76 the palette is sorted
+	* along its first axis and the search stops as soon as the distance on this axis alone exceeds the best match, which
+	* is exact and visits only a few entries of large palettes. The other metrics compare against every entry with the
+	* corresponding color_distance function.
+	*/
+	class palette_search
+	{
+	public:
+		//! Default constructor.
+		/*!
+		* \param palette The palette colors of any color type, they are copied.
+		* \param metric The distance metric used to find the nearest color.
+		*/
+		palette_search(const std::vector<color_space::color_base*>& palette, distance_metric metric = EUCLIDEAN_RGB);
+
+		//! Returns the index of the palette color nearest to a color.
+		size_t nearest(const color_space::color_base& color) const;
+
+		//! Returns the index of the palette color nearest to a color given as rgb deep color components.
+		size_t nearest_rgb(const float* rgb) const;
+
+		//! Returns the number of palette colors.
+		size_t size() const { return m_rgb.size(); }
+
+		//! Returns a palette color as rgb deep color.
+		const color_space::rgb_deepcolor& rgb(size_t index) const { return m_rgb[index]; }
+
+		//! Returns the distance metric.
+		distance_metric get_metric() const { return m_metric; }
+
+	private:
+		size_t nearest_sorted(const float* values) const;
+		size_t nearest_scan(const color_space::color_base& color) const;
+		float distance(color_space::color_base* color, size_t index) const;
+
+		distance_metric m_metric;
+		color_space::rgb_color_space_definition* m_rgb_color_space;
+		std::vector<color_space::rgb_deepcolor> m_rgb;
+		std::vector<color_space::lab> m_lab;
+
+		// Palette sorted by the first axis of the metric space, as separate arrays.
+		std::vector<float> m_axis0, m_axis1, m_axis2;
+		std::vector<size_t> m_order;
+	};
+}
@@ -1,17 +1,21 @@
 #include "stdafx.h"
 #include "porter_duff.h"
+#include "..\utils\instrumentation.h"
+#include "..\utils\parallel.h"
 
 color_space::color_base * color_manipulation::porter_duff::src(color_space::color_base * source, color_space::color_base * destination)
 {
+	COLORMAGIC_INSTRUMENT("porter_duff::src");
+
 	// Check input params
 	if (source == nullptr) throw new std::invalid_argument("source color is null.");
 	if (destination == nullptr) throw new std::invalid_argument("destination color is null.");
 	if (source->get_rgb_color_space() != destination->get_rgb_color_space()) throw new std::invalid_argument("The rgb color space definitions of both colors do not match.");
 
-	return color_converter::convertTo(
-		(new porter_duff())->general_porter_duff(
-			color_converter::to_rgb_deep(source),
-			color_converter::to_rgb_deep(destination),
+	return color_converter::create_converted(
+		porter_duff().general_porter_duff(
+			color_converter::to_rgb_deep(*source),
+			color_converter::to_rgb_deep(*destination),
 			true,
 			false,
 			true,
@@ -21,15 +25,17 @@ color_space::color_base * color_manipulation::porter_duff::src(color_space::colo
 
 color_space::color_base * color_manipulation::porter_duff::dest(color_space::color_base * source, color_space::color_base * destination)
 {
+	COLORMAGIC_INSTRUMENT("porter_duff::dest");
+
 	// Check input params
 	if (source == nullptr) throw new std::invalid_argument("source color is null.");
 	if (destination == nullptr) throw new std::invalid_argument("destination color is null.");
 	if (source->get_rgb_color_space() != destination->get_rgb_color_space()) throw new std::invalid_argument("The rgb color space definitions of both colors do not match.");
 
-	return color_converter::convertTo(
-		(new porter_duff())->general_porter_duff(
-			color_converter::to_rgb_deep(source), 
-			color_converter::to_rgb_deep(destination), 
+	return color_converter::create_converted(
+		porter_duff().general_porter_duff(
+			color_converter::to_rgb_deep(*source),
+			color_converter::to_rgb_deep(*destination), 
 			false, 
 			true, 
 			true,
@@ -39,15 +45,17 @@ color_space::color_base * color_manipulation::porter_duff::dest(color_space::col
 
 color_space::color_base * color_manipulation::porter_duff::atop(color_space::color_base * source, color_space::color_base * destination)
 {
+	COLORMAGIC_INSTRUMENT("porter_duff::atop");
+
 	// Check input params
 	if (source == nullptr) throw new std::invalid_argument("source color is null.");
 	if (destination == nullptr) throw new std::invalid_argument("destination color is null.");
 	if (source->get_rgb_color_space() != destination->get_rgb_color_space()) throw new std::invalid_argument("The rgb color space definitions of both colors do not match.");
 
-	return color_converter::convertTo(
-		(new porter_duff())->general_porter_duff(
-			color_converter::to_rgb_deep(source),
-			color_converter::to_rgb_deep(destination),
+	return color_converter::create_converted(
+		porter_duff().general_porter_duff(
+			color_converter::to_rgb_deep(*source),
+			color_converter::to_rgb_deep(*destination),
 			false,
 			true,
 			true,
@@ -57,15 +65,17 @@ color_space::color_base * color_manipulation::porter_duff::atop(color_space::col
 
 color_space::color_base * color_manipulation::porter_duff::dest_atop(color_space::color_base * source, color_space::color_base * destination)
 {
+	COLORMAGIC_INSTRUMENT("porter_duff::dest_atop");
+
 	// Check input params
 	if (source == nullptr) throw new std::invalid_argument("source color is null.");
 	if (destination == nullptr) throw new std::invalid_argument("destination color is null.");
 	if (source->get_rgb_color_space() != destination->get_rgb_color_space()) throw new std::invalid_argument("The rgb color space definitions of both colors do not match.");
 
-	return color_converter::convertTo(
-		(new porter_duff())->general_porter_duff(
-			color_converter::to_rgb_deep(source),
-			color_converter::to_rgb_deep(destination),
+	return color_converter::create_converted(
+		porter_duff().general_porter_duff(
+			color_converter::to_rgb_deep(*source),
+			color_converter::to_rgb_deep(*destination),
 			true,
 			false,
 			true,
@@ -75,15 +85,17 @@ color_space::color_base * color_manipulation::porter_duff::dest_atop(color_space
 
 color_space::color_base * color_manipulation::porter_duff::over(color_space::color_base * source, color_space::color_base * destination)
 {
+	COLORMAGIC_INSTRUMENT("porter_duff::over");
+
 	// Check input params
 	if (source == nullptr) throw new std::invalid_argument("source color is null.");
 	if (destination == nullptr) throw new std::invalid_argument("destination color is null.");
 	if (source->get_rgb_color_space() != destination->get_rgb_color_space()) throw new std::invalid_argument("The rgb color space definitions of both colors do not match.");
 
-	return color_converter::convertTo(
-		(new porter_duff())->general_porter_duff(
-			color_converter::to_rgb_deep(source),
-			color_converter::to_rgb_deep(destination),
+	return color_converter::create_converted(
+		porter_duff().general_porter_duff(
+			color_converter::to_rgb_deep(*source),
+			color_converter::to_rgb_deep(*destination),
 			true,
 			true,
 			true,
@@ -93,15 +105,17 @@ color_space::color_base * color_manipulation::porter_duff::over(color_space::col
 
 color_space::color_base * color_manipulation::porter_duff::dest_over(color_space::color_base * source, color_space::color_base * destination)
 {
+	COLORMAGIC_INSTRUMENT("porter_duff::dest_over");
+
 	// Check input params
 	if (source == nullptr) throw new std::invalid_argument("source color is null.");
 	if (destination == nullptr) throw new std::invalid_argument("destination color is null.");
 	if (source->get_rgb_color_space() != destination->get_rgb_color_space()) throw new std::invalid_argument("The rgb color space definitions of both colors do not match.");
 
-	return color_converter::convertTo(
-		(new porter_duff())->general_porter_duff(
-			color_converter::to_rgb_deep(source),
-			color_converter::to_rgb_deep(destination),
+	return color_converter::create_converted(
+		porter_duff().general_porter_duff(
+			color_converter::to_rgb_deep(*source),
+			color_converter::to_rgb_deep(*destination),
 			true,
 			true,
 			true,
@@ -111,15 +125,17 @@ color_space::color_base * color_manipulation::porter_duff::dest_over(color_space
 
 color_space::color_base * color_manipulation::porter_duff::in(color_space::color_base * source, color_space::color_base * destination)
 {
+	COLORMAGIC_INSTRUMENT("porter_duff::in");
+
 	// Check input params
 	if (source == nullptr) throw new std::invalid_argument("source color is null.");
 	if (destination == nullptr) throw new std::invalid_argument("destination color is null.");
 	if (source->get_rgb_color_space() != destination->get_rgb_color_space()) throw new std::invalid_argument("The rgb color space definitions of both colors do not match.");
 
-	return color_converter::convertTo(
-		(new porter_duff())->general_porter_duff(
-			color_converter::to_rgb_deep(source),
-			color_converter::to_rgb_deep(destination),
+	return color_converter::create_converted(
+		porter_duff().general_porter_duff(
+			color_converter::to_rgb_deep(*source),
+			color_converter::to_rgb_deep(*destination),
 			false,
 			false,
 			true,
@@ -129,15 +145,17 @@ color_space::color_base * color_manipulation::porter_duff::in(color_space::color
 
 color_space::color_base * color_manipulation::porter_duff::dest_in(color_space::color_base * source, color_space::color_base * destination)
 {
+	COLORMAGIC_INSTRUMENT("porter_duff::dest_in");
+
 	// Check input params
 	if (source == nullptr) throw new std::invalid_argument("source color is null.");
 	if (destination == nullptr) throw new std::invalid_argument("destination color is null.");
 	if (source->get_rgb_color_space() != destination->get_rgb_color_space()) throw new std::invalid_argument("The rgb color space definitions of both colors do not match.");
 
-	return color_converter::convertTo(
-		(new porter_duff())->general_porter_duff(
-			color_converter::to_rgb_deep(source),
-			color_converter::to_rgb_deep(destination),
+	return color_converter::create_converted(
+		porter_duff().general_porter_duff(
+			color_converter::to_rgb_deep(*source),
+			color_converter::to_rgb_deep(*destination),
 			false,
 			false,
 			true,
@@ -147,15 +165,17 @@ color_space::color_base * color_manipulation::porter_duff::dest_in(color_space::
 
 color_space::color_base * color_manipulation::porter_duff::out(color_space::color_base * source, color_space::color_base * destination)
 {
+	COLORMAGIC_INSTRUMENT("porter_duff::out");
+
 	// Check input params
 	if (source == nullptr) throw new std::invalid_argument("source color is null.");
 	if (destination == nullptr) throw new std::invalid_argument("destination color is null.");
 	if (source->get_rgb_color_space() != destination->get_rgb_color_space()) throw new std::invalid_argument("The rgb color space definitions of both colors do not match.");
 
-	return color_converter::convertTo(
-		(new porter_duff())->general_porter_duff(
-			color_converter::to_rgb_deep(source),
-			color_converter::to_rgb_deep(destination),
+	return color_converter::create_converted(
+		porter_duff().general_porter_duff(
+			color_converter::to_rgb_deep(*source),
+			color_converter::to_rgb_deep(*destination),
 			true,
 			false,
 			false,
@@ -165,15 +185,17 @@ color_space::color_base * color_manipulation::porter_duff::out(color_space::colo
 
 color_space::color_base * color_manipulation::porter_duff::dest_out(color_space::color_base * source, color_space::color_base * destination)
 {
+	COLORMAGIC_INSTRUMENT("porter_duff::dest_out");
+
 	// Check input params
 	if (source == nullptr) throw new std::invalid_argument("source color is null.");
 	if (destination == nullptr) throw new std::invalid_argument("destination color is null.");
 	if (source->get_rgb_color_space() != destination->get_rgb_color_space()) throw new std::invalid_argument("The rgb color space definitions of both colors do not match.");
 
-	return color_converter::convertTo(
-		(new porter_duff())->general_porter_duff(
-			color_converter::to_rgb_deep(source),
-			color_converter::to_rgb_deep(destination),
+	return color_converter::create_converted(
+		porter_duff().general_porter_duff(
+			color_converter::to_rgb_deep(*source),
+			color_converter::to_rgb_deep(*destination),
 			false,
 			true,
 			false,
@@ -183,15 +205,17 @@ color_space::color_base * color_manipulation::porter_duff::dest_out(color_space:
 
 color_space::color_base * color_manipulation::porter_duff::x_or(color_space::color_base * source, color_space::color_base * destination)
 {
+	COLORMAGIC_INSTRUMENT("porter_duff::x_or");
+
 	// Check input params
 	if (source == nullptr) throw new std::invalid_argument("source color is null.");
 	if (destination == nullptr) throw new std::invalid_argument("destination color is null.");
 	if (source->get_rgb_color_space() != destination->get_rgb_color_space()) throw new std::invalid_argument("The rgb color space definitions of both colors do not match.");
 
-	return color_converter::convertTo(
-		(new porter_duff())->general_porter_duff(
-			color_converter::to_rgb_deep(source),
-			color_converter::to_rgb_deep(destination),
+	return color_converter::create_converted(
+		porter_duff().general_porter_duff(
+			color_converter::to_rgb_deep(*source),
+			color_converter::to_rgb_deep(*destination),
 			true, 
 			true,
 			false,
@@ -201,18 +225,66 @@ color_space::color_base * color_manipulation::porter_duff::x_or(color_space::col
 
 color_space::color_base * color_manipulation::porter_duff::clear(color_space::color_base * source, color_space::color_base * destination)
 {
+	COLORMAGIC_INSTRUMENT("porter_duff::clear");
+
 	// Check input params
 	if (source == nullptr) throw new std::invalid_argument("source color is null.");
 	if (destination == nullptr) throw new std::invalid_argument("destination color is null.");
 	if (source->get_rgb_color_space() != destination->get_rgb_color_space()) throw new std::invalid_argument("The rgb color space definitions of both colors do not match.");
 
-	return color_converter::convertTo(
-		(new porter_duff())->general_porter_duff(
-			color_converter::to_rgb_deep(source),
-			color_converter::to_rgb_deep(destination),
+	return color_converter::create_converted(
+		porter_duff().general_porter_duff(
+			color_converter::to_rgb_deep(*source),
+			color_converter::to_rgb_deep(*destination),
 			false,
 			false,
 			false,
 			[](float s_component, float d_component) {return 0.f; }),
 		source->get_color_type());
 }
+
+void color_manipulation::porter_duff::composite(const premultiplied_buffer & source, premultiplied_buffer & destination, porter_duff_operator op)
+{
+	COLORMAGIC_INSTRUMENT("porter_duff::composite");
+
+	// Check input params
+	if (source.size() != destination.size()) throw new std::invalid_argument("The buffers do not contain the same number of colors.");
+	if (source.get_rgb_color_space() != destination.get_rgb_color_space()) throw new std::invalid_argument("The rgb color space definitions of both buffers do not match.");
+
+	// Whether the operator uses the source region, the destination region and which color fills the region of both,
+	// the flags of general_porter_duff() for every operator.
+	static const float regions[][4] =
+	{
+		{ 1.f, 0.f, 1.f, 0.f }, // src
+		{ 0.f, 1.f, 0.f, 1.f }, // dest
+		{ 0.f, 1.f, 1.f, 0.f }, // atop
+		{ 1.f, 0.f, 0.f, 1.f }, // dest_atop
+		{ 1.f, 1.f, 1.f, 0.f }, // over
+		{ 1.f, 1.f, 0.f, 1.f }, // dest_over
+		{ 0.f, 0.f, 1.f, 0.f }, // in
+		{ 0.f, 0.f, 0.f, 1.f }, // dest_in
+		{ 1.f, 0.f, 0.f, 0.f }, // out
+		{ 0.f, 1.f, 0.f, 0.f }, // dest_out
+		{ 1.f, 1.f, 0.f, 0.f }, // xor
+		{ 0.f, 0.f, 0.f, 0.f } // clear
+	};
+	if (op < SRC_OPERATOR || op > CLEAR_OPERATOR) throw new std::invalid_argument("Unknown porter duff operator.");
+	const float use_s = regions[op][0], use_d = regions[op][1], both_s = regions[op][2], both_d = regions[op][3];
+
+	// In premultiplied values the result is s * (use_s * (1 - ad) + both_s * ad) + d * (use_d * (1 - as) + both_d * as)
+	// for the colors and the alpha alike.
+	parallel::for_each_chunk(source.size(), 4096, [&](size_t chunk, size_t begin, size_t end)
+	{
+		const float* s = source.pixel(begin);
+		float* d = destination.pixel(begin);
+		for (size_t i = 0; i < end - begin; ++i, s += 4, d += 4)
+		{
+			const float source_factor = use_s + (both_s - use_s) * d[3];
+			const float destination_factor = use_d + (both_d - use_d) * s[3];
+			d[0] = s[0] * source_factor + d[0] * destination_factor;
+			d[1] = s[1] * source_factor + d[1] * destination_factor;
+			d[2] = s[2] * source_factor + d[2] * destination_factor;
+			d[3] = s[3] * source_factor + d[3] * destination_factor;
+		}
+	});
+}
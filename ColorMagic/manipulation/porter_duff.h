@@ -7,10 +7,28 @@
 
 #include "base_color_blend.h"
 #include "..\spaces\color_base.h"
+#include "..\utils\premultiplied_buffer.h"
 #include "color_converter.h"
 
 namespace color_manipulation
 {
+	//! Enum that defines the porter duff operators of porter_duff::composite().
+	enum porter_duff_operator
+	{
+		SRC_OPERATOR = 0, /*!< SRC_OPERATOR - \sa porter_duff::src() */
+		DEST_OPERATOR, /*!< DEST_OPERATOR - \sa porter_duff::dest() */
+		ATOP_OPERATOR, /*!< ATOP_OPERATOR - \sa porter_duff::atop() */
+		DEST_ATOP_OPERATOR, /*!< DEST_ATOP_OPERATOR - \sa porter_duff::dest_atop() */
+		OVER_OPERATOR, /*!< OVER_OPERATOR - \sa porter_duff::over() */
+		DEST_OVER_OPERATOR, /*!< DEST_OVER_OPERATOR - \sa porter_duff::dest_over() */
+		IN_OPERATOR, /*!< IN_OPERATOR - \sa porter_duff::in() */
+		DEST_IN_OPERATOR, /*!< DEST_IN_OPERATOR - \sa porter_duff::dest_in() */
+		OUT_OPERATOR, /*!< OUT_OPERATOR - \sa porter_duff::out() */
+		DEST_OUT_OPERATOR, /*!< DEST_OUT_OPERATOR - \sa porter_duff::dest_out() */
+		XOR_OPERATOR, /*!< XOR_OPERATOR - \sa porter_duff::x_or() */
+		CLEAR_OPERATOR /*!< CLEAR_OPERATOR - \sa porter_duff::clear() */
+	};
+
 	//! Static class for porter duff color blending operations
 	/*!
 	* This static class implements all 12 porter duff color blending operations.
@@ -201,5 +219,19 @@ namespace color_manipulation
 		* \return the combination of source and destination calculated with the clear operator.
 		*/
 		static color_space::color_base* clear(color_space::color_base* source, color_space::color_base* destination);
+
+		//! Static function that combines two buffers of premultiplied colors by using a porter duff operator.
+		/*!
+		* Every color of the source buffer is combined with the color at the same index of the destination
+		* buffer like the function of the operator. The colors stay premultiplied, so the result is a
+		* weighted sum of source and destination without any division. The result replaces the
+		* destination, which makes it the destination of the next step of a compositing chain.
+		* The buffers are processed in chunks on all cores.
+		* \param source The source colors of the operation.
+		* \param destination The destination colors of the operation, the same number of colors and the
+		* same rgb color space definition like the source colors. Receives the result.
+		* \param op The porter duff operator.
+		*/
+		static void composite(const premultiplied_buffer& source, premultiplied_buffer& destination, porter_duff_operator op);
 	};
 }
@@ -13,16 +13,16 @@ color_space::cmyk::cmyk(float cyan, float magenta, float yellow, float black, fl
 color_space::cmyk::cmyk(const color_space::cmyk & other) : color_base(other.alpha(), other.get_rgb_color_space(), 4, other.get_component_max(), other.get_component_min())
 {
 	this->m_type = other.get_color_type();
-	this->m_component_vector = other.get_component_vector();
+	this->m_component_vector = other.get_components();
 	this->alpha(other.alpha());
 }
 
 color_space::cmyk::cmyk(const color_base & other) : color_base(other.alpha(), other.get_rgb_color_space(), 4, other.get_component_max(), other.get_component_min())
 {
-	if (other.get_color_type() == color_type::CMYK && other.get_component_vector().size() == 4)
+	if (other.get_color_type() == color_type::CMYK && other.get_components().size() == 4)
 	{
 		this->m_type = color_type::CMYK;
-		this->m_component_vector = other.get_component_vector();
+		this->m_component_vector = other.get_components();
 	}
 	else
 	{
@@ -35,9 +35,11 @@ color_space::cmyk & color_space::cmyk::operator=(const cmyk & other)
 	if (this != &other)
 	{
 		this->m_type = other.get_color_type();
-		this->m_component_vector = other.get_component_vector();
+		this->m_component_vector = other.get_components();
 		this->m_max = other.get_component_max();
 		this->m_min = other.get_component_min();
+		this->m_alpha = other.m_alpha;
+		this->m_rgb_color_space = other.get_rgb_color_space();
 	}
 	return *this;
 }
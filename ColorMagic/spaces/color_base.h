@@ -7,6 +7,8 @@
 #define _USE_MATH_DEFINES
 
 #include "..\utils\color_type.h"
+#include "..\utils\color_arena.h"
+#include "..\utils\component_array.h"
 #include "rgb_color_space_definition.h"
 
 #include <vector>
@@ -52,6 +54,24 @@ namespace color_space
 			m_component_vector.clear();
 		}
 
+		//! Allocates a color object.
+		/*!
+		* Allocates from the color arena active on the calling thread or from the heap if there is none.
+		*/
+		static void* operator new(size_t size) { return color_arena::allocate_object(size); }
+
+		//! Releases a color object.
+		/*!
+		* Heap memory is freed at once, arena memory is given back when the arena is reset.
+		*/
+		static void operator delete(void* memory) { color_arena::release_object(memory); }
+
+		//! Placement new, constructs a color object in memory owned by the caller.
+		static void* operator new(size_t, void* place) { return place; }
+
+		//! Placement delete, matching the placement new.
+		static void operator delete(void*, void*) {}
+
 		//! Returns the color space the color is located in.
 		/*!
 		* Returns the color space the color is located in.
@@ -64,6 +84,12 @@ namespace color_space
 		*/
 		virtual std::vector<float> get_component_vector() const { return m_component_vector; }
 
+		//! Returns the colors component values without copying them.
+		/*!
+		* Returns the colors component values without copying them.
+		*/
+		const component_array& get_components() const { return m_component_vector; }
+
 		//! Returns one color component by index.
 		/*!
 		* Returns one color component by index.
@@ -146,7 +172,7 @@ namespace color_space
 				return false;
 			}
 
-			for (std::vector<float>::size_type i = 0; i < lhs.m_component_vector.size(); ++i)
+			for (size_t i = 0; i < lhs.m_component_vector.size(); ++i)
 			{
 				if (lhs.m_component_vector[i] != rhs.m_component_vector[i])
 				{
@@ -250,11 +276,11 @@ namespace color_space
 		float clamp(float in_value, float max, float min) { return fmaxf(fminf(in_value, max), min); }
 
 
-		//! Vector that stores the components of the color.
+		//! Array that stores the components of the color.
 		/*!
-		* Vector that stores the components of the color.
+		* Array that stores the components of the color inside the object.
 		*/
-		std::vector<float> m_component_vector;
+		component_array m_component_vector;
 
 		//! The rgb color space definition used for conversion to or from xyz and lab.
 		/*!
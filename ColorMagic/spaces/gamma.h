@@ -5,6 +5,8 @@
 
 #pragma once
 
+#include "..\utils\instrumentation.h"
+
 #include <algorithm>
 #include <functional>
 #include <vector>
@@ -321,6 +323,7 @@ namespace color_space
 		//! Takes the matching default gamma_part and calculates the gamma correction.
 		float gamma_correction(float input_value)
 		{
+			COLORMAGIC_COUNT_GAMMA_EVALUATION();
 			for (gamma_part* part : m_gamma_curve_parts)
 			{
 				if (part == nullptr || !(part->get_gamma_function())) continue;
@@ -336,6 +339,7 @@ namespace color_space
 		//! Takes the matching inverse gamma_part and calculates the gamma correction.
 		float inverse_gamma_correction(float input_value)
 		{
+			COLORMAGIC_COUNT_GAMMA_EVALUATION();
 			for (gamma_part* part : m_inverse_gamma_curve_parts)
 			{
 				if (part == nullptr || !(part->get_gamma_function())) continue;
@@ -10,16 +10,16 @@ color_space::grey_deepcolor::grey_deepcolor(float value, float alpha, rgb_color_
 color_space::grey_deepcolor::grey_deepcolor(const color_space::grey_deepcolor & other) : color_base(other.alpha(), other.get_rgb_color_space(), 1, other.get_component_max(), other.get_component_min())
 {
 	this->m_type = other.get_color_type();
-	this->m_component_vector = other.get_component_vector();
+	this->m_component_vector = other.get_components();
 	this->alpha(other.alpha());
 }
 
 color_space::grey_deepcolor::grey_deepcolor(const color_base & other) : color_base(other.alpha(), other.get_rgb_color_space(), 1, other.get_component_max(), other.get_component_min())
 {
-	if (other.get_color_type() == color_type::GREY_DEEP && other.get_component_vector().size() == 1)
+	if (other.get_color_type() == color_type::GREY_DEEP && other.get_components().size() == 1)
 	{
 		this->m_type = color_type::GREY_DEEP;
-		this->m_component_vector = other.get_component_vector();
+		this->m_component_vector = other.get_components();
 	}
 	else
 	{
@@ -32,14 +32,16 @@ color_space::grey_deepcolor & color_space::grey_deepcolor::operator=(const color
 	if (this != &other)
 	{
 		this->m_type = other.get_color_type();
-		this->m_component_vector = other.get_component_vector();
+		this->m_component_vector = other.get_components();
 		this->m_max = other.get_component_max();
 		this->m_min = other.get_component_min();
+		this->m_alpha = other.m_alpha;
+		this->m_rgb_color_space = other.get_rgb_color_space();
 	}
 	return *this;
 }
 
-float color_space::grey_deepcolor::grey()
+float color_space::grey_deepcolor::grey() const
 {
 	return m_component_vector[0];
 }
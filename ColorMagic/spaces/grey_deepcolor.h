@@ -50,7 +50,7 @@ namespace color_space
 		
 		//! Getter for grey component.
 		//! \return The grey component of this color.
-		float grey();
+		float grey() const;
 
 		//! Setter for grey component.
 		//! \param new_grey The grey value to set.
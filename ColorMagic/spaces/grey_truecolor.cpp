@@ -11,16 +11,16 @@ color_space::grey_truecolor::grey_truecolor(float value, float alpha, rgb_color_
 color_space::grey_truecolor::grey_truecolor(const color_space::grey_truecolor & other) : color_base(other.alpha(), other.get_rgb_color_space(), 1, other.get_component_max(), other.get_component_min())
 {
 	this->m_type = other.get_color_type();
-	this->m_component_vector = other.get_component_vector();
+	this->m_component_vector = other.get_components();
 	this->alpha(other.alpha());
 }
 
 color_space::grey_truecolor::grey_truecolor(const color_base & other) : color_base(other.alpha(), other.get_rgb_color_space(), 1, other.get_component_max(), other.get_component_min())
 {
-	if (other.get_color_type() == color_type::GREY_TRUE && other.get_component_vector().size() == 2)
+	if (other.get_color_type() == color_type::GREY_TRUE && other.get_components().size() == 2)
 	{
 		this->m_type = color_type::GREY_TRUE;
-		this->m_component_vector = other.get_component_vector();
+		this->m_component_vector = other.get_components();
 	}
 	else
 	{
@@ -33,14 +33,16 @@ color_space::grey_truecolor & color_space::grey_truecolor::operator=(const color
 	if (this != &other)
 	{
 		this->m_type = other.get_color_type();
-		this->m_component_vector = other.get_component_vector();
+		this->m_component_vector = other.get_components();
 		this->m_max = other.get_component_max();
 		this->m_min = other.get_component_min();
+		this->m_alpha = other.m_alpha;
+		this->m_rgb_color_space = other.get_rgb_color_space();
 	}
 	return *this;
 }
 
-float color_space::grey_truecolor::grey()
+float color_space::grey_truecolor::grey() const
 {
 	return (float)m_component_vector[0];
 }
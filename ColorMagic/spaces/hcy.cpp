@@ -12,16 +12,16 @@ color_space::hcy::hcy(float hue, float chroma, float luma, float alpha, rgb_colo
 color_space::hcy::hcy(const color_space::hcy & other) : color_base(other.alpha(), other.get_rgb_color_space(), 3, other.get_component_max(), other.get_component_min())
 {
 	this->m_type = other.get_color_type();
-	this->m_component_vector = other.get_component_vector();
+	this->m_component_vector = other.get_components();
 	this->alpha(other.alpha());
 }
 
 color_space::hcy::hcy(const color_base & other) : color_base(other.alpha(), other.get_rgb_color_space(), 3, other.get_component_max(), other.get_component_min())
 {
-	if (other.get_color_type() == color_type::HCY && other.get_component_vector().size() == 3)
+	if (other.get_color_type() == color_type::HCY && other.get_components().size() == 3)
 	{
 		this->m_type = color_type::HCY;
-		this->m_component_vector = other.get_component_vector();
+		this->m_component_vector = other.get_components();
 	}
 	else
 	{
@@ -34,9 +34,11 @@ color_space::hcy & color_space::hcy::operator=(const color_space::hcy & other)
 	if (this != &other)
 	{
 		this->m_type = other.get_color_type();
-		this->m_component_vector = other.get_component_vector();
+		this->m_component_vector = other.get_components();
 		this->m_max = other.get_component_max();
 		this->m_min = other.get_component_min();
+		this->m_alpha = other.m_alpha;
+		this->m_rgb_color_space = other.get_rgb_color_space();
 	}
 	return *this;
 }
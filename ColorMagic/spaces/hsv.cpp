@@ -12,16 +12,16 @@ color_space::hsv::hsv(float hue, float saturation, float value, float alpha, rgb
 color_space::hsv::hsv(const color_space::hsv & other) : color_base(other.alpha(), other.get_rgb_color_space(), 3, other.get_component_max(), other.get_component_min())
 {
 	this->m_type = other.get_color_type();
-	this->m_component_vector = other.get_component_vector();
+	this->m_component_vector = other.get_components();
 	this->alpha(other.alpha());
 }
 
 color_space::hsv::hsv(const color_base & other) : color_base(other.alpha(), other.get_rgb_color_space(), 3, other.get_component_max(), other.get_component_min())
 {
-	if (other.get_color_type() == color_type::HSV && other.get_component_vector().size() == 3)
+	if (other.get_color_type() == color_type::HSV && other.get_components().size() == 3)
 	{
 		this->m_type = color_type::HSV;
-		this->m_component_vector = other.get_component_vector();
+		this->m_component_vector = other.get_components();
 	}
 	else
 	{
@@ -34,14 +34,16 @@ color_space::hsv & color_space::hsv::operator=(const color_space::hsv & other)
 	if (this != &other)
 	{
 		this->m_type = other.get_color_type();
-		this->m_component_vector = other.get_component_vector();
+		this->m_component_vector = other.get_components();
 		this->m_max = other.get_component_max();
 		this->m_min = other.get_component_min();
+		this->m_alpha = other.m_alpha;
+		this->m_rgb_color_space = other.get_rgb_color_space();
 	}
 	return *this;
 }
 
-float color_space::hsv::hue()
+float color_space::hsv::hue() const
 {
 	return m_component_vector[0];
 }
@@ -57,7 +59,7 @@ void color_space::hsv::hue(float new_hue)
 	set_component(new_hue, 0, m_degrees_max, m_degrees_min);
 }
 
-float color_space::hsv::saturation()
+float color_space::hsv::saturation() const
 {
 	return m_component_vector[1];
 }
@@ -67,7 +69,7 @@ void color_space::hsv::saturation(float new_saturation)
 	set_component(new_saturation, 1);
 }
 
-float color_space::hsv::value()
+float color_space::hsv::value() const
 {
 	return m_component_vector[2];
 }
@@ -51,7 +51,7 @@ namespace color_space
 
 		//! Getter for hue component.
 		//! \return The hue component of this color.
-		float hue();
+		float hue() const;
 
 		//! Setter for hue component.
 		//! \param hue The hue value to set.
@@ -59,7 +59,7 @@ namespace color_space
 
 		//! Getter for saturation component.
 		//! \return The saturation component of this color.
-		float saturation();
+		float saturation() const;
 
 		//! Setter for saturation component.
 		//! \param saturation The saturation value to set.
@@ -67,7 +67,7 @@ namespace color_space
 
 		//! Getter for value component.
 		//! \return The value component of this color.
-		float value();
+		float value() const;
 
 		//! Setter for value component.
 		//! \param value The value value to set.
@@ -12,16 +12,16 @@ color_space::lab::lab(float luminance, float a, float b, float alpha, rgb_color_
 color_space::lab::lab(const color_space::lab & other) : color_base(other.alpha(), other.get_rgb_color_space(), 3, other.get_component_max(), other.get_component_min())
 {
 	this->m_type = other.get_color_type();
-	this->m_component_vector = other.get_component_vector();
+	this->m_component_vector = other.get_components();
 	this->alpha(other.alpha());
 }
 
 color_space::lab::lab(const color_base & other) : color_base(other.alpha(), other.get_rgb_color_space(), 3, other.get_component_max(), other.get_component_min())
 {
-	if (other.get_color_type() == color_type::LAB && other.get_component_vector().size() == 3)
+	if (other.get_color_type() == color_type::LAB && other.get_components().size() == 3)
 	{
 		this->m_type = color_type::LAB;
-		this->m_component_vector = other.get_component_vector();
+		this->m_component_vector = other.get_components();
 	}
 	else
 	{
@@ -34,14 +34,16 @@ color_space::lab & color_space::lab::operator=(const color_space::lab & other)
 	if (this != &other)
 	{
 		this->m_type = other.get_color_type();
-		this->m_component_vector = other.get_component_vector();
+		this->m_component_vector = other.get_components();
 		this->m_max = other.get_component_max();
 		this->m_min = other.get_component_min();
+		this->m_alpha = other.m_alpha;
+		this->m_rgb_color_space = other.get_rgb_color_space();
 	}
 	return *this;
 }
 
-float color_space::lab::luminance()
+float color_space::lab::luminance() const
 {
 	return m_component_vector[0];
 }
@@ -51,7 +53,7 @@ void color_space::lab::luminance(float new_luminance)
 	set_component(new_luminance, 0, m_lightness_max, m_lightness_min);
 }
 
-float color_space::lab::a()
+float color_space::lab::a() const
 {
 	return m_component_vector[1];
 }
@@ -61,7 +63,7 @@ void color_space::lab::a(float new_a)
 	set_component(new_a, 1);
 }
 
-float color_space::lab::b()
+float color_space::lab::b() const
 {
 	return m_component_vector[2];
 }
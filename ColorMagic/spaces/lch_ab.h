@@ -51,7 +51,7 @@ namespace color_space
 
 		//! Getter for luminance component.
 		//! \return The luminance component of this color.
-		float luminance();
+		float luminance() const;
 
 		//! Setter for luminance component.
 		//! \param new_luminance The luminance value to set.
@@ -59,7 +59,7 @@ namespace color_space
 
 		//! Getter for chroma component.
 		//! \return The chroma component of this color.
-		float chroma();
+		float chroma() const;
 
 		//! Setter for chroma component.
 		//! \param new_chroma The a value to set.
@@ -67,7 +67,7 @@ namespace color_space
 
 		//! Getter for hue component.
 		//! \return The hue component of this color.
-		float hue();
+		float hue() const;
 
 		//! Setter for hue component.
 		//! \param new_hue The hue value to set.
@@ -12,16 +12,16 @@ color_space::lch_uv::lch_uv(float luminance, float chroma, float hue, float alph
 color_space::lch_uv::lch_uv(const lch_uv & other) : color_base(other.alpha(), other.get_rgb_color_space(), 3, other.get_component_max(), other.get_component_min())
 {
 	this->m_type = other.get_color_type();
-	this->m_component_vector = other.get_component_vector();
+	this->m_component_vector = other.get_components();
 	this->alpha(other.alpha());
 }
 
 color_space::lch_uv::lch_uv(const color_base & other) : color_base(other.alpha(), other.get_rgb_color_space(), 3, other.get_component_max(), other.get_component_min())
 {
-	if (other.get_color_type() == color_type::LCH_UV && other.get_component_vector().size() == 3)
+	if (other.get_color_type() == color_type::LCH_UV && other.get_components().size() == 3)
 	{
 		this->m_type = color_type::LCH_UV;
-		this->m_component_vector = other.get_component_vector();
+		this->m_component_vector = other.get_components();
 	}
 	else
 	{
@@ -34,14 +34,16 @@ color_space::lch_uv& color_space::lch_uv::operator=(const lch_uv & other)
 	if (this != &other)
 	{
 		this->m_type = other.get_color_type();
-		this->m_component_vector = other.get_component_vector();
+		this->m_component_vector = other.get_components();
 		this->m_max = other.get_component_max();
 		this->m_min = other.get_component_min();
+		this->m_alpha = other.m_alpha;
+		this->m_rgb_color_space = other.get_rgb_color_space();
 	}
 	return *this;
 }
 
-float color_space::lch_uv::luminance()
+float color_space::lch_uv::luminance() const
 {
 	return m_component_vector[0];
 }
@@ -51,7 +53,7 @@ void color_space::lch_uv::luminance(float new_luminance)
 	set_component(new_luminance, 0);
 }
 
-float color_space::lch_uv::chroma()
+float color_space::lch_uv::chroma() const
 {
 	return m_component_vector[1];
 }
@@ -61,7 +63,7 @@ void color_space::lch_uv::chroma(float new_chroma)
 	set_component(new_chroma, 1);
 }
 
-float color_space::lch_uv::hue()
+float color_space::lch_uv::hue() const
 {
 	return m_component_vector[2];
 }
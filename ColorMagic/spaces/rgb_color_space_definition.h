@@ -9,6 +9,12 @@
 #include "white_point.h"
 #include "../utils/matrix.h"
 #include <array>
+#include <memory>
+
+namespace color_manipulation
+{
+	class gamut_boundary;
+}
 
 namespace color_space
 {
@@ -73,6 +79,7 @@ namespace color_space
 			m_transform_matrix = other.get_transform_matrix();
 			m_inverse_transform_matrix = other.get_inverse_transform_matrix();
 			m_gamma = other.get_gamma_curve();
+			m_gamut_boundary = std::atomic_load(&other.m_gamut_boundary);
 		}
 
 		//! Default deconstructor.
@@ -179,6 +186,7 @@ namespace color_space
 			m_white = new_white_point;
 			m_transform_matrix = calculate_transformation_matrix(m_red, m_green, m_blue, m_white->get_tristimulus());
 			m_inverse_transform_matrix = m_transform_matrix.invert();
+			std::atomic_store(&m_gamut_boundary, std::shared_ptr<const color_manipulation::gamut_boundary>());
 		}
 
 		//! Access the matrix to transform from rgb space to xyz.
@@ -193,6 +201,18 @@ namespace color_space
 			return m_inverse_transform_matrix;
 		}
 
+		//! Transforms linear rgb components to xyz without copying the transformation matrix.
+		void transform_to_xyz(const float* rgb, float* xyz) const
+		{
+			m_transform_matrix.multiply(rgb, xyz);
+		}
+
+		//! Transforms xyz components to linear rgb without copying the inverse transformation matrix.
+		void transform_to_rgb(const float* xyz, float* rgb) const
+		{
+			m_inverse_transform_matrix.multiply(xyz, rgb);
+		}
+
 		//! Access the gamma curve.
 		gamma* get_gamma_curve()
 		{
@@ -205,6 +225,16 @@ namespace color_space
 			m_gamma = new_gamma;
 		}
 
+		//! Access the gamut boundary of this rgb color space definition.
+		/*!
+		* Access the gamut boundary of this rgb color space definition.
+		* The boundary is built on the first call and cached until the white point changes, the gamma curve
+		* does not change the gamut. Building it samples the whole boundary, every query afterwards is a table lookup.
+		* Concurrent first calls may build it twice, but all callers get the same cached boundary.
+		* \return The shared gamut boundary, it stays valid after the white point changed or this definition was deleted.
+		*/
+		std::shared_ptr<const color_manipulation::gamut_boundary> get_gamut_boundary();
+
 	private:
 		//! Calculate the matrix used to transform from RGB space to XYZ space by using this rgb color space definition.
 		/*!
@@ -275,6 +305,12 @@ namespace color_space
 		* The gamma curve of this rgb color space definition.
 		*/
 		gamma* m_gamma;
+
+		//! The lazily built gamut boundary.
+		/*!
+		* The lazily built gamut boundary, accessed atomically.
+		*/
+		std::shared_ptr<const color_manipulation::gamut_boundary> m_gamut_boundary;
 	};
 
 	//! Class that stores some default reference white values.
@@ -20,16 +20,16 @@ color_space::rgb_deepcolor::rgb_deepcolor(float r, float g, float b, float alpha
 color_space::rgb_deepcolor::rgb_deepcolor(const color_space::rgb_deepcolor & other) : color_base(other.alpha(), other.get_rgb_color_space(), 3, other.get_component_max(), other.get_component_min())
 {
 	this->m_type = other.get_color_type();
-	this->m_component_vector = other.get_component_vector();
+	this->m_component_vector = other.get_components();
 	this->alpha(other.alpha());
 }
 
 color_space::rgb_deepcolor::rgb_deepcolor(const color_base & other) : color_base(other.alpha(), other.get_rgb_color_space(), 3, other.get_component_max(), other.get_component_min())
 {
-	if (other.get_color_type() == color_type::RGB_DEEP && other.get_component_vector().size() == 4)
+	if (other.get_color_type() == color_type::RGB_DEEP && other.get_components().size() == 4)
 	{
 		this->m_type = color_type::RGB_DEEP;
-		this->m_component_vector = other.get_component_vector();
+		this->m_component_vector = other.get_components();
 	}
 	else
 	{
@@ -42,14 +42,16 @@ color_space::rgb_deepcolor & color_space::rgb_deepcolor::operator=(const color_s
 	if (this != &other)
 	{
 		this->m_type = other.get_color_type();
-		this->m_component_vector = other.get_component_vector();
+		this->m_component_vector = other.get_components();
 		this->m_max = other.get_component_max();
 		this->m_min = other.get_component_min();
+		this->m_alpha = other.m_alpha;
+		this->m_rgb_color_space = other.get_rgb_color_space();
 	}
 	return *this;
 }
 
-float color_space::rgb_deepcolor::red()
+float color_space::rgb_deepcolor::red() const
 {
 	return m_component_vector[0];
 }
@@ -59,7 +61,7 @@ void color_space::rgb_deepcolor::red(float new_red)
 	set_component(new_red, 0);
 }
 
-float color_space::rgb_deepcolor::green()
+float color_space::rgb_deepcolor::green() const
 {
 	return m_component_vector[1];
 }
@@ -69,7 +71,7 @@ void color_space::rgb_deepcolor::green(float new_green)
 	set_component(new_green, 1);
 }
 
-float color_space::rgb_deepcolor::blue()
+float color_space::rgb_deepcolor::blue() const
 {
 	return m_component_vector[2];
 }
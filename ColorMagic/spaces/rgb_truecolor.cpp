@@ -1,5 +1,6 @@
 #include "stdafx.h"
 #include "rgb_truecolor.h"
+#include "..\utils\color_parser.h"
 
 color_space::rgb_truecolor::rgb_truecolor(float value, float alpha, rgb_color_space_definition* color_space) : color_base(alpha, color_space, 3, 255.f, 0.f)
 {
@@ -21,42 +22,23 @@ color_space::rgb_truecolor::rgb_truecolor(float r, float g, float b, float alpha
 
 color_space::rgb_truecolor::rgb_truecolor(std::string hex_code, rgb_color_space_definition* color_space) : color_base(0, color_space, 3, 255.f, 0.f)
 {
-	std::regex regex("^[#0-9A-Fa-f]+$");
-
-	if (!std::regex_match(hex_code, regex))
+	const size_t digits = hex_code.length() - (!hex_code.empty() && hex_code[0] == '#' ? 1 : 0);
+	if (digits != 6 && digits != 8)
 	{
-		throw std::invalid_argument(std::string("The given hex code '" + hex_code + "' contains illegal values. Allowed are only numbers (0-9) and digits (a-f or A-F)."));
+		throw std::invalid_argument("Wrong hex code format. Use one of the following formats: #AARRGGBB, #RRGGBB, AARRGGBB, RRGGBB");
 	}
 
-	if (hex_code[0] == '#')
+	float rgba[4];
+	if (!color_parser::parse_hex(hex_code.data(), hex_code.length(), rgba))
 	{
-		hex_code = hex_code.substr(1);
+		throw std::invalid_argument(std::string("The given hex code '" + hex_code + "' contains illegal values. Allowed are only numbers (0-9) and digits (a-f or A-F)."));
 	}
 
-	if (hex_code.length() == 6)
-	{
-		int r, g, b;
-		sscanf_s(hex_code.c_str(), "%02x%02x%02x", &r, &g, &b);
-		this->m_type = color_type::RGB_TRUE;
-		this->alpha(255.f);
-		this->red((float)r);
-		this->green((float)g);
-		this->blue((float)b);
-	}
-	else if (hex_code.length() == 8)
-	{
-		int a, r, g, b;
-		sscanf_s(hex_code.c_str(), "%02x%02x%02x%02x", &a, &r, &g, &b);
-		this->m_type = color_type::RGB_TRUE;
-		this->alpha((float)a);
-		this->red((float)r);
-		this->green((float)g);
-		this->blue((float)b);
-	}
-	else
-	{
-		throw std::invalid_argument("Wrong hex code format. Use one of the following formats: #AARRGGBB, #RRGGBB, AARRGGBB, RRGGBB");
-	}
+	this->m_type = color_type::RGB_TRUE;
+	this->alpha(rgba[3]);
+	this->red(rgba[0]);
+	this->green(rgba[1]);
+	this->blue(rgba[2]);
 }
 
 color_space::rgb_truecolor::rgb_truecolor(int hex_code, rgb_color_space_definition* color_space) : color_base(0, color_space, 3, 255.f, 0.f)
@@ -71,16 +53,16 @@ color_space::rgb_truecolor::rgb_truecolor(int hex_code, rgb_color_space_definiti
 color_space::rgb_truecolor::rgb_truecolor(const color_space::rgb_truecolor & other) : color_base(other.alpha(), other.get_rgb_color_space(), 3, other.get_component_max(), other.get_component_min())
 {
 	this->m_type = other.get_color_type();
-	this->m_component_vector = other.get_component_vector();
+	this->m_component_vector = other.get_components();
 	this->alpha(other.alpha());
 }
 
 color_space::rgb_truecolor::rgb_truecolor(const color_base & other) : color_base(other.alpha(), other.get_rgb_color_space(), 3, other.get_component_max(), other.get_component_min())
 {
-	if (other.get_color_type() == color_type::RGB_TRUE && other.get_component_vector().size() == 4)
+	if (other.get_color_type() == color_type::RGB_TRUE && other.get_components().size() == 4)
 	{
 		this->m_type = color_type::RGB_TRUE;
-		this->m_component_vector = other.get_component_vector();
+		this->m_component_vector = other.get_components();
 	}
 	else
 	{
@@ -93,14 +75,16 @@ color_space::rgb_truecolor & color_space::rgb_truecolor::operator=(const color_s
 	if (this != &other)
 	{
 		this->m_type = other.get_color_type();
-		this->m_component_vector = other.get_component_vector();
+		this->m_component_vector = other.get_components();
 		this->m_max = other.get_component_max();
 		this->m_min = other.get_component_min();
+		this->m_alpha = other.m_alpha;
+		this->m_rgb_color_space = other.get_rgb_color_space();
 	}
 	return *this;
 }
 
-float color_space::rgb_truecolor::red()
+float color_space::rgb_truecolor::red() const
 {
 	return m_component_vector[0];
 }
@@ -110,7 +94,7 @@ void color_space::rgb_truecolor::red(float new_red)
 	set_component(new_red, 0);
 }
 
-float color_space::rgb_truecolor::green()
+float color_space::rgb_truecolor::green() const
 {
 	return m_component_vector[1];
 }
@@ -120,7 +104,7 @@ void color_space::rgb_truecolor::green(float new_green)
 	set_component(new_green, 1);
 }
 
-float color_space::rgb_truecolor::blue()
+float color_space::rgb_truecolor::blue() const
 {
 	return m_component_vector[2];
 }
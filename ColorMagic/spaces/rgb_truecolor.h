@@ -7,7 +7,6 @@
 
 #include "color_base.h"
 #include <string>
-#include <regex>
 
 namespace color_space
 {
@@ -77,7 +76,7 @@ namespace color_space
 
 		//! Getter for red component.
 		//! \return The red component of this color.
-		float red();
+		float red() const;
 
 		//! Setter for red component.
 		//! \param new_red The red value to set.
@@ -85,7 +84,7 @@ namespace color_space
 
 		//! Getter for green component.
 		//! \return The green component of this color.
-		float green();
+		float green() const;
 
 		//! Setter for green component.
 		//! \param new_green The green value to set.
@@ -93,7 +92,7 @@ namespace color_space
 
 		//! Getter for blue component.
 		//! \return The blue component of this color.
-		float blue();
+		float blue() const;
 
 		//! Setter for blue component.
 		//! \param new_blue The blue value to set.
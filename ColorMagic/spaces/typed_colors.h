@@ -0,0 +1,311 @@
+/// Copyright Martin Ruehlicke, 2019
+/// Use, modification and distribution are subject to the
+/// MIT Software License, Version 1.0.
+/// See accompanying file LICENSE.txt
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+
+namespace color_space
+{
+	//! Header only color value types with compile time conversions.
+	/*!
+	* A parallel API to the color classes deriving from color_base. The types are plain structs without virtual functions,
+	* the color space definition is a template parameter and convert<To>(from) is resolved at compile time by template
+	* specialization, so a chain of conversions is inlined completely and never touches the heap.
+	*
+	* The value ranges match the color classes: rgb components in [0,1], hues in degrees, lab luminance in [0,100].
+	*/
+	namespace typed
+	{
+		//! The sRGB color space with the D65 (2 degree) white point.
+		/*!
+		* Matches rgb_color_space_definition_presets().sRGB(). The matrices are derived from the sRGB primaries and the
+		* D65_2Degree white point of white_point_presets.
+		*/
+		struct srgb_profile
+		{
+			//! Removes the gamma correction of a component.
+			template <typename T> static T to_linear(T value)
+			{
+				return value <= T(0.04045) ? value / T(12.92) : std::pow((value + T(0.055)) / T(1.055), T(2.4));
+			}
+
+			//! Applies the gamma correction to a linear component.
+			template <typename T> static T from_linear(T value)
+			{
+				return value <= T(0.0031308) ? T(12.92) * value : T(1.055) * std::pow(value, T(1) / T(2.4)) - T(0.055);
+			}
+
+			//! Transforms linear rgb components to xyz.
+			template <typename T> static void to_xyz(T r, T g, T b, T& x, T& y, T& z)
+			{
+				x = T(0.4123690) * r + T(0.3575999) * g + T(0.1804311) * b;
+				y = T(0.2126278) * r + T(0.7151998) * g + T(0.0721724) * b;
+				z = T(0.0193298) * r + T(0.1192000) * g + T(0.9502702) * b;
+			}
+
+			//! Transforms xyz components to linear rgb.
+			template <typename T> static void from_xyz(T x, T y, T z, T& r, T& g, T& b)
+			{
+				r = T(3.2411409) * x - T(1.5374643) * y - T(0.4986371) * z;
+				g = T(-0.9692015) * x + T(1.8758859) * y + T(0.0415533) * z;
+				b = T(0.0556454) * x - T(0.2040332) * y + T(1.0572628) * z;
+			}
+
+			//! The tristimulus values of the white point.
+			template <typename T> static T white_x() { return T(0.9504); }
+			template <typename T> static T white_y() { return T(1); }
+			template <typename T> static T white_z() { return T(1.0888); }
+		};
+
+#pragma region Color types
+
+		//! Gamma corrected rgb color, the counterpart of rgb_deepcolor.
+		template <typename T, typename Profile = srgb_profile> struct rgb
+		{
+			typedef T value_type;
+			typedef Profile profile;
+
+			T red, green, blue, alpha;
+		};
+
+		//! CIE XYZ color, the counterpart of color_space::xyz.
+		template <typename T, typename Profile = srgb_profile> struct xyz
+		{
+			typedef T value_type;
+			typedef Profile profile;
+
+			T x, y, z, alpha;
+		};
+
+		//! CIE L*a*b* color relative to the white point of the profile, the counterpart of color_space::lab.
+		template <typename T, typename Profile = srgb_profile> struct lab
+		{
+			typedef T value_type;
+			typedef Profile profile;
+
+			T luminance, a, b, alpha;
+		};
+
+		//! HSL color, the counterpart of color_space::hsl.
+		template <typename T, typename Profile = srgb_profile> struct hsl
+		{
+			typedef T value_type;
+			typedef Profile profile;
+
+			T hue, saturation, lightness, alpha;
+		};
+
+		//! HSV color, the counterpart of color_space::hsv.
+		template <typename T, typename Profile = srgb_profile> struct hsv
+		{
+			typedef T value_type;
+			typedef Profile profile;
+
+			T hue, saturation, value, alpha;
+		};
+
+#pragma endregion
+
+#pragma region Converters
+
+		//! Converts a color of type From to type To.
+		/*!
+		* The primary template converts through xyz. Direct conversions are specializations, so the route between
+		* two types is chosen by the compiler.
+		*/
+		template <typename To, typename From> struct converter
+		{
+			typedef xyz<typename From::value_type, typename From::profile> hub;
+
+			static To apply(const From& color)
+			{
+				return converter<To, hub>::apply(converter<hub, From>::apply(color));
+			}
+		};
+
+		//! Conversion of a type to itself.
+		template <typename Color> struct converter<Color, Color>
+		{
+			static Color apply(const Color& color) { return color; }
+		};
+
+		namespace detail
+		{
+			//! Computes the hue in degrees from rgb components, see color_converter::hue_from_rgb_helper.
+			template <typename T> T hue_from_rgb(T red, T green, T blue, T max, T delta)
+			{
+				T hue;
+				if (max == red) hue = T(60) * std::fmod((green - blue) / delta, T(6));
+				else if (max == green) hue = T(60) * ((blue - red) / delta + T(2));
+				else hue = T(60) * ((red - green) / delta + T(4));
+				return hue;
+			}
+
+			template <typename T> T lab_forward(T value)
+			{
+				return value > T(216) / T(24389) ? std::cbrt(value) : (T(24389) / T(27) * value + T(16)) / T(116);
+			}
+
+			template <typename T> T lab_inverse(T value)
+			{
+				T cube = value * value * value;
+				return cube > T(216) / T(24389) ? cube : (T(116) * value - T(16)) / (T(24389) / T(27));
+			}
+		}
+
+		template <typename T, typename P> struct converter<xyz<T, P>, rgb<T, P>>
+		{
+			static xyz<T, P> apply(const rgb<T, P>& color)
+			{
+				xyz<T, P> result;
+				P::to_xyz(P::to_linear(color.red), P::to_linear(color.green), P::to_linear(color.blue), result.x, result.y, result.z);
+				result.alpha = color.alpha;
+				return result;
+			}
+		};
+
+		template <typename T, typename P> struct converter<rgb<T, P>, xyz<T, P>>
+		{
+			static rgb<T, P> apply(const xyz<T, P>& color)
+			{
+				T r, g, b;
+				P::from_xyz(color.x, color.y, color.z, r, g, b);
+				return rgb<T, P>{
+					P::from_linear(std::min(std::max(r, T(0)), T(1))),
+					P::from_linear(std::min(std::max(g, T(0)), T(1))),
+					P::from_linear(std::min(std::max(b, T(0)), T(1))),
+					color.alpha };
+			}
+		};
+
+		template <typename T, typename P> struct converter<lab<T, P>, xyz<T, P>>
+		{
+			static lab<T, P> apply(const xyz<T, P>& color)
+			{
+				T f_x = detail::lab_forward(color.x / P::template white_x<T>());
+				T f_y = detail::lab_forward(color.y / P::template white_y<T>());
+				T f_z = detail::lab_forward(color.z / P::template white_z<T>());
+				return lab<T, P>{ T(116) * f_y - T(16), T(500) * (f_x - f_y), T(200) * (f_y - f_z), color.alpha };
+			}
+		};
+
+		template <typename T, typename P> struct converter<xyz<T, P>, lab<T, P>>
+		{
+			static xyz<T, P> apply(const lab<T, P>& color)
+			{
+				T f_y = (color.luminance + T(16)) / T(116);
+				T y = color.luminance > T(8) ? f_y * f_y * f_y : color.luminance / (T(24389) / T(27));
+				return xyz<T, P>{
+					detail::lab_inverse(color.a / T(500) + f_y) * P::template white_x<T>(),
+					y * P::template white_y<T>(),
+					detail::lab_inverse(f_y - color.b / T(200)) * P::template white_z<T>(),
+					color.alpha };
+			}
+		};
+
+		template <typename T, typename P> struct converter<hsl<T, P>, rgb<T, P>>
+		{
+			static hsl<T, P> apply(const rgb<T, P>& color)
+			{
+				T min = std::min(std::min(color.red, color.green), color.blue);
+				T max = std::max(std::max(color.red, color.green), color.blue);
+				if (max == min) return hsl<T, P>{ T(0), T(0), min, color.alpha };
+
+				T delta = max - min;
+				T lightness = T(0.5) * (max + min);
+				T saturation = (lightness == T(0) || lightness == T(1)) ? T(0) : delta / (T(1) - std::fabs(T(2) * lightness - T(1)));
+				return hsl<T, P>{ detail::hue_from_rgb(color.red, color.green, color.blue, max, delta), saturation, lightness, color.alpha };
+			}
+		};
+
+		template <typename T, typename P> struct converter<rgb<T, P>, hsl<T, P>>
+		{
+			static T component(const hsl<T, P>& color, T n)
+			{
+				T k = std::fmod(n + color.hue / T(30), T(12));
+				T a = color.saturation * std::min(color.lightness, T(1) - color.lightness);
+				return color.lightness - a * std::max(std::min(k - T(3), std::min(T(9) - k, T(1))), T(-1));
+			}
+
+			static rgb<T, P> apply(const hsl<T, P>& color)
+			{
+				return rgb<T, P>{ component(color, T(0)), component(color, T(8)), component(color, T(4)), color.alpha };
+			}
+		};
+
+		template <typename T, typename P> struct converter<hsv<T, P>, rgb<T, P>>
+		{
+			static hsv<T, P> apply(const rgb<T, P>& color)
+			{
+				T min = std::min(std::min(color.red, color.green), color.blue);
+				T max = std::max(std::max(color.red, color.green), color.blue);
+				if (max == min) return hsv<T, P>{ T(0), T(0), min, color.alpha };
+
+				T delta = max - min;
+				return hsv<T, P>{ detail::hue_from_rgb(color.red, color.green, color.blue, max, delta), delta / max, max, color.alpha };
+			}
+		};
+
+		template <typename T, typename P> struct converter<rgb<T, P>, hsv<T, P>>
+		{
+			static T component(const hsv<T, P>& color, T n)
+			{
+				T k = std::fmod(n + color.hue / T(60), T(6));
+				return color.value - color.value * color.saturation * std::max(std::min(k, std::min(T(4) - k, T(1))), T(0));
+			}
+
+			static rgb<T, P> apply(const hsv<T, P>& color)
+			{
+				return rgb<T, P>{ component(color, T(5)), component(color, T(3)), component(color, T(1)), color.alpha };
+			}
+		};
+
+		//! Conversions between the hue based types and xyz go through rgb.
+		template <typename T, typename P> struct converter<xyz<T, P>, hsl<T, P>>
+		{
+			static xyz<T, P> apply(const hsl<T, P>& color) { return converter<xyz<T, P>, rgb<T, P>>::apply(converter<rgb<T, P>, hsl<T, P>>::apply(color)); }
+		};
+
+		template <typename T, typename P> struct converter<hsl<T, P>, xyz<T, P>>
+		{
+			static hsl<T, P> apply(const xyz<T, P>& color) { return converter<hsl<T, P>, rgb<T, P>>::apply(converter<rgb<T, P>, xyz<T, P>>::apply(color)); }
+		};
+
+		template <typename T, typename P> struct converter<xyz<T, P>, hsv<T, P>>
+		{
+			static xyz<T, P> apply(const hsv<T, P>& color) { return converter<xyz<T, P>, rgb<T, P>>::apply(converter<rgb<T, P>, hsv<T, P>>::apply(color)); }
+		};
+
+		template <typename T, typename P> struct converter<hsv<T, P>, xyz<T, P>>
+		{
+			static hsv<T, P> apply(const xyz<T, P>& color) { return converter<hsv<T, P>, rgb<T, P>>::apply(converter<rgb<T, P>, xyz<T, P>>::apply(color)); }
+		};
+
+		//! Conversions between the hue based types skip xyz.
+		template <typename T, typename P> struct converter<hsv<T, P>, hsl<T, P>>
+		{
+			static hsv<T, P> apply(const hsl<T, P>& color) { return converter<hsv<T, P>, rgb<T, P>>::apply(converter<rgb<T, P>, hsl<T, P>>::apply(color)); }
+		};
+
+		template <typename T, typename P> struct converter<hsl<T, P>, hsv<T, P>>
+		{
+			static hsl<T, P> apply(const hsv<T, P>& color) { return converter<hsl<T, P>, rgb<T, P>>::apply(converter<rgb<T, P>, hsv<T, P>>::apply(color)); }
+		};
+
+#pragma endregion
+
+		//! Converts a color to another type.
+		/*!
+		* \param color The color to convert.
+		* \return The converted color, e.g. convert<lab<float>>(rgb<float>{ 1.f, 0.5f, 0.f, 1.f }).
+		*/
+		template <typename To, typename From> inline To convert(const From& color)
+		{
+			return converter<To, From>::apply(color);
+		}
+	}
+}
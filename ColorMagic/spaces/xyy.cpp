@@ -12,16 +12,16 @@ color_space::xyy::xyy(float x, float y, float Y, float alpha, rgb_color_space_de
 color_space::xyy::xyy(const xyy & other) : color_base(other.alpha(), other.get_rgb_color_space(), 3, other.get_component_max(), other.get_component_min())
 {
 	this->m_type = other.get_color_type();
-	this->m_component_vector = other.get_component_vector();
+	this->m_component_vector = other.get_components();
 	this->alpha(other.alpha());
 }
 
 color_space::xyy::xyy(const color_base & other) : color_base(other.alpha(), other.get_rgb_color_space(), 3, other.get_component_max(), other.get_component_min())
 {
-	if (other.get_color_type() == color_type::XYY && other.get_component_vector().size() == 3)
+	if (other.get_color_type() == color_type::XYY && other.get_components().size() == 3)
 	{
 		this->m_type = color_type::XYY;
-		this->m_component_vector = other.get_component_vector();
+		this->m_component_vector = other.get_components();
 	}
 	else
 	{
@@ -34,14 +34,16 @@ color_space::xyy & color_space::xyy::operator=(const color_space::xyy & other)
 	if (this != &other)
 	{
 		this->m_type = other.get_color_type();
-		this->m_component_vector = other.get_component_vector();
+		this->m_component_vector = other.get_components();
 		this->m_max = other.get_component_max();
 		this->m_min = other.get_component_min();
+		this->m_alpha = other.m_alpha;
+		this->m_rgb_color_space = other.get_rgb_color_space();
 	}
 	return *this;
 }
 
-float color_space::xyy::x()
+float color_space::xyy::x() const
 {
 	return m_component_vector[0];
 }
@@ -51,7 +53,7 @@ void color_space::xyy::x(float new_x)
 	set_component(new_x, 0);
 }
 
-float color_space::xyy::y()
+float color_space::xyy::y() const
 {
 	return m_component_vector[1];
 }
@@ -61,7 +63,7 @@ void color_space::xyy::y(float new_y)
 	set_component(new_y, 1);
 }
 
-float color_space::xyy::Y()
+float color_space::xyy::Y() const
 {
 	return m_component_vector[2];
 }
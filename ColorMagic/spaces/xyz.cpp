@@ -12,16 +12,16 @@ color_space::xyz::xyz(float x, float y, float z, float alpha, rgb_color_space_de
 color_space::xyz::xyz(const xyz & other) : color_base(other.alpha(), other.get_rgb_color_space(), 3, other.get_component_max(), other.get_component_min())
 {
 	this->m_type = other.get_color_type();
-	this->m_component_vector = other.get_component_vector();
+	this->m_component_vector = other.get_components();
 	this->alpha(other.alpha());
 }
 
 color_space::xyz::xyz(const color_base & other) : color_base(other.alpha(), other.get_rgb_color_space(), 3, other.get_component_max(), other.get_component_min())
 {
-	if (other.get_color_type() == color_type::XYZ && other.get_component_vector().size() == 3)
+	if (other.get_color_type() == color_type::XYZ && other.get_components().size() == 3)
 	{
 		this->m_type = color_type::XYZ;
-		this->m_component_vector = other.get_component_vector();
+		this->m_component_vector = other.get_components();
 	}
 	else
 	{
@@ -34,14 +34,16 @@ color_space::xyz & color_space::xyz::operator=(const color_space::xyz & other)
 	if (this != &other)
 	{
 		this->m_type = other.get_color_type();
-		this->m_component_vector = other.get_component_vector();
+		this->m_component_vector = other.get_components();
 		this->m_max = other.get_component_max();
 		this->m_min = other.get_component_min();
+		this->m_alpha = other.m_alpha;
+		this->m_rgb_color_space = other.get_rgb_color_space();
 	}
 	return *this;
 }
 
-float color_space::xyz::x()
+float color_space::xyz::x() const
 {
 	return m_component_vector[0];
 }
@@ -51,7 +53,7 @@ void color_space::xyz::x(float new_x)
 	set_component(new_x, 0);
 }
 
-float color_space::xyz::y()
+float color_space::xyz::y() const
 {
 	return m_component_vector[1];
 }
@@ -61,7 +63,7 @@ void color_space::xyz::y(float new_y)
 	set_component(new_y, 1);
 }
 
-float color_space::xyz::z()
+float color_space::xyz::z() const
 {
 	return m_component_vector[2];
 }
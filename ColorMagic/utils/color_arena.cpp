@@ -0,0 +1,187 @@
+#include "stdafx.h"
+#include "color_arena.h"
+#include "..\spaces\color_base.h"
+#include "instrumentation.h"
+
+#include <new>
+#include <cstdlib>
+#include <algorithm>
+#include <atomic>
+
+namespace
+{
+	thread_local color_arena* t_current_arena = nullptr;
+	std::atomic<size_t> g_heap_objects_alive(0);
+
+	size_t align_size(size_t size)
+	{
+		const size_t alignment = alignof(std::max_align_t);
+		return (size + alignment - 1) / alignment * alignment;
+	}
+}
+
+color_arena::color_arena(size_t block_size)
+{
+	m_block_size = std::max(block_size, align_size(sizeof(header) + sizeof(color_space::color_base)));
+}
+
+color_arena::~color_arena()
+{
+	release_memory();
+}
+
+void color_arena::reset()
+{
+	for (header* object : m_objects)
+	{
+		if (!object->destroyed)
+		{
+			object->destroyed = true;
+			reinterpret_cast<color_space::color_base*>(object + 1)->~color_base();
+		}
+	}
+
+	m_objects.clear();
+	for (block& b : m_blocks)
+	{
+		b.used = 0;
+	}
+
+	m_current_block = 0;
+	m_statistics.objects_alive = 0;
+	m_statistics.bytes_in_use = 0;
+	++m_statistics.reset_count;
+}
+
+void color_arena::release_memory()
+{
+	reset();
+
+	for (block& b : m_blocks)
+	{
+		std::free(b.memory);
+	}
+
+	m_blocks.clear();
+	m_statistics.bytes_reserved = 0;
+	m_statistics.block_count = 0;
+}
+
+color_arena_statistics color_arena::statistics() const
+{
+	return m_statistics;
+}
+
+bool color_arena::owns(const color_space::color_base* color) const
+{
+	const char* address = reinterpret_cast<const char*>(color);
+	for (const block& b : m_blocks)
+	{
+		if (address >= b.memory && address < b.memory + b.used) return true;
+	}
+
+	return false;
+}
+
+color_arena* color_arena::current()
+{
+	return t_current_arena;
+}
+
+color_arena& color_arena::thread_arena()
+{
+	thread_local color_arena arena;
+	return arena;
+}
+
+color_arena::scope::scope(color_arena* arena)
+{
+	m_previous = t_current_arena;
+	t_current_arena = arena;
+}
+
+color_arena::scope::~scope()
+{
+	t_current_arena = m_previous;
+}
+
+size_t color_arena::heap_objects_alive()
+{
+	return g_heap_objects_alive;
+}
+
+void* color_arena::allocate_object(size_t size)
+{
+	COLORMAGIC_COUNT_ALLOCATION();
+
+	if (t_current_arena != nullptr)
+	{
+		return t_current_arena->allocate(size);
+	}
+
+	void* memory = std::malloc(sizeof(header) + size);
+	if (memory == nullptr) throw std::bad_alloc();
+
+	header* object = new (memory) header{ nullptr, size, false };
+	++g_heap_objects_alive;
+	return object + 1;
+}
+
+void color_arena::release_object(void* memory)
+{
+	if (memory == nullptr) return;
+
+	header* object = static_cast<header*>(memory) - 1;
+	if (object->owner == nullptr)
+	{
+		std::free(object);
+		--g_heap_objects_alive;
+		return;
+	}
+
+	// The destructor already ran, the memory is given back by the next reset.
+	object->destroyed = true;
+	--object->owner->m_statistics.objects_alive;
+}
+
+void* color_arena::allocate(size_t size)
+{
+	const size_t needed = sizeof(header) + align_size(size);
+
+	while (m_current_block < m_blocks.size() && m_blocks[m_current_block].size - m_blocks[m_current_block].used < needed)
+	{
+		++m_current_block;
+	}
+
+	if (m_current_block == m_blocks.size())
+	{
+		add_block(needed);
+	}
+
+	block& b = m_blocks[m_current_block];
+	header* object = new (b.memory + b.used) header{ this, size, false };
+	b.used += needed;
+
+	m_objects.push_back(object);
+
+	++m_statistics.objects_served;
+	++m_statistics.objects_alive;
+	m_statistics.bytes_served += needed;
+	m_statistics.bytes_in_use += needed;
+	m_statistics.peak_bytes_in_use = std::max(m_statistics.peak_bytes_in_use, m_statistics.bytes_in_use);
+
+	return object + 1;
+}
+
+void color_arena::add_block(size_t minimum_size)
+{
+	const size_t size = std::max(m_block_size, minimum_size);
+
+	// malloc returns memory aligned for any fundamental type, which is what the headers need.
+	char* memory = static_cast<char*>(std::malloc(size));
+	if (memory == nullptr) throw std::bad_alloc();
+
+	m_blocks.push_back(block{ memory, size, 0 });
+	m_statistics.bytes_reserved += size;
+	++m_statistics.block_count;
+}
@@ -0,0 +1,193 @@
+/// Copyright Martin Ruehlicke, 2019
+/// Use, modification and distribution are subject to the
+/// MIT Software License, Version 1.0.
+/// See accompanying file LICENSE.txt
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace color_space
+{
+	class color_base;
+}
+
+//! Statistics of a color arena.
+/*!
+* Counters describing how many color objects and bytes an arena has served as well as its current memory footprint.
+*/
+struct color_arena_statistics
+{
+	//! Number of color objects allocated from the arena since its construction.
+	size_t objects_served = 0;
+
+	//! Number of color objects which are currently alive inside the arena.
+	size_t objects_alive = 0;
+
+	//! Number of bytes handed out since the construction of the arena (including headers and padding).
+	size_t bytes_served = 0;
+
+	//! Number of bytes currently handed out (set to 0 by reset()).
+	size_t bytes_in_use = 0;
+
+	//! Highest number of bytes that were in use at the same time.
+	size_t peak_bytes_in_use = 0;
+
+	//! Number of bytes reserved by the memory blocks of the arena.
+	size_t bytes_reserved = 0;
+
+	//! Number of memory blocks owned by the arena.
+	size_t block_count = 0;
+
+	//! Number of reset() calls.
+	size_t reset_count = 0;
+};
+
+//! Arena allocator for color objects.
+/*!
+* Every color object is allocated through color_base::operator new. While an arena is active on the calling thread
+* (see color_arena::scope) the memory is taken from the blocks of this arena by bumping a pointer instead of asking the heap.
+* This covers all results and intermediate colors created by color_converter, color_calculation, color_blend, porter_duff,
+* color_adjustments, color_combinations and chromatic_adaptation, so a whole batch of conversions can be thrown away with one reset().
+*
+* Deleting an arena object is allowed, it only runs its destructor. The memory is given back by reset(), which also destroys
+* all objects that were not deleted before. Objects allocated while no arena was active live on the heap as usual.
+* An arena must only be used by one thread at a time.
+*/
+class color_arena
+{
+public:
+	//! Activates an arena for the calling thread.
+	/*!
+	* The previously active arena is restored on destruction, so scopes can be nested.
+	* Passing nullptr deactivates the arena, colors are allocated on the heap again.
+	*/
+	class scope
+	{
+	public:
+		//! Default constructor.
+		/*!
+		* \param arena The arena to activate or nullptr to allocate from the heap.
+		*/
+		explicit scope(color_arena* arena);
+
+		//! Default destructor.
+		/*!
+		* Restores the previously active arena.
+		*/
+		~scope();
+
+		scope(const scope&) = delete;
+		scope& operator=(const scope&) = delete;
+
+	private:
+		color_arena* m_previous;
+	};
+
+	//! Default constructor.
+	/*!
+	* \param block_size The size in bytes of the memory blocks requested from the heap.
+	*/
+	explicit color_arena(size_t block_size = 64 * 1024);
+
+	//! Default destructor.
+	/*!
+	* Destroys all objects still alive and frees the memory blocks.
+	*/
+	~color_arena();
+
+	color_arena(const color_arena&) = delete;
+	color_arena& operator=(const color_arena&) = delete;
+
+	//! Creates a color object inside this arena, regardless of the arena active on the calling thread.
+	/*!
+	* \param args The arguments passed to the constructor of T.
+	* \return The new color object owned by this arena.
+	*/
+	template <typename T, typename... Args>
+	T* create(Args&&... args)
+	{
+		scope active(this);
+		return new T(static_cast<Args&&>(args)...);
+	}
+
+	//! Destroys all objects of the arena.
+	/*!
+	* The memory blocks are kept and reused by the following allocations.
+	*/
+	void reset();
+
+	//! Destroys all objects of the arena and frees its memory blocks.
+	void release_memory();
+
+	//! Returns the statistics of the arena.
+	color_arena_statistics statistics() const;
+
+	//! Returns whether a color object was allocated from this arena.
+	/*!
+	* \param color The color to check.
+	* \return True if the color lives inside one of the arenas memory blocks.
+	*/
+	bool owns(const color_space::color_base* color) const;
+
+	//! Returns the arena active on the calling thread or nullptr if there is none.
+	static color_arena* current();
+
+	//! Returns an arena owned by the calling thread.
+	/*!
+	* The arena lives as long as the thread, it can be activated with color_arena::scope like any other arena.
+	*/
+	static color_arena& thread_arena();
+
+	//! Returns the number of color objects currently alive on the heap, summed over all threads.
+	/*!
+	* Objects allocated while no arena was active are counted until they are deleted, which makes leaks visible without an external tool.
+	*/
+	static size_t heap_objects_alive();
+
+	//! Allocates the memory of a color object.
+	/*!
+	* Used by color_base::operator new. Takes the memory from the active arena or from the heap if there is none.
+	* \param size The size of the object.
+	* \return The memory for the object.
+	*/
+	static void* allocate_object(size_t size);
+
+	//! Releases the memory of a color object.
+	/*!
+	* Used by color_base::operator delete. Heap memory is freed at once, arena memory is given back by the next reset().
+	* \param memory The memory returned by allocate_object().
+	*/
+	static void release_object(void* memory);
+
+private:
+	//! A memory block of the arena.
+	struct block
+	{
+		char* memory;
+		size_t size;
+		size_t used;
+	};
+
+	//! Header stored in front of every color object.
+	/*!
+	* Stores the arena the object was allocated from (nullptr for heap objects) and whether the object was already destroyed.
+	* The header is padded to the maximum alignment so the object behind it is aligned as well.
+	*/
+	struct alignas(std::max_align_t) header
+	{
+		color_arena* owner;
+		size_t size;
+		bool destroyed;
+	};
+
+	void* allocate(size_t size);
+	void add_block(size_t minimum_size);
+
+	size_t m_block_size;
+	size_t m_current_block = 0;
+	std::vector<block> m_blocks;
+	std::vector<header*> m_objects;
+	color_arena_statistics m_statistics;
+};
@@ -0,0 +1,113 @@
+#include "stdafx.h"
+#include "color_buffer.h"
+#include "..\spaces\rgb_truecolor.h"
+#include "..\spaces\rgb_deepcolor.h"
+#include "..\spaces\grey_truecolor.h"
+#include "..\spaces\grey_deepcolor.h"
+#include "..\spaces\cmyk.h"
+#include "..\spaces\hsi.h"
+#include "..\spaces\hsv.h"
+#include "..\spaces\hsl.h"
+#include "..\spaces\hcy.h"
+#include "..\spaces\xyz.h"
+#include "..\spaces\xyy.h"
+#include "..\spaces\cieluv.h"
+#include "..\spaces\lab.h"
+#include "..\spaces\lch_ab.h"
+#include "..\spaces\lch_uv.h"
+
+#include <stdexcept>
+
+color_buffer::color_buffer(color_type type, color_space::rgb_color_space_definition * rgb_color_space, size_t size)
+	: m_type(type), m_rgb_color_space(rgb_color_space), m_channels(component_count(type) + 1), m_size(0)
+{
+	if (type == color_type::UNDEFINED) throw new std::invalid_argument("A color buffer needs a defined color type.");
+	resize(size);
+}
+
+void color_buffer::resize(size_t size)
+{
+	m_size = size;
+	m_data.resize(size * m_channels, 0.f);
+}
+
+void color_buffer::push_back(const color_space::color_base & color)
+{
+	if (color.get_color_type() != m_type) throw new std::invalid_argument("The color type of the color does not match the color type of the buffer.");
+
+	const auto& components = color.get_components();
+	m_data.insert(m_data.end(), components.begin(), components.end());
+	m_data.push_back(color.alpha());
+	++m_size;
+}
+
+color_space::color_base * color_buffer::create_color(size_t index) const
+{
+	const float* p = pixel(index);
+	switch (m_type)
+	{
+	case color_type::RGB_TRUE:
+		return new color_space::rgb_truecolor(p[0], p[1], p[2], p[3], m_rgb_color_space);
+	case color_type::RGB_DEEP:
+		return new color_space::rgb_deepcolor(p[0], p[1], p[2], p[3], m_rgb_color_space);
+	case color_type::GREY_TRUE:
+		return new color_space::grey_truecolor(p[0], p[1], m_rgb_color_space);
+	case color_type::GREY_DEEP:
+		return new color_space::grey_deepcolor(p[0], p[1], m_rgb_color_space);
+	case color_type::CMYK:
+		return new color_space::cmyk(p[0], p[1], p[2], p[3], p[4], m_rgb_color_space);
+	case color_type::HSI:
+		return new color_space::hsi(p[0], p[1], p[2], p[3], m_rgb_color_space);
+	case color_type::HSV:
+		return new color_space::hsv(p[0], p[1], p[2], p[3], m_rgb_color_space);
+	case color_type::HSL:
+		return new color_space::hsl(p[0], p[1], p[2], p[3], m_rgb_color_space);
+	case color_type::HCY:
+		return new color_space::hcy(p[0], p[1], p[2], p[3], m_rgb_color_space);
+	case color_type::XYZ:
+		return new color_space::xyz(p[0], p[1], p[2], p[3], m_rgb_color_space);
+	case color_type::XYY:
+		return new color_space::xyy(p[0], p[1], p[2], p[3], m_rgb_color_space);
+	case color_type::CIELUV:
+		return new color_space::cieluv(p[0], p[1], p[2], p[3], m_rgb_color_space);
+	case color_type::LAB:
+		return new color_space::lab(p[0], p[1], p[2], p[3], m_rgb_color_space);
+	case color_type::LCH_AB:
+		return new color_space::lch_ab(p[0], p[1], p[2], p[3], m_rgb_color_space);
+	case color_type::LCH_UV:
+		return new color_space::lch_uv(p[0], p[1], p[2], p[3], m_rgb_color_space);
+	default:
+		return nullptr;
+	}
+}
+
+size_t color_buffer::component_count(color_type type)
+{
+	switch (type)
+	{
+	case color_type::GREY_TRUE:
+	case color_type::GREY_DEEP:
+		return 1;
+	case color_type::CMYK:
+		return 4;
+	default:
+		return 3;
+	}
+}
+
+int color_buffer::hue_component(color_type type)
+{
+	switch (type)
+	{
+	case color_type::HSI:
+	case color_type::HSV:
+	case color_type::HSL:
+	case color_type::HCY:
+		return 0;
+	case color_type::LCH_AB:
+	case color_type::LCH_UV:
+		return 2;
+	default:
+		return -1;
+	}
+}
@@ -0,0 +1,97 @@
+/// Copyright Martin Ruehlicke, 2019
+/// Use, modification and distribution are subject to the
+/// MIT Software License, Version 1.0.
+/// See accompanying file LICENSE.txt
+
+#pragma once
+
+#include "color_type.h"
+
+#include <cstddef>
+#include <vector>
+
+namespace color_space
+{
+	class color_base;
+	class rgb_color_space_definition;
+}
+
+//! Contiguous storage for many colors of the same color type.
+/*!
+* Stores the components of every color followed by its alpha value in one float array, e.g. r, g, b, a, r, g, b, a, ...
+* for rgb colors or c, m, y, k, a, ... for cmyk colors. Buffers are used by the batch functions which process millions
+* of pixels without creating a color object per pixel.
+*/
+class color_buffer
+{
+public:
+	//! Default constructor.
+	/*!
+	* \param type The color type of all colors in the buffer.
+	* \param rgb_color_space The rgb color space definition of all colors in the buffer.
+	* \param size The initial number of colors, all set to 0.
+	*/
+	color_buffer(color_type type, color_space::rgb_color_space_definition* rgb_color_space, size_t size = 0);
+
+	//! Returns the color type of the colors.
+	color_type get_color_type() const { return m_type; }
+
+	//! Returns the rgb color space definition of the colors.
+	color_space::rgb_color_space_definition* get_rgb_color_space() const { return m_rgb_color_space; }
+
+	//! Returns the number of colors.
+	size_t size() const { return m_size; }
+
+	//! Returns whether the buffer contains no colors.
+	bool empty() const { return m_size == 0; }
+
+	//! Returns the number of floats per color (components and alpha).
+	size_t channels() const { return m_channels; }
+
+	//! Returns the index of the alpha value inside a color.
+	size_t alpha_channel() const { return m_channels - 1; }
+
+	//! Returns the values of a color.
+	float* pixel(size_t index) { return m_data.data() + index * m_channels; }
+
+	//! Returns the values of a color.
+	const float* pixel(size_t index) const { return m_data.data() + index * m_channels; }
+
+	//! Returns the values of all colors.
+	float* data() { return m_data.data(); }
+
+	//! Returns the values of all colors.
+	const float* data() const { return m_data.data(); }
+
+	//! Changes the number of colors, new colors are set to 0.
+	void resize(size_t size);
+
+	//! Appends a color.
+	/*!
+	* \param color The color to append, it must have the color type of the buffer.
+	*/
+	void push_back(const color_space::color_base& color);
+
+	//! Creates a color object from a color of the buffer.
+	/*!
+	* \param index The index of the color.
+	* \return A new color object owned by the caller.
+	*/
+	color_space::color_base* create_color(size_t index) const;
+
+	//! Returns the number of components of a color type (without alpha).
+	static size_t component_count(color_type type);
+
+	//! Returns the index of the hue component of a color type.
+	/*!
+	* \return The index of the hue or -1 if the color type has no hue.
+	*/
+	static int hue_component(color_type type);
+
+private:
+	color_type m_type;
+	color_space::rgb_color_space_definition* m_rgb_color_space;
+	size_t m_channels;
+	size_t m_size;
+	std::vector<float> m_data;
+};
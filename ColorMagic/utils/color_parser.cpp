@@ -0,0 +1,394 @@
+#include "stdafx.h"
+#include "color_parser.h"
+#include "predefined_colors.h"
+#include "parallel.h"
+#include "..\manipulation\color_converter.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+
+namespace
+{
+	const uint64_t g_ones = 0x0101010101010101ull;
+	const uint64_t g_high = 0x8080808080808080ull;
+
+	//! Marks the bytes of x in the range [low,high] with 0x80, all bytes of x have to be below 0x80.
+	inline uint64_t bytes_in_range(uint64_t x, uint64_t low, uint64_t high)
+	{
+		// Per byte x + 0x80 - low has its high bit set for x >= low and 0x80 + high - x for x <= high, no byte carries.
+		return (x + (0x80 - low) * g_ones) & ((0x80 + high) * g_ones - x) & g_high;
+	}
+
+	//! Decodes 8 hex digits at once, the first digit is the most significant.
+	/*!
+	* \return Whether all characters are hex digits.
+	*/
+	inline bool decode_hex8(const char* digits, uint32_t& value)
+	{
+		uint64_t x = 0;
+		for (int i = 0; i < 8; ++i) x |= (uint64_t)(uint8_t)digits[i] << (8 * i);
+		if (x & g_high) return false;
+
+		// Setting 0x20 maps 'A'-'F' to 'a'-'f', no other character ends up in that range.
+		const uint64_t digit = bytes_in_range(x, '0', '9');
+		const uint64_t letter = bytes_in_range(x | 0x20 * g_ones, 'a', 'f');
+		if ((digit | letter) != g_high) return false;
+
+		// '0'-'9' and 'a'-'f' have the values 0-9 and 1-6 in their low nibble, letters add 9.
+		const uint64_t nibbles = (x & 0x0F * g_ones) + (letter >> 7) * 9;
+		const uint64_t pairs = ((nibbles << 4) | (nibbles >> 8)) & 0x00FF00FF00FF00FFull;
+		value = (uint32_t)((pairs & 0xFF) << 24 | ((pairs >> 16) & 0xFF) << 16 | ((pairs >> 32) & 0xFF) << 8 | ((pairs >> 48) & 0xFF));
+		return true;
+	}
+
+	inline void argb_to_rgba(uint32_t argb, float* rgba)
+	{
+		rgba[0] = (float)((argb >> 16) & 0xFF);
+		rgba[1] = (float)((argb >> 8) & 0xFF);
+		rgba[2] = (float)(argb & 0xFF);
+		rgba[3] = (float)(argb >> 24);
+	}
+
+	inline bool is_space(char c)
+	{
+		return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+	}
+
+	inline char to_lower(char c)
+	{
+		return c >= 'A' && c <= 'Z' ? (char)(c + ('a' - 'A')) : c;
+	}
+
+	bool parse_name(const char* text, size_t length, float* rgba)
+	{
+		const size_t index = predefined_colors::find(text, length);
+		if (index == predefined_colors::not_found) return false;
+
+		argb_to_rgba(predefined_colors::argb(index), rgba);
+		return true;
+	}
+
+	//! Consumes a case insensitive prefix.
+	bool consume(const char*& text, const char* end, const char* prefix)
+	{
+		const char* p = text;
+		for (; *prefix != 0; ++prefix, ++p)
+		{
+			if (p == end || to_lower(*p) != *prefix) return false;
+		}
+		text = p;
+		return true;
+	}
+
+	void skip_spaces(const char*& text, const char* end)
+	{
+		while (text != end && is_space(*text)) ++text;
+	}
+
+	//! Parses a CSS number with an optional sign, fraction and percent sign.
+	bool parse_number(const char*& text, const char* end, float& value, bool& percent)
+	{
+		const char* p = text;
+		bool negative = false;
+		if (p != end && (*p == '-' || *p == '+')) negative = *p++ == '-';
+
+		double result = 0.;
+		bool digits = false;
+		for (; p != end && *p >= '0' && *p <= '9'; ++p, digits = true) result = result * 10. + (*p - '0');
+		if (p != end && *p == '.')
+		{
+			double scale = 0.1;
+			for (++p; p != end && *p >= '0' && *p <= '9'; ++p, digits = true, scale *= 0.1) result += (*p - '0') * scale;
+		}
+		if (!digits) return false;
+
+		percent = p != end && *p == '%';
+		if (percent) ++p;
+		value = (float)(negative ? -result : result);
+		text = p;
+		return true;
+	}
+
+	//! Consumes a separator between two arguments: a comma or white space, or a slash before alpha.
+	bool parse_separator(const char*& text, const char* end, bool alpha)
+	{
+		const char* start = text;
+		skip_spaces(text, end);
+		if (text != end && (*text == ',' || (alpha && *text == '/')))
+		{
+			++text;
+			skip_spaces(text, end);
+			return true;
+		}
+		return text != start;
+	}
+
+	inline float clamp_channel(float value)
+	{
+		return std::round(std::min(std::max(value, 0.f), 255.f));
+	}
+
+	//! Parses the arguments of rgb(), rgba(), hsl() or hsla() after the opening bracket.
+	bool parse_css(const char* text, const char* end, bool hsl, float* rgba)
+	{
+		float values[4];
+		bool percent[4];
+		size_t count = 0;
+
+		skip_spaces(text, end);
+		while (count < 4 && text != end && *text != ')')
+		{
+			if (count > 0 && !parse_separator(text, end, count == 3)) return false;
+			if (!parse_number(text, end, values[count], percent[count])) return false;
+			if (hsl && count == 0) consume(text, end, "deg");
+			++count;
+
+			const char* next = text;
+			skip_spaces(next, end);
+			if (next != end && *next == ')') text = next;
+		}
+		if (count < 3 || text == end || *text != ')') return false;
+		if (++text != end) return false;
+
+		float alpha = 1.f;
+		if (count == 4) alpha = percent[3] ? values[3] / 100.f : values[3];
+		rgba[3] = clamp_channel(alpha * 255.f);
+
+		if (!hsl)
+		{
+			for (size_t c = 0; c < 3; ++c) rgba[c] = clamp_channel(percent[c] ? values[c] * 2.55f : values[c]);
+			return true;
+		}
+
+		// CSS Color Module Level 3, the saturation and lightness are percentages.
+		float hue = std::fmod(values[0], 360.f);
+		if (hue < 0.f) hue += 360.f;
+		const float saturation = std::min(std::max(values[1] / 100.f, 0.f), 1.f);
+		const float lightness = std::min(std::max(values[2] / 100.f, 0.f), 1.f);
+		const float amplitude = saturation * std::min(lightness, 1.f - lightness);
+		const float offsets[3] = { 0.f, 8.f, 4.f };
+		for (size_t c = 0; c < 3; ++c)
+		{
+			const float k = std::fmod(offsets[c] + hue / 30.f, 12.f);
+			const float value = lightness - amplitude * std::max(-1.f, std::min(std::min(k - 3.f, 9.f - k), 1.f));
+			rgba[c] = clamp_channel(value * 255.f);
+		}
+		return true;
+	}
+
+	inline char* write_hex(uint32_t value, char* text)
+	{
+		static const char digits[] = "0123456789ABCDEF";
+		text[0] = digits[value >> 4];
+		text[1] = digits[value & 0x0F];
+		return text + 2;
+	}
+
+	inline char* write_integer(uint32_t value, char* text)
+	{
+		if (value >= 100) *text++ = (char)('0' + value / 100);
+		if (value >= 10) *text++ = (char)('0' + value / 10 % 10);
+		*text++ = (char)('0' + value % 10);
+		return text;
+	}
+}
+
+bool color_parser::parse(const char * text, size_t length, float * rgba)
+{
+	const char* end = text + length;
+	while (text != end && is_space(*text)) ++text;
+	while (end != text && is_space(end[-1])) --end;
+	if (text == end) return false;
+
+	if (*text == '#') return parse_hex(text, end - text, rgba);
+
+	const char* p = text;
+	if (consume(p, end, "rgb(") || consume(p, end, "rgba(")) return parse_css(p, end, false, rgba);
+	if (consume(p, end, "hsl(") || consume(p, end, "hsla(")) return parse_css(p, end, true, rgba);
+
+	return parse_name(text, end - text, rgba) || parse_hex(text, end - text, rgba);
+}
+
+bool color_parser::parse_hex(const char * text, size_t length, float * rgba)
+{
+	const bool hash = length > 0 && text[0] == '#';
+	if (hash)
+	{
+		++text;
+		--length;
+	}
+
+	// Shorter codes are padded to 8 digits, a missing alpha is opaque.
+	char digits[8];
+	switch (length)
+	{
+	case 3:
+		if (!hash) return false;
+		digits[0] = digits[1] = 'F';
+		for (size_t i = 0; i < 3; ++i) digits[2 + 2 * i] = digits[3 + 2 * i] = text[i];
+		break;
+	case 6:
+		digits[0] = digits[1] = 'F';
+		std::memcpy(digits + 2, text, 6);
+		break;
+	case 8:
+		std::memcpy(digits, text, 8);
+		break;
+	default:
+		return false;
+	}
+
+	uint32_t argb;
+	if (!decode_hex8(digits, argb)) return false;
+	argb_to_rgba(argb, rgba);
+	return true;
+}
+
+color_buffer color_parser::parse(const std::vector<std::string>& codes, color_space::rgb_color_space_definition * rgb_color_space)
+{
+	color_buffer result(color_type::RGB_TRUE, rgb_color_space, codes.size());
+	for (size_t i = 0; i < codes.size(); ++i)
+	{
+		if (!parse(codes[i].data(), codes[i].size(), result.pixel(i)))
+		{
+			throw new std::invalid_argument("The color '" + codes[i] + "' at index " + std::to_string(i) + " is not valid.");
+		}
+	}
+	return result;
+}
+
+color_buffer color_parser::parse_lines(const char * text, size_t length, color_space::rgb_color_space_definition * rgb_color_space, std::vector<size_t>* invalid_lines)
+{
+	// Offsets of all line starts, the last entry is the end of the text.
+	std::vector<size_t> lines(1, 0);
+	for (const char* p = text, *end = text + length; (p = (const char*)std::memchr(p, '\n', end - p)) != nullptr; ++p)
+	{
+		lines.push_back(p + 1 - text);
+	}
+	if (lines.back() != length) lines.push_back(length);
+	const size_t line_count = lines.size() - 1;
+
+	color_buffer result(color_type::RGB_TRUE, rgb_color_space, line_count);
+	std::vector<uint8_t> state(line_count);
+	enum { EMPTY = 0, VALID, INVALID };
+
+	parallel::for_each_chunk(line_count, 4096, [&](size_t chunk, size_t begin, size_t end)
+	{
+		for (size_t i = begin; i < end; ++i)
+		{
+			const char* line = text + lines[i];
+			size_t size = lines[i + 1] - lines[i];
+			while (size > 0 && is_space(line[size - 1])) --size;
+			while (size > 0 && is_space(*line))
+			{
+				++line;
+				--size;
+			}
+
+			if (size == 0) state[i] = EMPTY;
+			else state[i] = parse(line, size, result.pixel(i)) ? VALID : INVALID;
+		}
+	});
+
+	// Move the valid colors together.
+	size_t count = 0;
+	for (size_t i = 0; i < line_count; ++i)
+	{
+		if (state[i] == INVALID)
+		{
+			if (invalid_lines == nullptr)
+			{
+				throw new std::invalid_argument("The color in line " + std::to_string(i) + " is not valid.");
+			}
+			invalid_lines->push_back(i);
+		}
+		if (state[i] != VALID) continue;
+
+		if (count != i) std::copy(result.pixel(i), result.pixel(i) + 4, result.pixel(count));
+		++count;
+	}
+	result.resize(count);
+	return result;
+}
+
+size_t color_parser::format(const float * rgba, color_text_format format, char * text)
+{
+	uint32_t values[4];
+	for (size_t c = 0; c < 4; ++c) values[c] = (uint32_t)clamp_channel(rgba[c]);
+
+	char* p = text;
+	switch (format)
+	{
+	case HEX_RRGGBB:
+		*p++ = '#';
+		for (size_t c = 0; c < 3; ++c) p = write_hex(values[c], p);
+		break;
+	case HEX_AARRGGBB:
+		*p++ = '#';
+		p = write_hex(values[3], p);
+		for (size_t c = 0; c < 3; ++c) p = write_hex(values[c], p);
+		break;
+	case CSS_RGB:
+	{
+		const bool opaque = values[3] == 255;
+		std::memcpy(p, opaque ? "rgb(" : "rgba(", opaque ? 4 : 5);
+		p += opaque ? 4 : 5;
+		for (size_t c = 0; c < 3; ++c)
+		{
+			if (c > 0)
+			{
+				*p++ = ',';
+				*p++ = ' ';
+			}
+			p = write_integer(values[c], p);
+		}
+		if (!opaque)
+		{
+			// Alpha with 3 decimals at most, e.g. 0.502.
+			*p++ = ',';
+			*p++ = ' ';
+			uint32_t thousandths = (uint32_t)std::lround(values[3] * 1000. / 255.);
+			*p++ = '0';
+			if (thousandths > 0)
+			{
+				*p++ = '.';
+				for (uint32_t digit = 100; thousandths > 0; digit /= 10)
+				{
+					*p++ = (char)('0' + thousandths / digit);
+					thousandths %= digit;
+				}
+			}
+		}
+		*p++ = ')';
+		break;
+	}
+	default:
+		throw new std::invalid_argument("The text format is not defined.");
+	}
+	return p - text;
+}
+
+std::string color_parser::format(const color_buffer & colors, color_text_format format, char separator)
+{
+	std::string text(colors.size() * (max_text_length + 1), '\0');
+	char* p = &text[0];
+
+	const bool convert = colors.get_color_type() != color_type::RGB_TRUE;
+	float values[5];
+	for (size_t i = 0; i < colors.size(); ++i)
+	{
+		const float* rgba = colors.pixel(i);
+		if (convert)
+		{
+			color_manipulation::color_converter::convert_values(colors.get_color_type(), rgba, colors.get_rgb_color_space(), color_type::RGB_TRUE, values);
+			rgba = values;
+		}
+		p += color_parser::format(rgba, format, p);
+		*p++ = separator;
+	}
+	text.resize(p - text.data());
+	return text;
+}
@@ -0,0 +1,90 @@
+/// Copyright Martin Ruehlicke, 2019
+/// Use, modification and distribution are subject to the
+/// MIT Software License, Version 1.0.
+/// See accompanying file LICENSE.txt
+
+#pragma once
+
+#include "color_buffer.h"
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+//! Enum that defines the text formats written by color_parser::format().
+enum color_text_format
+{
+	HEX_RRGGBB = 0, /*!< HEX_RRGGBB - #RRGGBB, alpha is dropped */
+	HEX_AARRGGBB, /*!< HEX_AARRGGBB - #AARRGGBB, the format of the rgb_truecolor hex code constructor */
+	CSS_RGB /*!< CSS_RGB - rgb(r, g, b) for opaque colors and rgba(r, g, b, a) with alpha in [0,1] otherwise */
+};
+
+//! Parses and formats color lists as text.
+/*!
+* Supported inputs are the hex codes #RGB, #RRGGBB and #AARRGGBB (the # is optional for 6 and 8 digits), the CSS
+* functions rgb(), rgba(), hsl() and hsla() with comma or space separated arguments and the names of HexcodeColors
+* (case insensitive). Eight hex digits are decoded at once in a 64-bit register, nothing is allocated per color.
+* Parsed colors are rgb true colors with integer components and alpha in the range [0,255].
+*/
+class color_parser
+{
+public:
+	//! Parses one color.
+	/*!
+	* \param text The text of the color, leading and trailing white space is ignored.
+	* \param length The number of characters.
+	* \param rgba Receives red, green, blue and alpha in the range [0,255].
+	* \return Whether the text is a valid color.
+	*/
+	static bool parse(const char* text, size_t length, float* rgba);
+
+	//! Parses one hex code.
+	/*!
+	* \param text The hex code #RGB, #RRGGBB or #AARRGGBB, the # is optional for 6 and 8 digits.
+	* \param length The number of characters.
+	* \param rgba Receives red, green, blue and alpha in the range [0,255].
+	* \return Whether the text is a valid hex code.
+	*/
+	static bool parse_hex(const char* text, size_t length, float* rgba);
+
+	//! Parses a list of colors.
+	/*!
+	* \param codes The colors.
+	* \param rgb_color_space The rgb color space definition of the result.
+	* \return A buffer of rgb true colors, throws std::invalid_argument for the first invalid color.
+	*/
+	static color_buffer parse(const std::vector<std::string>& codes, color_space::rgb_color_space_definition* rgb_color_space);
+
+	//! Parses a text with one color per line.
+	/*!
+	* The lines are parsed in chunks on all cores. Empty lines are skipped.
+	* \param text The text, lines end with '\n' or "\r\n".
+	* \param length The number of characters.
+	* \param rgb_color_space The rgb color space definition of the result.
+	* \param invalid_lines If not null, receives the 0-based numbers of invalid lines which are skipped. Otherwise an
+	* invalid line throws std::invalid_argument.
+	* \return A buffer of rgb true colors in the order of the lines.
+	*/
+	static color_buffer parse_lines(const char* text, size_t length, color_space::rgb_color_space_definition* rgb_color_space, std::vector<size_t>* invalid_lines = nullptr);
+
+	//! Formats one color.
+	/*!
+	* \param rgba Red, green, blue and alpha in the range [0,255], they are rounded and clamped.
+	* \param format The text format.
+	* \param text Receives at least max_text_length characters, no terminating 0 is written.
+	* \return The number of characters written.
+	*/
+	static size_t format(const float* rgba, color_text_format format, char* text);
+
+	//! Formats a buffer of colors.
+	/*!
+	* \param colors The colors, any color type, they are converted to rgb true color.
+	* \param format The text format.
+	* \param separator The character written after every color.
+	* \return The text of all colors.
+	*/
+	static std::string format(const color_buffer& colors, color_text_format format, char separator = '\n');
+
+	//! Maximum number of characters written by format() for one color, e.g. "rgba(255, 255, 255, 0.502)".
+	static const size_t max_text_length = 26;
+};
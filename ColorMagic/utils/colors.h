@@ -6,16 +6,23 @@
 #pragma once
 
 #include "color_type.h"
+#include "predefined_colors.h"
 #include "..\spaces\rgb_color_space_definition.h"
 #include "..\spaces\color_base.h"
+#include "..\spaces\cieluv.h"
 #include "..\spaces\cmyk.h"
 #include "..\spaces\grey_deepcolor.h"
 #include "..\spaces\grey_truecolor.h"
+#include "..\spaces\hcy.h"
+#include "..\spaces\hsi.h"
 #include "..\spaces\hsl.h"
 #include "..\spaces\hsv.h"
 #include "..\spaces\lab.h"
+#include "..\spaces\lch_ab.h"
+#include "..\spaces\lch_uv.h"
 #include "..\spaces\rgb_deepcolor.h"
 #include "..\spaces\rgb_truecolor.h"
+#include "..\spaces\xyy.h"
 #include "..\spaces\xyz.h"
 #include "..\manipulation\color_converter.h"
 
@@ -175,6 +182,8 @@ enum HexcodeColors
 /*!
 * The class takes a HexcodeColors enum value as input and offers methods to return the
 * corresponding color object in any available color_space.
+* For sRGB the colors are created from the precomputed values of predefined_colors, other rgb color space
+* definitions convert the rgb true color.
 */
 class predefined_color
 {
@@ -185,7 +194,11 @@ public:
 	* \param hex_code The desired colors hex code.
 	* \param ref_white The reference_white used for conversions from or to lab color space.
 	*/
-	predefined_color(HexcodeColors hex_code, color_space::rgb_color_space_definition* ref_white) { base = new color_space::rgb_truecolor(hex_code, ref_white); }
+	predefined_color(HexcodeColors hex_code, color_space::rgb_color_space_definition* ref_white) : m_rgb_color_space(ref_white)
+	{
+		base = new color_space::rgb_truecolor(hex_code, ref_white);
+		m_index = predefined_colors::is_table_space(ref_white) ? predefined_colors::find((uint32_t)hex_code) : predefined_colors::not_found;
+	}
 	predefined_color() = delete;
 
 	//! Returns the desired color as rgb true color.
@@ -198,55 +211,157 @@ public:
 	/*!
 	* \return The desired color as rgb deep color.
 	*/
-	inline color_space::rgb_deepcolor* get_rgb_deep() { return color_manipulation::color_converter::to_rgb_deep(base); }
+	inline color_space::rgb_deepcolor* get_rgb_deep()
+	{
+		if (m_index == predefined_colors::not_found) return color_manipulation::color_converter::to_rgb_deep(base);
+		const float* v = predefined_colors::values(m_index, color_type::RGB_DEEP);
+		return new color_space::rgb_deepcolor(v[0], v[1], v[2], v[3], m_rgb_color_space);
+	}
 
 	//! Returns the desired color as grey true color.
 	/*!
 	* \return The desired color as grey true color.
 	*/
-	inline color_space::grey_truecolor* get_grey_true() { return color_manipulation::color_converter::to_grey_true(base); }
+	inline color_space::grey_truecolor* get_grey_true()
+	{
+		if (m_index == predefined_colors::not_found) return color_manipulation::color_converter::to_grey_true(base);
+		const float* v = predefined_colors::values(m_index, color_type::GREY_TRUE);
+		return new color_space::grey_truecolor(v[0], v[1], m_rgb_color_space);
+	}
 
 	//! Returns the desired color as grey deep color.
 	/*!
 	* \return The desired color as grey deep color.
 	*/
-	inline color_space::grey_deepcolor* get_grey_deep() { return color_manipulation::color_converter::to_grey_deep(base); }
+	inline color_space::grey_deepcolor* get_grey_deep()
+	{
+		if (m_index == predefined_colors::not_found) return color_manipulation::color_converter::to_grey_deep(base);
+		const float* v = predefined_colors::values(m_index, color_type::GREY_DEEP);
+		return new color_space::grey_deepcolor(v[0], v[1], m_rgb_color_space);
+	}
 
 	//! Returns the desired color as cmyk color.
 	/*!
 	* \return The desired color as cmyk color.
 	*/
-	inline color_space::cmyk* get_cmyk() { return color_manipulation::color_converter::to_cmyk(base); }
+	inline color_space::cmyk* get_cmyk()
+	{
+		if (m_index == predefined_colors::not_found) return color_manipulation::color_converter::to_cmyk(base);
+		const float* v = predefined_colors::values(m_index, color_type::CMYK);
+		return new color_space::cmyk(v[0], v[1], v[2], v[3], v[4], m_rgb_color_space);
+	}
+
+	//! Returns the desired color as hsi color.
+	/*!
+	* \return The desired color as hsi color.
+	*/
+	inline color_space::hsi* get_hsi()
+	{
+		if (m_index == predefined_colors::not_found) return color_manipulation::color_converter::to_hsi(base);
+		const float* v = predefined_colors::values(m_index, color_type::HSI);
+		return new color_space::hsi(v[0], v[1], v[2], v[3], m_rgb_color_space);
+	}
 
 	//! Returns the desired color as hsv color.
 	/*!
 	* \return The desired color as hsv color.
 	*/
-	inline color_space::hsv* get_hsv() { return color_manipulation::color_converter::to_hsv(base); }
+	inline color_space::hsv* get_hsv()
+	{
+		if (m_index == predefined_colors::not_found) return color_manipulation::color_converter::to_hsv(base);
+		const float* v = predefined_colors::values(m_index, color_type::HSV);
+		return new color_space::hsv(v[0], v[1], v[2], v[3], m_rgb_color_space);
+	}
 
 	//! Returns the desired color as hsl color.
 	/*!
 	* \return The desired color as hsl color.
 	*/
-	inline color_space::hsl* get_hsl() { return color_manipulation::color_converter::to_hsl(base); }
+	inline color_space::hsl* get_hsl()
+	{
+		if (m_index == predefined_colors::not_found) return color_manipulation::color_converter::to_hsl(base);
+		const float* v = predefined_colors::values(m_index, color_type::HSL);
+		return new color_space::hsl(v[0], v[1], v[2], v[3], m_rgb_color_space);
+	}
+
+	//! Returns the desired color as hcy color.
+	/*!
+	* \return The desired color as hcy color.
+	*/
+	inline color_space::hcy* get_hcy()
+	{
+		if (m_index == predefined_colors::not_found) return color_manipulation::color_converter::to_hcy(base);
+		const float* v = predefined_colors::values(m_index, color_type::HCY);
+		return new color_space::hcy(v[0], v[1], v[2], v[3], m_rgb_color_space);
+	}
 
 	//! Returns the desired color as xyz color.
 	/*!
 	* \return The desired color as xyz color.
 	*/
-	inline color_space::xyz* get_xyz() { return color_manipulation::color_converter::to_xyz(base); }
+	inline color_space::xyz* get_xyz()
+	{
+		if (m_index == predefined_colors::not_found) return color_manipulation::color_converter::to_xyz(base);
+		const float* v = predefined_colors::values(m_index, color_type::XYZ);
+		return new color_space::xyz(v[0], v[1], v[2], v[3], m_rgb_color_space);
+	}
 
 	//! Returns the desired color as xyY color.
 	/*!
 	* \return The desired color as xyY color.
 	*/
-	inline color_space::xyy* get_xyy() { return color_manipulation::color_converter::to_xyy(base); }
+	inline color_space::xyy* get_xyy()
+	{
+		if (m_index == predefined_colors::not_found) return color_manipulation::color_converter::to_xyy(base);
+		const float* v = predefined_colors::values(m_index, color_type::XYY);
+		return new color_space::xyy(v[0], v[1], v[2], v[3], m_rgb_color_space);
+	}
+
+	//! Returns the desired color as cieluv color.
+	/*!
+	* \return The desired color as cieluv color.
+	*/
+	inline color_space::cieluv* get_cieluv()
+	{
+		if (m_index == predefined_colors::not_found) return color_manipulation::color_converter::to_cieluv(base);
+		const float* v = predefined_colors::values(m_index, color_type::CIELUV);
+		return new color_space::cieluv(v[0], v[1], v[2], v[3], m_rgb_color_space);
+	}
 
 	//! Returns the desired color as lab color.
 	/*!
 	* \return The desired color as lab color.
 	*/
-	inline color_space::lab* get_lab() { return color_manipulation::color_converter::to_lab(base); }
+	inline color_space::lab* get_lab()
+	{
+		if (m_index == predefined_colors::not_found) return color_manipulation::color_converter::to_lab(base);
+		const float* v = predefined_colors::values(m_index, color_type::LAB);
+		return new color_space::lab(v[0], v[1], v[2], v[3], m_rgb_color_space);
+	}
+
+	//! Returns the desired color as lch_ab color.
+	/*!
+	* \return The desired color as lch_ab color.
+	*/
+	inline color_space::lch_ab* get_lch_ab()
+	{
+		if (m_index == predefined_colors::not_found) return color_manipulation::color_converter::to_lch_ab(base);
+		const float* v = predefined_colors::values(m_index, color_type::LCH_AB);
+		return new color_space::lch_ab(v[0], v[1], v[2], v[3], m_rgb_color_space);
+	}
+
+	//! Returns the desired color as lch_uv color.
+	/*!
+	* \return The desired color as lch_uv color.
+	*/
+	inline color_space::lch_uv* get_lch_uv()
+	{
+		if (m_index == predefined_colors::not_found) return color_manipulation::color_converter::to_lch_uv(base);
+		const float* v = predefined_colors::values(m_index, color_type::LCH_UV);
+		return new color_space::lch_uv(v[0], v[1], v[2], v[3], m_rgb_color_space);
+	}
 private:
 	color_space::rgb_truecolor* base;
+	color_space::rgb_color_space_definition* m_rgb_color_space;
+	size_t m_index;
 };
\ No newline at end of file
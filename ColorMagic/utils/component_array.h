@@ -0,0 +1,88 @@
+/// Copyright Martin Ruehlicke, 2019
+/// Use, modification and distribution are subject to the
+/// MIT Software License, Version 1.0.
+/// See accompanying file LICENSE.txt
+
+#pragma once
+
+#include <vector>
+#include <stdexcept>
+
+//! Fixed capacity storage for the components of a color.
+/*!
+* Stores up to four components inside the object, so colors can be copied and returned by value without touching the heap.
+* Offers the parts of the std::vector interface used by the color classes.
+*/
+class component_array
+{
+public:
+	//! The maximum number of components (cmyk needs four).
+	static const size_t capacity = 4;
+
+	//! Default constructor.
+	/*!
+	* Creates an empty component array.
+	*/
+	component_array() : m_size(0), m_values{ 0.f, 0.f, 0.f, 0.f }
+	{
+	}
+
+	//! Creates a component array from a vector.
+	/*!
+	* \param values The components to store, at most capacity values.
+	*/
+	component_array(const std::vector<float>& values) : component_array()
+	{
+		for (float value : values)
+		{
+			push_back(value);
+		}
+	}
+
+	//! Converts the components to a vector.
+	operator std::vector<float>() const
+	{
+		return std::vector<float>(begin(), end());
+	}
+
+	//! Returns the number of components.
+	size_t size() const { return m_size; }
+
+	//! Appends a component.
+	void push_back(float value)
+	{
+		if (m_size == capacity) throw std::out_of_range("Component array: A color can not have more than four components.");
+		m_values[m_size++] = value;
+	}
+
+	//! Removes all components.
+	void clear() { m_size = 0; }
+
+	//! Access a component by index.
+	float& operator[](size_t index) { return m_values[index]; }
+
+	//! Access a component by index.
+	const float& operator[](size_t index) const { return m_values[index]; }
+
+	//! Returns a pointer to the first component.
+	const float* data() const { return m_values; }
+
+	//! Returns a pointer to the first component.
+	float* begin() { return m_values; }
+
+	//! Returns a pointer behind the last component.
+	float* end() { return m_values + m_size; }
+
+	//! Returns a pointer to the first component.
+	const float* begin() const { return m_values; }
+
+	//! Returns a pointer behind the last component.
+	const float* end() const { return m_values + m_size; }
+
+private:
+	//! The number of components stored.
+	size_t m_size;
+
+	//! The component values.
+	float m_values[capacity];
+};
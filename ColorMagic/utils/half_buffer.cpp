@@ -0,0 +1,144 @@
+#include "stdafx.h"
+#include "half_buffer.h"
+#include "parallel.h"
+
+#include <cstring>
+#include <stdexcept>
+
+// The F16C instructions are available whenever the compiler targets them, AVX2 implies them.
+#if defined(__F16C__) || defined(__AVX2__)
+#define COLORMAGIC_F16C
+#include <immintrin.h>
+#endif
+
+namespace
+{
+	inline uint32_t float_bits(float value)
+	{
+		uint32_t bits;
+		std::memcpy(&bits, &value, sizeof(bits));
+		return bits;
+	}
+
+	inline float bits_float(uint32_t bits)
+	{
+		float value;
+		std::memcpy(&value, &bits, sizeof(value));
+		return value;
+	}
+}
+
+const size_t half_buffer::chunk_size;
+
+half_buffer::half_buffer(color_type type, color_space::rgb_color_space_definition * rgb_color_space, size_t size)
+	: m_type(type), m_rgb_color_space(rgb_color_space), m_channels(color_buffer::component_count(type) + 1), m_size(0)
+{
+	if (type == color_type::UNDEFINED) throw new std::invalid_argument("A half buffer needs a defined color type.");
+	resize(size);
+}
+
+half_buffer::half_buffer(const color_buffer & colors)
+	: half_buffer(colors.get_color_type(), colors.get_rgb_color_space(), colors.size())
+{
+	parallel::for_each_chunk(m_size, chunk_size, [&](size_t chunk, size_t begin, size_t end)
+	{
+		store(begin, end - begin, colors.pixel(begin));
+	});
+}
+
+void half_buffer::resize(size_t size)
+{
+	m_size = size;
+	m_data.resize(size * m_channels, 0);
+}
+
+void half_buffer::load(size_t first, size_t count, float * values) const
+{
+	if (first + count > m_size) throw new std::invalid_argument("The range exceeds the buffer.");
+	to_float(m_data.data() + first * m_channels, values, count * m_channels);
+}
+
+void half_buffer::store(size_t first, size_t count, const float * values)
+{
+	if (first + count > m_size) throw new std::invalid_argument("The range exceeds the buffer.");
+	to_half(values, m_data.data() + first * m_channels, count * m_channels);
+}
+
+void half_buffer::transform(const std::function<void(float* values, size_t first, size_t count)>& function)
+{
+	parallel::for_each_chunk(m_size, chunk_size, [&](size_t chunk, size_t begin, size_t end)
+	{
+		std::vector<float> values((end - begin) * m_channels);
+		load(begin, end - begin, values.data());
+		function(values.data(), begin, end - begin);
+		store(begin, end - begin, values.data());
+	});
+}
+
+color_buffer half_buffer::to_color_buffer() const
+{
+	color_buffer result(m_type, m_rgb_color_space, m_size);
+	parallel::for_each_chunk(m_size, chunk_size, [&](size_t chunk, size_t begin, size_t end)
+	{
+		load(begin, end - begin, result.pixel(begin));
+	});
+	return result;
+}
+
+void half_buffer::to_half(const float * values, uint16_t * halves, size_t count)
+{
+	size_t i = 0;
+#ifdef COLORMAGIC_F16C
+	for (; i + 8 <= count; i += 8)
+	{
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(halves + i), _mm256_cvtps_ph(_mm256_loadu_ps(values + i), _MM_FROUND_TO_NEAREST_INT));
+	}
+#endif
+	for (; i < count; ++i) halves[i] = to_half(values[i]);
+}
+
+void half_buffer::to_float(const uint16_t * halves, float * values, size_t count)
+{
+	size_t i = 0;
+#ifdef COLORMAGIC_F16C
+	for (; i + 8 <= count; i += 8)
+	{
+		_mm256_storeu_ps(values + i, _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(halves + i))));
+	}
+#endif
+	for (; i < count; ++i) values[i] = to_float(halves[i]);
+}
+
+uint16_t half_buffer::to_half(float value)
+{
+	uint32_t bits = float_bits(value);
+	const uint16_t sign = (uint16_t)((bits >> 16) & 0x8000);
+	bits &= 0x7fffffff;
+
+	// Infinity and NaN, a NaN stays a quiet NaN.
+	if (bits >= 0x7f800000) return sign | 0x7c00 | (bits > 0x7f800000 ? 0x200 | ((bits >> 13) & 0x3ff) : 0);
+
+	// 65520 and above round to infinity.
+	if (bits >= 0x477ff000) return sign | 0x7c00;
+
+	// Below the smallest normal half the float addition of 0.5 rounds the subnormal mantissa to nearest even.
+	if (bits < 0x38800000) return sign | (uint16_t)(float_bits(bits_float(bits) + 0.5f) - 0x3f000000);
+
+	// Rebias the exponent and round the mantissa to nearest even.
+	const uint32_t odd = (bits >> 13) & 1;
+	bits += 0xc8000fff + odd;
+	return sign | (uint16_t)(bits >> 13);
+}
+
+float half_buffer::to_float(uint16_t half)
+{
+	uint32_t bits = (uint32_t)(half & 0x7fff) << 13;
+	const uint32_t exponent = bits & 0x0f800000;
+	bits += 0x38000000;
+
+	// Infinity and NaN keep the maximum exponent, subnormals are normalized by a float subtraction.
+	if (exponent == 0x0f800000) bits += 0x38000000;
+	else if (exponent == 0) bits = float_bits(bits_float(bits + 0x00800000) - bits_float(0x38800000));
+
+	return bits_float(bits | ((uint32_t)(half & 0x8000) << 16));
+}
@@ -0,0 +1,111 @@
+/// Copyright Martin Ruehlicke, 2019
+/// Use, modification and distribution are subject to the
+/// MIT Software License, Version 1.0.
+/// See accompanying file LICENSE.txt
+
+#pragma once
+
+#include "color_buffer.h"
+#include "color_type.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+//! Contiguous storage for many colors with half precision values.
+/*!
+* The layout matches color_buffer, but every value is stored as an IEEE 754 half float (16 bits) instead of a float, which
+* halves the memory and the memory traffic of large intermediate buffers. Half floats keep 11 significant bits, enough for
+* deep rgb, xyz and lab values but not for the 0-255 range of the true color types.
+*
+* Computations stay in float: load() and store() convert a range of colors, transform() runs a function on all colors
+* in chunks of floats. The conversion uses the F16C instructions when the compiler targets them (e.g. /arch:AVX2 or
+* -mf16c) and an exact scalar implementation otherwise, both round to nearest even.
+*/
+class half_buffer
+{
+public:
+	//! Default constructor.
+	/*!
+	* \param type The color type of all colors in the buffer.
+	* \param rgb_color_space The rgb color space definition of all colors in the buffer.
+	* \param size The initial number of colors, all set to 0.
+	*/
+	half_buffer(color_type type, color_space::rgb_color_space_definition* rgb_color_space, size_t size = 0);
+
+	//! Converts the values of a color buffer to half floats.
+	explicit half_buffer(const color_buffer& colors);
+
+	//! Returns the color type of the colors.
+	color_type get_color_type() const { return m_type; }
+
+	//! Returns the rgb color space definition of the colors.
+	color_space::rgb_color_space_definition* get_rgb_color_space() const { return m_rgb_color_space; }
+
+	//! Returns the number of colors.
+	size_t size() const { return m_size; }
+
+	//! Returns whether the buffer contains no colors.
+	bool empty() const { return m_size == 0; }
+
+	//! Returns the number of values per color (components and alpha).
+	size_t channels() const { return m_channels; }
+
+	//! Returns the half floats of all colors.
+	uint16_t* data() { return m_data.data(); }
+
+	//! Returns the half floats of all colors.
+	const uint16_t* data() const { return m_data.data(); }
+
+	//! Changes the number of colors, new colors are set to 0.
+	void resize(size_t size);
+
+	//! Converts a range of colors to floats.
+	/*!
+	* \param first The index of the first color.
+	* \param count The number of colors.
+	* \param values Receives count * channels() floats.
+	*/
+	void load(size_t first, size_t count, float* values) const;
+
+	//! Stores floats in a range of colors.
+	/*!
+	* \param first The index of the first color.
+	* \param count The number of colors.
+	* \param values count * channels() floats, they are rounded to the nearest half float.
+	*/
+	void store(size_t first, size_t count, const float* values);
+
+	//! Runs a function on the float values of all colors.
+	/*!
+	* The colors are loaded in chunks, passed to the function and stored again. The chunks are processed on all cores.
+	* \param function Called with the float values of a chunk, the index of its first color and its number of colors.
+	*/
+	void transform(const std::function<void(float* values, size_t first, size_t count)>& function);
+
+	//! Converts the colors to a color buffer of the same color type.
+	color_buffer to_color_buffer() const;
+
+	//! Converts floats to half floats.
+	static void to_half(const float* values, uint16_t* halves, size_t count);
+
+	//! Converts half floats to floats.
+	static void to_float(const uint16_t* halves, float* values, size_t count);
+
+	//! Converts a float to a half float, rounded to nearest even.
+	static uint16_t to_half(float value);
+
+	//! Converts a half float to a float, the conversion is exact.
+	static float to_float(uint16_t half);
+
+	//! Number of colors that transform() converts at once.
+	static const size_t chunk_size = 1024;
+
+private:
+	color_type m_type;
+	color_space::rgb_color_space_definition* m_rgb_color_space;
+	size_t m_channels;
+	size_t m_size;
+	std::vector<uint16_t> m_data;
+};
@@ -0,0 +1,93 @@
+#include "stdafx.h"
+#include "instrumentation.h"
+
+#include <deque>
+#include <mutex>
+
+namespace
+{
+	std::mutex g_entries_mutex;
+
+	// A deque keeps the addresses of the entries stable while new ones are added.
+	std::deque<instrumentation::entry>& entries()
+	{
+		static std::deque<instrumentation::entry> all_entries;
+		return all_entries;
+	}
+}
+
+thread_local instrumentation::events instrumentation::t_events = { 0, 0, 0 };
+
+instrumentation::scope::scope(entry& entry) : m_entry(entry)
+{
+	m_allocations = t_events.allocations;
+	m_gamma_evaluations = t_events.gamma_evaluations;
+	m_matrix_multiplies = t_events.matrix_multiplies;
+}
+
+instrumentation::scope::~scope()
+{
+	m_entry.calls.fetch_add(1, std::memory_order_relaxed);
+	m_entry.allocations.fetch_add(t_events.allocations - m_allocations, std::memory_order_relaxed);
+	m_entry.gamma_evaluations.fetch_add(t_events.gamma_evaluations - m_gamma_evaluations, std::memory_order_relaxed);
+	m_entry.matrix_multiplies.fetch_add(t_events.matrix_multiplies - m_matrix_multiplies, std::memory_order_relaxed);
+}
+
+bool instrumentation::enabled()
+{
+#ifdef COLORMAGIC_INSTRUMENTATION
+	return true;
+#else
+	return false;
+#endif
+}
+
+instrumentation::entry & instrumentation::register_entry(const char * name)
+{
+	std::lock_guard<std::mutex> lock(g_entries_mutex);
+	for (entry& existing : entries())
+	{
+		if (existing.name == name) return existing;
+	}
+
+	entries().emplace_back();
+	entry& created = entries().back();
+	created.name = name;
+	created.calls = 0;
+	created.allocations = 0;
+	created.gamma_evaluations = 0;
+	created.matrix_multiplies = 0;
+	return created;
+}
+
+std::vector<instrumentation_record> instrumentation::snapshot()
+{
+	std::vector<instrumentation_record> records;
+
+	std::lock_guard<std::mutex> lock(g_entries_mutex);
+	for (const entry& existing : entries())
+	{
+		instrumentation_record record;
+		record.name = existing.name;
+		record.calls = existing.calls.load(std::memory_order_relaxed);
+		record.allocations = existing.allocations.load(std::memory_order_relaxed);
+		record.gamma_evaluations = existing.gamma_evaluations.load(std::memory_order_relaxed);
+		record.matrix_multiplies = existing.matrix_multiplies.load(std::memory_order_relaxed);
+
+		if (record.calls > 0) records.push_back(record);
+	}
+
+	return records;
+}
+
+void instrumentation::reset()
+{
+	std::lock_guard<std::mutex> lock(g_entries_mutex);
+	for (entry& existing : entries())
+	{
+		existing.calls = 0;
+		existing.allocations = 0;
+		existing.gamma_evaluations = 0;
+		existing.matrix_multiplies = 0;
+	}
+}
@@ -0,0 +1,131 @@
+/// Copyright Martin Ruehlicke, 2019
+/// Use, modification and distribution are subject to the
+/// MIT Software License, Version 1.0.
+/// See accompanying file LICENSE.txt
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+//! Counters of an instrumented entry point.
+/*!
+* The counters are inclusive: the events of nested entry points are counted for the calling entry point as well.
+*/
+struct instrumentation_record
+{
+	//! The name of the entry point, e.g. "color_blend::multiply".
+	std::string name;
+
+	//! Number of calls.
+	size_t calls = 0;
+
+	//! Number of color objects allocated during the calls.
+	size_t allocations = 0;
+
+	//! Number of gamma and inverse gamma evaluations during the calls.
+	size_t gamma_evaluations = 0;
+
+	//! Number of matrix multiplications during the calls.
+	size_t matrix_multiplies = 0;
+};
+
+//! Call and allocation counters of the public entry points.
+/*!
+* The counters are only collected if the library is compiled with COLORMAGIC_INSTRUMENTATION defined. Otherwise all
+* COLORMAGIC_* macros below expand to nothing and snapshot() returns an empty list, so the hooks cost nothing.
+*
+* Events are counted per thread without synchronization and added to the entry point when its scope ends.
+* Events outside of any instrumented entry point are not reported.
+*/
+class instrumentation
+{
+public:
+	//! The shared counters of one entry point.
+	struct entry
+	{
+		std::string name;
+		std::atomic<size_t> calls;
+		std::atomic<size_t> allocations;
+		std::atomic<size_t> gamma_evaluations;
+		std::atomic<size_t> matrix_multiplies;
+	};
+
+	//! Counts one call of an entry point and all events until the scope ends.
+	class scope
+	{
+	public:
+		//! Default constructor.
+		/*!
+		* \param entry The entry point the call is counted for.
+		*/
+		explicit scope(entry& entry);
+
+		//! Default destructor.
+		/*!
+		* Adds the events since the construction to the entry point.
+		*/
+		~scope();
+
+		scope(const scope&) = delete;
+		scope& operator=(const scope&) = delete;
+
+	private:
+		entry& m_entry;
+		size_t m_allocations;
+		size_t m_gamma_evaluations;
+		size_t m_matrix_multiplies;
+	};
+
+	//! Returns whether the library was compiled with COLORMAGIC_INSTRUMENTATION.
+	static bool enabled();
+
+	//! Returns the counters of an entry point, creating them on the first call.
+	/*!
+	* \param name The name of the entry point.
+	* \return The counters, which live until the end of the program.
+	*/
+	static entry& register_entry(const char* name);
+
+	//! Returns a copy of the counters of all entry points that were called at least once.
+	static std::vector<instrumentation_record> snapshot();
+
+	//! Sets all counters to 0.
+	static void reset();
+
+	//! Counts the allocation of a color object on the calling thread.
+	static void count_allocation() { ++t_events.allocations; }
+
+	//! Counts a gamma evaluation on the calling thread.
+	static void count_gamma_evaluation() { ++t_events.gamma_evaluations; }
+
+	//! Counts a matrix multiplication on the calling thread.
+	static void count_matrix_multiply() { ++t_events.matrix_multiplies; }
+
+private:
+	//! The events counted on one thread since its start.
+	struct events
+	{
+		size_t allocations;
+		size_t gamma_evaluations;
+		size_t matrix_multiplies;
+	};
+
+	static thread_local events t_events;
+};
+
+#ifdef COLORMAGIC_INSTRUMENTATION
+#define COLORMAGIC_INSTRUMENT(name) \
+	static instrumentation::entry& colormagic_instrumentation_entry = instrumentation::register_entry(name); \
+	instrumentation::scope colormagic_instrumentation_scope(colormagic_instrumentation_entry)
+#define COLORMAGIC_COUNT_ALLOCATION() instrumentation::count_allocation()
+#define COLORMAGIC_COUNT_GAMMA_EVALUATION() instrumentation::count_gamma_evaluation()
+#define COLORMAGIC_COUNT_MATRIX_MULTIPLY() instrumentation::count_matrix_multiply()
+#else
+#define COLORMAGIC_INSTRUMENT(name) ((void)0)
+#define COLORMAGIC_COUNT_ALLOCATION() ((void)0)
+#define COLORMAGIC_COUNT_GAMMA_EVALUATION() ((void)0)
+#define COLORMAGIC_COUNT_MATRIX_MULTIPLY() ((void)0)
+#endif
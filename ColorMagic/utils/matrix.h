@@ -4,6 +4,7 @@
 /// See accompanying file LICENSE.txt
 
 #pragma once
+#include "instrumentation.h"
 #include <vector>
 #include <stdexcept>
 
@@ -213,6 +214,7 @@ public:
 	//! Multiply two matrices
 	matrix<T> operator*(const matrix<T>& other)
 	{
+		COLORMAGIC_COUNT_MATRIX_MULTIPLY();
 		int rows = other.rows();
 		int cols = other.columns();
 		matrix result(rows, cols);
@@ -310,6 +312,7 @@ public:
 	*/
 	std::vector<T> operator*(const std::vector<T>& other)
 	{
+		COLORMAGIC_COUNT_MATRIX_MULTIPLY();
 		std::vector<T> result(other.size());
 
 		for (int i = 0; i < m_rows; i++)
@@ -323,6 +326,26 @@ public:
 		return result;
 	}
 
+	//! Multiply this matrix with a vector without allocating the result.
+	/*!
+	* Multiply this matrix with a vector without allocating the result.
+	* /param other The values to multiply this matrix with (one per column).
+	* /param result The array receiving the result (one value per row).
+	*/
+	void multiply(const T* other, T* result) const
+	{
+		COLORMAGIC_COUNT_MATRIX_MULTIPLY();
+		for (int i = 0; i < m_rows; i++)
+		{
+			T sum = T();
+			for (int j = 0; j < m_columns; j++)
+			{
+				sum += this->m_values[i][j] * other[j];
+			}
+			result[i] = sum;
+		}
+	}
+
 	//! Create a identity matrix of the given size.
 	/*!
 	* Create a identity matrix of the given size.
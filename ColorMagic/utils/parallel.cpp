@@ -0,0 +1,69 @@
+#include "stdafx.h"
+#include "parallel.h"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <thread>
+#include <vector>
+
+namespace
+{
+	std::atomic<size_t> g_thread_count(0);
+}
+
+void parallel::for_each_chunk(size_t count, size_t chunk_size, const std::function<void(size_t chunk, size_t begin, size_t end)>& function)
+{
+	size_t chunks = chunk_count(count, chunk_size);
+	size_t threads = std::min(thread_count(), chunks);
+
+	auto run_chunk = [&](size_t chunk)
+	{
+		size_t begin = chunk * chunk_size;
+		function(chunk, begin, std::min(begin + chunk_size, count));
+	};
+
+	if (threads <= 1)
+	{
+		for (size_t chunk = 0; chunk < chunks; ++chunk) run_chunk(chunk);
+		return;
+	}
+
+	std::atomic<size_t> next_chunk(0);
+	std::exception_ptr error;
+	std::atomic<bool> failed(false);
+
+	auto worker = [&]()
+	{
+		for (size_t chunk = next_chunk++; chunk < chunks && !failed; chunk = next_chunk++)
+		{
+			try
+			{
+				run_chunk(chunk);
+			}
+			catch (...)
+			{
+				if (!failed.exchange(true)) error = std::current_exception();
+			}
+		}
+	};
+
+	std::vector<std::thread> workers;
+	for (size_t i = 1; i < threads; ++i) workers.emplace_back(worker);
+	worker();
+	for (auto& thread : workers) thread.join();
+
+	if (error) std::rethrow_exception(error);
+}
+
+size_t parallel::thread_count()
+{
+	size_t count = g_thread_count;
+	if (count == 0) count = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+	return count;
+}
+
+void parallel::set_thread_count(size_t count)
+{
+	g_thread_count = count;
+}
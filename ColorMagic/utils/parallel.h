@@ -0,0 +1,42 @@
+/// Copyright Martin Ruehlicke, 2019
+/// Use, modification and distribution are subject to the
+/// MIT Software License, Version 1.0.
+/// See accompanying file LICENSE.txt
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+//! Helper to process large buffers on all cores.
+/*!
+* The work is split into chunks of a fixed size which do not depend on the number of threads. A reduction that stores one
+* partial result per chunk and combines the partials in chunk order therefore gives the same result on every machine.
+*/
+class parallel
+{
+public:
+	//! Returns the number of chunks needed to cover count elements.
+	static size_t chunk_count(size_t count, size_t chunk_size)
+	{
+		return (count + chunk_size - 1) / chunk_size;
+	}
+
+	//! Calls a function for every chunk of the range [0, count).
+	/*!
+	* The chunks are distributed over the hardware threads. Small ranges are processed on the calling thread.
+	* \param count The number of elements.
+	* \param chunk_size The number of elements per chunk (the last chunk may be smaller).
+	* \param function Called with the chunk index and the element range [begin, end) of the chunk.
+	*/
+	static void for_each_chunk(size_t count, size_t chunk_size, const std::function<void(size_t chunk, size_t begin, size_t end)>& function);
+
+	//! Returns the number of threads used by for_each_chunk.
+	static size_t thread_count();
+
+	//! Sets the number of threads used by for_each_chunk.
+	/*!
+	* \param count The number of threads, 0 uses the number of hardware threads.
+	*/
+	static void set_thread_count(size_t count);
+};
@@ -0,0 +1,2432 @@
+#include "stdafx.h"
+#include "predefined_colors.h"
+#include "..\spaces\rgb_color_space_definition.h"
+
+#include <cmath>
+#include <initializer_list>
+#include <stdexcept>
+
+namespace
+{
+	struct predefined_color_values
+	{
+		const char* name;
+		uint32_t argb;
+		float values[color_type::UNDEFINED][5];
+	};
+
+	// Generated with color_manipulation::color_converter::convert_values() from rgb true color under
+	// rgb_color_space_definition_presets().sRGB(). PredefinedColors_Test compares every value with the converter.
+	constexpr predefined_color_values g_colors[predefined_colors::count] =
+	{
+		{ "AliceBlue", 0xFFF0F8FF, {
+			{ 240.f, 248.f, 255.f, 255.f, 0.f },
+			{ 0.941176474f, 0.972549021f, 1.f, 1.f, 0.f },
+			{ 247.666672f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.971241832f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.0588235259f, 0.0274509788f, 0.f, 0.f, 1.f },
+			{ 208.f, 0.0309555531f, 0.971241772f, 1.f, 0.f },
+			{ 208.f, 0.0588235259f, 1.f, 1.f, 0.f },
+			{ 208.f, 0.999998987f, 0.970588207f, 1.f, 0.f },
+			{ 208.f, 0.0588235259f, 0.967861176f, 1.f, 0.f },
+			{ 0.875429869f, 0.928797245f, 1.07900488f, 1.f, 0.f },
+			{ 0.303627968f, 0.322137535f, 0.928797245f, 1.f, 0.f },
+			{ 94.9681702f, -4.64901018f, 100.f, 1.f, 0.f },
+			{ 97.178772f, -1.34831667f, -4.26263809f, 1.f, 0.f },
+			{ 97.178772f, 51.7464027f, 358.122864f, 1.f, 0.f },
+			{ 94.9681702f, 100.f, 1.61725295f, 1.f, 0.f } } },
+		{ "AntiqueWhite", 0xFFFAEBD7, {
+			{ 250.f, 235.f, 215.f, 255.f, 0.f },
+			{ 0.980392158f, 0.921568632f, 0.843137264f, 1.f, 0.f },
+			{ 233.333328f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.915032685f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.f, 0.0599999949f, 0.139999986f, 0.019607842f, 1.f },
+			{ 34.285717f, 0.0785714388f, 0.915032685f, 1.f, 0.f },
+			{ 34.285717f, 0.139999986f, 0.980392158f, 1.f, 0.f },
+			{ 34.285717f, 0.777778029f, 0.911764741f, 1.f, 0.f },
+			{ 34.285717f, 0.137254894f, 0.928411782f, 1.f, 0.f },
+			{ 0.813907623f, 0.84647727f, 0.763255537f, 1.f, 0.f },
+			{ 0.335820287f, 0.349258602f, 0.84647727f, 1.f, 0.f },
+			{ 92.3052979f, 9.85752392f, 100.f, 1.f, 0.f },
+			{ 93.731102f, 1.83808804f, 11.5257025f, 1.f, 0.f },
+			{ 93.731102f, 54.559124f, 1.4126507f, 1.f, 0.f },
+			{ 92.3052979f, 100.f, 1.47253847f, 1.f, 0.f } } },
+		{ "Aqua", 0xFF00FFFF, {
+			{ 0.f, 255.f, 255.f, 255.f, 0.f },
+			{ 0.f, 1.f, 1.f, 1.f, 0.f },
+			{ 170.f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.666666687f, 1.f, 0.f, 0.f, 0.f },
+			{ 1.f, 0.f, 0.f, 0.f, 1.f },
+			{ 180.f, 1.f, 0.666666687f, 1.f, 0.f },
+			{ 180.f, 1.f, 1.f, 1.f, 0.f },
+			{ 180.f, 1.f, 0.5f, 1.f, 0.f },
+			{ 180.f, 1.f, 0.787400007f, 1.f, 0.f },
+			{ 0.538030982f, 0.787372231f, 1.06947017f, 1.f, 0.f },
+			{ 0.224659473f, 0.328774065f, 0.787372231f, 1.f, 0.f },
+			{ 78.3467789f, -60.5901642f, 100.f, 1.f, 0.f },
+			{ 91.1152649f, -48.0817261f, -14.1278858f, 1.f, 0.f },
+			{ 91.1152649f, 69.5759201f, 357.144196f, 1.f, 0.f },
+			{ 78.3467789f, 100.f, 2.11554384f, 1.f, 0.f } } },
+		{ "Aquamarine", 0xFF7FFFD4, {
+			{ 127.f, 255.f, 212.f, 255.f, 0.f },
+			{ 0.498039216f, 1.f, 0.831372559f, 1.f, 0.f },
+			{ 198.f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.776470602f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.501960754f, 0.f, 0.168627441f, 0.f, 1.f },
+			{ 159.84375f, 0.358585894f, 0.776470602f, 1.f, 0.f },
+			{ 159.84375f, 0.501960754f, 1.f, 1.f, 0.f },
+			{ 159.84375f, 1.f, 0.749019623f, 1.f, 0.f },
+			{ 159.84375f, 0.501960754f, 0.881108224f, 1.f, 0.f },
+			{ 0.563908577f, 0.807842493f, 0.748936296f, 1.f, 0.f },
+			{ 0.26590839f, 0.380934238f, 0.807842493f, 1.f, 0.f },
+			{ 79.8357544f, -48.4989815f, 100.f, 1.f, 0.f },
+			{ 92.0355988f, -45.5209312f, 9.72049236f, 1.f, 0.f },
+			{ 92.0355988f, 68.1825027f, 2.93121338f, 1.f, 0.f },
+			{ 79.8357544f, 100.f, 2.02236366f, 1.f, 0.f } } },
+		{ "Azure", 0xFFF0FFFF, {
+			{ 240.f, 255.f, 255.f, 255.f, 0.f },
+			{ 0.941176474f, 1.f, 1.f, 1.f, 0.f },
+			{ 250.f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.980392158f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.0588235259f, 0.f, 0.f, 0.f, 1.f },
+			{ 180.f, 0.0400000215f, 0.980392158f, 1.f, 0.f },
+			{ 180.f, 0.0588235259f, 1.f, 1.f, 0.f },
+			{ 180.f, 0.999998987f, 0.970588207f, 1.f, 0.f },
+			{ 180.f, 0.0588235259f, 0.987494111f, 1.f, 0.f },
+			{ 0.897355795f, 0.972649097f, 1.08631349f, 1.f, 0.f },
+			{ 0.303538293f, 0.329006881f, 0.972649097f, 1.f, 0.f },
+			{ 95.8869781f, -7.91605949f, 100.f, 1.f, 0.f },
+			{ 98.9326401f, -4.88004112f, -1.68790817f, 1.f, 0.f },
+			{ 98.9326401f, 52.017067f, 357.191406f, 1.f, 0.f },
+			{ 95.8869781f, 100.f, 1.64979219f, 1.f, 0.f } } },
+		{ "Beige", 0xFFF5F5DC, {
+			{ 245.f, 245.f, 220.f, 255.f, 0.f },
+			{ 0.960784316f, 0.960784316f, 0.862745106f, 1.f, 0.f },
+			{ 236.666672f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.928104579f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.f, 0.f, 0.102040812f, 0.0392156839f, 1.f },
+			{ 60.f, 0.0704225302f, 0.928104579f, 1.f, 0.f },
+			{ 60.f, 0.102040812f, 0.960784316f, 1.f, 0.f },
+			{ 60.f, 0.555555761f, 0.911764741f, 1.f, 0.f },
+			{ 60.f, 0.0980392098f, 0.953705847f, 1.f, 0.f },
+			{ 0.83219099f, 0.898851514f, 0.806593657f, 1.f, 0.f },
+			{ 0.327939421f, 0.354208171f, 0.898851514f, 1.f, 0.f },
+			{ 93.1102753f, 1.31506789f, 100.f, 1.f, 0.f },
+			{ 95.9491119f, -4.19321632f, 12.048912f, 1.f, 0.f },
+			{ 95.9491119f, 54.9834862f, 1.90570271f, 1.f, 0.f },
+			{ 93.1102753f, 100.f, 1.55764639f, 1.f, 0.f } } },
+		{ "Bisque", 0xFFFFE4C4, {
+			{ 255.f, 228.f, 196.f, 255.f, 0.f },
+			{ 1.f, 0.894117653f, 0.768627465f, 1.f, 0.f },
+			{ 226.333328f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.887581706f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.f, 0.105882347f, 0.231372535f, 0.f, 1.f },
+			{ 32.5423737f, 0.134020567f, 0.887581646f, 1.f, 0.f },
+			{ 32.5423737f, 0.231372535f, 1.f, 1.f, 0.f },
+			{ 32.5423737f, 0.999999762f, 0.884313703f, 1.f, 0.f },
+			{ 32.5423737f, 0.231372535f, 0.907567859f, 1.f, 0.f },
+			{ 0.789403021f, 0.807335734f, 0.636367857f, 1.f, 0.f },
+			{ 0.353499919f, 0.361530304f, 0.807335734f, 1.f, 0.f },
+			{ 91.2072754f, 18.2623024f, 100.f, 1.f, 0.f },
+			{ 92.0130005f, 4.4298768f, 19.0111752f, 1.f, 0.f },
+			{ 92.0130005f, 57.6251793f, 1.34186697f, 1.f, 0.f },
+			{ 91.2072754f, 100.f, 1.3901639f, 1.f, 0.f } } },
+		{ "Black", 0xFF000000, {
+			{ 0.f, 0.f, 0.f, 255.f, 0.f },
+			{ 0.f, 0.f, 0.f, 1.f, 0.f },
+			{ 0.f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.f, 1.f, 0.f, 0.f, 0.f },
+			{ 1.f, 1.f, 1.f, 1.f, 1.f },
+			{ 0.f, 0.f, 0.f, 1.f, 0.f },
+			{ 0.f, 0.f, 0.f, 1.f, 0.f },
+			{ 0.f, 0.f, 0.f, 1.f, 0.f },
+			{ 0.f, 0.f, 0.f, 1.f, 0.f },
+			{ 0.f, 0.f, 0.f, 1.f, 0.f },
+			{ 0.312700003f, 0.328999996f, 0.f, 1.f, 0.f },
+			{ 0.f, 100.f, 100.f, 1.f, 0.f },
+			{ 0.f, 0.f, 0.f, 1.f, 0.f },
+			{ 0.f, 50.f, 0.f, 1.f, 0.f },
+			{ 0.f, 100.f, 0.785398185f, 1.f, 0.f } } },
+		{ "BlanchedAlmond", 0xFFFFEBCD, {
+			{ 255.f, 235.f, 205.f, 255.f, 0.f },
+			{ 1.f, 0.921568632f, 0.80392158f, 1.f, 0.f },
+			{ 231.666672f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.908496737f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.f, 0.0784313679f, 0.19607842f, 0.f, 1.f },
+			{ 36.f, 0.115107834f, 0.908496678f, 1.f, 0.f },
+			{ 36.f, 0.19607842f, 1.f, 1.f, 0.f },
+			{ 36.f, 1.f, 0.90196079f, 1.f, 0.f },
+			{ 36.f, 0.19607842f, 0.929749012f, 1.f, 0.f },
+			{ 0.819604635f, 0.850855231f, 0.698493361f, 1.f, 0.f },
+			{ 0.345977545f, 0.359169275f, 0.850855231f, 1.f, 0.f },
+			{ 92.5574036f, 13.5771179f, 100.f, 1.f, 0.f },
+			{ 93.9199524f, 2.12931633f, 17.0255299f, 1.f, 0.f },
+			{ 93.9199524f, 56.7024117f, 1.44637632f, 1.f, 0.f },
+			{ 92.5574036f, 100.f, 1.43585026f, 1.f, 0.f } } },
+		{ "Blue", 0xFF0000FF, {
+			{ 0.f, 0.f, 255.f, 255.f, 0.f },
+			{ 0.f, 0.f, 1.f, 1.f, 0.f },
+			{ 85.f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.333333343f, 1.f, 0.f, 0.f, 0.f },
+			{ 1.f, 1.f, 0.f, 0.f, 1.f },
+			{ 240.f, 1.f, 0.333333343f, 1.f, 0.f },
+			{ 240.f, 1.f, 1.f, 1.f, 0.f },
+			{ 240.f, 1.f, 0.5f, 1.f, 0.f },
+			{ 240.f, 1.f, 0.0722000003f, 1.f, 0.f },
+			{ 0.180431068f, 0.0721724182f, 0.950270236f, 1.f, 0.f },
+			{ 0.150000006f, 0.0599999949f, 0.0721724182f, 1.f, 0.f },
+			{ 49.5483551f, -14.4209404f, -32.3716316f, 1.f, 0.f },
+			{ 32.2964363f, 79.1936188f, -107.860649f, 1.f, 0.f },
+			{ 32.2964363f, 100.f, 359.f, 1.f, 0.f },
+			{ 49.5483551f, 67.7192383f, 358.010101f, 1.f, 0.f } } },
+		{ "BlueViolet", 0xFF8A2BE2, {
+			{ 138.f, 43.f, 226.f, 255.f, 0.f },
+			{ 0.541176498f, 0.168627456f, 0.886274517f, 1.f, 0.f },
+			{ 135.666672f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.532026172f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.389380515f, 0.809734523f, 0.f, 0.113725483f, 1.f },
+			{ 271.147552f, 0.683046699f, 0.532026112f, 1.f, 0.f },
+			{ 271.147552f, 0.809734523f, 0.886274517f, 1.f, 0.f },
+			{ 271.147552f, 0.759336114f, 0.527450979f, 1.f, 0.f },
+			{ 271.147552f, 0.717647076f, 0.299645483f, 1.f, 0.f },
+			{ 0.250665516f, 0.126206249f, 0.730496228f, 1.f, 0.f },
+			{ 0.226361528f, 0.113969564f, 0.126206249f, 1.f, 0.f },
+			{ 57.1402054f, 24.8507462f, 40.0037651f, 1.f, 0.f },
+			{ 42.1859703f, 69.8494873f, -74.7661209f, 1.f, 0.f },
+			{ 42.1859703f, 89.9678726f, 359.f, 1.f, 0.f },
+			{ 57.1402054f, 73.5470886f, 1.01492691f, 1.f, 0.f } } },
+		{ "Brown", 0xFFA52A2A, {
+			{ 165.f, 42.f, 42.f, 255.f, 0.f },
+			{ 0.647058845f, 0.164705887f, 0.164705887f, 1.f, 0.f },
+			{ 83.f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.325490206f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.f, 0.74545455f, 0.74545455f, 0.352941155f, 1.f },
+			{ 0.f, 0.493975878f, 0.325490206f, 1.f, 0.f },
+			{ 0.f, 0.74545455f, 0.647058845f, 1.f, 0.f },
+			{ 0.f, 0.594202936f, 0.405882359f, 1.f, 0.f },
+			{ 0.f, 0.482352972f, 0.267254114f, 1.f, 0.f },
+			{ 0.167616084f, 0.0982341096f, 0.0320349038f, 1.f, 0.f },
+			{ 0.562687039f, 0.329771817f, 0.0982341096f, 1.f, 0.f },
+			{ 47.9582443f, 100.f, 100.f, 1.f, 0.f },
+			{ 37.523613f, 49.6915894f, 30.5389938f, 1.f, 0.f },
+			{ 37.523613f, 72.7834702f, 0.551064372f, 1.f, 0.f },
+			{ 47.9582443f, 100.f, 0.785398185f, 1.f, 0.f } } },
+		{ "BurlyWood", 0xFFDEB887, {
+			{ 222.f, 184.f, 135.f, 255.f, 0.f },
+			{ 0.870588243f, 0.721568644f, 0.529411793f, 1.f, 0.f },
+			{ 180.333328f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.7071895f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.f, 0.171171159f, 0.391891867f, 0.129411757f, 1.f },
+			{ 33.7931061f, 0.251386285f, 0.70718956f, 1.f, 0.f },
+			{ 33.7931061f, 0.391891867f, 0.870588243f, 1.f, 0.f },
+			{ 33.7931061f, 0.568627536f, 0.700000048f, 1.f, 0.f },
+			{ 33.7931061f, 0.34117645f, 0.739376426f, 1.f, 0.f },
+			{ 0.516339302f, 0.515612006f, 0.301487207f, 1.f, 0.f },
+			{ 0.387223929f, 0.386678487f, 0.515612006f, 1.f, 0.f },
+			{ 77.0614243f, 27.822361f, 100.f, 1.f, 0.f },
+			{ 77.0177155f, 7.04851723f, 30.0176029f, 1.f, 0.f },
+			{ 77.0177155f, 62.044548f, 1.3401618f, 1.f, 0.f },
+			{ 77.0614243f, 100.f, 1.29943562f, 1.f, 0.f } } },
+		{ "CadetBlue", 0xFF5F9EA0, {
+			{ 95.f, 158.f, 160.f, 255.f, 0.f },
+			{ 0.372549027f, 0.619607866f, 0.627451003f, 1.f, 0.f },
+			{ 137.666672f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.539869308f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.40624997f, 0.0124999993f, 0.f, 0.372548997f, 1.f },
+			{ 181.846161f, 0.309927404f, 0.539869308f, 1.f, 0.f },
+			{ 181.846161f, 0.40625f, 0.627451003f, 1.f, 0.f },
+			{ 181.846161f, 0.254901975f, 0.5f, 1.f, 0.f },
+			{ 181.846161f, 0.254901975f, 0.567649424f, 1.f, 0.f },
+			{ 0.232885599f, 0.294240266f, 0.377019256f, 1.f, 0.f },
+			{ 0.257575452f, 0.325434774f, 0.294240266f, 1.f, 0.f },
+			{ 55.3683319f, -26.3384666f, 100.f, 1.f, 0.f },
+			{ 61.1540451f, -19.6774597f, -7.41933584f, 1.f, 0.f },
+			{ 61.1540451f, 58.2147369f, 357.218964f, 1.f, 0.f },
+			{ 55.3683319f, 100.f, 1.82833207f, 1.f, 0.f } } },
+		{ "Chartreuse", 0xFF7FFF00, {
+			{ 127.f, 255.f, 0.f, 255.f, 0.f },
+			{ 0.498039216f, 1.f, 0.f, 1.f, 0.f },
+			{ 127.333336f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.499346405f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.501960754f, 0.f, 1.f, 0.f, 1.f },
+			{ 90.1176453f, 1.f, 0.499346405f, 1.f, 0.f },
+			{ 90.1176453f, 1.f, 1.f, 1.f, 0.f },
+			{ 90.1176453f, 1.f, 0.5f, 1.f, 0.f },
+			{ 90.1176453f, 1.f, 0.821083128f, 1.f, 0.f },
+			{ 0.445117295f, 0.760325968f, 0.123302303f, 1.f, 0.f },
+			{ 0.334990621f, 0.572213352f, 0.760325968f, 1.f, 0.f },
+			{ 72.5692215f, -49.1743622f, 100.f, 1.f, 0.f },
+			{ 89.8744736f, -68.0626602f, 85.7802963f, 1.f, 0.f },
+			{ 89.8744736f, 92.7743912f, 2.24153256f, 1.f, 0.f },
+			{ 72.5692215f, 100.f, 2.02781701f, 1.f, 0.f } } },
+		{ "Chocolate", 0xFFD2691E, {
+			{ 210.f, 105.f, 30.f, 255.f, 0.f },
+			{ 0.823529422f, 0.411764711f, 0.117647059f, 1.f, 0.f },
+			{ 115.f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.450980395f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.f, 0.49999997f, 0.857142866f, 0.176470578f, 1.f },
+			{ 25.0000019f, 0.739130437f, 0.450980395f, 1.f, 0.f },
+			{ 25.0000019f, 0.857142866f, 0.823529422f, 1.f, 0.f },
+			{ 25.0000019f, 0.75f, 0.470588237f, 1.f, 0.f },
+			{ 25.0000019f, 0.70588237f, 0.478070587f, 1.f, 0.f },
+			{ 0.318621755f, 0.239002794f, 0.0416336246f, 1.f, 0.f },
+			{ 0.531693637f, 0.398831099f, 0.239002794f, 1.f, 0.f },
+			{ 63.2288055f, 97.4332962f, 100.f, 1.f, 0.f },
+			{ 55.9878159f, 37.05159f, 56.7372818f, 1.f, 0.f },
+			{ 55.9878159f, 76.470253f, 0.99228853f, 1.f, 0.f },
+			{ 63.2288055f, 100.f, 0.798397779f, 1.f, 0.f } } },
+		{ "Coral", 0xFFFF7F50, {
+			{ 255.f, 127.f, 80.f, 255.f, 0.f },
+			{ 1.f, 0.498039216f, 0.313725501f, 1.f, 0.f },
+			{ 154.f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.603921592f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.f, 0.501960754f, 0.686274529f, 0.f, 1.f },
+			{ 16.1142845f, 0.480519474f, 0.603921592f, 1.f, 0.f },
+			{ 16.1142845f, 0.686274529f, 1.f, 1.f, 0.f },
+			{ 16.1142845f, 1.f, 0.656862736f, 1.f, 0.f },
+			{ 16.1142845f, 0.686274529f, 0.591448605f, 1.f, 0.f },
+			{ 0.502736807f, 0.370204836f, 0.120858192f, 1.f, 0.f },
+			{ 0.505873322f, 0.372514486f, 0.370204836f, 1.f, 0.f },
+			{ 76.2369385f, 100.f, 100.f, 1.f, 0.f },
+			{ 67.2923965f, 45.3533821f, 47.4893036f, 1.f, 0.f },
+			{ 67.2923965f, 75.6511917f, 0.808399916f, 1.f, 0.f },
+			{ 76.2369385f, 100.f, 0.785398185f, 1.f, 0.f } } },
+		{ "CornflowerBlue", 0xFF6495ED, {
+			{ 100.f, 149.f, 237.f, 255.f, 0.f },
+			{ 0.392156869f, 0.58431375f, 0.929411769f, 1.f, 0.f },
+			{ 162.f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.635294139f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.578059077f, 0.371307999f, 0.f, 0.0705882311f, 1.f },
+			{ 218.540146f, 0.38271606f, 0.635294139f, 1.f, 0.f },
+			{ 218.540146f, 0.578059077f, 0.929411769f, 1.f, 0.f },
+			{ 218.540146f, 0.791907549f, 0.660784304f, 1.f, 0.f },
+			{ 218.540146f, 0.53725493f, 0.568377256f, 1.f, 0.f },
+			{ 0.312828064f, 0.303166598f, 0.843046665f, 1.f, 0.f },
+			{ 0.21440658f, 0.207784787f, 0.303166598f, 1.f, 0.f },
+			{ 62.7456436f, -23.2387943f, 100.f, 1.f, 0.f },
+			{ 61.9264832f, 9.33566666f, -49.296917f, 1.f, 0.f },
+			{ 61.9264832f, 69.5988693f, 358.616364f, 1.f, 0.f },
+			{ 62.7456436f, 100.f, 1.79913151f, 1.f, 0.f } } },
+		{ "Cornsilk", 0xFFFFF8DC, {
+			{ 255.f, 248.f, 220.f, 255.f, 0.f },
+			{ 1.f, 0.972549021f, 0.862745106f, 1.f, 0.f },
+			{ 241.f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.945098042f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.f, 0.0274509788f, 0.137254894f, 0.f, 1.f },
+			{ 48.f, 0.0871368647f, 0.945097983f, 1.f, 0.f },
+			{ 48.f, 0.137254894f, 1.f, 1.f, 0.f },
+			{ 48.f, 0.999999583f, 0.931372523f, 1.f, 0.f },
+			{ 48.f, 0.137254894f, 0.970457256f, 1.f, 0.f },
+			{ 0.877176285f, 0.93562907f, 0.811323404f, 1.f, 0.f },
+			{ 0.334273338f, 0.356548458f, 0.93562907f, 1.f, 0.f },
+			{ 95.0419159f, 5.50490522f, 100.f, 1.f, 0.f },
+			{ 97.4555893f, -2.21824646f, 14.2932529f, 1.f, 0.f },
+			{ 97.4555893f, 55.6501389f, 1.72476339f, 1.f, 0.f },
+			{ 95.0419159f, 100.f, 1.51580274f, 1.f, 0.f } } },
+		{ "Crimson", 0xFFDC143C, {
+			{ 220.f, 20.f, 60.f, 255.f, 0.f },
+			{ 0.862745106f, 0.0784313753f, 0.235294119f, 1.f, 0.f },
+			{ 100.f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.392156869f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.f, 0.909090936f, 0.727272749f, 0.137254894f, 1.f },
+			{ 348.f, 0.800000012f, 0.392156869f, 1.f, 0.f },
+			{ 348.f, 0.909090936f, 0.862745106f, 1.f, 0.f },
+			{ 348.f, 0.833333373f, 0.470588237f, 1.f, 0.f },
+			{ 348.f, 0.784313738f, 0.256501973f, 1.f, 0.f },
+			{ 0.305784404f, 0.160440654f, 0.0576071702f, 1.f, 0.f },
+			{ 0.583744943f, 0.30628252f, 0.160440654f, 1.f, 0.f },
+			{ 62.1501389f, 100.f, 100.f, 1.f, 0.f },
+			{ 47.0322495f, 70.9242249f, 33.5936623f, 1.f, 0.f },
+			{ 47.0322495f, 80.655426f, 0.442350924f, 1.f, 0.f },
+			{ 62.1501389f, 100.f, 0.785398185f, 1.f, 0.f } } },
+		{ "Cyan", 0xFF00FFFF, {
+			{ 0.f, 255.f, 255.f, 255.f, 0.f },
+			{ 0.f, 1.f, 1.f, 1.f, 0.f },
+			{ 170.f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.666666687f, 1.f, 0.f, 0.f, 0.f },
+			{ 1.f, 0.f, 0.f, 0.f, 1.f },
+			{ 180.f, 1.f, 0.666666687f, 1.f, 0.f },
+			{ 180.f, 1.f, 1.f, 1.f, 0.f },
+			{ 180.f, 1.f, 0.5f, 1.f, 0.f },
+			{ 180.f, 1.f, 0.787400007f, 1.f, 0.f },
+			{ 0.538030982f, 0.787372231f, 1.06947017f, 1.f, 0.f },
+			{ 0.224659473f, 0.328774065f, 0.787372231f, 1.f, 0.f },
+			{ 78.3467789f, -60.5901642f, 100.f, 1.f, 0.f },
+			{ 91.1152649f, -48.0817261f, -14.1278858f, 1.f, 0.f },
+			{ 91.1152649f, 69.5759201f, 357.144196f, 1.f, 0.f },
+			{ 78.3467789f, 100.f, 2.11554384f, 1.f, 0.f } } },
+		{ "DarkBlue", 0xFF00008B, {
+			{ 0.f, 0.f, 139.f, 255.f, 0.f },
+			{ 0.f, 0.f, 0.545098066f, 1.f, 0.f },
+			{ 46.3333321f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.181699336f, 1.f, 0.f, 0.f, 0.f },
+			{ 1.f, 1.f, 0.f, 0.454901934f, 1.f },
+			{ 240.f, 1.f, 0.18169935f, 1.f, 0.f },
+			{ 240.f, 1.f, 0.545098066f, 1.f, 0.f },
+			{ 240.f, 1.f, 0.272549033f, 1.f, 0.f },
+			{ 240.f, 0.545098066f, 0.039356079f, 1.f, 0.f },
+			{ 0.0465842187f, 0.018633686f, 0.245343536f, 1.f, 0.f },
+			{ 0.150000006f, 0.0599999987f, 0.018633686f, 1.f, 0.f },
+			{ 25.7385712f, -7.49115038f, -16.8158798f, 1.f, 0.f },
+			{ 14.7532425f, 50.4273491f, -68.6813507f, 1.f, 0.f },
+			{ 14.7532425f, 83.2835541f, 359.f, 1.f, 0.f },
+			{ 25.7385712f, 59.2044983f, 358.010101f, 1.f, 0.f } } },
+		{ "DarkCyan", 0xFF008B8B, {
+			{ 0.f, 139.f, 139.f, 255.f, 0.f },
+			{ 0.f, 0.545098066f, 0.545098066f, 1.f, 0.f },
+			{ 92.6666641f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.363398671f, 1.f, 0.f, 0.f, 0.f },
+			{ 1.f, 0.f, 0.f, 0.454901934f, 1.f },
+			{ 180.f, 1.f, 0.363398701f, 1.f, 0.f },
+			{ 180.f, 1.f, 0.545098066f, 1.f, 0.f },
+			{ 180.f, 1.f, 0.272549033f, 1.f, 0.f },
+			{ 180.f, 0.545098066f, 0.429210216f, 1.f, 0.f },
+			{ 0.138910413f, 0.203286052f, 0.276118934f, 1.f, 0.f },
+			{ 0.224659473f, 0.328774035f, 0.203286052f, 1.f, 0.f },
+			{ 44.0762596f, -34.08675f, 100.f, 1.f, 0.f },
+			{ 52.2067184f, -30.6165218f, -8.99608135f, 1.f, 0.f },
+			{ 52.2067184f, 62.465168f, 357.144196f, 1.f, 0.f },
+			{ 44.0762596f, 100.f, 1.89931214f, 1.f, 0.f } } },
+		{ "DarkGoldenrod", 0xFFB8860B, {
+			{ 184.f, 134.f, 11.f, 255.f, 0.f },
+			{ 0.721568644f, 0.525490224f, 0.0431372561f, 1.f, 0.f },
+			{ 109.666664f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.430065364f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.f, 0.271739095f, 0.940217376f, 0.278431356f, 1.f },
+			{ 42.6589622f, 0.899696052f, 0.430065393f, 1.f, 0.f },
+			{ 42.6589622f, 0.940217376f, 0.721568644f, 1.f, 0.f },
+			{ 42.6589622f, 0.887179494f, 0.382352948f, 1.f, 0.f },
+			{ 42.6589622f, 0.678431392f, 0.5323506f, 1.f, 0.f },
+			{ 0.283511609f, 0.272660255f, 0.0408622585f, 1.f, 0.f },
+			{ 0.474866658f, 0.456691206f, 0.272660255f, 1.f, 0.f },
+			{ 60.2046738f, 42.5826225f, 100.f, 1.f, 0.f },
+			{ 59.2197571f, 9.86278057f, 62.7283211f, 1.f, 0.f },
+			{ 59.2197571f, 74.8042755f, 1.41484296f, 1.f, 0.f },
+			{ 60.2046738f, 100.f, 1.168226f, 1.f, 0.f } } },
+		{ "DarkGray", 0xFFA9A9A9, {
+			{ 169.f, 169.f, 169.f, 255.f, 0.f },
+			{ 0.662745118f, 0.662745118f, 0.662745118f, 1.f, 0.f },
+			{ 169.f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.662745118f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.f, 0.f, 0.f, 0.337254882f, 1.f },
+			{ 0.f, 0.f, 0.662745118f, 1.f, 0.f },
+			{ 0.f, 0.f, 0.662745118f, 1.f, 0.f },
+			{ 0.f, 0.f, 0.662745118f, 1.f, 0.f },
+			{ 0.f, 0.f, 0.662745118f, 1.f, 0.f },
+			{ 0.377076209f, 0.396755308f, 0.431987166f, 1.f, 0.f },
+			{ 0.312713861f, 0.329033971f, 0.396755308f, 1.f, 0.f },
+			{ 67.8045654f, 0.f, 100.f, 1.f, 0.f },
+			{ 69.2378006f, 0.f, 0.f, 1.f, 0.f },
+			{ 69.2378006f, 50.f, 0.f, 1.f, 0.f },
+			{ 67.8045654f, 100.f, 1.57079637f, 1.f, 0.f } } },
+		{ "DarkGreen", 0xFF006400, {
+			{ 0.f, 100.f, 0.f, 255.f, 0.f },
+			{ 0.f, 0.392156869f, 0.f, 1.f, 0.f },
+			{ 33.3333321f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.130718946f, 1.f, 0.f, 0.f, 0.f },
+			{ 1.f, 0.f, 1.f, 0.607843161f, 1.f },
+			{ 120.f, 1.f, 0.130718961f, 1.f, 0.f },
+			{ 120.f, 1.f, 0.392156869f, 1.f, 0.f },
+			{ 120.f, 1.f, 0.196078435f, 1.f, 0.f },
+			{ 120.f, 0.392156869f, 0.28047061f, 1.f, 0.f },
+			{ 0.0455717109f, 0.0911434218f, 0.0151905641f, 1.f, 0.f },
+			{ 0.300000042f, 0.600000083f, 0.0911434218f, 1.f, 0.f },
+			{ 25.43396f, -24.0795918f, 100.f, 1.f, 0.f },
+			{ 36.2035141f, -43.3661652f, 41.8587608f, 1.f, 0.f },
+			{ 36.2035141f, 73.5439682f, 2.37387991f, 1.f, 0.f },
+			{ 25.43396f, 100.f, 1.80709374f, 1.f, 0.f } } },
+		{ "DarkKhaki", 0xFFBDB76B, {
+			{ 189.f, 183.f, 107.f, 255.f, 0.f },
+			{ 0.741176486f, 0.717647076f, 0.419607848f, 1.f, 0.f },
+			{ 159.666672f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.626143813f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.f, 0.0317460299f, 0.433862388f, 0.258823514f, 1.f },
+			{ 55.6097565f, 0.329853892f, 0.626143813f, 1.f, 0.f },
+			{ 55.6097565f, 0.433862448f, 0.741176486f, 1.f, 0.f },
+			{ 55.6097565f, 0.383177608f, 0.580392182f, 1.f, 0.f },
+			{ 55.6097565f, 0.321568638f, 0.701130986f, 1.f, 0.f },
+			{ 0.405710071f, 0.457483351f, 0.205997154f, 1.f, 0.f },
+			{ 0.379455358f, 0.427878231f, 0.457483351f, 1.f, 0.f },
+			{ 69.8743057f, 7.23229122f, 100.f, 1.f, 0.f },
+			{ 73.3819351f, -8.78879452f, 39.2911453f, 1.f, 0.f },
+			{ 73.3819351f, 65.7273865f, 1.79085767f, 1.f, 0.f },
+			{ 69.8743057f, 100.f, 1.49859917f, 1.f, 0.f } } },
+		{ "DarkMagenta", 0xFF8B008B, {
+			{ 139.f, 0.f, 139.f, 255.f, 0.f },
+			{ 0.545098066f, 0.f, 0.545098066f, 1.f, 0.f },
+			{ 92.6666641f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.363398671f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.f, 1.f, 0.f, 0.454901934f, 1.f },
+			{ 300.f, 1.f, 0.363398701f, 1.f, 0.f },
+			{ 300.f, 1.f, 0.545098066f, 1.f, 0.f },
+			{ 300.f, 1.f, 0.272549033f, 1.f, 0.f },
+			{ 300.f, 0.545098066f, 0.155243918f, 1.f, 0.f },
+			{ 0.15305084f, 0.0735305399f, 0.250334173f, 1.f, 0.f },
+			{ 0.320918113f, 0.154179379f, 0.0735305399f, 1.f, 0.f },
+			{ 46.0492516f, 64.1774826f, 72.7828674f, 1.f, 0.f },
+			{ 32.597496f, 62.5557022f, -38.7350693f, 1.f, 0.f },
+			{ 32.597496f, 78.7411423f, 359.f, 1.f, 0.f },
+			{ 46.0492516f, 98.51828f, 0.848146915f, 1.f, 0.f } } },
+		{ "DarkOliveGreen", 0xFF556B2F, {
+			{ 85.f, 107.f, 47.f, 255.f, 0.f },
+			{ 0.333333343f, 0.419607848f, 0.184313729f, 1.f, 0.f },
+			{ 79.6666641f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.312418282f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.205607444f, 0.f, 0.560747743f, 0.580392122f, 1.f },
+			{ 81.9999924f, 0.410041869f, 0.312418312f, 1.f, 0.f },
+			{ 81.9999924f, 0.560747683f, 0.419607848f, 1.f, 0.f },
+			{ 81.9999924f, 0.38961038f, 0.301960796f, 1.f, 0.f },
+			{ 81.9999924f, 0.235294119f, 0.384277672f, 1.f, 0.f },
+			{ 0.0951661989f, 0.126520932f, 0.0462940112f, 1.f, 0.f },
+			{ 0.355122745f, 0.472126245f, 0.126520932f, 1.f, 0.f },
+			{ 36.9605141f, -9.25759792f, 100.f, 1.f, 0.f },
+			{ 42.2342873f, -18.8277359f, 30.5985622f, 1.f, 0.f },
+			{ 42.2342873f, 64.0340195f, 2.12240028f, 1.f, 0.f },
+			{ 36.9605141f, 100.f, 1.66310918f, 1.f, 0.f } } },
+		{ "DarkOrange", 0xFFFF8C00, {
+			{ 255.f, 140.f, 0.f, 255.f, 0.f },
+			{ 1.f, 0.549019635f, 0.f, 1.f, 0.f },
+			{ 131.666672f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.516339898f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.f, 0.450980365f, 1.f, 0.f, 1.f },
+			{ 32.9411774f, 1.f, 0.516339839f, 1.f, 0.f },
+			{ 32.9411774f, 1.f, 1.f, 1.f, 0.f },
+			{ 32.9411774f, 1.f, 0.5f, 1.f, 0.f },
+			{ 32.9411774f, 1.f, 0.605258822f, 1.f, 0.f },
+			{ 0.506149828f, 0.400189459f, 0.0505900644f, 1.f, 0.f },
+			{ 0.52893126f, 0.418201685f, 0.400189459f, 1.f, 0.f },
+			{ 76.4451981f, 100.f, 100.f, 1.f, 0.f },
+			{ 69.4830246f, 36.8240166f, 75.4833984f, 1.f, 0.f },
+			{ 69.4830246f, 82.8072739f, 1.1169219f, 1.f, 0.f },
+			{ 76.4451981f, 100.f, 0.785398185f, 1.f, 0.f } } },
+		{ "DarkOrchid", 0xFF9932CC, {
+			{ 153.f, 50.f, 204.f, 255.f, 0.f },
+			{ 0.600000024f, 0.196078435f, 0.800000012f, 1.f, 0.f },
+			{ 135.666672f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.532026172f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.249999985f, 0.754902005f, 0.f, 0.199999988f, 1.f },
+			{ 280.129883f, 0.63144958f, 0.532026112f, 1.f, 0.f },
+			{ 280.129883f, 0.754902005f, 0.800000012f, 1.f, 0.f },
+			{ 280.129883f, 0.606299222f, 0.498039216f, 1.f, 0.f },
+			{ 280.129883f, 0.603921592f, 0.325555325f, 1.f, 0.f },
+			{ 0.251714081f, 0.134123623f, 0.583758652f, 1.f, 0.f },
+			{ 0.259607077f, 0.138329342f, 0.134123623f, 1.f, 0.f },
+			{ 57.2420425f, 39.4073906f, 68.8418503f, 1.f, 0.f },
+			{ 43.3781128f, 65.1574402f, -60.1008911f, 1.f, 0.f },
+			{ 43.3781128f, 84.626236f, 359.f, 1.f, 0.f },
+			{ 57.2420425f, 89.6615143f, 1.05089283f, 1.f, 0.f } } },
+		{ "DarkRed", 0xFF8B0000, {
+			{ 139.f, 0.f, 0.f, 255.f, 0.f },
+			{ 0.545098066f, 0.f, 0.f, 1.f, 0.f },
+			{ 46.3333321f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.181699336f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.f, 1.f, 1.f, 0.454901934f, 1.f },
+			{ 0.f, 1.f, 0.18169935f, 1.f, 0.f },
+			{ 0.f, 1.f, 0.545098066f, 1.f, 0.f },
+			{ 0.f, 1.f, 0.272549033f, 1.f, 0.f },
+			{ 0.f, 0.545098066f, 0.115887843f, 1.f, 0.f },
+			{ 0.106466629f, 0.0548968576f, 0.00499062333f, 1.f, 0.f },
+			{ 0.639999986f, 0.330000013f, 0.0548968576f, 1.f, 0.f },
+			{ 38.9788704f, 100.f, 100.f, 1.f, 0.f },
+			{ 28.0866547f, 51.0020103f, 41.2867355f, 1.f, 0.f },
+			{ 28.0866547f, 75.6322632f, 0.680514038f, 1.f, 0.f },
+			{ 38.9788704f, 100.f, 0.785398185f, 1.f, 0.f } } },
+		{ "DarkSalmon", 0xFFE9967A, {
+			{ 233.f, 150.f, 122.f, 255.f, 0.f },
+			{ 0.913725495f, 0.588235319f, 0.478431374f, 1.f, 0.f },
+			{ 168.333328f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.66013068f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.f, 0.356223166f, 0.476394892f, 0.0862745047f, 1.f },
+			{ 15.1351385f, 0.275247455f, 0.66013068f, 1.f, 0.f },
+			{ 15.1351385f, 0.476394862f, 0.913725495f, 1.f, 0.f },
+			{ 15.1351385f, 0.716129005f, 0.69607842f, 1.f, 0.f },
+			{ 15.1351385f, 0.435294122f, 0.649506688f, 1.f, 0.f },
+			{ 0.480196029f, 0.405431986f, 0.237044796f, 1.f, 0.f },
+			{ 0.427725732f, 0.361131042f, 0.405431986f, 1.f, 0.f },
+			{ 74.8372955f, 64.4807587f, 100.f, 1.f, 0.f },
+			{ 69.8546829f, 28.1729107f, 27.7091141f, 1.f, 0.f },
+			{ 69.8546829f, 65.4359055f, 0.777098775f, 1.f, 0.f },
+			{ 74.8372955f, 100.f, 0.998079956f, 1.f, 0.f } } },
+		{ "DarkSeaGreen", 0xFF8FBC8F, {
+			{ 143.f, 188.f, 143.f, 255.f, 0.f },
+			{ 0.56078434f, 0.737254918f, 0.56078434f, 1.f, 0.f },
+			{ 158.f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.619607866f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.239361688f, 0.f, 0.239361688f, 0.262745082f, 1.f },
+			{ 120.f, 0.0949367285f, 0.619607866f, 1.f, 0.f },
+			{ 120.f, 0.239361688f, 0.737254918f, 1.f, 0.f },
+			{ 120.f, 0.251396626f, 0.649019599f, 1.f, 0.f },
+			{ 120.f, 0.176470578f, 0.686996102f, 1.f, 0.f },
+			{ 0.342660964f, 0.437892556f, 0.326271236f, 1.f, 0.f },
+			{ 0.309589177f, 0.395629525f, 0.437892556f, 1.f, 0.f },
+			{ 65.173233f, -20.4228058f, 100.f, 1.f, 0.f },
+			{ 72.08741f, -23.8187313f, 18.0386543f, 1.f, 0.f },
+			{ 72.08741f, 61.6712914f, 2.49341655f, 1.f, 0.f },
+			{ 65.173233f, 100.f, 1.77225399f, 1.f, 0.f } } },
+		{ "DarkSlateBlue", 0xFF483D8B, {
+			{ 72.f, 61.f, 139.f, 255.f, 0.f },
+			{ 0.282352954f, 0.239215687f, 0.545098066f, 1.f, 0.f },
+			{ 90.6666641f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.355555534f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.482014447f, 0.561151147f, 0.f, 0.454901934f, 1.f },
+			{ 248.461533f, 0.327205896f, 0.355555564f, 1.f, 0.f },
+			{ 248.461533f, 0.561151147f, 0.545098066f, 1.f, 0.f },
+			{ 248.461533f, 0.390000045f, 0.392156869f, 1.f, 0.f },
+			{ 248.461533f, 0.305882394f, 0.270471364f, 1.f, 0.f },
+			{ 0.0899945125f, 0.065787524f, 0.252158642f, 1.f, 0.f },
+			{ 0.220606863f, 0.16126737f, 0.065787524f, 1.f, 0.f },
+			{ 35.9832382f, -0.687576771f, 53.7082062f, 1.f, 0.f },
+			{ 30.8280258f, 26.0527287f, -42.0828209f, 1.f, 0.f },
+			{ 30.8280258f, 69.3338013f, 358.983551f, 1.f, 0.f },
+			{ 35.9832382f, 76.8563004f, 1.58359766f, 1.f, 0.f } } },
+		{ "DarkSlateGray", 0xFF2F4F4F, {
+			{ 47.f, 79.f, 79.f, 255.f, 0.f },
+			{ 0.184313729f, 0.309803933f, 0.309803933f, 1.f, 0.f },
+			{ 68.3333359f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.26797387f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.405063391f, 0.f, 0.f, 0.690196037f, 1.f },
+			{ 180.f, 0.312195122f, 0.26797387f, 1.f, 0.f },
+			{ 180.f, 0.405063301f, 0.309803933f, 1.f, 0.f },
+			{ 180.f, 0.253968239f, 0.247058839f, 1.f, 0.f },
+			{ 180.f, 0.125490203f, 0.283124715f, 1.f, 0.f },
+			{ 0.0537892729f, 0.067606777f, 0.0841685906f, 1.f, 0.f },
+			{ 0.26166597f, 0.32888329f, 0.067606777f, 1.f, 0.f },
+			{ 27.7881432f, -12.5995541f, 91.2744141f, 1.f, 0.f },
+			{ 31.2557564f, -11.7187347f, -3.72279882f, 1.f, 0.f },
+			{ 31.2557564f, 54.8030663f, 357.166016f, 1.f, 0.f },
+			{ 27.7881432f, 96.0699692f, 1.70796978f, 1.f, 0.f } } },
+		{ "DarkTurquoise", 0xFF00CED1, {
+			{ 0.f, 206.f, 209.f, 255.f, 0.f },
+			{ 0.f, 0.807843149f, 0.819607854f, 1.f, 0.f },
+			{ 138.333328f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.542483628f, 1.f, 0.f, 0.f, 0.f },
+			{ 1.f, 0.014354066f, 0.f, 0.180392146f, 1.f },
+			{ 180.861237f, 1.f, 0.542483628f, 1.f, 0.f },
+			{ 180.861237f, 1.f, 0.819607854f, 1.f, 0.f },
+			{ 180.861237f, 1.f, 0.409803927f, 1.f, 0.f },
+			{ 180.861237f, 0.819607854f, 0.636945069f, 1.f, 0.f },
+			{ 0.335755348f, 0.48744297f, 0.679460406f, 1.f, 0.f },
+			{ 0.223440856f, 0.324387014f, 0.48744297f, 1.f, 0.f },
+			{ 64.6242371f, -49.7077904f, 100.f, 1.f, 0.f },
+			{ 75.2919693f, -40.0383453f, -13.5105247f, 1.f, 0.f },
+			{ 75.2919693f, 66.5064087f, 357.183838f, 1.f, 0.f },
+			{ 64.6242371f, 100.f, 2.03210354f, 1.f, 0.f } } },
+		{ "DarkViolet", 0xFF9400D3, {
+			{ 148.f, 0.f, 211.f, 255.f, 0.f },
+			{ 0.580392182f, 0.f, 0.827450991f, 1.f, 0.f },
+			{ 119.666664f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.469281048f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.298578173f, 1.f, 0.f, 0.172549009f, 1.f },
+			{ 282.085297f, 1.f, 0.469281048f, 1.f, 0.f },
+			{ 282.085297f, 1.f, 0.827450991f, 1.f, 0.f },
+			{ 282.085297f, 1.f, 0.413725495f, 1.f, 0.f },
+			{ 282.085297f, 0.827450991f, 0.183133334f, 1.f, 0.f },
+			{ 0.239652082f, 0.109980747f, 0.624735773f, 1.f, 0.f },
+			{ 0.245956287f, 0.112873867f, 0.109980747f, 1.f, 0.f },
+			{ 56.0529404f, 41.447979f, 39.9691658f, 1.f, 0.f },
+			{ 39.5772285f, 76.3274612f, -70.3702011f, 1.f, 0.f },
+			{ 39.5772285f, 90.5532837f, 359.f, 1.f, 0.f },
+			{ 56.0529404f, 78.7900543f, 0.76723671f, 1.f, 0.f } } },
+		{ "DeepPink", 0xFFFF1493, {
+			{ 255.f, 20.f, 147.f, 255.f, 0.f },
+			{ 1.f, 0.0784313753f, 0.576470613f, 1.f, 0.f },
+			{ 140.666672f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.551634014f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.f, 0.921568632f, 0.423529387f, 0.f, 1.f },
+			{ 327.574463f, 0.857819915f, 0.551634014f, 1.f, 0.f },
+			{ 327.574463f, 0.921568632f, 1.f, 1.f, 0.f },
+			{ 327.574463f, 1.f, 0.539215684f, 1.f, 0.f },
+			{ 327.574463f, 0.921568632f, 0.310315281f, 1.f, 0.f },
+			{ 0.467515022f, 0.238688678f, 0.297424674f, 1.f, 0.f },
+			{ 0.465824842f, 0.237825751f, 0.238688678f, 1.f, 0.f },
+			{ 74.0305328f, 100.f, 100.f, 1.f, 0.f },
+			{ 55.9562607f, 84.5430527f, -5.70708513f, 1.f, 0.f },
+			{ 55.9562607f, 83.0997925f, 359.f, 1.f, 0.f },
+			{ 74.0305328f, 100.f, 0.785398185f, 1.f, 0.f } } },
+		{ "DeepSkyBlue", 0xFF00BFFF, {
+			{ 0.f, 191.f, 255.f, 255.f, 0.f },
+			{ 0.f, 0.749019623f, 1.f, 1.f, 0.f },
+			{ 148.666672f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.583006561f, 1.f, 0.f, 0.f, 0.f },
+			{ 1.f, 0.250980377f, 0.f, 0.f, 1.f },
+			{ 195.058823f, 1.f, 0.583006561f, 1.f, 0.f },
+			{ 195.058823f, 1.f, 1.f, 1.f, 0.f },
+			{ 195.058823f, 1.f, 0.5f, 1.f, 0.f },
+			{ 195.058823f, 1.f, 0.607898831f, 1.f, 0.f },
+			{ 0.366739094f, 0.444788456f, 1.01237285f, 1.f, 0.f },
+			{ 0.201074079f, 0.243866622f, 0.444788456f, 1.f, 0.f },
+			{ 67.0316544f, -45.5165901f, 100.f, 1.f, 0.f },
+			{ 72.5474014f, -17.6540318f, -42.5384979f, 1.f, 0.f },
+			{ 72.5474014f, 67.9907684f, 358.035828f, 1.f, 0.f },
+			{ 67.0316544f, 100.f, 1.9979378f, 1.f, 0.f } } },
+		{ "DimGray", 0xFF696969, {
+			{ 105.f, 105.f, 105.f, 255.f, 0.f },
+			{ 0.411764711f, 0.411764711f, 0.411764711f, 1.f, 0.f },
+			{ 105.f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.411764711f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.f, 0.f, 0.f, 0.588235259f, 1.f },
+			{ 0.f, 0.f, 0.411764711f, 1.f, 0.f },
+			{ 0.f, 0.f, 0.411764711f, 1.f, 0.f },
+			{ 0.f, 0.f, 0.411764711f, 1.f, 0.f },
+			{ 0.f, 0.f, 0.411764711f, 1.f, 0.f },
+			{ 0.134256646f, 0.141263306f, 0.153807491f, 1.f, 0.f },
+			{ 0.312713861f, 0.329033941f, 0.141263306f, 1.f, 0.f },
+			{ 43.3977432f, 8.40679786e-06f, 100.f, 1.f, 0.f },
+			{ 44.413559f, 0.f, 0.f, 1.f, 0.f },
+			{ 44.413559f, 50.f, 0.f, 1.f, 0.f },
+			{ 43.3977432f, 100.f, 1.57079625f, 1.f, 0.f } } },
+		{ "DodgerBlue", 0xFF1E90FF, {
+			{ 30.f, 144.f, 255.f, 255.f, 0.f },
+			{ 0.117647059f, 0.564705908f, 1.f, 1.f, 0.f },
+			{ 143.f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.56078434f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.882352948f, 0.435294092f, 0.f, 0.f, 1.f },
+			{ 209.600006f, 0.79020977f, 0.56078434f, 1.f, 0.f },
+			{ 209.600006f, 0.882352948f, 1.f, 1.f, 0.f },
+			{ 209.600006f, 1.f, 0.558823526f, 1.f, 0.f },
+			{ 209.600006f, 0.882352948f, 0.501089454f, 1.f, 0.f },
+			{ 0.285517454f, 0.274398148f, 0.983765364f, 1.f, 0.f },
+			{ 0.18495886f, 0.177755743f, 0.274398148f, 1.f, 0.f },
+			{ 60.3839722f, -33.3637962f, 100.f, 1.f, 0.f },
+			{ 59.3792343f, 9.96142578f, -63.3859406f, 1.f, 0.f },
+			{ 59.3792343f, 75.0640259f, 358.585083f, 1.f, 0.f },
+			{ 60.3839722f, 100.f, 1.89282095f, 1.f, 0.f } } },
+		{ "Firebrick", 0xFFB22222, {
+			{ 178.f, 34.f, 34.f, 255.f, 0.f },
+			{ 0.698039234f, 0.13333334f, 0.13333334f, 1.f, 0.f },
+			{ 82.f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.321568638f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.f, 0.80898881f, 0.80898881f, 0.301960766f, 1.f },
+			{ 0.f, 0.585365832f, 0.321568638f, 1.f, 0.f },
+			{ 0.f, 0.80898881f, 0.698039234f, 1.f, 0.f },
+			{ 0.f, 0.679245293f, 0.41568628f, 1.f, 0.f },
+			{ 0.f, 0.564705908f, 0.253389806f, 1.f, 0.f },
+			{ 0.192193672f, 0.10725718f, 0.0257132053f, 1.f, 0.f },
+			{ 0.591066778f, 0.329855591f, 0.10725718f, 1.f, 0.f },
+			{ 50.9428711f, 100.f, 100.f, 1.f, 0.f },
+			{ 39.1146164f, 55.9186172f, 37.644474f, 1.f, 0.f },
+			{ 39.1146164f, 76.3317108f, 0.592512786f, 1.f, 0.f },
+			{ 50.9428711f, 100.f, 0.785398185f, 1.f, 0.f } } },
+		{ "FloralWhite", 0xFFFFFAF0, {
+			{ 255.f, 250.f, 240.f, 255.f, 0.f },
+			{ 1.f, 0.980392158f, 0.941176474f, 1.f, 0.f },
+			{ 248.333328f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.973856211f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.f, 0.019607842f, 0.0588235259f, 0.f, 1.f },
+			{ 40.f, 0.0335570574f, 0.973856211f, 1.f, 0.f },
+			{ 40.f, 0.0588235259f, 1.f, 1.f, 0.f },
+			{ 40.f, 0.999998987f, 0.970588207f, 1.f, 0.f },
+			{ 40.f, 0.0588235259f, 0.981729388f, 1.f, 0.f },
+			{ 0.91144675f, 0.959228516f, 0.961316109f, 1.f, 0.f },
+			{ 0.321839511f, 0.338711649f, 0.959228516f, 1.f, 0.f },
+			{ 96.4695892f, 3.34756851f, 100.f, 1.f, 0.f },
+			{ 98.4015732f, -0.0367760658f, 5.37602901f, 1.f, 0.f },
+			{ 98.4015732f, 52.1000633f, 1.57763696f, 1.f, 0.f },
+			{ 96.4695892f, 100.f, 1.53733313f, 1.f, 0.f } } },
+		{ "ForestGreen", 0xFF228B22, {
+			{ 34.f, 139.f, 34.f, 255.f, 0.f },
+			{ 0.13333334f, 0.545098066f, 0.13333334f, 1.f, 0.f },
+			{ 69.f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.270588249f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.75539571f, 0.f, 0.75539571f, 0.454901934f, 1.f },
+			{ 120.f, 0.507246375f, 0.270588249f, 1.f, 0.f },
+			{ 120.f, 0.75539571f, 0.545098066f, 1.f, 0.f },
+			{ 120.f, 0.606936455f, 0.339215696f, 1.f, 0.f },
+			{ 120.f, 0.411764741f, 0.427827448f, 1.f, 0.f },
+			{ 0.101808786f, 0.18920812f, 0.0462853871f, 1.f, 0.f },
+			{ 0.301832467f, 0.560945272f, 0.18920812f, 1.f, 0.f },
+			{ 38.165123f, -32.5251808f, 100.f, 1.f, 0.f },
+			{ 50.594429f, -49.5817642f, 45.0169334f, 1.f, 0.f },
+			{ 50.594429f, 76.1598434f, 2.40441179f, 1.f, 0.f },
+			{ 38.165123f, 100.f, 1.88525593f, 1.f, 0.f } } },
+		{ "Fuchsia", 0xFFFF00FF, {
+			{ 255.f, 0.f, 255.f, 255.f, 0.f },
+			{ 1.f, 0.f, 1.f, 1.f, 0.f },
+			{ 170.f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.666666687f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.f, 1.f, 0.f, 0.f, 1.f },
+			{ 300.f, 1.f, 0.666666687f, 1.f, 0.f },
+			{ 300.f, 1.f, 1.f, 1.f, 0.f },
+			{ 300.f, 1.f, 0.5f, 1.f, 0.f },
+			{ 300.f, 1.f, 0.284799993f, 1.f, 0.f },
+			{ 0.592800021f, 0.284800172f, 0.969600022f, 1.f, 0.f },
+			{ 0.320918143f, 0.154179379f, 0.284800172f, 1.f, 0.f },
+			{ 81.4452591f, 100.f, 100.f, 1.f, 0.f },
+			{ 60.3199539f, 98.2406158f, -60.8314972f, 1.f, 0.f },
+			{ 60.3199539f, 95.1365204f, 359.f, 1.f, 0.f },
+			{ 81.4452591f, 100.f, 0.785398185f, 1.f, 0.f } } },
+		{ "Gainsboro", 0xFFDCDCDC, {
+			{ 220.f, 220.f, 220.f, 255.f, 0.f },
+			{ 0.862745106f, 0.862745106f, 0.862745106f, 1.f, 0.f },
+			{ 220.f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.862745106f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.f, 0.f, 0.f, 0.137254894f, 1.f },
+			{ 0.f, 0.f, 0.862745106f, 1.f, 0.f },
+			{ 0.f, 0.f, 0.862745106f, 1.f, 0.f },
+			{ 0.f, 0.f, 0.862745106f, 1.f, 0.f },
+			{ 0.f, 0.f, 0.862745106f, 1.f, 0.f },
+			{ 0.680195212f, 0.715693653f, 0.779247165f, 1.f, 0.f },
+			{ 0.312713861f, 0.329033971f, 0.715693653f, 1.f, 0.f },
+			{ 86.0162125f, 0.f, 100.f, 1.f, 0.f },
+			{ 87.7608948f, -2.98023224e-05f, 1.1920929e-05f, 1.f, 0.f },
+			{ 87.7608948f, 50.0000114f, 2.76108623f, 1.f, 0.f },
+			{ 86.0162125f, 100.f, 1.57079637f, 1.f, 0.f } } },
+		{ "GhostWhite", 0xFFF8F8FF, {
+			{ 248.f, 248.f, 255.f, 255.f, 0.f },
+			{ 0.972549021f, 0.972549021f, 1.f, 1.f, 0.f },
+			{ 250.333328f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.981699347f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.0274509788f, 0.0274509788f, 0.f, 0.f, 1.f },
+			{ 240.f, 0.00932085514f, 0.981699288f, 1.f, 0.f },
+			{ 240.f, 0.0274509788f, 1.f, 1.f, 0.f },
+			{ 240.f, 0.999997854f, 0.986274481f, 1.f, 0.f },
+			{ 240.f, 0.0274509788f, 0.974530995f, 1.f, 0.f },
+			{ 0.903190017f, 0.943111062f, 1.08030617f, 1.f, 0.f },
+			{ 0.30861336f, 0.322254062f, 0.943111062f, 1.f, 0.f },
+			{ 96.1289291f, -0.385802805f, 100.f, 1.f, 0.f },
+			{ 97.7572098f, 1.24722719f, -3.34544182f, 1.f, 0.f },
+			{ 97.7572098f, 51.3946762f, 358.786041f, 1.f, 0.f },
+			{ 96.1289291f, 100.f, 1.57465434f, 1.f, 0.f } } },
+		{ "Gold", 0xFFFFD700, {
+			{ 255.f, 215.f, 0.f, 255.f, 0.f },
+			{ 1.f, 0.843137264f, 0.f, 1.f, 0.f },
+			{ 156.666672f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.614379108f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.f, 0.156862736f, 1.f, 0.f, 1.f },
+			{ 50.5882339f, 1.f, 0.614379108f, 1.f, 0.f },
+			{ 50.5882339f, 1.f, 1.f, 1.f, 0.f },
+			{ 50.5882339f, 1.f, 0.5f, 1.f, 0.f },
+			{ 50.5882339f, 1.f, 0.81561178f, 1.f, 0.f },
+			{ 0.655373335f, 0.698636472f, 0.100331217f, 1.f, 0.f },
+			{ 0.450632483f, 0.480380088f, 0.698636472f, 1.f, 0.f },
+			{ 84.7598648f, 34.6061172f, 100.f, 1.f, 0.f },
+			{ 86.9299469f, -1.9262135f, 87.1297455f, 1.f, 0.f },
+			{ 86.9299469f, 84.0433731f, 1.59290016f, 1.f, 0.f },
+			{ 84.7598648f, 100.f, 1.23763478f, 1.f, 0.f } } },
+		{ "Goldenrod", 0xFFDAA520, {
+			{ 218.f, 165.f, 32.f, 255.f, 0.f },
+			{ 0.854901969f, 0.647058845f, 0.125490203f, 1.f, 0.f },
+			{ 138.333328f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.542483628f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.f, 0.243119255f, 0.853211045f, 0.145098031f, 1.f },
+			{ 42.9032288f, 0.768674672f, 0.542483628f, 1.f, 0.f },
+			{ 42.9032288f, 0.853211045f, 0.854901969f, 1.f, 0.f },
+			{ 42.9032288f, 0.744000018f, 0.490196079f, 1.f, 0.f },
+			{ 42.9032288f, 0.729411781f, 0.65358901f, 1.f, 0.f },
+			{ 0.426270157f, 0.419218868f, 0.0721281394f, 1.f, 0.f },
+			{ 0.464540303f, 0.456855983f, 0.419218868f, 1.f, 0.f },
+			{ 71.3010864f, 44.661705f, 100.f, 1.f, 0.f },
+			{ 70.8170319f, 8.52188492f, 68.7596283f, 1.f, 0.f },
+			{ 70.8170319f, 77.0647278f, 1.44748783f, 1.f, 0.f },
+			{ 71.3010864f, 100.f, 1.15075922f, 1.f, 0.f } } },
+		{ "Gray", 0xFF808080, {
+			{ 128.f, 128.f, 128.f, 255.f, 0.f },
+			{ 0.501960814f, 0.501960814f, 0.501960814f, 1.f, 0.f },
+			{ 128.f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.501960814f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.f, 0.f, 0.f, 0.498039186f, 1.f },
+			{ 0.f, 0.f, 0.501960814f, 1.f, 0.f },
+			{ 0.f, 0.f, 0.501960814f, 1.f, 0.f },
+			{ 0.f, 0.f, 0.501960814f, 1.f, 0.f },
+			{ 0.f, 0.f, 0.501960814f, 1.f, 0.f },
+			{ 0.205153853f, 0.215860546f, 0.235028937f, 1.f, 0.f },
+			{ 0.312713861f, 0.329033971f, 0.215860546f, 1.f, 0.f },
+			{ 52.414978f, 0.f, 100.f, 1.f, 0.f },
+			{ 53.585022f, -2.98023224e-05f, 1.1920929e-05f, 1.f, 0.f },
+			{ 53.585022f, 50.0000114f, 2.76108623f, 1.f, 0.f },
+			{ 52.414978f, 100.f, 1.57079637f, 1.f, 0.f } } },
+		{ "Green", 0xFF008000, {
+			{ 0.f, 128.f, 0.f, 255.f, 0.f },
+			{ 0.f, 0.501960814f, 0.f, 1.f, 0.f },
+			{ 42.6666679f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.167320266f, 1.f, 0.f, 0.f, 0.f },
+			{ 1.f, 0.f, 1.f, 0.498039186f, 1.f },
+			{ 120.f, 1.f, 0.167320266f, 1.f, 0.f },
+			{ 120.f, 1.f, 0.501960814f, 1.f, 0.f },
+			{ 120.f, 1.f, 0.250980407f, 1.f, 0.f },
+			{ 120.f, 0.501960814f, 0.359002382f, 1.f, 0.f },
+			{ 0.0771917105f, 0.154383421f, 0.0257305596f, 1.f, 0.f },
+			{ 0.300000012f, 0.600000024f, 0.154383421f, 1.f, 0.f },
+			{ 33.3910446f, -31.6129513f, 100.f, 1.f, 0.f },
+			{ 46.228817f, -51.6943474f, 49.897438f, 1.f, 0.f },
+			{ 46.228817f, 78.0654221f, 2.37388015f, 1.f, 0.f },
+			{ 33.3910446f, 100.f, 1.87698436f, 1.f, 0.f } } },
+		{ "GreenYellow", 0xFFADFF2F, {
+			{ 173.f, 255.f, 47.f, 255.f, 0.f },
+			{ 0.678431392f, 1.f, 0.184313729f, 1.f, 0.f },
+			{ 158.333328f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.620914996f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.321568608f, 0.f, 0.815686285f, 0.f, 1.f },
+			{ 83.6538467f, 0.703157902f, 0.620915055f, 1.f, 0.f },
+			{ 83.6538467f, 0.815686285f, 1.f, 1.f, 0.f },
+			{ 83.6538467f, 1.f, 0.592156887f, 1.f, 0.f },
+			{ 83.6538467f, 0.815686285f, 0.872741938f, 1.f, 0.f },
+			{ 0.535051703f, 0.806105375f, 0.154289976f, 1.f, 0.f },
+			{ 0.357787132f, 0.539039731f, 0.806105375f, 1.f, 0.f },
+			{ 78.1723099f, -34.8786736f, 100.f, 1.f, 0.f },
+			{ 91.958107f, -52.4795647f, 81.864563f, 1.f, 0.f },
+			{ 91.958107f, 87.9849701f, 2.1408565f, 1.f, 0.f },
+			{ 78.1723099f, 100.f, 1.90638983f, 1.f, 0.f } } },
+		{ "Honeydew", 0xFFF0FFF0, {
+			{ 240.f, 255.f, 240.f, 255.f, 0.f },
+			{ 0.941176474f, 1.f, 0.941176474f, 1.f, 0.f },
+			{ 245.f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.960784316f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.0588235259f, 0.f, 0.0588235259f, 0.f, 1.f },
+			{ 120.f, 0.0204080939f, 0.960784256f, 1.f, 0.f },
+			{ 120.f, 0.0588235259f, 1.f, 1.f, 0.f },
+			{ 120.f, 0.999998987f, 0.970588207f, 1.f, 0.f },
+			{ 120.f, 0.0588235259f, 0.983247042f, 1.f, 0.f },
+			{ 0.874146461f, 0.963365376f, 0.964077592f, 1.f, 0.f },
+			{ 0.312018037f, 0.343863875f, 0.963365376f, 1.f, 0.f },
+			{ 94.9139175f, -7.26089954f, 100.f, 1.f, 0.f },
+			{ 98.5658035f, -7.56475353f, 5.47562838f, 1.f, 0.f },
+			{ 98.5658035f, 53.6478577f, 2.51504898f, 1.f, 0.f },
+			{ 94.9139175f, 100.f, 1.64327812f, 1.f, 0.f } } },
+		{ "HotPink", 0xFFFF69B4, {
+			{ 255.f, 105.f, 180.f, 255.f, 0.f },
+			{ 1.f, 0.411764711f, 0.70588237f, 1.f, 0.f },
+			{ 180.f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.70588237f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.f, 0.588235259f, 0.29411763f, 0.f, 1.f },
+			{ 330.f, 0.416666687f, 0.70588237f, 1.f, 0.f },
+			{ 330.f, 0.588235259f, 1.f, 1.f, 0.f },
+			{ 330.f, 1.f, 0.70588237f, 1.f, 0.f },
+			{ 330.f, 0.588235259f, 0.558058858f, 1.f, 0.f },
+			{ 0.545235455f, 0.346599549f, 0.46988222f, 1.f, 0.f },
+			{ 0.400402844f, 0.254531235f, 0.346599549f, 1.f, 0.f },
+			{ 78.7660294f, 100.f, 100.f, 1.f, 0.f },
+			{ 65.4830551f, 64.2399521f, -10.651123f, 1.f, 0.f },
+			{ 65.4830551f, 75.4363098f, 359.f, 1.f, 0.f },
+			{ 78.7660294f, 100.f, 0.785398185f, 1.f, 0.f } } },
+		{ "IndianRed", 0xFFCD5C5C, {
+			{ 205.f, 92.f, 92.f, 255.f, 0.f },
+			{ 0.80392158f, 0.360784322f, 0.360784322f, 1.f, 0.f },
+			{ 129.666672f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.508496761f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.f, 0.551219523f, 0.551219523f, 0.19607842f, 1.f },
+			{ 0.f, 0.290488362f, 0.508496702f, 1.f, 0.f },
+			{ 0.f, 0.551219523f, 0.80392158f, 1.f, 0.f },
+			{ 0.f, 0.530516446f, 0.582352936f, 1.f, 0.f },
+			{ 0.f, 0.443137258f, 0.454995304f, 1.f, 0.f },
+			{ 0.309331208f, 0.214075357f, 0.12625879f, 1.f, 0.f },
+			{ 0.476139307f, 0.329516351f, 0.214075357f, 1.f, 0.f },
+			{ 62.4511414f, 97.0161438f, 100.f, 1.f, 0.f },
+			{ 53.392662f, 44.8282356f, 22.1133595f, 1.f, 0.f },
+			{ 53.392662f, 69.5256729f, 0.458265901f, 1.f, 0.f },
+			{ 62.4511414f, 100.f, 0.800542235f, 1.f, 0.f } } },
+		{ "Indigo", 0xFF4B0082, {
+			{ 75.f, 0.f, 130.f, 255.f, 0.f },
+			{ 0.294117659f, 0.f, 0.509803951f, 1.f, 0.f },
+			{ 68.3333359f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.26797387f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.423076868f, 1.f, 0.f, 0.490196049f, 1.f },
+			{ 274.615387f, 1.f, 0.26797387f, 1.f, 0.f },
+			{ 274.615387f, 1.f, 0.509803951f, 1.f, 0.f },
+			{ 274.615387f, 1.f, 0.254901975f, 1.f, 0.f },
+			{ 274.615387f, 0.509803951f, 0.0993372649f, 1.f, 0.f },
+			{ 0.0692915916f, 0.031071417f, 0.21348694f, 1.f, 0.f },
+			{ 0.220779359f, 0.0990008637f, 0.031071417f, 1.f, 0.f },
+			{ 31.645092f, 15.5891218f, 12.2082682f, 1.f, 0.f },
+			{ 20.4679756f, 51.689415f, -53.3148041f, 1.f, 0.f },
+			{ 20.4679756f, 79.0070648f, 359.f, 1.f, 0.f },
+			{ 31.645092f, 59.9002838f, 0.664367735f, 1.f, 0.f } } },
+		{ "Ivory", 0xFFFFFFF0, {
+			{ 255.f, 255.f, 240.f, 255.f, 0.f },
+			{ 1.f, 1.f, 0.941176474f, 1.f, 0.f },
+			{ 250.f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.980392158f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.f, 0.f, 0.0588235259f, 0.f, 1.f },
+			{ 60.f, 0.0400000215f, 0.980392158f, 1.f, 0.f },
+			{ 60.f, 0.0588235259f, 1.f, 1.f, 0.f },
+			{ 60.f, 0.999998987f, 0.970588207f, 1.f, 0.f },
+			{ 60.f, 0.0588235259f, 0.995752931f, 1.f, 0.f },
+			{ 0.927190602f, 0.990716279f, 0.966564059f, 1.f, 0.f },
+			{ 0.321442157f, 0.343465507f, 0.990716279f, 1.f, 0.f },
+			{ 97.113472f, 0.800352395f, 100.f, 1.f, 0.f },
+			{ 99.6399078f, -2.55158544f, 7.16257095f, 1.f, 0.f },
+			{ 99.6399078f, 52.9701118f, 1.91301823f, 1.f, 0.f },
+			{ 97.113472f, 100.f, 1.56279302f, 1.f, 0.f } } },
+		{ "Khaki", 0xFFF0E68C, {
+			{ 240.f, 230.f, 140.f, 255.f, 0.f },
+			{ 0.941176474f, 0.90196079f, 0.549019635f, 1.f, 0.f },
+			{ 203.333328f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.797385573f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.f, 0.0416666642f, 0.416666627f, 0.0588235259f, 1.f },
+			{ 54.f, 0.311475396f, 0.797385633f, 1.f, 0.f },
+			{ 54.f, 0.416666627f, 0.941176474f, 1.f, 0.f },
+			{ 54.f, 0.769230783f, 0.745098054f, 1.f, 0.f },
+			{ 54.f, 0.392156839f, 0.884815693f, 1.f, 0.f },
+			{ 0.689611077f, 0.77014035f, 0.360375077f, 1.f, 0.f },
+			{ 0.378880858f, 0.423124641f, 0.77014035f, 1.f, 0.f },
+			{ 86.484787f, 10.3653345f, 100.f, 1.f, 0.f },
+			{ 90.3280716f, -9.01114941f, 44.9786072f, 1.f, 0.f },
+			{ 90.3280716f, 67.9188995f, 1.76852167f, 1.f, 0.f },
+			{ 86.484787f, 100.f, 1.46751177f, 1.f, 0.f } } },
+		{ "Lavender", 0xFFE6E6FA, {
+			{ 230.f, 230.f, 250.f, 255.f, 0.f },
+			{ 0.90196079f, 0.90196079f, 0.980392158f, 1.f, 0.f },
+			{ 236.666672f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.928104579f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.0799999982f, 0.0799999982f, 0.f, 0.019607842f, 1.f },
+			{ 240.f, 0.0281690359f, 0.928104579f, 1.f, 0.f },
+			{ 240.f, 0.0799999982f, 0.980392158f, 1.f, 0.f },
+			{ 240.f, 0.666666687f, 0.941176474f, 1.f, 0.f },
+			{ 240.f, 0.0784313679f, 0.907623529f, 1.f, 0.f },
+			{ 0.781762183f, 0.803183079f, 1.01805139f, 1.f, 0.f },
+			{ 0.300331622f, 0.308560938f, 0.803183079f, 1.f, 0.f },
+			{ 90.8602524f, -1.12788975f, 100.f, 1.f, 0.f },
+			{ 91.8274918f, 3.70812416f, -9.66125679f, 1.f, 0.f },
+			{ 91.8274918f, 54.0423584f, 358.795685f, 1.f, 0.f },
+			{ 90.8602524f, 100.f, 1.58207476f, 1.f, 0.f } } },
+		{ "LavenderBlush", 0xFFFFF0F5, {
+			{ 255.f, 240.f, 245.f, 255.f, 0.f },
+			{ 1.f, 0.941176474f, 0.960784316f, 1.f, 0.f },
+			{ 246.666672f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.967320263f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.f, 0.0588235259f, 0.0392156839f, 0.f, 1.f },
+			{ 340.f, 0.0270270109f, 0.967320263f, 1.f, 0.f },
+			{ 340.f, 0.0588235259f, 1.f, 1.f, 0.f },
+			{ 340.f, 0.999998987f, 0.970588207f, 1.f, 0.f },
+			{ 340.f, 0.0588235259f, 0.955098033f, 1.f, 0.f },
+			{ 0.888721168f, 0.901730001f, 0.990887225f, 1.f, 0.f },
+			{ 0.31953004f, 0.324207217f, 0.901730001f, 1.f, 0.f },
+			{ 95.5269547f, 8.22808838f, 100.f, 1.f, 0.f },
+			{ 96.0684814f, 5.88709116f, -0.594067574f, 1.f, 0.f },
+			{ 96.0684814f, 52.3113251f, 359.f, 1.f, 0.f },
+			{ 95.5269547f, 100.f, 1.48870039f, 1.f, 0.f } } },
+		{ "LawnGreen", 0xFF7CFC00, {
+			{ 124.f, 252.f, 0.f, 255.f, 0.f },
+			{ 0.486274511f, 0.988235295f, 0.f, 1.f, 0.f },
+			{ 125.333336f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.491503268f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.507936537f, 0.f, 1.f, 0.0117647052f, 1.f },
+			{ 90.4761887f, 1.f, 0.491503268f, 1.f, 0.f },
+			{ 90.4761887f, 1.f, 0.988235295f, 1.f, 0.f },
+			{ 90.4761887f, 1.f, 0.494117647f, 1.f, 0.f },
+			{ 90.4761887f, 0.988235295f, 0.810167849f, 1.f, 0.f },
+			{ 0.431219578f, 0.739064515f, 0.11993067f, 1.f, 0.f },
+			{ 0.334223121f, 0.572822928f, 0.739064515f, 1.f, 0.f },
+			{ 71.6376724f, -48.9841423f, 100.f, 1.f, 0.f },
+			{ 88.8782501f, -67.8525848f, 84.9528046f, 1.f, 0.f },
+			{ 88.8782501f, 92.4703979f, 2.24474978f, 1.f, 0.f },
+			{ 71.6376724f, 100.f, 2.02628422f, 1.f, 0.f } } },
+		{ "LemonChiffon", 0xFFFFFACD, {
+			{ 255.f, 250.f, 205.f, 255.f, 0.f },
+			{ 1.f, 0.980392158f, 0.80392158f, 1.f, 0.f },
+			{ 236.666672f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.928104579f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.f, 0.019607842f, 0.19607842f, 0.f, 1.f },
+			{ 54.f, 0.133802831f, 0.928104579f, 1.f, 0.f },
+			{ 54.f, 0.19607842f, 1.f, 1.f, 0.f },
+			{ 54.f, 1.f, 0.90196079f, 1.f, 0.f },
+			{ 54.f, 0.19607842f, 0.97181958f, 1.f, 0.f },
+			{ 0.864377379f, 0.940400779f, 0.71341759f, 1.f, 0.f },
+			{ 0.343252659f, 0.373442292f, 0.940400779f, 1.f, 0.f },
+			{ 94.4991913f, 5.20990133f, 100.f, 1.f, 0.f },
+			{ 97.6481323f, -5.42747974f, 22.2335701f, 1.f, 0.f },
+			{ 97.6481323f, 58.9400177f, 1.81022561f, 1.f, 0.f },
+			{ 94.4991913f, 100.f, 1.51874435f, 1.f, 0.f } } },
+		{ "LightBlue", 0xFFADD8E6, {
+			{ 173.f, 216.f, 230.f, 255.f, 0.f },
+			{ 0.678431392f, 0.847058833f, 0.90196079f, 1.f, 0.f },
+			{ 206.333328f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.809150279f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.24782607f, 0.0608695596f, 0.f, 0.0980392098f, 1.f },
+			{ 194.736847f, 0.161550939f, 0.809150398f, 1.f, 0.f },
+			{ 194.736847f, 0.24782607f, 0.90196079f, 1.f, 0.f },
+			{ 194.736847f, 0.532710195f, 0.790196061f, 1.f, 0.f },
+			{ 194.736847f, 0.223529398f, 0.815172613f, 1.f, 0.f },
+			{ 0.56065625f, 0.637081206f, 0.84187746f, 1.f, 0.f },
+			{ 0.274883389f, 0.312353671f, 0.637081206f, 1.f, 0.f },
+			{ 79.6511536f, -21.1640987f, 100.f, 1.f, 0.f },
+			{ 83.8135757f, -10.8904543f, -11.4756107f, 1.f, 0.f },
+			{ 83.8135757f, 56.179924f, 357.669952f, 1.f, 0.f },
+			{ 79.6511536f, 100.f, 1.7793597f, 1.f, 0.f } } },
+		{ "LightCoral", 0xFFF08080, {
+			{ 240.f, 128.f, 128.f, 255.f, 0.f },
+			{ 0.941176474f, 0.501960814f, 0.501960814f, 1.f, 0.f },
+			{ 165.333328f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.648365974f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.f, 0.466666639f, 0.466666639f, 0.0588235259f, 1.f },
+			{ 0.f, 0.225806415f, 0.648366034f, 1.f, 0.f },
+			{ 0.f, 0.466666639f, 0.941176474f, 1.f, 0.f },
+			{ 0.f, 0.788732409f, 0.721568644f, 1.f, 0.f },
+			{ 0.f, 0.43921566f, 0.595338106f, 1.f, 0.f },
+			{ 0.475464463f, 0.355239451f, 0.247699752f, 1.f, 0.f },
+			{ 0.440896541f, 0.329412311f, 0.355239451f, 1.f, 0.f },
+			{ 74.5379486f, 89.7861786f, 100.f, 1.f, 0.f },
+			{ 66.1545639f, 42.8093681f, 19.553257f, 1.f, 0.f },
+			{ 66.1545639f, 68.3841782f, 0.428454548f, 1.f, 0.f },
+			{ 74.5379486f, 100.f, 0.83916378f, 1.f, 0.f } } },
+		{ "LightCyan", 0xFFE0FFFF, {
+			{ 224.f, 255.f, 255.f, 255.f, 0.f },
+			{ 0.87843138f, 1.f, 1.f, 1.f, 0.f },
+			{ 244.666672f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.959477127f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.12156862f, 0.f, 0.f, 0.f, 1.f },
+			{ 180.f, 0.0844686627f, 0.959477127f, 1.f, 0.f },
+			{ 180.f, 0.12156862f, 1.f, 1.f, 0.f },
+			{ 180.f, 0.999999523f, 0.93921566f, 1.f, 0.f },
+			{ 180.f, 0.12156862f, 0.974154532f, 1.f, 0.f },
+			{ 0.845412612f, 0.94586587f, 1.08387864f, 1.f, 0.f },
+			{ 0.294040501f, 0.328978837f, 0.94586587f, 1.f, 0.f },
+			{ 93.6850815f, -15.6939583f, 100.f, 1.f, 0.f },
+			{ 97.8678665f, -9.94372368f, -3.37430239f, 1.f, 0.f },
+			{ 97.8678665f, 54.1018143f, 357.185547f, 1.f, 0.f },
+			{ 93.6850815f, 100.f, 1.72646606f, 1.f, 0.f } } },
+		{ "LightGoldenrodYellow", 0xFFFAFAD2, {
+			{ 250.f, 250.f, 210.f, 255.f, 0.f },
+			{ 0.980392158f, 0.980392158f, 0.823529422f, 1.f, 0.f },
+			{ 236.666672f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.928104579f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.f, 0.f, 0.159999996f, 0.019607842f, 1.f },
+			{ 60.f, 0.112676024f, 0.928104579f, 1.f, 0.f },
+			{ 60.f, 0.159999996f, 0.980392158f, 1.f, 0.f },
+			{ 60.f, 0.800000012f, 0.90196079f, 1.f, 0.f },
+			{ 60.f, 0.156862736f, 0.969066679f, 1.f, 0.f },
+			{ 0.85235405f, 0.933492243f, 0.744860649f, 1.f, 0.f },
+			{ 0.336804718f, 0.368866205f, 0.933492243f, 1.f, 0.f },
+			{ 93.9844666f, 2.05112982f, 100.f, 1.f, 0.f },
+			{ 97.3691483f, -6.48158789f, 19.2371006f, 1.f, 0.f },
+			{ 97.3691483f, 57.9295654f, 1.89578187f, 1.f, 0.f },
+			{ 93.9844666f, 100.f, 1.55028796f, 1.f, 0.f } } },
+		{ "LightGreen", 0xFF90EE90, {
+			{ 144.f, 238.f, 144.f, 255.f, 0.f },
+			{ 0.564705908f, 0.933333337f, 0.564705908f, 1.f, 0.f },
+			{ 175.333328f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.687581658f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.39495796f, 0.f, 0.39495796f, 0.0666666627f, 1.f },
+			{ 120.f, 0.178707182f, 0.687581718f, 1.f, 0.f },
+			{ 120.f, 0.39495796f, 0.933333337f, 1.f, 0.f },
+			{ 120.f, 0.734375f, 0.749019623f, 1.f, 0.f },
+			{ 120.f, 0.368627429f, 0.828348219f, 1.f, 0.f },
+			{ 0.471073866f, 0.690919757f, 0.372331023f, 1.f, 0.f },
+			{ 0.307023585f, 0.45030871f, 0.690919757f, 1.f, 0.f },
+			{ 74.2584076f, -38.7783394f, 100.f, 1.f, 0.f },
+			{ 86.5495758f, -46.3257141f, 36.9506226f, 1.f, 0.f },
+			{ 86.5495758f, 73.1473541f, 2.46830058f, 1.f, 0.f },
+			{ 74.2584076f, 100.f, 1.940727f, 1.f, 0.f } } },
+		{ "LightGray", 0xFFD3D3D3, {
+			{ 211.f, 211.f, 211.f, 255.f, 0.f },
+			{ 0.827450991f, 0.827450991f, 0.827450991f, 1.f, 0.f },
+			{ 211.f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.827450991f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.f, 0.f, 0.f, 0.172549009f, 1.f },
+			{ 0.f, 0.f, 0.827450991f, 1.f, 0.f },
+			{ 0.f, 0.f, 0.827450991f, 1.f, 0.f },
+			{ 0.f, 0.f, 0.827450991f, 1.f, 0.f },
+			{ 0.f, 0.f, 0.827450991f, 1.f, 0.f },
+			{ 0.619095922f, 0.651405692f, 0.70925051f, 1.f, 0.f },
+			{ 0.312713861f, 0.329033971f, 0.651405692f, 1.f, 0.f },
+			{ 82.8653183f, 0.f, 100.f, 1.f, 0.f },
+			{ 84.5561142f, 0.f, 0.f, 1.f, 0.f },
+			{ 84.5561142f, 50.f, 0.f, 1.f, 0.f },
+			{ 82.8653183f, 100.f, 1.57079637f, 1.f, 0.f } } },
+		{ "LightPink", 0xFFFFB6C1, {
+			{ 255.f, 182.f, 193.f, 255.f, 0.f },
+			{ 1.f, 0.713725507f, 0.75686276f, 1.f, 0.f },
+			{ 210.f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.823529422f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.f, 0.286274493f, 0.24313724f, 0.f, 1.f },
+			{ 350.958893f, 0.133333325f, 0.823529422f, 1.f, 0.f },
+			{ 350.958893f, 0.286274493f, 1.f, 1.f, 0.f },
+			{ 350.958893f, 1.f, 0.856862783f, 1.f, 0.f },
+			{ 350.958893f, 0.286274493f, 0.777701974f, 1.f, 0.f },
+			{ 0.675868094f, 0.585674584f, 0.581846356f, 1.f, 0.f },
+			{ 0.366644293f, 0.317716211f, 0.585674584f, 1.f, 0.f },
+			{ 85.7994156f, 48.4236603f, 100.f, 1.f, 0.f },
+			{ 81.0532532f, 27.9618206f, 5.03386259f, 1.f, 0.f },
+			{ 81.0532532f, 61.0981712f, 0.178118393f, 1.f, 0.f },
+			{ 85.7994156f, 100.f, 1.11983871f, 1.f, 0.f } } },
+		{ "LightSalmon", 0xFFFFA07A, {
+			{ 255.f, 160.f, 122.f, 255.f, 0.f },
+			{ 1.f, 0.627451003f, 0.478431374f, 1.f, 0.f },
+			{ 179.f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.701960802f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.f, 0.372548997f, 0.521568656f, 0.f, 1.f },
+			{ 17.1428585f, 0.318435788f, 0.701960802f, 1.f, 0.f },
+			{ 17.1428585f, 0.521568656f, 1.f, 1.f, 0.f },
+			{ 17.1428585f, 1.f, 0.739215672f, 1.f, 0.f },
+			{ 17.1428585f, 0.521568656f, 0.695895731f, 1.f, 0.f },
+			{ 0.573192179f, 0.478089929f, 0.246171981f, 1.f, 0.f },
+			{ 0.441782236f, 0.368483096f, 0.478089929f, 1.f, 0.f },
+			{ 80.3588028f, 75.6852646f, 100.f, 1.f, 0.f },
+			{ 74.7042923f, 31.4760513f, 34.5456963f, 1.f, 0.f },
+			{ 74.7042923f, 68.255806f, 0.831859171f, 1.f, 0.f },
+			{ 80.3588028f, 100.f, 0.922923923f, 1.f, 0.f } } },
+		{ "LightSeaGreen", 0xFF20B2AA, {
+			{ 32.f, 178.f, 170.f, 255.f, 0.f },
+			{ 0.125490203f, 0.698039234f, 0.666666687f, 1.f, 0.f },
+			{ 126.666664f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.496732026f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.820224762f, 0.f, 0.044943817f, 0.301960766f, 1.f },
+			{ 176.712326f, 0.747368395f, 0.496732026f, 1.f, 0.f },
+			{ 176.712326f, 0.820224762f, 0.698039234f, 1.f, 0.f },
+			{ 176.712326f, 0.695238113f, 0.411764711f, 1.f, 0.f },
+			{ 176.712326f, 0.572549045f, 0.574050188f, 1.f, 0.f },
+			{ 0.237689406f, 0.350490749f, 0.435334742f, 1.f, 0.f },
+			{ 0.232228547f, 0.34243831f, 0.350490749f, 1.f, 0.f },
+			{ 55.8557053f, -42.1379089f, 100.f, 1.f, 0.f },
+			{ 65.7868576f, -37.5098f, -6.32853508f, 1.f, 0.f },
+			{ 65.7868576f, 64.8593445f, 357.025543f, 1.f, 0.f },
+			{ 55.8557053f, 100.f, 1.96959603f, 1.f, 0.f } } },
+		{ "LightSkyBlue", 0xFF87CEFA, {
+			{ 135.f, 206.f, 250.f, 255.f, 0.f },
+			{ 0.529411793f, 0.807843149f, 0.980392158f, 1.f, 0.f },
+			{ 197.f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.772549033f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.459999979f, 0.175999984f, 0.f, 0.019607842f, 1.f },
+			{ 202.956512f, 0.314720869f, 0.772549093f, 1.f, 0.f },
+			{ 202.956512f, 0.459999979f, 0.980392158f, 1.f, 0.f },
+			{ 202.956512f, 0.920000136f, 0.754902005f, 1.f, 0.f },
+			{ 202.956512f, 0.450980365f, 0.76110667f, 1.f, 0.f },
+			{ 0.493109614f, 0.561936677f, 0.986687362f, 1.f, 0.f },
+			{ 0.241515145f, 0.275225252f, 0.561936677f, 1.f, 0.f },
+			{ 75.644371f, -31.2986851f, 100.f, 1.f, 0.f },
+			{ 79.7239151f, -10.8285847f, -28.5001392f, 1.f, 0.f },
+			{ 79.7239151f, 61.9093666f, 358.066101f, 1.f, 0.f },
+			{ 75.644371f, 100.f, 1.87412465f, 1.f, 0.f } } },
+		{ "LightSlateGray", 0xFF778899, {
+			{ 119.f, 136.f, 153.f, 255.f, 0.f },
+			{ 0.466666669f, 0.533333361f, 0.600000024f, 1.f, 0.f },
+			{ 136.f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.533333361f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.222222194f, 0.111111097f, 0.f, 0.399999976f, 1.f },
+			{ 210.f, 0.12500006f, 0.533333361f, 1.f, 0.f },
+			{ 210.f, 0.222222254f, 0.600000024f, 1.f, 0.f },
+			{ 210.f, 0.142857179f, 0.533333361f, 1.f, 0.f },
+			{ 210.f, 0.133333355f, 0.523973346f, 1.f, 0.f },
+			{ 0.221589103f, 0.238297999f, 0.335618645f, 1.f, 0.f },
+			{ 0.278551221f, 0.299555331f, 0.238297999f, 1.f, 0.f },
+			{ 54.1952057f, -9.35723972f, 100.f, 1.f, 0.f },
+			{ 55.9169769f, -2.2469461f, -11.107481f, 1.f, 0.f },
+			{ 55.9169769f, 54.4267464f, 358.229614f, 1.f, 0.f },
+			{ 54.1952057f, 100.f, 1.66409695f, 1.f, 0.f } } },
+		{ "LightSteelBlue", 0xFFB0C4DE, {
+			{ 176.f, 196.f, 222.f, 255.f, 0.f },
+			{ 0.690196097f, 0.768627465f, 0.870588243f, 1.f, 0.f },
+			{ 198.f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.776470602f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.207207188f, 0.117117107f, 0.f, 0.129411757f, 1.f },
+			{ 213.913055f, 0.111111104f, 0.776470602f, 1.f, 0.f },
+			{ 213.913055f, 0.207207188f, 0.870588243f, 1.f, 0.f },
+			{ 213.913055f, 0.410714298f, 0.78039217f, 1.f, 0.f },
+			{ 213.913055f, 0.180392146f, 0.759314537f, 1.f, 0.f },
+			{ 0.5082286f, 0.539830804f, 0.768327057f, 1.f, 0.f },
+			{ 0.279802024f, 0.297200412f, 0.539830804f, 1.f, 0.f },
+			{ 76.571579f, -11.4508343f, 100.f, 1.f, 0.f },
+			{ 78.4518661f, -1.2806952f, -15.2104378f, 1.f, 0.f },
+			{ 78.4518661f, 55.9625969f, 358.345215f, 1.f, 0.f },
+			{ 76.571579f, 100.f, 1.68480802f, 1.f, 0.f } } },
+		{ "LightYellow", 0xFFFFFFE0, {
+			{ 255.f, 255.f, 224.f, 255.f, 0.f },
+			{ 1.f, 1.f, 0.87843138f, 1.f, 0.f },
+			{ 244.666672f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.959477127f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.f, 0.f, 0.12156862f, 0.f, 1.f },
+			{ 60.f, 0.0844686627f, 0.959477127f, 1.f, 0.f },
+			{ 60.f, 0.12156862f, 1.f, 1.f, 0.f },
+			{ 60.f, 0.999999523f, 0.93921566f, 1.f, 0.f },
+			{ 60.f, 0.12156862f, 0.991222739f, 1.f, 0.f },
+			{ 0.904462993f, 0.981625259f, 0.846865296f, 1.f, 0.f },
+			{ 0.330947071f, 0.359181106f, 0.981625259f, 1.f, 0.f },
+			{ 96.1815872f, 1.6136651f, 100.f, 1.f, 0.f },
+			{ 99.2851105f, -5.10770082f, 14.8376465f, 1.f, 0.f },
+			{ 99.2851105f, 56.1297531f, 1.90232992f, 1.f, 0.f },
+			{ 96.1815872f, 100.f, 1.55466104f, 1.f, 0.f } } },
+		{ "Lime", 0xFF00FF00, {
+			{ 0.f, 255.f, 0.f, 255.f, 0.f },
+			{ 0.f, 1.f, 0.f, 1.f, 0.f },
+			{ 85.f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.333333343f, 1.f, 0.f, 0.f, 0.f },
+			{ 1.f, 0.f, 1.f, 0.f, 1.f },
+			{ 120.f, 1.f, 0.333333343f, 1.f, 0.f },
+			{ 120.f, 1.f, 1.f, 1.f, 0.f },
+			{ 120.f, 1.f, 0.5f, 1.f, 0.f },
+			{ 120.f, 1.f, 0.715200007f, 1.f, 0.f },
+			{ 0.357599914f, 0.715199828f, 0.119199924f, 1.f, 0.f },
+			{ 0.300000042f, 0.600000083f, 0.715199828f, 1.f, 0.f },
+			{ 66.3361282f, -62.8037109f, 100.f, 1.f, 0.f },
+			{ 87.73703f, -86.175766f, 83.1802979f, 1.f, 0.f },
+			{ 87.73703f, 96.785759f, 2.37388015f, 1.f, 0.f },
+			{ 66.3361282f, 100.f, 2.13157654f, 1.f, 0.f } } },
+		{ "LimeGreen", 0xFF32CD32, {
+			{ 50.f, 205.f, 50.f, 255.f, 0.f },
+			{ 0.196078435f, 0.80392158f, 0.196078435f, 1.f, 0.f },
+			{ 101.666664f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.398692787f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.756097555f, 0.f, 0.756097555f, 0.19607842f, 1.f },
+			{ 120.f, 0.508196712f, 0.398692816f, 1.f, 0.f },
+			{ 120.f, 0.756097555f, 0.80392158f, 1.f, 0.f },
+			{ 120.f, 0.607843161f, 0.5f, 1.f, 0.f },
+			{ 120.f, 0.607843161f, 0.630807877f, 1.f, 0.f },
+			{ 0.237221152f, 0.445710391f, 0.103697427f, 1.f, 0.f },
+			{ 0.30156678f, 0.566608191f, 0.445710391f, 1.f, 0.f },
+			{ 55.8084869f, -48.3597832f, 100.f, 1.f, 0.f },
+			{ 72.6085434f, -67.1206131f, 61.4384766f, 1.f, 0.f },
+			{ 72.6085434f, 85.5444336f, 2.4003644f, 1.f, 0.f },
+			{ 55.8084869f, 100.f, 2.02123642f, 1.f, 0.f } } },
+		{ "Linen", 0xFFFAF0E6, {
+			{ 250.f, 240.f, 230.f, 255.f, 0.f },
+			{ 0.980392158f, 0.941176474f, 0.90196079f, 1.f, 0.f },
+			{ 240.f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.941176474f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.f, 0.0399999991f, 0.0799999982f, 0.019607842f, 1.f },
+			{ 30.f, 0.0416666865f, 0.941176474f, 1.f, 0.f },
+			{ 30.f, 0.0799999982f, 0.980392158f, 1.f, 0.f },
+			{ 30.f, 0.666666687f, 0.941176474f, 1.f, 0.f },
+			{ 30.f, 0.0784313679f, 0.946682394f, 1.f, 0.f },
+			{ 0.84858942f, 0.883578062f, 0.874292672f, 1.f, 0.f },
+			{ 0.325571626f, 0.338995427f, 0.883578062f, 1.f, 0.f },
+			{ 93.8222961f, 6.24791288f, 100.f, 1.f, 0.f },
+			{ 95.3114014f, 1.67709589f, 6.02183342f, 1.f, 0.f },
+			{ 95.3114014f, 52.4417992f, 1.29917669f, 1.f, 0.f },
+			{ 93.8222961f, 100.f, 1.50839829f, 1.f, 0.f } } },
+		{ "Magenta", 0xFFFF00FF, {
+			{ 255.f, 0.f, 255.f, 255.f, 0.f },
+			{ 1.f, 0.f, 1.f, 1.f, 0.f },
+			{ 170.f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.666666687f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.f, 1.f, 0.f, 0.f, 1.f },
+			{ 300.f, 1.f, 0.666666687f, 1.f, 0.f },
+			{ 300.f, 1.f, 1.f, 1.f, 0.f },
+			{ 300.f, 1.f, 0.5f, 1.f, 0.f },
+			{ 300.f, 1.f, 0.284799993f, 1.f, 0.f },
+			{ 0.592800021f, 0.284800172f, 0.969600022f, 1.f, 0.f },
+			{ 0.320918143f, 0.154179379f, 0.284800172f, 1.f, 0.f },
+			{ 81.4452591f, 100.f, 100.f, 1.f, 0.f },
+			{ 60.3199539f, 98.2406158f, -60.8314972f, 1.f, 0.f },
+			{ 60.3199539f, 95.1365204f, 359.f, 1.f, 0.f },
+			{ 81.4452591f, 100.f, 0.785398185f, 1.f, 0.f } } },
+		{ "Maroon", 0xFF800000, {
+			{ 128.f, 0.f, 0.f, 255.f, 0.f },
+			{ 0.501960814f, 0.f, 0.f, 1.f, 0.f },
+			{ 42.6666679f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.167320266f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.f, 1.f, 1.f, 0.498039186f, 1.f },
+			{ 0.f, 1.f, 0.167320266f, 1.f, 0.f },
+			{ 0.f, 1.f, 0.501960814f, 1.f, 0.f },
+			{ 0.f, 1.f, 0.250980407f, 1.f, 0.f },
+			{ 0.f, 0.501960814f, 0.106716864f, 1.f, 0.f },
+			{ 0.0890141875f, 0.045897942f, 0.00417254027f, 1.f, 0.f },
+			{ 0.639999986f, 0.330000013f, 0.045897942f, 1.f, 0.f },
+			{ 35.7937927f, 100.f, 100.f, 1.f, 0.f },
+			{ 25.5325928f, 48.0473328f, 38.0533562f, 1.f, 0.f },
+			{ 25.5325928f, 73.9418488f, 0.669842124f, 1.f, 0.f },
+			{ 35.7937927f, 100.f, 0.785398185f, 1.f, 0.f } } },
+		{ "MediumAquamarine", 0xFF66CDAA, {
+			{ 102.f, 205.f, 170.f, 255.f, 0.f },
+			{ 0.400000006f, 0.80392158f, 0.666666687f, 1.f, 0.f },
+			{ 159.f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.623529434f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.502439082f, 0.f, 0.170731694f, 0.19607842f, 1.f },
+			{ 159.611649f, 0.358490586f, 0.623529434f, 1.f, 0.f },
+			{ 159.611649f, 0.502439022f, 0.80392158f, 1.f, 0.f },
+			{ 159.611649f, 0.507389188f, 0.601960778f, 1.f, 0.f },
+			{ 159.611649f, 0.403921574f, 0.708137989f, 1.f, 0.f },
+			{ 0.345633239f, 0.4938896f, 0.457326949f, 1.f, 0.f },
+			{ 0.26651758f, 0.380837947f, 0.4938896f, 1.f, 0.f },
+			{ 65.4072647f, -39.396122f, 100.f, 1.f, 0.f },
+			{ 75.6926651f, -38.3326416f, 8.30997276f, 1.f, 0.f },
+			{ 75.6926651f, 65.3215027f, 2.92811012f, 1.f, 0.f },
+			{ 65.4072647f, 100.f, 1.94608605f, 1.f, 0.f } } },
+		{ "MediumBlue", 0xFF0000CD, {
+			{ 0.f, 0.f, 205.f, 255.f, 0.f },
+			{ 0.f, 0.f, 0.80392158f, 1.f, 0.f },
+			{ 68.3333359f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.26797387f, 1.f, 0.f, 0.f, 0.f },
+			{ 1.f, 1.f, 0.f, 0.19607842f, 1.f },
+			{ 240.f, 1.f, 0.26797387f, 1.f, 0.f },
+			{ 240.f, 1.f, 0.80392158f, 1.f, 0.f },
+			{ 240.f, 1.f, 0.40196079f, 1.f, 0.f },
+			{ 240.f, 0.80392158f, 0.0580431372f, 1.f, 0.f },
+			{ 0.110152379f, 0.0440609455f, 0.580135822f, 1.f, 0.f },
+			{ 0.150000006f, 0.0599999949f, 0.0440609455f, 1.f, 0.f },
+			{ 39.6061211f, -11.5272751f, -25.8760338f, 1.f, 0.f },
+			{ 24.9709396f, 67.1817245f, -91.5005798f, 1.f, 0.f },
+			{ 24.9709396f, 94.3419495f, 359.f, 1.f, 0.f },
+			{ 39.6061211f, 64.1637497f, 358.010101f, 1.f, 0.f } } },
+		{ "MediumOrchid", 0xFFBA55D3, {
+			{ 186.f, 85.f, 211.f, 255.f, 0.f },
+			{ 0.729411781f, 0.333333343f, 0.827450991f, 1.f, 0.f },
+			{ 160.666672f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.630065382f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.118483402f, 0.597156346f, 0.f, 0.172549009f, 1.f },
+			{ 288.095215f, 0.470954359f, 0.630065382f, 1.f, 0.f },
+			{ 288.095215f, 0.597156405f, 0.827450991f, 1.f, 0.f },
+			{ 288.095215f, 0.588785112f, 0.580392182f, 1.f, 0.f },
+			{ 288.095215f, 0.494117647f, 0.453214943f, 1.f, 0.f },
+			{ 0.352500618f, 0.216388196f, 0.639331102f, 1.f, 0.f },
+			{ 0.29175204f, 0.179096699f, 0.216388196f, 1.f, 0.f },
+			{ 65.9428864f, 49.5313911f, 100.f, 1.f, 0.f },
+			{ 53.6416702f, 59.0629883f, -47.4054451f, 1.f, 0.f },
+			{ 53.6416702f, 79.583786f, 359.f, 1.f, 0.f },
+			{ 65.9428864f, 100.f, 1.11090457f, 1.f, 0.f } } },
+		{ "MediumPurple", 0xFF9370DB, {
+			{ 147.f, 112.f, 219.f, 255.f, 0.f },
+			{ 0.576470613f, 0.43921569f, 0.858823538f, 1.f, 0.f },
+			{ 159.333328f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.624836564f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.328767091f, 0.488584518f, 0.f, 0.141176462f, 1.f },
+			{ 259.62616f, 0.297071159f, 0.624836624f, 1.f, 0.f },
+			{ 259.62616f, 0.488584489f, 0.858823538f, 1.f, 0.f },
+			{ 259.62616f, 0.597765326f, 0.649019599f, 1.f, 0.f },
+			{ 259.62616f, 0.419607848f, 0.498691767f, 1.f, 0.f },
+			{ 0.306071907f, 0.229047149f, 0.698102355f, 1.f, 0.f },
+			{ 0.248188928f, 0.185730755f, 0.229047149f, 1.f, 0.f },
+			{ 62.1746292f, 9.66043186f, 100.f, 1.f, 0.f },
+			{ 54.9740601f, 36.7996407f, -50.0903854f, 1.f, 0.f },
+			{ 54.9740601f, 74.2793503f, 359.f, 1.f, 0.f },
+			{ 62.1746292f, 100.f, 1.47449088f, 1.f, 0.f } } },
+		{ "MediumSeaGreen", 0xFF3CB371, {
+			{ 60.f, 179.f, 113.f, 255.f, 0.f },
+			{ 0.235294119f, 0.701960802f, 0.443137258f, 1.f, 0.f },
+			{ 117.333336f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.460130721f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.664804518f, 0.f, 0.368715048f, 0.298039198f, 1.f },
+			{ 146.722687f, 0.488636374f, 0.460130721f, 1.f, 0.f },
+			{ 146.722687f, 0.664804518f, 0.701960802f, 1.f, 0.f },
+			{ 146.722687f, 0.497907996f, 0.468627453f, 1.f, 0.f },
+			{ 146.722687f, 0.466666698f, 0.584060431f, 1.f, 0.f },
+			{ 0.209629357f, 0.343927801f, 0.211527318f, 1.f, 0.f },
+			{ 0.273995042f, 0.449529171f, 0.343927801f, 1.f, 0.f },
+			{ 52.908905f, -39.9943008f, 100.f, 1.f, 0.f },
+			{ 65.2731476f, -48.2144966f, 24.2921104f, 1.f, 0.f },
+			{ 65.2731476f, 71.0892105f, 2.67488241f, 1.f, 0.f },
+			{ 52.908905f, 100.f, 1.95125353f, 1.f, 0.f } } },
+		{ "MediumSlateBlue", 0xFF7B68EE, {
+			{ 123.f, 104.f, 238.f, 255.f, 0.f },
+			{ 0.482352942f, 0.407843143f, 0.933333337f, 1.f, 0.f },
+			{ 155.f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.607843161f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.483193249f, 0.563025236f, 0.f, 0.0666666627f, 1.f },
+			{ 248.507446f, 0.329032302f, 0.607843161f, 1.f, 0.f },
+			{ 248.507446f, 0.563025177f, 0.933333337f, 1.f, 0.f },
+			{ 248.507446f, 0.797619045f, 0.670588255f, 1.f, 0.f },
+			{ 248.507446f, 0.525490165f, 0.461624324f, 1.f, 0.f },
+			{ 0.285448015f, 0.202828184f, 0.832803786f, 1.f, 0.f },
+			{ 0.21607171f, 0.153532103f, 0.202828184f, 1.f, 0.f },
+			{ 60.3777771f, -1.4554143f, 82.5431442f, 1.f, 0.f },
+			{ 52.1554718f, 41.0711746f, -65.3966675f, 1.f, 0.f },
+			{ 52.1554718f, 80.1656723f, 358.98999f, 1.f, 0.f },
+			{ 60.3777771f, 91.2779846f, 1.58842659f, 1.f, 0.f } } },
+		{ "MediumSpringGreen", 0xFF00FA9A, {
+			{ 0.f, 250.f, 154.f, 255.f, 0.f },
+			{ 0.f, 0.980392158f, 0.603921592f, 1.f, 0.f },
+			{ 134.666672f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.528104603f, 1.f, 0.f, 0.f, 0.f },
+			{ 1.f, 0.f, 0.383999974f, 0.019607842f, 1.f },
+			{ 156.959991f, 1.f, 0.528104603f, 1.f, 0.f },
+			{ 156.959991f, 1.f, 0.980392158f, 1.f, 0.f },
+			{ 156.959991f, 1.f, 0.490196079f, 1.f, 0.f },
+			{ 156.959991f, 0.980392158f, 0.744779587f, 1.f, 0.f },
+			{ 0.400161117f, 0.707034111f, 0.421025395f, 1.f, 0.f },
+			{ 0.261847734f, 0.462651849f, 0.707034111f, 1.f, 0.f },
+			{ 69.4810028f, -60.8446732f, 100.f, 1.f, 0.f },
+			{ 87.3407135f, -70.6801987f, 32.4656372f, 1.f, 0.f },
+			{ 87.3407135f, 80.3827667f, 2.71100593f, 1.f, 0.f },
+			{ 69.4810028f, 100.f, 2.11740351f, 1.f, 0.f } } },
+		{ "MediumTurquoise", 0xFF48D1CC, {
+			{ 72.f, 209.f, 204.f, 255.f, 0.f },
+			{ 0.282352954f, 0.819607854f, 0.800000012f, 1.f, 0.f },
+			{ 161.666672f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.63398695f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.655502439f, 0.f, 0.0239234436f, 0.180392146f, 1.f },
+			{ 177.810211f, 0.554639161f, 0.63398695f, 1.f, 0.f },
+			{ 177.810211f, 0.655502439f, 0.819607854f, 1.f, 0.f },
+			{ 177.810211f, 0.59825331f, 0.550980389f, 1.f, 0.f },
+			{ 177.810211f, 0.53725493f, 0.703971803f, 1.f, 0.f },
+			{ 0.363676727f, 0.513367891f, 0.651053309f, 1.f, 0.f },
+			{ 0.237993091f, 0.335952222f, 0.513367891f, 1.f, 0.f },
+			{ 66.7999039f, -45.6849251f, 100.f, 1.f, 0.f },
+			{ 76.8825684f, -37.3561401f, -8.3523035f, 1.f, 0.f },
+			{ 76.8825684f, 64.9525299f, 357.078369f, 1.f, 0.f },
+			{ 66.7999039f, 100.f, 1.99933147f, 1.f, 0.f } } },
+		{ "MediumVioletRed", 0xFFC71585, {
+			{ 199.f, 21.f, 133.f, 255.f, 0.f },
+			{ 0.78039217f, 0.0823529437f, 0.521568656f, 1.f, 0.f },
+			{ 117.666664f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.461437911f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.f, 0.894472361f, 0.331658274f, 0.21960783f, 1.f },
+			{ 322.247192f, 0.821529746f, 0.461437941f, 1.f, 0.f },
+			{ 322.247192f, 0.894472361f, 0.78039217f, 1.f, 0.f },
+			{ 322.247192f, 0.809090912f, 0.431372553f, 1.f, 0.f },
+			{ 322.247192f, 0.698039234f, 0.262467444f, 1.f, 0.f },
+			{ 0.280516088f, 0.143728405f, 0.234820113f, 1.f, 0.f },
+			{ 0.425627619f, 0.218079388f, 0.143728405f, 1.f, 0.f },
+			{ 59.9353333f, 100.f, 100.f, 1.f, 0.f },
+			{ 44.7629509f, 70.9958344f, -15.1749134f, 1.f, 0.f },
+			{ 44.7629509f, 78.3591766f, 359.f, 1.f, 0.f },
+			{ 59.9353333f, 100.f, 0.785398185f, 1.f, 0.f } } },
+		{ "MidnightBlue", 0xFF191970, {
+			{ 25.f, 25.f, 112.f, 255.f, 0.f },
+			{ 0.0980392173f, 0.0980392173f, 0.43921569f, 1.f, 0.f },
+			{ 54.f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.211764708f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.776785731f, 0.776785731f, 0.f, 0.56078434f, 1.f },
+			{ 240.f, 0.537037015f, 0.211764708f, 1.f, 0.f },
+			{ 240.f, 0.776785731f, 0.43921569f, 1.f, 0.f },
+			{ 240.f, 0.635036469f, 0.268627465f, 1.f, 0.f },
+			{ 240.f, 0.34117648f, 0.122672155f, 1.f, 0.f },
+			{ 0.0367201716f, 0.0207136683f, 0.155318394f, 1.f, 0.f },
+			{ 0.172595933f, 0.0973605216f, 0.0207136683f, 1.f, 0.f },
+			{ 22.5560799f, -5.05712652f, 6.17076015f, 1.f, 0.f },
+			{ 15.857399f, 31.7158108f, -49.5747223f, 1.f, 0.f },
+			{ 15.857399f, 72.9890213f, 358.998352f, 1.f, 0.f },
+			{ 22.5560799f, 53.9891357f, 2.25733328f, 1.f, 0.f } } },
+		{ "MintCream", 0xFFF5FFFA, {
+			{ 245.f, 255.f, 250.f, 255.f, 0.f },
+			{ 0.960784316f, 1.f, 0.980392158f, 1.f, 0.f },
+			{ 250.f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.980392158f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.0392156839f, 0.f, 0.019607842f, 0.f, 1.f },
+			{ 150.f, 0.0199999809f, 0.980392158f, 1.f, 0.f },
+			{ 150.f, 0.0392156839f, 1.f, 1.f, 0.f },
+			{ 150.f, 1.f, 0.980392158f, 1.f, 0.f },
+			{ 150.f, 0.0392156839f, 0.990247071f, 1.f, 0.f },
+			{ 0.9066208f, 0.978344917f, 1.04528308f, 1.f, 0.f },
+			{ 0.309400618f, 0.333877772f, 0.978344917f, 1.f, 0.f },
+			{ 96.2707291f, -5.10634565f, 100.f, 1.f, 0.f },
+			{ 99.1565475f, -4.16275883f, 1.24659538f, 1.f, 0.f },
+			{ 99.1565475f, 51.6974258f, 2.8506279f, 1.f, 0.f },
+			{ 96.2707291f, 100.f, 1.62181544f, 1.f, 0.f } } },
+		{ "MistyRose", 0xFFFFE4E1, {
+			{ 255.f, 228.f, 225.f, 255.f, 0.f },
+			{ 1.f, 0.894117653f, 0.882352948f, 1.f, 0.f },
+			{ 236.f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.925490201f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.f, 0.105882347f, 0.117647052f, 0.f, 1.f },
+			{ 6.f, 0.0466101766f, 0.925490201f, 1.f, 0.f },
+			{ 6.f, 0.117647052f, 1.f, 1.f, 0.f },
+			{ 6.f, 1.f, 0.941176474f, 1.f, 0.f },
+			{ 6.f, 0.117647052f, 0.915778816f, 1.f, 0.f },
+			{ 0.825657189f, 0.821837425f, 0.827306449f, 1.f, 0.f },
+			{ 0.333625674f, 0.332082212f, 0.821837425f, 1.f, 0.f },
+			{ 92.8239746f, 16.1751194f, 100.f, 1.f, 0.f },
+			{ 92.6558914f, 8.74653435f, 4.83498573f, 1.f, 0.f },
+			{ 92.6558914f, 53.9038849f, 0.504981756f, 1.f, 0.f },
+			{ 92.8239746f, 100.f, 1.41043401f, 1.f, 0.f } } },
+		{ "Moccasin", 0xFFFFE4B5, {
+			{ 255.f, 228.f, 181.f, 255.f, 0.f },
+			{ 1.f, 0.894117653f, 0.709803939f, 1.f, 0.f },
+			{ 221.333328f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.867973864f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.f, 0.105882347f, 0.290196061f, 0.f, 1.f },
+			{ 38.1081085f, 0.182228863f, 0.867973804f, 1.f, 0.f },
+			{ 38.1081085f, 0.290196061f, 1.f, 1.f, 0.f },
+			{ 38.1081085f, 1.f, 0.854901969f, 1.f, 0.f },
+			{ 38.1081085f, 0.290196061f, 0.903320789f, 1.f, 0.f },
+			{ 0.773176074f, 0.800844967f, 0.550905824f, 1.f, 0.f },
+			{ 0.363860071f, 0.376881152f, 0.800844967f, 1.f, 0.f },
+			{ 90.467598f, 19.2530556f, 100.f, 1.f, 0.f },
+			{ 91.7227631f, 2.4381578f, 26.3589497f, 1.f, 0.f },
+			{ 91.7227631f, 60.340416f, 1.47856045f, 1.f, 0.f },
+			{ 90.467598f, 100.f, 1.38059318f, 1.f, 0.f } } },
+		{ "NavajoWhite", 0xFFFFDEAD, {
+			{ 255.f, 222.f, 173.f, 255.f, 0.f },
+			{ 1.f, 0.870588243f, 0.678431392f, 1.f, 0.f },
+			{ 216.666672f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.849673212f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.f, 0.129411757f, 0.321568608f, 0.f, 1.f },
+			{ 35.8536606f, 0.201538503f, 0.849673271f, 1.f, 0.f },
+			{ 35.8536606f, 0.321568608f, 1.f, 1.f, 0.f },
+			{ 35.8536606f, 1.f, 0.839215696f, 1.f, 0.f },
+			{ 35.8536606f, 0.321568608f, 0.884227455f, 1.f, 0.f },
+			{ 0.748981178f, 0.765213013f, 0.503504515f, 1.f, 0.f },
+			{ 0.371205658f, 0.379250377f, 0.765213013f, 1.f, 0.f },
+			{ 89.345253f, 23.5245247f, 100.f, 1.f, 0.f },
+			{ 90.1008301f, 4.50879335f, 28.2711258f, 1.f, 0.f },
+			{ 90.1008301f, 61.1829681f, 1.41264415f, 1.f, 0.f },
+			{ 89.345253f, 100.f, 1.33975196f, 1.f, 0.f } } },
+		{ "Navy", 0xFF000080, {
+			{ 0.f, 0.f, 128.f, 255.f, 0.f },
+			{ 0.f, 0.f, 0.501960814f, 1.f, 0.f },
+			{ 42.6666679f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.167320266f, 1.f, 0.f, 0.f, 0.f },
+			{ 1.f, 1.f, 0.f, 0.498039186f, 1.f },
+			{ 240.f, 1.f, 0.167320266f, 1.f, 0.f },
+			{ 240.f, 1.f, 0.501960814f, 1.f, 0.f },
+			{ 240.f, 1.f, 0.250980407f, 1.f, 0.f },
+			{ 240.f, 0.501960814f, 0.0362415724f, 1.f, 0.f },
+			{ 0.0389479473f, 0.0155791761f, 0.205125839f, 1.f, 0.f },
+			{ 0.150000006f, 0.0599999912f, 0.0155791761f, 1.f, 0.f },
+			{ 23.3205414f, -6.7873888f, -15.2361078f, 1.f, 0.f },
+			{ 12.9716206f, 47.5059586f, -64.7024536f, 1.f, 0.f },
+			{ 12.9716206f, 81.3553467f, 359.f, 1.f, 0.f },
+			{ 23.3205414f, 58.3397789f, 358.010101f, 1.f, 0.f } } },
+		{ "OldLace", 0xFFFDF5E6, {
+			{ 253.f, 245.f, 230.f, 255.f, 0.f },
+			{ 0.992156863f, 0.960784316f, 0.90196079f, 1.f, 0.f },
+			{ 242.666672f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.95163399f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.f, 0.0316205509f, 0.0909090862f, 0.00784313679f, 1.f },
+			{ 39.1304359f, 0.052197814f, 0.95163399f, 1.f, 0.f },
+			{ 39.1304359f, 0.0909090862f, 0.992156863f, 1.f, 0.f },
+			{ 39.1304359f, 0.851851344f, 0.947058797f, 1.f, 0.f },
+			{ 39.1304359f, 0.0901960731f, 0.963207066f, 1.f, 0.f },
+			{ 0.874348462f, 0.919011652f, 0.879774988f, 1.f, 0.f },
+			{ 0.327087283f, 0.343795449f, 0.919011652f, 1.f, 0.f },
+			{ 94.9224625f, 5.36548328f, 100.f, 1.f, 0.f },
+			{ 96.779892f, 0.170558691f, 8.16596794f, 1.f, 0.f },
+			{ 96.779892f, 53.1905289f, 1.54991281f, 1.f, 0.f },
+			{ 94.9224625f, 100.f, 1.51719284f, 1.f, 0.f } } },
+		{ "Olive", 0xFF808000, {
+			{ 128.f, 128.f, 0.f, 255.f, 0.f },
+			{ 0.501960814f, 0.501960814f, 0.f, 1.f, 0.f },
+			{ 85.3333359f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.334640533f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.f, 0.f, 1.f, 0.498039186f, 1.f },
+			{ 60.f, 1.f, 0.334640533f, 1.f, 0.f },
+			{ 60.f, 1.f, 0.501960814f, 1.f, 0.f },
+			{ 60.f, 1.f, 0.250980407f, 1.f, 0.f },
+			{ 60.f, 0.501960814f, 0.465719253f, 1.f, 0.f },
+			{ 0.166205898f, 0.200281367f, 0.0299030989f, 1.f, 0.f },
+			{ 0.41929853f, 0.505262911f, 0.200281367f, 1.f, 0.f },
+			{ 47.7783737f, 3.78773212f, 100.f, 1.f, 0.f },
+			{ 51.8690033f, -12.9305725f, 56.6735802f, 1.f, 0.f },
+			{ 51.8690033f, 72.7070236f, 1.79511523f, 1.f, 0.f },
+			{ 47.7783737f, 100.f, 1.53293705f, 1.f, 0.f } } },
+		{ "OliveDrab", 0xFF6B8E23, {
+			{ 107.f, 142.f, 35.f, 255.f, 0.f },
+			{ 0.419607848f, 0.556862772f, 0.137254909f, 1.f, 0.f },
+			{ 94.6666641f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.371241808f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.246478841f, 0.f, 0.753521144f, 0.443137228f, 1.f },
+			{ 79.6261749f, 0.630281687f, 0.371241838f, 1.f, 0.f },
+			{ 79.6261749f, 0.753521144f, 0.556862772f, 1.f, 0.f },
+			{ 79.6261749f, 0.604519784f, 0.347058833f, 1.f, 0.f },
+			{ 79.6261749f, 0.419607878f, 0.497386694f, 1.f, 0.f },
+			{ 0.160392076f, 0.225935131f, 0.0510568805f, 1.f, 0.f },
+			{ 0.366707593f, 0.516560018f, 0.225935131f, 1.f, 0.f },
+			{ 47.0258865f, -15.0091171f, 100.f, 1.f, 0.f },
+			{ 54.6511536f, -28.2215481f, 49.690731f, 1.f, 0.f },
+			{ 54.6511536f, 72.3225174f, 2.08731151f, 1.f, 0.f },
+			{ 47.0258865f, 100.f, 1.71977544f, 1.f, 0.f } } },
+		{ "Orange", 0xFFFFA500, {
+			{ 255.f, 165.f, 0.f, 255.f, 0.f },
+			{ 1.f, 0.647058845f, 0.f, 1.f, 0.f },
+			{ 140.f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.549019635f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.f, 0.352941155f, 1.f, 0.f, 1.f },
+			{ 38.8235321f, 1.f, 0.549019635f, 1.f, 0.f },
+			{ 38.8235321f, 1.f, 1.f, 1.f, 0.f },
+			{ 38.8235321f, 1.f, 0.5f, 1.f, 0.f },
+			{ 38.8235321f, 1.f, 0.675376475f, 1.f, 0.f },
+			{ 0.5469203f, 0.481730431f, 0.0641802251f, 1.f, 0.f },
+			{ 0.500461936f, 0.440809637f, 0.481730431f, 1.f, 0.f },
+			{ 78.8635406f, 78.7584f, 100.f, 1.f, 0.f },
+			{ 74.9339371f, 23.9308777f, 78.9465561f, 1.f, 0.f },
+			{ 74.9339371f, 82.2241821f, 1.27647269f, 1.f, 0.f },
+			{ 78.8635406f, 100.f, 0.903672099f, 1.f, 0.f } } },
+		{ "OrangeRed", 0xFFFF4500, {
+			{ 255.f, 69.f, 0.f, 255.f, 0.f },
+			{ 1.f, 0.270588249f, 0.f, 1.f, 0.f },
+			{ 108.f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.423529416f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.f, 0.729411721f, 1.f, 0.f, 1.f },
+			{ 16.2352943f, 1.f, 0.423529416f, 1.f, 0.f },
+			{ 16.2352943f, 1.f, 1.f, 1.f, 0.f },
+			{ 16.2352943f, 1.f, 0.5f, 1.f, 0.f },
+			{ 16.2352943f, 1.f, 0.406124711f, 1.f, 0.f },
+			{ 0.433650196f, 0.255190194f, 0.0264235325f, 1.f, 0.f },
+			{ 0.606279969f, 0.356777668f, 0.255190194f, 1.f, 0.f },
+			{ 71.8020172f, 100.f, 100.f, 1.f, 0.f },
+			{ 57.5776596f, 67.7842789f, 68.9537201f, 1.f, 0.f },
+			{ 57.5776596f, 87.7702713f, 0.793950379f, 1.f, 0.f },
+			{ 71.8020172f, 100.f, 0.785398185f, 1.f, 0.f } } },
+		{ "Orchid", 0xFFDA70D6, {
+			{ 218.f, 112.f, 214.f, 255.f, 0.f },
+			{ 0.854901969f, 0.43921569f, 0.839215696f, 1.f, 0.f },
+			{ 181.333328f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.711111069f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.f, 0.486238569f, 0.0183486231f, 0.145098031f, 1.f },
+			{ 302.26416f, 0.382352948f, 0.711111128f, 1.f, 0.f },
+			{ 302.26416f, 0.486238539f, 0.854901969f, 1.f, 0.f },
+			{ 302.26416f, 0.588888943f, 0.647058845f, 1.f, 0.f },
+			{ 302.26416f, 0.41568628f, 0.556470573f, 1.f, 0.f },
+			{ 0.468384087f, 0.31348902f, 0.671868801f, 1.f, 0.f },
+			{ 0.322192043f, 0.215642825f, 0.31348902f, 1.f, 0.f },
+			{ 74.0862885f, 60.5626564f, 100.f, 1.f, 0.f },
+			{ 62.8010712f, 55.2839622f, -34.40765f, 1.f, 0.f },
+			{ 62.8010712f, 75.436264f, 359.f, 1.f, 0.f },
+			{ 74.0862885f, 100.f, 1.02624989f, 1.f, 0.f } } },
+		{ "PaleGoldenrod", 0xFFEEE8AA, {
+			{ 238.f, 232.f, 170.f, 255.f, 0.f },
+			{ 0.933333337f, 0.909803927f, 0.666666687f, 1.f, 0.f },
+			{ 213.333328f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.836601317f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.f, 0.0252100825f, 0.285714269f, 0.0666666627f, 1.f },
+			{ 54.7058792f, 0.203125f, 0.836601317f, 1.f, 0.f },
+			{ 54.7058792f, 0.285714269f, 0.933333337f, 1.f, 0.f },
+			{ 54.7058792f, 0.666666687f, 0.800000012f, 1.f, 0.f },
+			{ 54.7058792f, 0.266666651f, 0.897251725f, 1.f, 0.f },
+			{ 0.71366787f, 0.787939072f, 0.494703084f, 1.f, 0.f },
+			{ 0.35749352f, 0.394697756f, 0.787939072f, 1.f, 0.f },
+			{ 87.6629028f, 6.64728785f, 100.f, 1.f, 0.f },
+			{ 91.1409607f, -7.3500576f, 30.9709435f, 1.f, 0.f },
+			{ 91.1409607f, 62.4340477f, 1.80380666f, 1.f, 0.f },
+			{ 87.6629028f, 100.f, 1.50442111f, 1.f, 0.f } } },
+		{ "PaleGreen", 0xFF98FB98, {
+			{ 152.f, 251.f, 152.f, 255.f, 0.f },
+			{ 0.596078455f, 0.984313726f, 0.596078455f, 1.f, 0.f },
+			{ 185.f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.725490212f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.394422293f, 0.f, 0.394422293f, 0.0156862736f, 1.f },
+			{ 120.f, 0.178378284f, 0.725490153f, 1.f, 0.f },
+			{ 120.f, 0.394422293f, 0.984313726f, 1.f, 0.f },
+			{ 120.f, 0.925233543f, 0.790196061f, 1.f, 0.f },
+			{ 120.f, 0.388235271f, 0.873744309f, 1.f, 0.f },
+			{ 0.531104267f, 0.779367507f, 0.419434011f, 1.f, 0.f },
+			{ 0.307013392f, 0.450525969f, 0.779367507f, 1.f, 0.f },
+			{ 77.9401474f, -40.760128f, 100.f, 1.f, 0.f },
+			{ 90.75103f, -48.2944565f, 38.5293236f, 1.f, 0.f },
+			{ 90.75103f, 74.13311f, 2.46819448f, 1.f, 0.f },
+			{ 77.9401474f, 100.f, 1.9578383f, 1.f, 0.f } } },
+		{ "PaleTurquoise", 0xFFAFEEEE, {
+			{ 175.f, 238.f, 238.f, 255.f, 0.f },
+			{ 0.686274529f, 0.933333337f, 0.933333337f, 1.f, 0.f },
+			{ 217.f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.850980401f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.264705867f, 0.f, 0.f, 0.0666666627f, 1.f },
+			{ 180.f, 0.193548441f, 0.850980461f, 1.f, 0.f },
+			{ 180.f, 0.264705867f, 0.933333337f, 1.f, 0.f },
+			{ 180.f, 0.649484634f, 0.809803963f, 1.f, 0.f },
+			{ 180.f, 0.247058809f, 0.880808651f, 1.f, 0.f },
+			{ 0.636791229f, 0.764349043f, 0.922675669f, 1.f, 0.f },
+			{ 0.274028271f, 0.328919798f, 0.764349043f, 1.f, 0.f },
+			{ 83.7984238f, -28.9033794f, 100.f, 1.f, 0.f },
+			{ 90.0608826f, -19.6366615f, -6.39851093f, 1.f, 0.f },
+			{ 90.0608826f, 58.0675125f, 357.173401f, 1.f, 0.f },
+			{ 83.7984238f, 100.f, 1.85216224f, 1.f, 0.f } } },
+		{ "PaleVioletRed", 0xFFDB7093, {
+			{ 219.f, 112.f, 147.f, 255.f, 0.f },
+			{ 0.858823538f, 0.43921569f, 0.576470613f, 1.f, 0.f },
+			{ 159.333328f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.624836564f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.f, 0.488584518f, 0.328767091f, 0.141176462f, 1.f },
+			{ 340.37384f, 0.297071159f, 0.624836624f, 1.f, 0.f },
+			{ 340.37384f, 0.488584489f, 0.858823538f, 1.f, 0.f },
+			{ 340.37384f, 0.597765326f, 0.649019599f, 1.f, 0.f },
+			{ 340.37384f, 0.419607848f, 0.538334131f, 1.f, 0.f },
+			{ 0.402698457f, 0.287561566f, 0.310267687f, 1.f, 0.f },
+			{ 0.402486056f, 0.287409902f, 0.287561566f, 1.f, 0.f },
+			{ 69.6613007f, 79.1714554f, 100.f, 1.f, 0.f },
+			{ 60.5658188f, 45.5192337f, 0.39883852f, 1.f, 0.f },
+			{ 60.5658188f, 67.7816315f, 0.00876175333f, 1.f, 0.f },
+			{ 69.6613007f, 100.f, 0.901127934f, 1.f, 0.f } } },
+		{ "PapayaWhip", 0xFFFFEFD5, {
+			{ 255.f, 239.f, 213.f, 255.f, 0.f },
+			{ 1.f, 0.937254906f, 0.835294127f, 1.f, 0.f },
+			{ 235.666672f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.924183011f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.f, 0.0627450943f, 0.164705873f, 0.f, 1.f },
+			{ 37.1428604f, 0.0961810946f, 0.924183071f, 1.f, 0.f },
+			{ 37.1428604f, 0.164705873f, 1.f, 1.f, 0.f },
+			{ 37.1428604f, 1.f, 0.917647064f, 1.f, 0.f },
+			{ 37.1428604f, 0.164705873f, 0.943232954f, 1.f, 0.f },
+			{ 0.8410905f, 0.877980351f, 0.754515827f, 1.f, 0.f },
+			{ 0.340028703f, 0.354942203f, 0.877980351f, 1.f, 0.f },
+			{ 93.4978409f, 10.819006f, 100.f, 1.f, 0.f },
+			{ 95.0758362f, 1.27002597f, 14.5249367f, 1.f, 0.f },
+			{ 95.0758362f, 55.6954498f, 1.48358047f, 1.f, 0.f },
+			{ 93.4978409f, 100.f, 1.46302545f, 1.f, 0.f } } },
+		{ "PeachPuff", 0xFFFFDAB9, {
+			{ 255.f, 218.f, 185.f, 255.f, 0.f },
+			{ 1.f, 0.854901969f, 0.725490212f, 1.f, 0.f },
+			{ 219.333328f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.860130727f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.f, 0.145098031f, 0.274509788f, 0.f, 1.f },
+			{ 28.2857151f, 0.156535029f, 0.860130787f, 1.f, 0.f },
+			{ 28.2857151f, 0.274509788f, 1.f, 1.f, 0.f },
+			{ 28.2857151f, 1.f, 0.862745106f, 1.f, 0.f },
+			{ 28.2857151f, 0.274509788f, 0.876406252f, 1.f, 0.f },
+			{ 0.750619173f, 0.749070287f, 0.56392467f, 1.f, 0.f },
+			{ 0.363740087f, 0.362989515f, 0.749070287f, 1.f, 0.f },
+			{ 89.4219894f, 25.1995544f, 100.f, 1.f, 0.f },
+			{ 89.3494263f, 8.0840292f, 21.0213661f, 1.f, 0.f },
+			{ 89.3494263f, 58.7977333f, 1.20366859f, 1.f, 0.f },
+			{ 89.4219894f, 100.f, 1.3239404f, 1.f, 0.f } } },
+		{ "Peru", 0xFFCD853F, {
+			{ 205.f, 133.f, 63.f, 255.f, 0.f },
+			{ 0.80392158f, 0.521568656f, 0.247058824f, 1.f, 0.f },
+			{ 133.666672f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.524183035f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.f, 0.351219475f, 0.692682922f, 0.19607842f, 1.f },
+			{ 29.5774689f, 0.528678298f, 0.524183035f, 1.f, 0.f },
+			{ 29.5774689f, 0.692682922f, 0.80392158f, 1.f, 0.f },
+			{ 29.5774689f, 0.586776912f, 0.525490224f, 1.f, 0.f },
+			{ 29.5774689f, 0.556862772f, 0.561777234f, 1.f, 0.f },
+			{ 0.344593376f, 0.301146358f, 0.0869938433f, 1.f, 0.f },
+			{ 0.470284671f, 0.410990238f, 0.301146358f, 1.f, 0.f },
+			{ 65.3255386f, 60.5002289f, 100.f, 1.f, 0.f },
+			{ 61.753006f, 21.3938351f, 47.9158592f, 1.f, 0.f },
+			{ 61.753006f, 70.4980469f, 1.15086722f, 1.f, 0.f },
+			{ 65.3255386f, 100.f, 1.02670681f, 1.f, 0.f } } },
+		{ "Pink", 0xFFFFC0CB, {
+			{ 255.f, 192.f, 203.f, 255.f, 0.f },
+			{ 1.f, 0.752941191f, 0.796078444f, 1.f, 0.f },
+			{ 216.666672f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.849673212f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.f, 0.247058809f, 0.203921556f, 0.f, 1.f },
+			{ 349.523804f, 0.113846123f, 0.849673212f, 1.f, 0.f },
+			{ 349.523804f, 0.247058809f, 1.f, 1.f, 0.f },
+			{ 349.523804f, 0.999999762f, 0.876470566f, 1.f, 0.f },
+			{ 349.523804f, 0.247058809f, 0.808580399f, 1.f, 0.f },
+			{ 0.708619118f, 0.632721961f, 0.649665058f, 1.f, 0.f },
+			{ 0.355910063f, 0.317790061f, 0.632721961f, 1.f, 0.f },
+			{ 87.4178696f, 40.3356781f, 100.f, 1.f, 0.f },
+			{ 83.5853882f, 24.1428318f, 3.32413912f, 1.f, 0.f },
+			{ 83.5853882f, 59.5197678f, 0.136826083f, 1.f, 0.f },
+			{ 87.4178696f, 100.f, 1.18739951f, 1.f, 0.f } } },
+		{ "Plum", 0xFFDDA0DD, {
+			{ 221.f, 160.f, 221.f, 255.f, 0.f },
+			{ 0.866666675f, 0.627451003f, 0.866666675f, 1.f, 0.f },
+			{ 200.666672f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.786928117f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.f, 0.276018083f, 0.f, 0.133333325f, 1.f },
+			{ 300.f, 0.202657878f, 0.786928177f, 1.f, 0.f },
+			{ 300.f, 0.276018083f, 0.866666675f, 1.f, 0.f },
+			{ 300.f, 0.472868264f, 0.747058868f, 1.f, 0.f },
+			{ 300.f, 0.239215672f, 0.695579648f, 1.f, 0.f },
+			{ 0.554335237f, 0.457342386f, 0.742977023f, 1.f, 0.f },
+			{ 0.315922707f, 0.260645241f, 0.457342386f, 1.f, 0.f },
+			{ 79.290329f, 33.094635f, 100.f, 1.f, 0.f },
+			{ 73.3727493f, 32.5311737f, -21.9873199f, 1.f, 0.f },
+			{ 73.3727493f, 65.3377914f, 359.f, 1.f, 0.f },
+			{ 79.290329f, 100.f, 1.25119555f, 1.f, 0.f } } },
+		{ "PowderBlue", 0xFFB0E0E6, {
+			{ 176.f, 224.f, 230.f, 255.f, 0.f },
+			{ 0.690196097f, 0.87843138f, 0.90196079f, 1.f, 0.f },
+			{ 210.f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.823529422f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.234782591f, 0.0260869544f, 0.f, 0.0980392098f, 1.f },
+			{ 186.666672f, 0.161904752f, 0.823529422f, 1.f, 0.f },
+			{ 186.666672f, 0.234782591f, 0.90196079f, 1.f, 0.f },
+			{ 186.666672f, 0.519230783f, 0.796078444f, 1.f, 0.f },
+			{ 186.666672f, 0.211764693f, 0.840111375f, 1.f, 0.f },
+			{ 0.588362813f, 0.682536066f, 0.849191248f, 1.f, 0.f },
+			{ 0.277517855f, 0.321937293f, 0.682536066f, 1.f, 0.f },
+			{ 81.2015228f, -23.070015f, 100.f, 1.f, 0.f },
+			{ 86.1331024f, -14.0915213f, -8.00647736f, 1.f, 0.f },
+			{ 86.1331024f, 56.3309555f, 357.375092f, 1.f, 0.f },
+			{ 81.2015228f, 100.f, 1.79752958f, 1.f, 0.f } } },
+		{ "Purple", 0xFF800080, {
+			{ 128.f, 0.f, 128.f, 255.f, 0.f },
+			{ 0.501960814f, 0.f, 0.501960814f, 1.f, 0.f },
+			{ 85.3333359f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.334640533f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.f, 1.f, 0.f, 0.498039186f, 1.f },
+			{ 300.f, 1.f, 0.334640533f, 1.f, 0.f },
+			{ 300.f, 1.f, 0.501960814f, 1.f, 0.f },
+			{ 300.f, 1.f, 0.250980407f, 1.f, 0.f },
+			{ 300.f, 0.501960814f, 0.142958432f, 1.f, 0.f },
+			{ 0.127962142f, 0.0614771172f, 0.209298372f, 1.f, 0.f },
+			{ 0.320918143f, 0.154179364f, 0.0614771172f, 1.f, 0.f },
+			{ 42.4545708f, 59.1676979f, 67.1013184f, 1.f, 0.f },
+			{ 29.7821121f, 58.931694f, -36.4910431f, 1.f, 0.f },
+			{ 29.7821121f, 77.076088f, 359.f, 1.f, 0.f },
+			{ 42.4545708f, 94.7308655f, 0.848146737f, 1.f, 0.f } } },
+		{ "Red", 0xFFFF0000, {
+			{ 255.f, 0.f, 0.f, 255.f, 0.f },
+			{ 1.f, 0.f, 0.f, 1.f, 0.f },
+			{ 85.f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.333333343f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.f, 1.f, 1.f, 0.f, 1.f },
+			{ 0.f, 1.f, 0.333333343f, 1.f, 0.f },
+			{ 0.f, 1.f, 1.f, 1.f, 0.f },
+			{ 0.f, 1.f, 0.5f, 1.f, 0.f },
+			{ 0.f, 1.f, 0.212599993f, 1.f, 0.f },
+			{ 0.412368983f, 0.212627769f, 0.0193297975f, 1.f, 0.f },
+			{ 0.639999986f, 0.330000013f, 0.212627769f, 1.f, 0.f },
+			{ 70.3415833f, 100.f, 100.f, 1.f, 0.f },
+			{ 53.2359009f, 80.0961227f, 67.1979675f, 1.f, 0.f },
+			{ 53.2359009f, 90.8403168f, 0.698053598f, 1.f, 0.f },
+			{ 70.3415833f, 100.f, 0.785398185f, 1.f, 0.f } } },
+		{ "RosyBrown", 0xFFBC8F8F, {
+			{ 188.f, 143.f, 143.f, 255.f, 0.f },
+			{ 0.737254918f, 0.56078434f, 0.56078434f, 1.f, 0.f },
+			{ 158.f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.619607866f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.f, 0.239361688f, 0.239361688f, 0.262745082f, 1.f },
+			{ 0.f, 0.0949367285f, 0.619607866f, 1.f, 0.f },
+			{ 0.f, 0.239361688f, 0.737254918f, 1.f, 0.f },
+			{ 0.f, 0.251396626f, 0.649019599f, 1.f, 0.f },
+			{ 0.f, 0.176470578f, 0.598302007f, 1.f, 0.f },
+			{ 0.35515976f, 0.323200971f, 0.30347997f, 1.f, 0.f },
+			{ 0.361728519f, 0.329178631f, 0.323200971f, 1.f, 0.f },
+			{ 66.1484222f, 29.707243f, 100.f, 1.f, 0.f },
+			{ 63.6065598f, 17.01194f, 6.6083312f, 1.f, 0.f },
+			{ 63.6065598f, 57.1290512f, 0.370512187f, 1.f, 0.f },
+			{ 66.1484222f, 100.f, 1.28202748f, 1.f, 0.f } } },
+		{ "RoyalBlue", 0xFF4169E1, {
+			{ 65.f, 105.f, 225.f, 255.f, 0.f },
+			{ 0.254901975f, 0.411764711f, 0.882352948f, 1.f, 0.f },
+			{ 131.666672f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.516339898f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.711111069f, 0.533333302f, 0.f, 0.117647052f, 1.f },
+			{ 225.f, 0.50632906f, 0.516339839f, 1.f, 0.f },
+			{ 225.f, 0.711111069f, 0.882352948f, 1.f, 0.f },
+			{ 225.f, 0.727272749f, 0.568627477f, 1.f, 0.f },
+			{ 225.f, 0.627450943f, 0.412392169f, 1.f, 0.f },
+			{ 0.20816803f, 0.166612804f, 0.733359039f, 1.f, 0.f },
+			{ 0.187853575f, 0.150353581f, 0.166612804f, 1.f, 0.f },
+			{ 52.7484055f, -19.304203f, 66.7958984f, 1.f, 0.f },
+			{ 47.8303833f, 26.2662468f, -65.2627945f, 1.f, 0.f },
+			{ 47.8303833f, 77.480545f, 358.811829f, 1.f, 0.f },
+			{ 52.7484055f, 84.7647247f, 1.85213363f, 1.f, 0.f } } },
+		{ "SaddleBrown", 0xFF8B4513, {
+			{ 139.f, 69.f, 19.f, 255.f, 0.f },
+			{ 0.545098066f, 0.270588249f, 0.0745098069f, 1.f, 0.f },
+			{ 75.6666641f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.296732008f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.f, 0.503597081f, 0.863309383f, 0.454901934f, 1.f },
+			{ 25.0000019f, 0.748898685f, 0.296732038f, 1.f, 0.f },
+			{ 25.0000019f, 0.863309383f, 0.545098066f, 1.f, 0.f },
+			{ 25.0000019f, 0.759493709f, 0.309803933f, 1.f, 0.f },
+			{ 25.0000019f, 0.470588267f, 0.314792186f, 1.f, 0.f },
+			{ 0.128922835f, 0.0979292765f, 0.0182726048f, 1.f, 0.f },
+			{ 0.525947869f, 0.39950794f, 0.0979292765f, 1.f, 0.f },
+			{ 42.6004944f, 63.2483025f, 100.f, 1.f, 0.f },
+			{ 37.4681892f, 26.4417534f, 40.9813271f, 1.f, 0.f },
+			{ 37.4681892f, 69.0512695f, 0.997792482f, 1.f, 0.f },
+			{ 42.6004944f, 100.f, 1.00683403f, 1.f, 0.f } } },
+		{ "Salmon", 0xFFFA8072, {
+			{ 250.f, 128.f, 114.f, 255.f, 0.f },
+			{ 0.980392158f, 0.501960814f, 0.447058827f, 1.f, 0.f },
+			{ 164.f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.643137276f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.f, 0.487999976f, 0.54400003f, 0.019607842f, 1.f },
+			{ 6.17647362f, 0.304878056f, 0.643137276f, 1.f, 0.f },
+			{ 6.17647362f, 0.54399997f, 0.980392158f, 1.f, 0.f },
+			{ 6.17647362f, 0.931506872f, 0.713725507f, 1.f, 0.f },
+			{ 6.17647362f, 0.533333302f, 0.599711359f, 1.f, 0.f },
+			{ 0.501766562f, 0.369794339f, 0.204110727f, 1.f, 0.f },
+			{ 0.466468126f, 0.343779922f, 0.369794339f, 1.f, 0.f },
+			{ 76.1775665f, 100.f, 100.f, 1.f, 0.f },
+			{ 67.2615967f, 45.2258301f, 29.0903931f, 1.f, 0.f },
+			{ 67.2615967f, 71.0054092f, 0.571597874f, 1.f, 0.f },
+			{ 76.1775665f, 100.f, 0.785398185f, 1.f, 0.f } } },
+		{ "SandyBrown", 0xFFF4A460, {
+			{ 244.f, 164.f, 96.f, 255.f, 0.f },
+			{ 0.956862748f, 0.643137276f, 0.376470596f, 1.f, 0.f },
+			{ 168.f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.65882355f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.f, 0.327868819f, 0.606557429f, 0.0431372523f, 1.f },
+			{ 27.5675716f, 0.428571463f, 0.65882355f, 1.f, 0.f },
+			{ 27.5675716f, 0.60655731f, 0.956862748f, 1.f, 0.f },
+			{ 27.5675716f, 0.870588243f, 0.666666687f, 1.f, 0.f },
+			{ 27.5675716f, 0.580392122f, 0.690581918f, 1.f, 0.f },
+			{ 0.52691406f, 0.466307342f, 0.172892183f, 1.f, 0.f },
+			{ 0.451854825f, 0.399881572f, 0.466307342f, 1.f, 0.f },
+			{ 77.6924438f, 64.9560852f, 100.f, 1.f, 0.f },
+			{ 73.9529419f, 23.0251541f, 46.7886314f, 1.f, 0.f },
+			{ 73.9529419f, 70.3700104f, 1.11348057f, 1.f, 0.f },
+			{ 77.6924438f, 100.f, 0.994729877f, 1.f, 0.f } } },
+		{ "SeaGreen", 0xFF2E8B57, {
+			{ 46.f, 139.f, 87.f, 255.f, 0.f },
+			{ 0.180392161f, 0.545098066f, 0.34117648f, 1.f, 0.f },
+			{ 90.6666641f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.355555534f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.66906476f, 0.f, 0.374100685f, 0.454901934f, 1.f },
+			{ 146.451614f, 0.492647052f, 0.355555564f, 1.f, 0.f },
+			{ 146.451614f, 0.66906476f, 0.545098066f, 1.f, 0.f },
+			{ 146.451614f, 0.502702773f, 0.362745106f, 1.f, 0.f },
+			{ 146.451614f, 0.36470592f, 0.452838421f, 1.f, 0.f },
+			{ 0.120788909f, 0.197340116f, 0.121871352f, 1.f, 0.f },
+			{ 0.27452001f, 0.448499858f, 0.197340116f, 1.f, 0.f },
+			{ 41.3412285f, -30.9776745f, 100.f, 1.f, 0.f },
+			{ 51.5351334f, -39.7123108f, 20.0537682f, 1.f, 0.f },
+			{ 51.5351334f, 67.3782959f, 2.67397213f, 1.f, 0.f },
+			{ 41.3412285f, 100.f, 1.8711983f, 1.f, 0.f } } },
+		{ "SeaShell", 0xFFFFF5EE, {
+			{ 255.f, 245.f, 238.f, 255.f, 0.f },
+			{ 1.f, 0.960784316f, 0.933333337f, 1.f, 0.f },
+			{ 246.f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.964705884f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.f, 0.0392156839f, 0.0666666627f, 0.f, 1.f },
+			{ 24.705883f, 0.0325202942f, 0.964705884f, 1.f, 0.f },
+			{ 24.705883f, 0.0666666627f, 1.f, 1.f, 0.f },
+			{ 24.705883f, 1.f, 0.966666698f, 1.f, 0.f },
+			{ 24.705883f, 0.0666666627f, 0.967139602f, 1.f, 0.f },
+			{ 0.893160284f, 0.927382708f, 0.940645218f, 1.f, 0.f },
+			{ 0.32346952f, 0.33586362f, 0.927382708f, 1.f, 0.f },
+			{ 95.7123337f, 6.05524349f, 100.f, 1.f, 0.f },
+			{ 97.1212845f, 2.16189027f, 4.55383062f, 1.f, 0.f },
+			{ 97.1212845f, 51.9691162f, 1.1275593f, 1.f, 0.f },
+			{ 95.7123337f, 100.f, 1.51031768f, 1.f, 0.f } } },
+		{ "Sienna", 0xFFA0522D, {
+			{ 160.f, 82.f, 45.f, 255.f, 0.f },
+			{ 0.627451003f, 0.321568638f, 0.176470593f, 1.f, 0.f },
+			{ 95.6666641f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.375163376f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.f, 0.487500042f, 0.71875f, 0.372548997f, 1.f },
+			{ 19.3043461f, 0.529616773f, 0.375163436f, 1.f, 0.f },
+			{ 19.3043461f, 0.71875f, 0.627451003f, 1.f, 0.f },
+			{ 19.3043461f, 0.560975671f, 0.40196079f, 1.f, 0.f },
+			{ 19.3043461f, 0.450980425f, 0.37612316f, 1.f, 0.f },
+			{ 0.179868832f, 0.136985362f, 0.0417889468f, 1.f, 0.f },
+			{ 0.501525939f, 0.381954521f, 0.136985362f, 1.f, 0.f },
+			{ 49.4801941f, 68.8484573f, 100.f, 1.f, 0.f },
+			{ 43.7974548f, 29.3214912f, 35.6357346f, 1.f, 0.f },
+			{ 43.7974548f, 68.0266418f, 0.8822999f, 1.f, 0.f },
+			{ 49.4801941f, 100.f, 0.967840731f, 1.f, 0.f } } },
+		{ "Silver", 0xFFC0C0C0, {
+			{ 192.f, 192.f, 192.f, 255.f, 0.f },
+			{ 0.752941191f, 0.752941191f, 0.752941191f, 1.f, 0.f },
+			{ 192.f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.752941191f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.f, 0.f, 0.f, 0.247058809f, 1.f },
+			{ 0.f, 0.f, 0.752941191f, 1.f, 0.f },
+			{ 0.f, 0.f, 0.752941191f, 1.f, 0.f },
+			{ 0.f, 0.f, 0.752941191f, 1.f, 0.f },
+			{ 0.f, 0.f, 0.752941191f, 1.f, 0.f },
+			{ 0.500970304f, 0.527115285f, 0.573923051f, 1.f, 0.f },
+			{ 0.312713861f, 0.329034001f, 0.527115285f, 1.f, 0.f },
+			{ 76.1287766f, -1.47472929e-05f, 100.f, 1.f, 0.f },
+			{ 77.7043686f, 0.f, 0.f, 1.f, 0.f },
+			{ 77.7043686f, 50.f, 0.f, 1.f, 0.f },
+			{ 76.1287766f, 100.f, 1.57079649f, 1.f, 0.f } } },
+		{ "SkyBlue", 0xFF87CEEB, {
+			{ 135.f, 206.f, 235.f, 255.f, 0.f },
+			{ 0.529411793f, 0.807843149f, 0.921568632f, 1.f, 0.f },
+			{ 192.f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.752941191f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.425531894f, 0.12340425f, 0.f, 0.0784313679f, 1.f },
+			{ 197.399994f, 0.296875f, 0.752941191f, 1.f, 0.f },
+			{ 197.399994f, 0.425531894f, 0.921568632f, 1.f, 0.f },
+			{ 197.399994f, 0.714285731f, 0.725490212f, 1.f, 0.f },
+			{ 197.399994f, 0.392156839f, 0.756859601f, 1.f, 0.f },
+			{ 0.470519006f, 0.552900434f, 0.867710173f, 1.f, 0.f },
+			{ 0.248803169f, 0.292365193f, 0.552900434f, 1.f, 0.f },
+			{ 74.2229538f, -31.1232662f, 100.f, 1.f, 0.f },
+			{ 79.208046f, -14.8366089f, -21.2748642f, 1.f, 0.f },
+			{ 79.208046f, 60.1317635f, 357.820251f, 1.f, 0.f },
+			{ 74.2229538f, 100.f, 1.87252617f, 1.f, 0.f } } },
+		{ "SlateBlue", 0xFF6A5ACD, {
+			{ 106.f, 90.f, 205.f, 255.f, 0.f },
+			{ 0.41568628f, 0.352941185f, 0.80392158f, 1.f, 0.f },
+			{ 133.666672f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.524183035f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.482926875f, 0.560975671f, 0.f, 0.19607842f, 1.f },
+			{ 248.347839f, 0.326683283f, 0.524183035f, 1.f, 0.f },
+			{ 248.347839f, 0.560975611f, 0.80392158f, 1.f, 0.f },
+			{ 248.347839f, 0.534883738f, 0.578431368f, 1.f, 0.f },
+			{ 248.347839f, 0.450980395f, 0.39884156f, 1.f, 0.f },
+			{ 0.206148133f, 0.14782995f, 0.595108986f, 1.f, 0.f },
+			{ 0.217206761f, 0.155760154f, 0.14782995f, 1.f, 0.f },
+			{ 52.525322f, -1.30531347f, 73.7152328f, 1.f, 0.f },
+			{ 45.3355331f, 36.0418854f, -57.772316f, 1.f, 0.f },
+			{ 45.3355331f, 76.5988312f, 358.986969f, 1.f, 0.f },
+			{ 52.525322f, 86.8633881f, 1.58850193f, 1.f, 0.f } } },
+		{ "SlateGray", 0xFF708090, {
+			{ 112.f, 128.f, 144.f, 255.f, 0.f },
+			{ 0.43921569f, 0.501960814f, 0.564705908f, 1.f, 0.f },
+			{ 128.f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.501960814f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.222222298f, 0.111111097f, 0.f, 0.435294092f, 1.f },
+			{ 210.f, 0.12500006f, 0.501960814f, 1.f, 0.f },
+			{ 210.f, 0.222222254f, 0.564705908f, 1.f, 0.f },
+			{ 210.f, 0.125984281f, 0.501960814f, 1.f, 0.f },
+			{ 210.f, 0.125490218f, 0.493151426f, 1.f, 0.f },
+			{ 0.194328815f, 0.208963841f, 0.293887556f, 1.f, 0.f },
+			{ 0.278735399f, 0.299727142f, 0.208963841f, 1.f, 0.f },
+			{ 51.1898575f, -8.79158688f, 100.f, 1.f, 0.f },
+			{ 52.835907f, -2.14210153f, -10.5705147f, 1.f, 0.f },
+			{ 52.835907f, 54.2130394f, 358.229248f, 1.f, 0.f },
+			{ 51.1898575f, 100.f, 1.65848672f, 1.f, 0.f } } },
+		{ "Snow", 0xFFFFFAFA, {
+			{ 255.f, 250.f, 250.f, 255.f, 0.f },
+			{ 1.f, 0.980392158f, 0.980392158f, 1.f, 0.f },
+			{ 251.666672f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.986928105f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.f, 0.019607842f, 0.019607842f, 0.f, 1.f },
+			{ 0.f, 0.00662255287f, 0.986928165f, 1.f, 0.f },
+			{ 0.f, 0.019607842f, 1.f, 1.f, 0.f },
+			{ 0.f, 1.f, 0.990196109f, 1.f, 0.f },
+			{ 0.f, 0.019607842f, 0.984560788f, 1.f, 0.f },
+			{ 0.926712334f, 0.965334773f, 1.04171491f, 1.f, 0.f },
+			{ 0.315878481f, 0.329043299f, 0.965334773f, 1.f, 0.f },
+			{ 97.0940247f, 2.77522445f, 100.f, 1.f, 0.f },
+			{ 98.6438217f, 1.65662169f, 0.587332249f, 1.f, 0.f },
+			{ 98.6438217f, 50.6865845f, 0.340710193f, 1.f, 0.f },
+			{ 97.0940247f, 100.f, 1.54305124f, 1.f, 0.f } } },
+		{ "SpringGreen", 0xFF00FF7F, {
+			{ 0.f, 255.f, 127.f, 255.f, 0.f },
+			{ 0.f, 1.f, 0.498039216f, 1.f, 0.f },
+			{ 127.333336f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.499346405f, 1.f, 0.f, 0.f, 0.f },
+			{ 1.f, 0.f, 0.501960754f, 0.f, 1.f },
+			{ 149.882355f, 1.f, 0.499346405f, 1.f, 0.f },
+			{ 149.882355f, 1.f, 1.f, 1.f, 0.f },
+			{ 149.882355f, 1.f, 0.5f, 1.f, 0.f },
+			{ 149.882355f, 1.f, 0.751158416f, 1.f, 0.f },
+			{ 0.395892918f, 0.73051703f, 0.320876479f, 1.f, 0.f },
+			{ 0.27354151f, 0.504749417f, 0.73051703f, 1.f, 0.f },
+			{ 69.1759949f, -62.2769394f, 100.f, 1.f, 0.f },
+			{ 88.4723663f, -76.8952103f, 47.0303307f, 1.f, 0.f },
+			{ 88.4723663f, 85.2098694f, 2.59267592f, 1.f, 0.f },
+			{ 69.1759949f, 100.f, 2.12778997f, 1.f, 0.f } } },
+		{ "SteelBlue", 0xFF4682B4, {
+			{ 70.f, 130.f, 180.f, 255.f, 0.f },
+			{ 0.274509817f, 0.509803951f, 0.70588237f, 1.f, 0.f },
+			{ 126.666664f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.496732026f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.611111164f, 0.277777761f, 0.f, 0.29411763f, 1.f },
+			{ 207.272736f, 0.447368443f, 0.496732086f, 1.f, 0.f },
+			{ 207.272736f, 0.611111104f, 0.70588237f, 1.f, 0.f },
+			{ 207.272736f, 0.439999968f, 0.490196109f, 1.f, 0.f },
+			{ 207.272736f, 0.431372553f, 0.473937273f, 1.f, 0.f },
+			{ 0.187433019f, 0.20561552f, 0.461506486f, 1.f, 0.f },
+			{ 0.219334066f, 0.24061121f, 0.20561552f, 1.f, 0.f },
+			{ 50.3855133f, -24.1099129f, 100.f, 1.f, 0.f },
+			{ 52.4662628f, -4.07507992f, -32.1904411f, 1.f, 0.f },
+			{ 52.4662628f, 62.6747475f, 358.303284f, 1.f, 0.f },
+			{ 50.3855133f, 100.f, 1.80738032f, 1.f, 0.f } } },
+		{ "Tan", 0xFFD2B48C, {
+			{ 210.f, 180.f, 140.f, 255.f, 0.f },
+			{ 0.823529422f, 0.70588237f, 0.549019635f, 1.f, 0.f },
+			{ 176.666672f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.692810476f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.f, 0.142857134f, 0.333333313f, 0.176470578f, 1.f },
+			{ 34.285717f, 0.207547128f, 0.692810476f, 1.f, 0.f },
+			{ 34.285717f, 0.333333313f, 0.823529422f, 1.f, 0.f },
+			{ 34.285717f, 0.4375f, 0.686274529f, 1.f, 0.f },
+			{ 34.285717f, 0.274509788f, 0.71956861f, 1.f, 0.f },
+			{ 0.47629419f, 0.482386678f, 0.316070884f, 1.f, 0.f },
+			{ 0.373636812f, 0.378416151f, 0.482386678f, 1.f, 0.f },
+			{ 74.5905914f, 21.4906082f, 100.f, 1.f, 0.f },
+			{ 74.9752121f, 5.020082f, 24.4271507f, 1.f, 0.f },
+			{ 74.9752121f, 59.741272f, 1.36810601f, 1.f, 0.f },
+			{ 74.5905914f, 100.f, 1.35910988f, 1.f, 0.f } } },
+		{ "Teal", 0xFF008080, {
+			{ 0.f, 128.f, 128.f, 255.f, 0.f },
+			{ 0.f, 0.501960814f, 0.501960814f, 1.f, 0.f },
+			{ 85.3333359f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.334640533f, 1.f, 0.f, 0.f, 0.f },
+			{ 1.f, 0.f, 0.f, 0.498039186f, 1.f },
+			{ 180.f, 1.f, 0.334640533f, 1.f, 0.f },
+			{ 180.f, 1.f, 0.501960814f, 1.f, 0.f },
+			{ 180.f, 1.f, 0.250980407f, 1.f, 0.f },
+			{ 180.f, 0.501960814f, 0.395243943f, 1.f, 0.f },
+			{ 0.116139658f, 0.1699626f, 0.230856404f, 1.f, 0.f },
+			{ 0.224659473f, 0.328774065f, 0.1699626f, 1.f, 0.f },
+			{ 40.5958786f, -31.3951817f, 100.f, 1.f, 0.f },
+			{ 48.2553253f, -28.8428364f, -8.47489834f, 1.f, 0.f },
+			{ 48.2553253f, 61.7430267f, 357.144196f, 1.f, 0.f },
+			{ 40.5958786f, 100.f, 1.87500322f, 1.f, 0.f } } },
+		{ "Thistle", 0xFFD8BFD8, {
+			{ 216.f, 191.f, 216.f, 255.f, 0.f },
+			{ 0.847058833f, 0.749019623f, 0.847058833f, 1.f, 0.f },
+			{ 207.666672f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.814379096f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.f, 0.115740731f, 0.f, 0.152941167f, 1.f },
+			{ 300.f, 0.0802567601f, 0.814379036f, 1.f, 0.f },
+			{ 300.f, 0.115740731f, 0.847058833f, 1.f, 0.f },
+			{ 300.f, 0.242718413f, 0.798039198f, 1.f, 0.f },
+			{ 300.f, 0.0980392098f, 0.77694118f, 1.f, 0.f },
+			{ 0.593375206f, 0.568184197f, 0.727912903f, 1.f, 0.f },
+			{ 0.314042836f, 0.300710529f, 0.568184197f, 1.f, 0.f },
+			{ 81.4767685f, 12.9430943f, 100.f, 1.f, 0.f },
+			{ 80.0773544f, 13.2175388f, -9.22950554f, 1.f, 0.f },
+			{ 80.0773544f, 56.2972717f, 359.f, 1.f, 0.f },
+			{ 81.4767685f, 100.f, 1.44208097f, 1.f, 0.f } } },
+		{ "Tomato", 0xFFFF6347, {
+			{ 255.f, 99.f, 71.f, 255.f, 0.f },
+			{ 1.f, 0.388235301f, 0.278431386f, 1.f, 0.f },
+			{ 141.666672f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.555555582f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.f, 0.611764669f, 0.721568584f, 0.f, 1.f },
+			{ 9.13043404f, 0.498823524f, 0.555555582f, 1.f, 0.f },
+			{ 9.13043404f, 0.721568584f, 1.f, 1.f, 0.f },
+			{ 9.13043404f, 1.f, 0.639215708f, 1.f, 0.f },
+			{ 9.13043404f, 0.721568584f, 0.510368645f, 1.f, 0.f },
+			{ 0.468356341f, 0.30641216f, 0.0940791443f, 1.f, 0.f },
+			{ 0.539054632f, 0.352665007f, 0.30641216f, 1.f, 0.f },
+			{ 74.0845108f, 100.f, 100.f, 1.f, 0.f },
+			{ 62.2035828f, 57.8515244f, 46.414875f, 1.f, 0.f },
+			{ 62.2035828f, 78.9725342f, 0.676148117f, 1.f, 0.f },
+			{ 74.0845108f, 100.f, 0.785398185f, 1.f, 0.f } } },
+		{ "Transparent", 0x00FFFFFF, {
+			{ 255.f, 255.f, 255.f, 0.f, 0.f },
+			{ 1.f, 1.f, 1.f, 0.f, 0.f },
+			{ 255.f, 0.f, 0.f, 0.f, 0.f },
+			{ 1.f, 0.f, 0.f, 0.f, 0.f },
+			{ 0.f, 0.f, 0.f, 0.f, 0.f },
+			{ 0.f, 0.f, 1.f, 0.f, 0.f },
+			{ 0.f, 0.f, 1.f, 0.f, 0.f },
+			{ 0.f, 0.f, 1.f, 0.f, 0.f },
+			{ 0.f, 0.f, 1.f, 0.f, 0.f },
+			{ 0.950399935f, 1.f, 1.08879995f, 0.f, 0.f },
+			{ 0.312713861f, 0.329033971f, 1.f, 0.f, 0.f },
+			{ 98.0495224f, -1.89936727e-05f, 100.f, 0.f, 0.f },
+			{ 100.f, 0.f, 0.f, 0.f, 0.f },
+			{ 100.f, 50.f, 0.f, 0.f, 0.f },
+			{ 98.0495224f, 100.f, 1.57079649f, 0.f, 0.f } } },
+		{ "Turquoise", 0xFF40E0D0, {
+			{ 64.f, 224.f, 208.f, 255.f, 0.f },
+			{ 0.250980407f, 0.87843138f, 0.815686285f, 1.f, 0.f },
+			{ 165.333328f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.648365974f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.714285731f, 0.f, 0.0714285672f, 0.12156862f, 1.f },
+			{ 174.f, 0.612903237f, 0.648366034f, 1.f, 0.f },
+			{ 174.f, 0.714285672f, 0.87843138f, 1.f, 0.f },
+			{ 174.f, 0.720720708f, 0.564705908f, 1.f, 0.f },
+			{ 174.f, 0.627450943f, 0.740505099f, 1.f, 0.f },
+			{ 0.401506662f, 0.58953768f, 0.689232945f, 1.f, 0.f },
+			{ 0.238952607f, 0.350857377f, 0.58953768f, 1.f, 0.f },
+			{ 69.5767059f, -50.5205193f, 100.f, 1.f, 0.f },
+			{ 81.2661743f, -44.0773087f, -4.02566195f, 1.f, 0.f },
+			{ 81.2661743f, 67.28936f, 356.949493f, 1.f, 0.f },
+			{ 69.5767059f, 100.f, 2.03859949f, 1.f, 0.f } } },
+		{ "Violet", 0xFFEE82EE, {
+			{ 238.f, 130.f, 238.f, 255.f, 0.f },
+			{ 0.933333337f, 0.509803951f, 0.933333337f, 1.f, 0.f },
+			{ 202.f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.792156875f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.f, 0.453781486f, 0.f, 0.0666666627f, 1.f },
+			{ 300.f, 0.356435597f, 0.792156875f, 1.f, 0.f },
+			{ 300.f, 0.453781486f, 0.933333337f, 1.f, 0.f },
+			{ 300.f, 0.760563374f, 0.721568644f, 1.f, 0.f },
+			{ 300.f, 0.423529387f, 0.630425155f, 1.f, 0.f },
+			{ 0.586665988f, 0.403154671f, 0.855609715f, 1.f, 0.f },
+			{ 0.317901999f, 0.218461052f, 0.403154671f, 1.f, 0.f },
+			{ 81.1079865f, 60.3357964f, 100.f, 1.f, 0.f },
+			{ 69.6936264f, 56.3582191f, -36.8130569f, 1.f, 0.f },
+			{ 69.6936264f, 76.2953262f, 359.f, 1.f, 0.f },
+			{ 81.1079865f, 100.f, 1.02791142f, 1.f, 0.f } } },
+		{ "Wheat", 0xFFF5DEB3, {
+			{ 245.f, 222.f, 179.f, 255.f, 0.f },
+			{ 0.960784316f, 0.870588243f, 0.701960802f, 1.f, 0.f },
+			{ 215.333328f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.844444454f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.f, 0.0938775465f, 0.269387752f, 0.0392156839f, 1.f },
+			{ 39.0909081f, 0.168730617f, 0.844444454f, 1.f, 0.f },
+			{ 39.0909081f, 0.269387752f, 0.960784316f, 1.f, 0.f },
+			{ 39.0909081f, 0.767441869f, 0.831372559f, 1.f, 0.f },
+			{ 39.0909081f, 0.258823514f, 0.877589047f, 1.f, 0.f },
+			{ 0.719082117f, 0.749109924f, 0.53308928f, 1.f, 0.f },
+			{ 0.359310865f, 0.374315172f, 0.749109924f, 1.f, 0.f },
+			{ 87.9243851f, 16.425148f, 100.f, 1.f, 0.f },
+			{ 89.3512878f, 1.5104413f, 24.0070934f, 1.f, 0.f },
+			{ 89.3512878f, 59.3963165f, 1.5079627f, 1.f, 0.f },
+			{ 87.9243851f, 100.f, 1.40799844f, 1.f, 0.f } } },
+		{ "White", 0xFFFFFFFF, {
+			{ 255.f, 255.f, 255.f, 255.f, 0.f },
+			{ 1.f, 1.f, 1.f, 1.f, 0.f },
+			{ 255.f, 255.f, 0.f, 0.f, 0.f },
+			{ 1.f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.f, 0.f, 0.f, 0.f, 1.f },
+			{ 0.f, 0.f, 1.f, 1.f, 0.f },
+			{ 0.f, 0.f, 1.f, 1.f, 0.f },
+			{ 0.f, 0.f, 1.f, 1.f, 0.f },
+			{ 0.f, 0.f, 1.f, 1.f, 0.f },
+			{ 0.950399935f, 1.f, 1.08879995f, 1.f, 0.f },
+			{ 0.312713861f, 0.329033971f, 1.f, 1.f, 0.f },
+			{ 98.0495224f, -1.89936727e-05f, 100.f, 1.f, 0.f },
+			{ 100.f, 0.f, 0.f, 1.f, 0.f },
+			{ 100.f, 50.f, 0.f, 1.f, 0.f },
+			{ 98.0495224f, 100.f, 1.57079649f, 1.f, 0.f } } },
+		{ "WhiteSmoke", 0xFFF5F5F5, {
+			{ 245.f, 245.f, 245.f, 255.f, 0.f },
+			{ 0.960784316f, 0.960784316f, 0.960784316f, 1.f, 0.f },
+			{ 245.f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.960784316f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.f, 0.f, 0.f, 0.0392156839f, 1.f },
+			{ 0.f, 0.f, 0.960784316f, 1.f, 0.f },
+			{ 0.f, 0.f, 0.960784316f, 1.f, 0.f },
+			{ 0.f, 0.f, 0.960784316f, 1.f, 0.f },
+			{ 0.f, 0.f, 0.960784316f, 1.f, 0.f },
+			{ 0.867808938f, 0.913098752f, 0.994181812f, 1.f, 0.f },
+			{ 0.312713861f, 0.329033971f, 0.913098752f, 1.f, 0.f },
+			{ 94.6452255f, -3.6668418e-05f, 100.f, 1.f, 0.f },
+			{ 96.5374985f, -2.98023224e-05f, 1.1920929e-05f, 1.f, 0.f },
+			{ 96.5374985f, 50.0000114f, 2.76108623f, 1.f, 0.f },
+			{ 94.6452255f, 100.f, 1.57079661f, 1.f, 0.f } } },
+		{ "Yellow", 0xFFFFFF00, {
+			{ 255.f, 255.f, 0.f, 255.f, 0.f },
+			{ 1.f, 1.f, 0.f, 1.f, 0.f },
+			{ 170.f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.666666687f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.f, 0.f, 1.f, 0.f, 1.f },
+			{ 60.f, 1.f, 0.666666687f, 1.f, 0.f },
+			{ 60.f, 1.f, 1.f, 1.f, 0.f },
+			{ 60.f, 1.f, 0.5f, 1.f, 0.f },
+			{ 60.f, 1.f, 0.9278f, 1.f, 0.f },
+			{ 0.769968867f, 0.927827597f, 0.138529718f, 1.f, 0.f },
+			{ 0.41929853f, 0.505262971f, 0.927827597f, 1.f, 0.f },
+			{ 90.3201828f, 7.16032457f, 100.f, 1.f, 0.f },
+			{ 97.1393738f, -21.555603f, 94.4763031f, 1.f, 0.f },
+			{ 97.1393738f, 87.8531799f, 1.79511535f, 1.f, 0.f },
+			{ 90.3201828f, 100.f, 1.49931502f, 1.f, 0.f } } },
+		{ "YellowGreen", 0xFF9ACD32, {
+			{ 154.f, 205.f, 50.f, 255.f, 0.f },
+			{ 0.603921592f, 0.80392158f, 0.196078435f, 1.f, 0.f },
+			{ 136.333328f, 255.f, 0.f, 0.f, 0.f },
+			{ 0.534640491f, 1.f, 0.f, 0.f, 0.f },
+			{ 0.248780474f, 0.f, 0.756097555f, 0.19607842f, 1.f },
+			{ 79.7419281f, 0.633251786f, 0.534640491f, 1.f, 0.f },
+			{ 79.7419281f, 0.756097555f, 0.80392158f, 1.f, 0.f },
+			{ 79.7419281f, 0.607843161f, 0.5f, 1.f, 0.f },
+			{ 79.7419281f, 0.607843161f, 0.71751529f, 1.f, 0.f },
+			{ 0.357322484f, 0.50763756f, 0.109327175f, 1.f, 0.f },
+			{ 0.366752684f, 0.521034777f, 0.50763756f, 1.f, 0.f },
+			{ 66.3148346f, -22.0872803f, 100.f, 1.f, 0.f },
+			{ 76.5356827f, -37.9874725f, 66.5855865f, 1.f, 0.f },
+			{ 76.5356827f, 79.9451447f, 2.08924675f, 1.f, 0.f },
+			{ 66.3148346f, 100.f, 1.78817892f, 1.f, 0.f } } },
+	};
+
+	const size_t g_bucket_count = 64;
+	const size_t g_slot_count = 256;
+	const uint8_t g_empty_slot = 255;
+
+	// Seeds per bucket and color index per slot of the perfect hashes of the lower case names and of the hex codes.
+	constexpr uint8_t g_name_seeds[g_bucket_count] =
+	{
+		5, 1, 1, 2, 0, 0, 1, 1, 1, 3, 1, 0, 0, 0, 3, 1,
+		1, 0, 1, 1, 2, 1, 1, 1, 0, 1, 2, 3, 1, 1, 3, 1,
+		1, 1, 1, 1, 2, 1, 1, 0, 4, 1, 1, 1, 1, 2, 0, 6,
+		1, 1, 2, 8, 1, 2, 3, 6, 1, 6, 2, 1, 2, 1, 2, 1,
+	};
+
+	constexpr uint8_t g_name_slots[g_slot_count] =
+	{
+		74, 255, 255, 116, 63, 255, 255, 29, 255, 122, 255, 92, 48, 255, 96, 82,
+		112, 255, 255, 78, 45, 255, 255, 255, 255, 16, 6, 255, 60, 0, 24, 255,
+		255, 120, 255, 87, 255, 255, 108, 255, 255, 255, 255, 255, 255, 255, 117, 81,
+		22, 255, 97, 255, 255, 35, 255, 255, 255, 40, 44, 99, 89, 138, 255, 255,
+		32, 107, 10, 255, 255, 255, 11, 88, 19, 255, 255, 71, 111, 123, 95, 67,
+		139, 104, 255, 50, 20, 255, 70, 255, 255, 85, 51, 255, 255, 255, 77, 106,
+		255, 12, 38, 255, 8, 93, 33, 255, 34, 255, 80, 135, 126, 255, 255, 255,
+		255, 3, 255, 255, 91, 255, 255, 131, 43, 124, 105, 255, 25, 255, 84, 255,
+		73, 28, 255, 26, 54, 255, 129, 255, 133, 42, 255, 76, 255, 13, 27, 56,
+		21, 255, 255, 255, 255, 132, 255, 17, 255, 255, 52, 49, 255, 61, 37, 4,
+		255, 55, 255, 255, 125, 41, 255, 137, 101, 31, 255, 2, 59, 47, 255, 18,
+		255, 255, 5, 90, 110, 136, 255, 69, 255, 94, 65, 128, 127, 255, 255, 255,
+		79, 9, 7, 118, 66, 255, 58, 255, 255, 64, 255, 255, 1, 255, 62, 36,
+		255, 57, 100, 255, 255, 121, 255, 15, 39, 115, 114, 103, 86, 255, 140, 119,
+		255, 255, 255, 134, 255, 75, 83, 255, 98, 130, 255, 255, 255, 14, 72, 255,
+		255, 255, 255, 113, 30, 255, 53, 102, 109, 255, 23, 255, 255, 255, 46, 68,
+	};
+
+	constexpr uint8_t g_argb_seeds[g_bucket_count] =
+	{
+		1, 1, 1, 0, 1, 2, 0, 3, 1, 4, 2, 3, 0, 4, 1, 1,
+		6, 1, 1, 2, 1, 2, 4, 3, 0, 2, 3, 1, 3, 1, 2, 6,
+		1, 1, 3, 1, 3, 5, 2, 1, 5, 0, 4, 10, 2, 1, 0, 1,
+		1, 2, 1, 1, 1, 1, 1, 3, 1, 1, 1, 4, 0, 5, 0, 1,
+	};
+
+	constexpr uint8_t g_argb_slots[g_slot_count] =
+	{
+		69, 109, 255, 255, 121, 255, 118, 59, 255, 255, 139, 84, 255, 255, 62, 255,
+		255, 255, 114, 97, 31, 40, 21, 42, 120, 255, 130, 255, 255, 131, 6, 24,
+		255, 81, 125, 25, 45, 255, 56, 134, 7, 38, 99, 129, 30, 255, 126, 255,
+		255, 255, 72, 53, 113, 1, 255, 255, 255, 255, 10, 58, 255, 255, 255, 19,
+		106, 255, 255, 28, 82, 54, 255, 44, 255, 255, 94, 122, 98, 255, 9, 255,
+		255, 255, 255, 85, 76, 255, 255, 255, 255, 255, 255, 255, 255, 137, 95, 70,
+		255, 23, 255, 255, 68, 51, 255, 8, 48, 39, 255, 61, 255, 63, 29, 255,
+		4, 255, 255, 78, 115, 255, 255, 16, 255, 93, 136, 90, 255, 92, 47, 60,
+		255, 34, 64, 255, 255, 103, 255, 255, 255, 255, 32, 101, 96, 77, 255, 55,
+		255, 255, 91, 255, 65, 17, 135, 112, 49, 18, 255, 50, 0, 108, 5, 86,
+		255, 255, 80, 110, 87, 88, 255, 67, 255, 255, 43, 255, 123, 255, 255, 13,
+		255, 255, 255, 35, 255, 71, 12, 117, 255, 33, 89, 255, 127, 107, 255, 255,
+		11, 255, 255, 102, 66, 255, 119, 255, 255, 75, 26, 57, 255, 255, 255, 255,
+		255, 124, 255, 255, 140, 255, 27, 105, 41, 255, 133, 128, 3, 104, 37, 46,
+		255, 52, 255, 255, 255, 255, 83, 116, 255, 255, 255, 255, 36, 255, 255, 2,
+		138, 255, 255, 14, 255, 73, 22, 255, 15, 255, 111, 255, 100, 132, 74, 255,
+	};
+
+	inline char to_lower(char c)
+	{
+		return c >= 'A' && c <= 'Z' ? (char)(c + ('a' - 'A')) : c;
+	}
+
+	//! FNV-1a followed by the MurmurHash3 finalizer, which spreads every input bit over the low bits.
+	inline uint32_t finalize(uint32_t hash)
+	{
+		hash ^= hash >> 16;
+		hash *= 0x85EBCA6Bu;
+		hash ^= hash >> 13;
+		hash *= 0xC2B2AE35u;
+		return hash ^ (hash >> 16);
+	}
+
+	inline uint32_t hash_name(const char* name, size_t length, uint32_t seed)
+	{
+		uint32_t hash = 2166136261u ^ seed;
+		for (size_t i = 0; i < length; ++i) hash = (hash ^ (uint8_t)to_lower(name[i])) * 16777619u;
+		return finalize(hash);
+	}
+
+	inline uint32_t hash_argb(uint32_t argb, uint32_t seed)
+	{
+		uint32_t hash = 2166136261u ^ seed;
+		for (int i = 0; i < 4; ++i) hash = (hash ^ ((argb >> (8 * i)) & 0xFF)) * 16777619u;
+		return finalize(hash);
+	}
+}
+
+const size_t predefined_colors::count;
+const size_t predefined_colors::not_found;
+
+size_t predefined_colors::find(const char * name, size_t length)
+{
+	const uint8_t seed = g_name_seeds[hash_name(name, length, 0) & (g_bucket_count - 1)];
+	const uint8_t index = g_name_slots[hash_name(name, length, seed) & (g_slot_count - 1)];
+	if (index == g_empty_slot) return not_found;
+
+	// The slot only proves that the name hashes like a predefined color.
+	const char* candidate = g_colors[index].name;
+	for (size_t i = 0; i < length; ++i)
+	{
+		if (candidate[i] == 0 || to_lower(candidate[i]) != to_lower(name[i])) return not_found;
+	}
+	return candidate[length] == 0 ? index : not_found;
+}
+
+size_t predefined_colors::find(uint32_t argb)
+{
+	const uint8_t seed = g_argb_seeds[hash_argb(argb, 0) & (g_bucket_count - 1)];
+	const uint8_t index = g_argb_slots[hash_argb(argb, seed) & (g_slot_count - 1)];
+	return index != g_empty_slot && g_colors[index].argb == argb ? index : not_found;
+}
+
+const char * predefined_colors::name(size_t index)
+{
+	return g_colors[index].name;
+}
+
+uint32_t predefined_colors::argb(size_t index)
+{
+	return g_colors[index].argb;
+}
+
+const float * predefined_colors::values(size_t index, color_type type)
+{
+	if (type >= color_type::UNDEFINED) throw new std::invalid_argument("The color type is not defined.");
+	return g_colors[index].values[type];
+}
+
+bool predefined_colors::is_table_space(color_space::rgb_color_space_definition * rgb_color_space)
+{
+	if (rgb_color_space == nullptr) return false;
+	if (rgb_color_space->get_red_x() != 0.64f || rgb_color_space->get_red_y() != 0.33f) return false;
+	if (rgb_color_space->get_green_x() != 0.3f || rgb_color_space->get_green_y() != 0.6f) return false;
+	if (rgb_color_space->get_blue_x() != 0.15f || rgb_color_space->get_blue_y() != 0.06f) return false;
+
+	auto white = rgb_color_space->get_white_point()->get_tristimulus();
+	if (white[0] != 0.9504f || white[1] != 1.f || white[2] != 1.0888f) return false;
+
+	// Gamma curves are functions, they are compared at points of both segments of the sRGB curve.
+	auto gamma = rgb_color_space->get_gamma_curve();
+	for (float value : { 0.002f, 0.02f, 0.5f, 0.9f })
+	{
+		const float linear = value <= 0.04045f ? value / 12.92f : std::pow((value + 0.055f) / 1.055f, 2.4f);
+		if (std::fabs(gamma->inverse_gamma_correction(value) - linear) > 1e-6f) return false;
+		const float corrected = value <= 0.0031308f ? 12.92f * value : 1.055f * std::pow(value, 1.f / 2.4f) - 0.055f;
+		if (std::fabs(gamma->gamma_correction(value) - corrected) > 1e-6f) return false;
+	}
+	return true;
+}
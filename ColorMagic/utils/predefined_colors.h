@@ -0,0 +1,68 @@
+/// Copyright Martin Ruehlicke, 2019
+/// Use, modification and distribution are subject to the
+/// MIT Software License, Version 1.0.
+/// See accompanying file LICENSE.txt
+
+#pragma once
+
+#include "color_type.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace color_space
+{
+	class rgb_color_space_definition;
+}
+
+//! Precomputed values of the HexcodeColors in every color type.
+/*!
+* The values of all 15 color types were computed with color_converter under rgb_color_space_definition_presets().sRGB()
+* and are stored in constexpr tables, so they cost neither a conversion nor any startup time. Names and hex codes are
+* found in O(1) by perfect hashes: the hash of a key selects a bucket, the seed stored for the bucket selects a slot
+* which holds at most one color.
+*/
+class predefined_colors
+{
+public:
+	//! Number of predefined colors.
+	static const size_t count = 141;
+
+	//! Returned by find() for unknown colors.
+	static const size_t not_found = (size_t)-1;
+
+	//! Finds a color by its name.
+	/*!
+	* \param name The name of a HexcodeColors value, the case is ignored.
+	* \param length The number of characters.
+	* \return The index of the color or not_found.
+	*/
+	static size_t find(const char* name, size_t length);
+
+	//! Finds a color by its hex code.
+	/*!
+	* \param argb The hex code in the format 0xaarrggbb, e.g. a HexcodeColors value.
+	* \return The index of the first color with this hex code or not_found.
+	*/
+	static size_t find(uint32_t argb);
+
+	//! Returns the name of a color.
+	static const char* name(size_t index);
+
+	//! Returns the hex code of a color in the format 0xaarrggbb.
+	static uint32_t argb(size_t index);
+
+	//! Returns the values of a color.
+	/*!
+	* \param index The index of the color.
+	* \param type The color type, anything but UNDEFINED.
+	* \return The components followed by alpha, the layout used by color_buffer.
+	*/
+	static const float* values(size_t index, color_type type);
+
+	//! Returns whether the values of the tables are valid for an rgb color space definition.
+	/*!
+	* \return True if the definition has the primaries, the white point and the gamma curve of sRGB.
+	*/
+	static bool is_table_space(color_space::rgb_color_space_definition* rgb_color_space);
+};
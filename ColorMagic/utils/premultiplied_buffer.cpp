@@ -0,0 +1,55 @@
+#include "stdafx.h"
+#include "premultiplied_buffer.h"
+#include "parallel.h"
+#include "..\manipulation\color_converter.h"
+
+const size_t premultiplied_buffer::channels;
+
+premultiplied_buffer::premultiplied_buffer(color_space::rgb_color_space_definition * rgb_color_space, size_t size)
+	: m_rgb_color_space(rgb_color_space), m_size(0)
+{
+	resize(size);
+}
+
+premultiplied_buffer::premultiplied_buffer(const color_buffer & colors)
+	: m_rgb_color_space(colors.get_rgb_color_space()), m_size(0)
+{
+	resize(colors.size());
+	parallel::for_each_chunk(m_size, 4096, [&](size_t chunk, size_t begin, size_t end)
+	{
+		for (size_t i = begin; i < end; ++i)
+		{
+			float* p = pixel(i);
+			color_manipulation::color_converter::convert_values(colors.get_color_type(), colors.pixel(i), m_rgb_color_space, color_type::RGB_DEEP, p);
+			p[0] *= p[3];
+			p[1] *= p[3];
+			p[2] *= p[3];
+		}
+	});
+}
+
+void premultiplied_buffer::resize(size_t size)
+{
+	m_size = size;
+	m_data.resize(size * channels, 0.f);
+}
+
+color_buffer premultiplied_buffer::to_color_buffer(color_type type) const
+{
+	color_buffer result(type, m_rgb_color_space, m_size);
+	parallel::for_each_chunk(m_size, 4096, [&](size_t chunk, size_t begin, size_t end)
+	{
+		float rgba[4];
+		for (size_t i = begin; i < end; ++i)
+		{
+			const float* p = pixel(i);
+			const float scale = p[3] > 0.f ? 1.f / p[3] : 0.f;
+			rgba[0] = p[0] * scale;
+			rgba[1] = p[1] * scale;
+			rgba[2] = p[2] * scale;
+			rgba[3] = p[3];
+			color_manipulation::color_converter::convert_values(color_type::RGB_DEEP, rgba, m_rgb_color_space, type, result.pixel(i));
+		}
+	});
+	return result;
+}
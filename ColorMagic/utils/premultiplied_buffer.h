@@ -0,0 +1,74 @@
+/// Copyright Martin Ruehlicke, 2019
+/// Use, modification and distribution are subject to the
+/// MIT Software License, Version 1.0.
+/// See accompanying file LICENSE.txt
+
+#pragma once
+
+#include "color_buffer.h"
+
+#include <cstddef>
+#include <vector>
+
+//! Contiguous storage for rgb deep colors with premultiplied alpha.
+/*!
+* Every color is stored as r * a, g * a, b * a, a. Porter duff operators and most blend modes are linear in premultiplied
+* values, so porter_duff::composite() and color_blend::blend() work on them without dividing by alpha. A chain of
+* compositing steps therefore stays premultiplied and divides once per pixel in to_color_buffer().
+*/
+class premultiplied_buffer
+{
+public:
+	//! Default constructor.
+	/*!
+	* \param rgb_color_space The rgb color space definition of all colors in the buffer.
+	* \param size The initial number of colors, all transparent black.
+	*/
+	premultiplied_buffer(color_space::rgb_color_space_definition* rgb_color_space, size_t size = 0);
+
+	//! Converts a buffer of any color type.
+	/*!
+	* The colors are converted to rgb deep and multiplied by their alpha in chunks on all cores.
+	*/
+	explicit premultiplied_buffer(const color_buffer& colors);
+
+	//! Returns the rgb color space definition of the colors.
+	color_space::rgb_color_space_definition* get_rgb_color_space() const { return m_rgb_color_space; }
+
+	//! Returns the number of colors.
+	size_t size() const { return m_size; }
+
+	//! Returns whether the buffer contains no colors.
+	bool empty() const { return m_size == 0; }
+
+	//! Returns the premultiplied red, green, blue and alpha of a color.
+	float* pixel(size_t index) { return m_data.data() + index * channels; }
+
+	//! Returns the premultiplied red, green, blue and alpha of a color.
+	const float* pixel(size_t index) const { return m_data.data() + index * channels; }
+
+	//! Returns the values of all colors.
+	float* data() { return m_data.data(); }
+
+	//! Returns the values of all colors.
+	const float* data() const { return m_data.data(); }
+
+	//! Changes the number of colors, new colors are transparent black.
+	void resize(size_t size);
+
+	//! Converts the colors back to straight alpha.
+	/*!
+	* This is the only place where the colors are divided by alpha. Colors with an alpha of 0 become black.
+	* \param type The color type of the result.
+	* \return A new buffer with the rgb color space definition of this buffer.
+	*/
+	color_buffer to_color_buffer(color_type type = color_type::RGB_DEEP) const;
+
+	//! Number of floats per color.
+	static const size_t channels = 4;
+
+private:
+	color_space::rgb_color_space_definition* m_rgb_color_space;
+	size_t m_size;
+	std::vector<float> m_data;
+};
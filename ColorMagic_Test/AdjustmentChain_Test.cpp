@@ -0,0 +1,163 @@
+#include "gtest\gtest.h"
+#include "pch.h"
+#include "..\ColorMagic\spaces\rgb_deepcolor.h"
+#include "..\ColorMagic\spaces\rgb_truecolor.h"
+#include "..\ColorMagic\manipulation\adjustment_chain.h"
+#include "..\ColorMagic\manipulation\chromatic_adaptation.h"
+#include "..\ColorMagic\manipulation\color_adjustments.h"
+
+#include <memory>
+
+using namespace color_space;
+
+class AdjustmentChain_Test : public ::testing::Test {
+protected:
+	float avg_error = 0.001f;
+
+	rgb_color_space_definition* srgb;
+
+	virtual void SetUp()
+	{
+		srgb = rgb_color_space_definition_presets().sRGB();
+	}
+
+	virtual void TearDown()
+	{
+		delete srgb;
+	}
+
+	void expect_rgb_near(const color_base& expected, const float* actual, float error)
+	{
+		EXPECT_NEAR(expected.get_components()[0], actual[0], error);
+		EXPECT_NEAR(expected.get_components()[1], actual[1], error);
+		EXPECT_NEAR(expected.get_components()[2], actual[2], error);
+	}
+};
+
+TEST_F(AdjustmentChain_Test, Single_Step_Tests)
+{
+	rgb_deepcolor color(0.6f, 0.4f, 0.3f, 1.f, srgb);
+	float rgb[3];
+
+	color_manipulation::adjustment_chain saturation(srgb);
+	saturation.saturation(0.3f);
+	saturation.apply_rgb(color.get_components().data(), rgb);
+	std::unique_ptr<color_base> expected(color_manipulation::color_adjustments::saturate_in_rgb_space(&color, 0.3f));
+	expect_rgb_near(*expected, rgb, avg_error);
+
+	color_manipulation::adjustment_chain lightness(srgb);
+	lightness.lightness(0.4f);
+	lightness.apply_rgb(color.get_components().data(), rgb);
+	expected.reset(color_manipulation::color_adjustments::luminate_in_rgb_space(&color, 0.4f));
+	expect_rgb_near(*expected, rgb, avg_error);
+
+	// 120 degrees turn red into green.
+	color_manipulation::adjustment_chain hue(srgb);
+	hue.hue_shift(120.f);
+	const float red[3] = { 1.f, 0.f, 0.f };
+	hue.apply_rgb(red, rgb);
+	EXPECT_NEAR(0.f, rgb[0], avg_error);
+	EXPECT_NEAR(1.f, rgb[1], avg_error);
+	EXPECT_NEAR(0.f, rgb[2], avg_error);
+
+	// One stop doubles the linear value.
+	color_manipulation::adjustment_chain exposure(srgb);
+	exposure.exposure(1.f);
+	const float grey[3] = { 0.4f, 0.4f, 0.4f };
+	exposure.apply_rgb(grey, rgb);
+	auto gamma = srgb->get_gamma_curve();
+	EXPECT_NEAR(gamma->gamma_correction(2.f * gamma->inverse_gamma_correction(0.4f)), rgb[0], avg_error);
+
+	// Contrast keeps the pivot.
+	color_manipulation::adjustment_chain contrast(srgb);
+	contrast.contrast(0.5f, 0.4f);
+	contrast.apply_rgb(grey, rgb);
+	EXPECT_NEAR(0.4f, rgb[0], avg_error);
+
+	// The white balance gives the rgb values of chromatic adaptation.
+	color_manipulation::adjustment_chain white_balance(srgb);
+	white_balance.white_balance(white_point_presets().D50_2Degree());
+	white_balance.apply_rgb(color.get_components().data(), rgb);
+	std::unique_ptr<color_base> adapted(color_manipulation::chromatic_adaptation::bradford_adaptation_simplified(&color, white_point_presets().D50_2Degree()));
+	expect_rgb_near(*adapted, rgb, 0.002f);
+}
+
+TEST_F(AdjustmentChain_Test, Fusion_Tests)
+{
+	// Linear steps in the same domain become one matrix.
+	color_manipulation::adjustment_chain chain(srgb);
+	chain.saturation(0.2f).lightness(-0.1f).contrast(0.1f).hue_shift(30.f);
+	EXPECT_EQ(1, chain.operation_count());
+
+	// Exposure needs linear values, so the gamma curve is removed before and applied again at the end.
+	chain.exposure(0.5f);
+	EXPECT_EQ(4, chain.operation_count());
+	chain.white_balance(white_point_presets().D50_2Degree());
+	EXPECT_EQ(4, chain.operation_count());
+	chain.saturation(0.1f);
+	EXPECT_EQ(5, chain.operation_count());
+
+	// Consecutive curves are composed into one table.
+	chain.curve([](float v) { return v * v; }).curve([](float v) { return std::sqrt(v); });
+	EXPECT_EQ(6, chain.operation_count());
+
+	// The fused chain gives the result of the single steps.
+	color_manipulation::adjustment_chain steps[] = { color_manipulation::adjustment_chain(srgb), color_manipulation::adjustment_chain(srgb), color_manipulation::adjustment_chain(srgb), color_manipulation::adjustment_chain(srgb) };
+	steps[0].saturation(0.2f);
+	steps[1].lightness(-0.1f);
+	steps[2].contrast(0.1f);
+	steps[3].hue_shift(30.f);
+	color_manipulation::adjustment_chain fused(srgb);
+	fused.saturation(0.2f).lightness(-0.1f).contrast(0.1f).hue_shift(30.f);
+
+	const float colors[][3] = { { 0.5f, 0.4f, 0.3f }, { 0.2f, 0.5f, 0.6f }, { 0.45f, 0.45f, 0.5f } };
+	for (const auto& color : colors)
+	{
+		float expected[3] = { color[0], color[1], color[2] }, actual[3];
+		for (const auto& step : steps) step.apply_rgb(expected, expected);
+		fused.apply_rgb(color, actual);
+		EXPECT_NEAR(expected[0], actual[0], avg_error);
+		EXPECT_NEAR(expected[1], actual[1], avg_error);
+		EXPECT_NEAR(expected[2], actual[2], avg_error);
+	}
+
+	// The composed curves cancel.
+	color_manipulation::adjustment_chain curves(srgb);
+	curves.curve([](float v) { return v * v; }).curve([](float v) { return std::sqrt(v); });
+	float result[3];
+	curves.apply_rgb(colors[0], result);
+	EXPECT_NEAR(colors[0][0], result[0], 0.002f);
+	EXPECT_NEAR(colors[0][1], result[1], 0.002f);
+	EXPECT_NEAR(colors[0][2], result[2], 0.002f);
+}
+
+TEST_F(AdjustmentChain_Test, Buffer_And_Lut_Tests)
+{
+	color_manipulation::adjustment_chain chain(srgb);
+	chain.exposure(0.3f).saturation(0.25f).curve([](float v) { return v * (2.f - v); }).hue_shift(-20.f);
+
+	color_buffer colors(color_type::RGB_TRUE, srgb);
+	for (int i = 0; i < 200; ++i) colors.push_back(rgb_truecolor((i * 37) % 256, (i * 91) % 256, (i * 13) % 256, 255 - i, srgb));
+
+	color_buffer adjusted = chain.apply(colors);
+	ASSERT_EQ(color_type::RGB_TRUE, adjusted.get_color_type());
+	ASSERT_EQ(colors.size(), adjusted.size());
+
+	color_manipulation::color_lut lut = chain.bake();
+	EXPECT_EQ(33, lut.size());
+	color_buffer baked = lut.apply(colors);
+
+	for (size_t i = 0; i < colors.size(); ++i)
+	{
+		std::unique_ptr<color_base> color(colors.create_color(i));
+		std::unique_ptr<color_base> expected(chain.apply(color.get()));
+		for (size_t c = 0; c < 3; ++c)
+		{
+			EXPECT_NEAR(expected->get_components()[c], adjusted.pixel(i)[c], 0.5f);
+			EXPECT_NEAR(adjusted.pixel(i)[c], baked.pixel(i)[c], 3.f);
+		}
+		EXPECT_NEAR(colors.pixel(i)[3], adjusted.pixel(i)[3], avg_error);
+	}
+
+	EXPECT_ANY_THROW(chain.bake(1));
+}
@@ -0,0 +1,105 @@
+#include "gtest\gtest.h"
+#include "pch.h"
+#include "..\ColorMagic\spaces\rgb_deepcolor.h"
+#include "..\ColorMagic\spaces\hsv.h"
+#include "..\ColorMagic\manipulation\color_accumulator.h"
+
+using namespace color_space;
+
+class ColorAccumulator_Test : public ::testing::Test {
+protected:
+	float avg_error = 0.001f;
+
+	rgb_color_space_definition* srgb;
+
+	virtual void SetUp()
+	{
+		srgb = rgb_color_space_definition_presets().sRGB();
+	}
+
+	virtual void TearDown()
+	{
+		delete srgb;
+	}
+};
+
+TEST_F(ColorAccumulator_Test, Sliding_Window_Tests)
+{
+	color_manipulation::color_accumulator window(color_type::RGB_DEEP, srgb);
+	std::vector<rgb_deepcolor> frames;
+	for (int i = 0; i < 20; ++i)
+	{
+		frames.push_back(rgb_deepcolor(i / 20.f, 0.5f, 1.f - i / 20.f, 1.f, srgb));
+	}
+
+	// Window of the last 4 frames.
+	for (int i = 0; i < 20; ++i)
+	{
+		window.add(frames[i]);
+		if (i >= 4) window.remove(frames[i - 4]);
+	}
+	ASSERT_EQ(4, window.count());
+
+	auto mean = static_cast<rgb_deepcolor*>(window.mean());
+	EXPECT_NEAR((16.f + 17.f + 18.f + 19.f) / 80.f, mean->red(), avg_error);
+	EXPECT_NEAR(0.5f, mean->green(), avg_error);
+	EXPECT_NEAR(1.f - (16.f + 17.f + 18.f + 19.f) / 80.f, mean->blue(), avg_error);
+	delete mean;
+
+	auto variance = window.variance();
+	ASSERT_EQ(4, variance.size());
+	EXPECT_NEAR(1.25f / 400.f, variance[0], avg_error);
+	EXPECT_NEAR(0.f, variance[1], avg_error);
+
+	// Colors of other types are converted.
+	window.clear();
+	window.add(hsv(0.f, 1.f, 1.f, 1.f, srgb));
+	mean = static_cast<rgb_deepcolor*>(window.mean());
+	EXPECT_NEAR(1.f, mean->red(), avg_error);
+	EXPECT_NEAR(0.f, mean->green(), avg_error);
+	delete mean;
+
+	window.remove(hsv(0.f, 1.f, 1.f, 1.f, srgb));
+	EXPECT_EQ(0, window.count());
+	EXPECT_ANY_THROW(window.mean());
+	EXPECT_ANY_THROW(window.remove(frames[0]));
+}
+
+TEST_F(ColorAccumulator_Test, Merge_Tests)
+{
+	color_buffer colors(color_type::HSV, srgb);
+	colors.push_back(hsv(350.f, 1.f, 1.f, 1.f, srgb));
+	colors.push_back(hsv(10.f, 0.5f, 1.f, 1.f, srgb));
+	colors.push_back(hsv(20.f, 0.6f, 0.4f, 1.f, srgb));
+	colors.push_back(hsv(0.f, 0.9f, 0.2f, 1.f, srgb));
+
+	color_manipulation::color_accumulator all(color_type::HSV, srgb);
+	all.add(colors);
+
+	color_manipulation::color_accumulator first(color_type::HSV, srgb);
+	color_manipulation::color_accumulator second(color_type::HSV, srgb);
+	first.add(colors.pixel(0));
+	first.add(colors.pixel(1));
+	second.add(colors.pixel(2));
+	second.add(colors.pixel(3));
+	first.merge(second);
+
+	auto all_mean = static_cast<hsv*>(all.mean());
+	auto merged_mean = static_cast<hsv*>(first.mean());
+	EXPECT_NEAR(all_mean->hue(), merged_mean->hue(), avg_error);
+	EXPECT_NEAR(all_mean->saturation(), merged_mean->saturation(), avg_error);
+	EXPECT_NEAR(all_mean->value(), merged_mean->value(), avg_error);
+	EXPECT_NEAR(5.f, all_mean->hue(), 0.5f);
+	delete all_mean;
+	delete merged_mean;
+
+	auto all_variance = all.variance();
+	auto merged_variance = first.variance();
+	for (size_t i = 0; i < all_variance.size(); ++i)
+	{
+		EXPECT_NEAR(all_variance[i], merged_variance[i], avg_error);
+	}
+	EXPECT_LT(all_variance[0], 0.05f);
+
+	EXPECT_ANY_THROW(first.merge(color_manipulation::color_accumulator(color_type::LAB, srgb)));
+}
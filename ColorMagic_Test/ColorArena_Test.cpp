@@ -0,0 +1,106 @@
+#include "gtest\gtest.h"
+#include "pch.h"
+#include "..\ColorMagic\utils\color_arena.h"
+#include "..\ColorMagic\spaces\rgb_deepcolor.h"
+#include "..\ColorMagic\spaces\lab.h"
+#include "..\ColorMagic\manipulation\color_converter.h"
+
+using namespace color_space;
+
+class ColorArena_Test : public ::testing::Test {
+protected:
+	rgb_color_space_definition* srgb;
+
+	virtual void SetUp()
+	{
+		srgb = color_space::rgb_color_space_definition_presets().sRGB();
+	}
+
+	virtual void TearDown()
+	{
+		delete srgb;
+	}
+};
+
+TEST_F(ColorArena_Test, AllocationTests)
+{
+	color_arena arena;
+
+	rgb_deepcolor* color = arena.create<rgb_deepcolor>(1.f, 0.5f, 0.f, 1.f, srgb);
+	ASSERT_TRUE(arena.owns(color));
+	ASSERT_FLOAT_EQ(0.5f, color->green());
+
+	color_arena_statistics statistics = arena.statistics();
+	ASSERT_EQ(1, statistics.objects_served);
+	ASSERT_EQ(1, statistics.objects_alive);
+	ASSERT_EQ(1, statistics.block_count);
+	ASSERT_GE(statistics.bytes_served, sizeof(rgb_deepcolor));
+
+	delete color;
+	ASSERT_EQ(0, arena.statistics().objects_alive);
+
+	rgb_deepcolor* heap_color = new rgb_deepcolor(1.f, 0.5f, 0.f, 1.f, srgb);
+	ASSERT_FALSE(arena.owns(heap_color));
+	delete heap_color;
+}
+
+TEST_F(ColorArena_Test, ScopeTests)
+{
+	color_arena arena;
+	rgb_deepcolor* color = new rgb_deepcolor(1.f, 0.5f, 0.f, 1.f, srgb);
+
+	ASSERT_EQ(nullptr, color_arena::current());
+	{
+		color_arena::scope active(&arena);
+		ASSERT_EQ(&arena, color_arena::current());
+
+		lab* result = color_manipulation::color_converter::to_lab(color);
+		ASSERT_TRUE(arena.owns(result));
+		ASSERT_GE(arena.statistics().objects_served, 1);
+
+		{
+			color_arena::scope heap(nullptr);
+			lab* heap_result = color_manipulation::color_converter::to_lab(color);
+			ASSERT_FALSE(arena.owns(heap_result));
+			delete heap_result;
+		}
+
+		ASSERT_EQ(&arena, color_arena::current());
+	}
+	ASSERT_EQ(nullptr, color_arena::current());
+
+	delete color;
+}
+
+TEST_F(ColorArena_Test, ResetTests)
+{
+	color_arena arena(256);
+
+	for (int i = 0; i < 100; ++i)
+	{
+		arena.create<rgb_deepcolor>(1.f, 0.5f, 0.f, 1.f, srgb);
+	}
+
+	color_arena_statistics statistics = arena.statistics();
+	ASSERT_EQ(100, statistics.objects_served);
+	ASSERT_EQ(100, statistics.objects_alive);
+	ASSERT_GT(statistics.block_count, 1);
+
+	arena.reset();
+	statistics = arena.statistics();
+	ASSERT_EQ(0, statistics.objects_alive);
+	ASSERT_EQ(0, statistics.bytes_in_use);
+	ASSERT_EQ(1, statistics.reset_count);
+	ASSERT_GT(statistics.peak_bytes_in_use, 0);
+
+	// The blocks are reused after a reset.
+	size_t blocks = statistics.block_count;
+	for (int i = 0; i < 100; ++i)
+	{
+		arena.create<rgb_deepcolor>(1.f, 0.5f, 0.f, 1.f, srgb);
+	}
+	ASSERT_EQ(blocks, arena.statistics().block_count);
+
+	arena.release_memory();
+	ASSERT_EQ(0, arena.statistics().bytes_reserved);
+}
@@ -1,8 +1,12 @@
 #include "gtest\gtest.h"
 #include "pch.h"
 #include "..\ColorMagic\spaces\rgb_deepcolor.h"
+#include "..\ColorMagic\spaces\rgb_truecolor.h"
 #include "..\ColorMagic\manipulation\color_blend.h"
 
+#include <algorithm>
+#include <memory>
+
 using namespace color_space;
 
 class ColorBlend_Test : public ::testing::Test {
@@ -574,21 +578,21 @@ TEST_F(ColorBlend_Test, ExclusionTests)
 TEST_F(ColorBlend_Test, HueTests)
 {
 	auto result = color_manipulation::color_converter::to_rgb_deep(color_manipulation::color_blend::hue(red_100, blue_100));
-	ASSERT_NEAR(0.85f, result->red(), avg_error);
+	ASSERT_NEAR(0.37f, result->red(), avg_error);
 	ASSERT_NEAR(0.f, result->green(), avg_error);
 	ASSERT_NEAR(0.f, result->blue(), avg_error);
 	ASSERT_NEAR(1.f, result->alpha(), avg_error);
 	delete result;
 
 	result = color_manipulation::color_converter::to_rgb_deep(color_manipulation::color_blend::hue(red_100, blue_50));
-	ASSERT_NEAR(0.85f, result->red(), avg_error);
+	ASSERT_NEAR(0.68f, result->red(), avg_error);
 	ASSERT_NEAR(0.f, result->green(), avg_error);
 	ASSERT_NEAR(0.f, result->blue(), avg_error);
 	ASSERT_NEAR(1.f, result->alpha(), avg_error);
 	delete result;
 
 	result = color_manipulation::color_converter::to_rgb_deep(color_manipulation::color_blend::hue(red_100, blue_0));
-	ASSERT_NEAR(0.85f, result->red(), avg_error);
+	ASSERT_NEAR(1.f, result->red(), avg_error);
 	ASSERT_NEAR(0.f, result->green(), avg_error);
 	ASSERT_NEAR(0.f, result->blue(), avg_error);
 	ASSERT_NEAR(1.f, result->alpha(), avg_error);
@@ -605,16 +609,16 @@ TEST_F(ColorBlend_Test, SaturationTests)
 	delete result;
 
 	result = color_manipulation::color_converter::to_rgb_deep(color_manipulation::color_blend::saturation(red_100, blue_50));
-	ASSERT_NEAR(0.f, result->red(), avg_error);
+	ASSERT_NEAR(0.5f, result->red(), avg_error);
 	ASSERT_NEAR(0.f, result->green(), avg_error);
-	ASSERT_NEAR(1.f, result->blue(), avg_error);
+	ASSERT_NEAR(0.5f, result->blue(), avg_error);
 	ASSERT_NEAR(1.f, result->alpha(), avg_error);
 	delete result;
 
 	result = color_manipulation::color_converter::to_rgb_deep(color_manipulation::color_blend::saturation(red_100, blue_0));
-	ASSERT_NEAR(0.f, result->red(), avg_error);
+	ASSERT_NEAR(1.f, result->red(), avg_error);
 	ASSERT_NEAR(0.f, result->green(), avg_error);
-	ASSERT_NEAR(1.f, result->blue(), avg_error);
+	ASSERT_NEAR(0.f, result->blue(), avg_error);
 	ASSERT_NEAR(1.f, result->alpha(), avg_error);
 	delete result;
 }
@@ -622,21 +626,21 @@ TEST_F(ColorBlend_Test, SaturationTests)
 TEST_F(ColorBlend_Test, ColorTests)
 {
 	auto result = color_manipulation::color_converter::to_rgb_deep(color_manipulation::color_blend::color(red_100, blue_100));
-	ASSERT_NEAR(0.85f, result->red(), avg_error);
+	ASSERT_NEAR(0.37f, result->red(), avg_error);
 	ASSERT_NEAR(0.f, result->green(), avg_error);
 	ASSERT_NEAR(0.f, result->blue(), avg_error);
 	ASSERT_NEAR(1.f, result->alpha(), avg_error);
 	delete result;
 
 	result = color_manipulation::color_converter::to_rgb_deep(color_manipulation::color_blend::color(red_100, blue_50));
-	ASSERT_NEAR(0.85f, result->red(), avg_error);
+	ASSERT_NEAR(0.68f, result->red(), avg_error);
 	ASSERT_NEAR(0.f, result->green(), avg_error);
 	ASSERT_NEAR(0.f, result->blue(), avg_error);
 	ASSERT_NEAR(1.f, result->alpha(), avg_error);
 	delete result;
 
 	result = color_manipulation::color_converter::to_rgb_deep(color_manipulation::color_blend::color(red_100, blue_0));
-	ASSERT_NEAR(0.85f, result->red(), avg_error);
+	ASSERT_NEAR(1.f, result->red(), avg_error);
 	ASSERT_NEAR(0.f, result->green(), avg_error);
 	ASSERT_NEAR(0.f, result->blue(), avg_error);
 	ASSERT_NEAR(1.f, result->alpha(), avg_error);
@@ -646,23 +650,149 @@ TEST_F(ColorBlend_Test, ColorTests)
 TEST_F(ColorBlend_Test, LuminosityTests)
 {
 	auto result = color_manipulation::color_converter::to_rgb_deep(color_manipulation::color_blend::luminosity(red_100, blue_100));
-	ASSERT_NEAR(0.14f, result->red(), avg_error);
-	ASSERT_NEAR(0.14f, result->green(), avg_error);
+	ASSERT_NEAR(0.21f, result->red(), avg_error);
+	ASSERT_NEAR(0.21f, result->green(), avg_error);
 	ASSERT_NEAR(1.f, result->blue(), avg_error);
 	ASSERT_NEAR(1.f, result->alpha(), avg_error);
 	delete result;
 
 	result = color_manipulation::color_converter::to_rgb_deep(color_manipulation::color_blend::luminosity(red_100, blue_50));
-	ASSERT_NEAR(0.14f, result->red(), avg_error);
-	ASSERT_NEAR(0.14f, result->green(), avg_error);
-	ASSERT_NEAR(1.f, result->blue(), avg_error);
+	ASSERT_NEAR(0.61f, result->red(), avg_error);
+	ASSERT_NEAR(0.11f, result->green(), avg_error);
+	ASSERT_NEAR(0.5f, result->blue(), avg_error);
 	ASSERT_NEAR(1.f, result->alpha(), avg_error);
 	delete result;
 
 	result = color_manipulation::color_converter::to_rgb_deep(color_manipulation::color_blend::luminosity(red_100, blue_0));
-	ASSERT_NEAR(0.14f, result->red(), avg_error);
-	ASSERT_NEAR(0.14f, result->green(), avg_error);
-	ASSERT_NEAR(1.f, result->blue(), avg_error);
+	ASSERT_NEAR(1.f, result->red(), avg_error);
+	ASSERT_NEAR(0.f, result->green(), avg_error);
+	ASSERT_NEAR(0.f, result->blue(), avg_error);
 	ASSERT_NEAR(1.f, result->alpha(), avg_error);
 	delete result;
-}
\ No newline at end of file
+}
+
+TEST_F(ColorBlend_Test, NonSeparableRegionTests)
+{
+	// Without the source region only the overlapping area remains.
+	auto result = color_manipulation::color_converter::to_rgb_deep(color_manipulation::color_blend::hue(red_100, blue_50, false, true));
+	ASSERT_NEAR(0.37f, result->red(), avg_error);
+	ASSERT_NEAR(0.f, result->green(), avg_error);
+	ASSERT_NEAR(0.f, result->blue(), avg_error);
+	ASSERT_NEAR(0.5f, result->alpha(), avg_error);
+	delete result;
+
+	result = color_manipulation::color_converter::to_rgb_deep(color_manipulation::color_blend::luminosity(blue_50, red_100, true, false));
+	ASSERT_NEAR(0.5f, result->alpha(), avg_error);
+	delete result;
+
+	EXPECT_ANY_THROW(color_manipulation::color_blend::color(red_100, nullptr));
+}
+
+TEST_F(ColorBlend_Test, NonSeparableBufferTests)
+{
+	color_buffer source(color_type::RGB_TRUE, srgb);
+	color_buffer destination(color_type::RGB_DEEP, srgb);
+	for (int i = 0; i < 300; ++i)
+	{
+		source.push_back(rgb_truecolor((i * 53) % 256, (i * 17) % 256, (i * 101) % 256, (i * 7) % 256, srgb));
+		destination.push_back(rgb_deepcolor(((i * 31) % 100) / 99.f, ((i * 11) % 100) / 99.f, ((i * 71) % 100) / 99.f, ((i * 3) % 100) / 99.f, srgb));
+	}
+
+	typedef color_space::color_base* (*scalar_blend)(color_space::color_base*, color_space::color_base*, bool, bool);
+	typedef color_buffer (*buffer_blend)(const color_buffer&, const color_buffer&, bool, bool);
+	const scalar_blend scalar[] = { color_manipulation::color_blend::hue, color_manipulation::color_blend::saturation, color_manipulation::color_blend::color, color_manipulation::color_blend::luminosity };
+	const buffer_blend buffer[] = { color_manipulation::color_blend::hue, color_manipulation::color_blend::saturation, color_manipulation::color_blend::color, color_manipulation::color_blend::luminosity };
+
+	for (int mode = 0; mode < 4; ++mode)
+	{
+		for (int regions = 0; regions < 4; ++regions)
+		{
+			const bool use_source = (regions & 1) != 0, use_destination = (regions & 2) != 0;
+			color_buffer result = buffer[mode](source, destination, use_source, use_destination);
+			ASSERT_EQ(color_type::RGB_TRUE, result.get_color_type());
+			ASSERT_EQ(source.size(), result.size());
+
+			for (size_t i = 0; i < source.size(); ++i)
+			{
+				std::unique_ptr<color_base> s(source.create_color(i));
+				std::unique_ptr<color_base> d(destination.create_color(i));
+				std::unique_ptr<color_base> expected(scalar[mode](s.get(), d.get(), use_source, use_destination));
+				for (size_t c = 0; c < 3; ++c) EXPECT_NEAR(expected->get_components()[c], result.pixel(i)[c], 0.5f);
+				EXPECT_NEAR(expected->alpha(), result.pixel(i)[3], 0.5f);
+			}
+		}
+	}
+
+	color_buffer shorter(color_type::RGB_DEEP, srgb, 10);
+	EXPECT_ANY_THROW(color_manipulation::color_blend::hue(source, shorter));
+}
+
+TEST_F(ColorBlend_Test, DissolveTests)
+{
+	// The whole pixel takes one color, 3/4 of the pixels take the color with the greater alpha.
+	rgb_deepcolor orange(1.f, 0.5f, 0.f, 0.9f, srgb), teal(0.f, 0.5f, 0.5f, 0.6f, srgb);
+	size_t orange_count = 0;
+	for (uint32_t y = 0; y < 40; ++y)
+	{
+		for (uint32_t x = 0; x < 50; ++x)
+		{
+			auto result = color_manipulation::color_converter::to_rgb_deep(color_manipulation::color_blend::dissolve(&orange, &teal, x, y, 7, false, false));
+			ASSERT_NEAR(0.54f, result->alpha(), 0.001f);
+			const bool is_orange = result->red() > 0.5f;
+			EXPECT_NEAR(is_orange ? 0.f : 0.5f, result->blue(), 0.001f);
+			if (is_orange) ++orange_count;
+			delete result;
+		}
+	}
+	EXPECT_NEAR(0.75f, orange_count / 2000.f, 0.03f);
+
+	// The noise depends on nothing but position and seed.
+	EXPECT_EQ(color_manipulation::color_blend::dissolve_noise(3, 4, 5), color_manipulation::color_blend::dissolve_noise(3, 4, 5));
+	EXPECT_NE(color_manipulation::color_blend::dissolve_noise(3, 4, 5), color_manipulation::color_blend::dissolve_noise(4, 3, 5));
+	EXPECT_NE(color_manipulation::color_blend::dissolve_noise(3, 4, 5), color_manipulation::color_blend::dissolve_noise(3, 4, 6));
+}
+
+TEST_F(ColorBlend_Test, DissolveBufferTests)
+{
+	const size_t width = 37, height = 29;
+	color_buffer source(color_type::RGB_DEEP, srgb), destination(color_type::RGB_DEEP, srgb);
+	for (size_t i = 0; i < width * height; ++i)
+	{
+		source.push_back(rgb_deepcolor((i % 7) / 6.f, (i % 5) / 4.f, (i % 3) / 2.f, ((i * 13) % 10) / 9.f, srgb));
+		destination.push_back(rgb_deepcolor((i % 4) / 3.f, (i % 9) / 8.f, (i % 6) / 5.f, ((i * 7) % 10) / 9.f, srgb));
+	}
+
+	color_buffer image = color_manipulation::color_blend::dissolve(source, destination, width, 42);
+	for (size_t i = 0; i < image.size(); ++i)
+	{
+		std::unique_ptr<color_base> s(source.create_color(i));
+		std::unique_ptr<color_base> d(destination.create_color(i));
+		std::unique_ptr<color_base> expected(color_manipulation::color_blend::dissolve(s.get(), d.get(), (uint32_t)(i % width), (uint32_t)(i / width), 42));
+		for (size_t c = 0; c < 3; ++c) EXPECT_FLOAT_EQ(expected->get_components()[c], image.pixel(i)[c]);
+		EXPECT_FLOAT_EQ(expected->alpha(), image.pixel(i)[3]);
+	}
+
+	// A tile of the image gives the same bits as the whole image.
+	const size_t tile_x = 10, tile_y = 5, tile_width = 20, tile_height = 15;
+	color_buffer tile_source(color_type::RGB_DEEP, srgb, tile_width * tile_height), tile_destination(color_type::RGB_DEEP, srgb, tile_width * tile_height);
+	for (size_t y = 0; y < tile_height; ++y)
+	{
+		for (size_t x = 0; x < tile_width; ++x)
+		{
+			const size_t i = (tile_y + y) * width + tile_x + x;
+			std::copy(source.pixel(i), source.pixel(i) + 4, tile_source.pixel(y * tile_width + x));
+			std::copy(destination.pixel(i), destination.pixel(i) + 4, tile_destination.pixel(y * tile_width + x));
+		}
+	}
+	color_buffer tile = color_manipulation::color_blend::dissolve(tile_source, tile_destination, tile_width, 42, tile_x, tile_y);
+	for (size_t y = 0; y < tile_height; ++y)
+	{
+		for (size_t x = 0; x < tile_width; ++x)
+		{
+			const size_t i = (tile_y + y) * width + tile_x + x;
+			for (size_t c = 0; c < 4; ++c) EXPECT_EQ(image.pixel(i)[c], tile.pixel(y * tile_width + x)[c]);
+		}
+	}
+
+	EXPECT_ANY_THROW(color_manipulation::color_blend::dissolve(source, destination, 0));
+}
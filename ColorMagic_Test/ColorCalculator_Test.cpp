@@ -3,6 +3,7 @@
 #include "..\ColorMagic\spaces\color_base.h"
 #include "..\ColorMagic\spaces\rgb_truecolor.h"
 #include "..\ColorMagic\manipulation\color_calculation.h"
+#include "..\ColorMagic\utils\parallel.h"
 
 using namespace color_space;
 
@@ -740,4 +741,59 @@ TEST_F(ColorCalculator_Test, XYZ_Average)
 	ASSERT_NEAR(35.26f, avg->x(), avg_error);
 	ASSERT_NEAR(16.75f, avg->y(), avg_error);
 	ASSERT_NEAR(70.6f, avg->z(), avg_error);
-}
\ No newline at end of file
+}
+TEST_F(ColorCalculator_Test, Buffer_Average)
+{
+	color_buffer colors(color_type::RGB_DEEP, srgb, 100000);
+	for (size_t i = 0; i < colors.size(); ++i)
+	{
+		float* pixel = colors.pixel(i);
+		pixel[0] = i % 2 == 0 ? 1.f : 0.f;
+		pixel[1] = 0.25f;
+		pixel[2] = (i % 10) / 10.f;
+		pixel[3] = i == 0 ? 0.5f : 1.f;
+	}
+
+	auto avg = static_cast<rgb_deepcolor*>(color_manipulation::color_calculation::average(colors));
+	EXPECT_NEAR(0.5f, avg->red(), 1e-6f);
+	EXPECT_NEAR(0.25f, avg->green(), 1e-6f);
+	EXPECT_NEAR(0.45f, avg->blue(), 1e-6f);
+	EXPECT_FLOAT_EQ(0.5f, avg->alpha());
+
+	// The result does not depend on the number of threads.
+	parallel::set_thread_count(1);
+	auto single = static_cast<rgb_deepcolor*>(color_manipulation::color_calculation::average(colors, true));
+	parallel::set_thread_count(7);
+	auto multi = static_cast<rgb_deepcolor*>(color_manipulation::color_calculation::average(colors, true));
+	parallel::set_thread_count(0);
+	EXPECT_EQ(single->red(), multi->red());
+	EXPECT_EQ(single->blue(), multi->blue());
+	EXPECT_EQ(single->alpha(), multi->alpha());
+
+	delete avg;
+	delete single;
+	delete multi;
+
+	EXPECT_ANY_THROW(color_manipulation::color_calculation::average(color_buffer(color_type::RGB_DEEP, srgb)));
+}
+
+TEST_F(ColorCalculator_Test, Buffer_Average_Hue)
+{
+	color_buffer colors(color_type::HSV, srgb);
+	colors.push_back(hsv(350.f, 1.f, 1.f, 1.f, srgb));
+	colors.push_back(hsv(10.f, 0.5f, 1.f, 1.f, srgb));
+	colors.push_back(hsv(20.f, 0.6f, 1.f, 1.f, srgb));
+
+	auto avg = static_cast<hsv*>(color_manipulation::color_calculation::average(colors));
+	EXPECT_NEAR(6.7f, avg->hue(), avg_error);
+	EXPECT_NEAR(0.7f, avg->saturation(), avg_error);
+	delete avg;
+
+	auto weighted = static_cast<hsv*>(color_manipulation::color_calculation::weighted_average(colors, { 1.f, 0.f, 0.f }));
+	EXPECT_NEAR(350.f, weighted->hue(), avg_error);
+	EXPECT_NEAR(1.f, weighted->saturation(), avg_error);
+	delete weighted;
+
+	EXPECT_ANY_THROW(color_manipulation::color_calculation::weighted_average(colors, { 1.f }));
+	EXPECT_ANY_THROW(color_manipulation::color_calculation::weighted_average(colors, { 0.f, 0.f, 0.f }));
+}
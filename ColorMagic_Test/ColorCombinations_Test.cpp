@@ -261,4 +261,104 @@ TEST_F(ColorCombinations_Test, ComplimentarySplit)
 	EXPECT_NEAR(rgb_t_light_blue2->red(), static_cast<color_space::rgb_truecolor*>(triplet[2])->red(), avg_error);
 	EXPECT_NEAR(rgb_t_light_blue2->green(), static_cast<color_space::rgb_truecolor*>(triplet[2])->green(), avg_error);
 	EXPECT_NEAR(rgb_t_light_blue2->blue(), static_cast<color_space::rgb_truecolor*>(triplet[2])->blue(), avg_error);
-}
\ No newline at end of file
+}
+TEST_F(ColorCombinations_Test, Batch)
+{
+	std::vector<rgb_truecolor*> bases = { rgb_t_red, rgb_t_orange, rgb_t_yellow, rgb_t_mint, rgb_t_light_blue, rgb_t_violet, rgb_t_pink2 };
+	color_buffer base_colors(color_type::RGB_TRUE, srgb);
+	for (auto color : bases) base_colors.push_back(*color);
+
+	// The batch versions give the results of the functions for single colors.
+	color_buffer combinations(color_type::RGB_TRUE, srgb, bases.size() * 5);
+	color_manipulation::color_combinations::create_combination(base_colors, 5, combinations);
+	color_buffer analogous(color_type::RGB_TRUE, srgb, bases.size() * 3);
+	color_manipulation::color_combinations::create_analogous(base_colors, 25.f, analogous);
+	color_buffer splits(color_type::RGB_TRUE, srgb, bases.size() * 3);
+	color_manipulation::color_combinations::create_complimentary_split(base_colors, 30.f, splits);
+
+	for (size_t i = 0; i < bases.size(); ++i)
+	{
+		std::vector<std::pair<std::vector<color_base*>, const color_buffer*>> expected = {
+			{ color_manipulation::color_combinations::create_combination(bases[i], 5), &combinations },
+			{ color_manipulation::color_combinations::create_analogous(bases[i], 25.f), &analogous },
+			{ color_manipulation::color_combinations::create_complimentary_split(bases[i], 30.f), &splits } };
+		for (auto& harmony : expected)
+		{
+			const size_t count = harmony.first.size();
+			for (size_t j = 0; j < count; ++j)
+			{
+				const float* result = harmony.second->pixel(i * count + j);
+				for (size_t c = 0; c < 4; ++c) EXPECT_NEAR(harmony.first[j]->get_components().size() > c ? harmony.first[j]->get_components()[c] : harmony.first[j]->alpha(), result[c], avg_error);
+				delete harmony.first[j];
+			}
+		}
+	}
+
+	// In lch_ab the hue turns by the offsets while lightness and chroma stay.
+	color_buffer lab_colors(color_type::LAB, srgb, bases.size() * 3);
+	color_manipulation::color_combinations::create_analogous(base_colors, 40.f, lab_colors, color_manipulation::HARMONY_LCH_AB);
+	for (size_t i = 0; i < bases.size(); ++i)
+	{
+		const float* base = lab_colors.pixel(i * 3 + 1);
+		for (size_t j = 0; j < 3; j += 2)
+		{
+			const float* color = lab_colors.pixel(i * 3 + j);
+			EXPECT_NEAR(base[0], color[0], 0.001f);
+			EXPECT_NEAR(sqrtf(base[1] * base[1] + base[2] * base[2]), sqrtf(color[1] * color[1] + color[2] * color[2]), 0.01f);
+			float turn = (atan2f(color[2], color[1]) - atan2f(base[2], base[1])) * 180.f / (float)M_PI;
+			if (turn > 180.f) turn -= 360.f;
+			if (turn < -180.f) turn += 360.f;
+			EXPECT_NEAR(j == 0 ? -40.f : 40.f, turn, 0.01f);
+		}
+	}
+
+	color_buffer wrong_size(color_type::RGB_TRUE, srgb, 2);
+	EXPECT_ANY_THROW(color_manipulation::color_combinations::create_analogous(base_colors, 25.f, wrong_size));
+	EXPECT_ANY_THROW(color_manipulation::color_combinations::create_combination(base_colors, 1, combinations));
+}
+
+TEST_F(ColorCombinations_Test, Batch_Monochromatic)
+{
+	std::vector<rgb_truecolor*> bases = { rgb_t_red, rgb_t_orange, rgb_t_mint, rgb_t_light_blue, rgb_t_pink2 };
+	color_buffer base_colors(color_type::RGB_TRUE, srgb);
+	for (auto color : bases) base_colors.push_back(*color);
+
+	for (int mode = 0; mode < 3; ++mode)
+	{
+		color_buffer result(color_type::RGB_TRUE, srgb, bases.size() * 4);
+		color_manipulation::color_combinations::create_monochromatic(base_colors, mode, 0.3f, 4, result);
+		for (size_t i = 0; i < bases.size(); ++i)
+		{
+			auto expected = color_manipulation::color_combinations::create_monochromatic(bases[i], mode, 0.3f, 4);
+			for (size_t j = 0; j < expected.size(); ++j)
+			{
+				auto color = static_cast<rgb_truecolor*>(expected[j]);
+				EXPECT_NEAR(color->red(), result.pixel(i * 4 + j)[0], avg_error);
+				EXPECT_NEAR(color->green(), result.pixel(i * 4 + j)[1], avg_error);
+				EXPECT_NEAR(color->blue(), result.pixel(i * 4 + j)[2], avg_error);
+				EXPECT_NEAR(color->alpha(), result.pixel(i * 4 + j)[3], avg_error);
+				delete color;
+			}
+		}
+	}
+
+	// In lch_ab lightness and chroma shrink geometrically, the hue stays.
+	color_buffer lab_colors(color_type::LAB, srgb, bases.size() * 3);
+	color_manipulation::color_combinations::create_monochromatic(base_colors, 2, 0.5f, 3, lab_colors, color_manipulation::HARMONY_LCH_AB);
+	for (size_t i = 0; i < bases.size(); ++i)
+	{
+		const float* base = lab_colors.pixel(i * 3);
+		for (size_t j = 1; j < 3; ++j)
+		{
+			const float* color = lab_colors.pixel(i * 3 + j);
+			const float factor = j == 1 ? 0.5f : 0.25f;
+			EXPECT_NEAR(base[0] * factor, color[0], 0.001f);
+			EXPECT_NEAR(base[1] * factor, color[1], 0.001f);
+			EXPECT_NEAR(base[2] * factor, color[2], 0.001f);
+		}
+	}
+
+	color_buffer wrong_size(color_type::RGB_TRUE, srgb, 3);
+	EXPECT_ANY_THROW(color_manipulation::color_combinations::create_monochromatic(base_colors, 0, 0.3f, 4, wrong_size));
+	EXPECT_ANY_THROW(color_manipulation::color_combinations::create_monochromatic(base_colors, 3, 0.3f, 1, lab_colors));
+}
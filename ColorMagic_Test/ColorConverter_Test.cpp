@@ -550,4 +550,40 @@ TEST_F(ColorConverter_Test, To_LAB)
 	EXPECT_NEAR(lab_yellow->luminance(), color_manipulation::color_converter::to_lab(lab_yellow)->luminance(), avg_error);
 	EXPECT_NEAR(lab_yellow->a(), color_manipulation::color_converter::to_lab(lab_yellow)->a(), avg_error);
 	EXPECT_NEAR(lab_yellow->b(), color_manipulation::color_converter::to_lab(lab_yellow)->b(), avg_error);
-}
\ No newline at end of file
+}
+TEST_F(ColorConverter_Test, Value_Overloads)
+{
+	std::vector<color_base*> colors = { cmyk_yellow, hsv_yellow, hsl_yellow, xyz_yellow, xyy_yellow, luv_yellow, lch_uv_orange, lch_ab_yellow, lab_yellow, grey_d, grey_t, rgb_d_yellow, rgb_t_yellow };
+
+	for (color_base* color : colors)
+	{
+		lab lab_value = color_manipulation::color_converter::to_lab(*color);
+		lab* lab_pointer = color_manipulation::color_converter::to_lab(color);
+		EXPECT_NEAR(lab_pointer->luminance(), lab_value.luminance(), avg_error);
+		EXPECT_NEAR(lab_pointer->a(), lab_value.a(), avg_error);
+		EXPECT_NEAR(lab_pointer->b(), lab_value.b(), avg_error);
+		EXPECT_NEAR(lab_pointer->alpha(), lab_value.alpha(), avg_error);
+		if (lab_pointer != color) delete lab_pointer;
+
+		rgb_truecolor rgb_value = color_manipulation::color_converter::to_rgb_true(*color);
+		rgb_truecolor* rgb_pointer = color_manipulation::color_converter::to_rgb_true(color);
+		EXPECT_NEAR(rgb_pointer->red(), rgb_value.red(), avg_error);
+		EXPECT_NEAR(rgb_pointer->green(), rgb_value.green(), avg_error);
+		EXPECT_NEAR(rgb_pointer->blue(), rgb_value.blue(), avg_error);
+		EXPECT_NEAR(rgb_pointer->alpha(), rgb_value.alpha(), avg_error);
+		if (rgb_pointer != color) delete rgb_pointer;
+	}
+
+	lab out_color(0.f, 0.f, 0.f, 0.f, nullptr);
+	color_manipulation::color_converter::rgb_deep_to_lab(*rgb_d_yellow, out_color);
+	EXPECT_NEAR(lab_yellow->luminance(), out_color.luminance(), avg_error);
+	EXPECT_NEAR(lab_yellow->a(), out_color.a(), avg_error);
+	EXPECT_NEAR(lab_yellow->b(), out_color.b(), avg_error);
+	EXPECT_NEAR(1.f, out_color.alpha(), avg_error);
+	EXPECT_EQ(srgb, out_color.get_rgb_color_space());
+
+	// The input color is not linearized by the conversion.
+	rgb_deepcolor orange(1.f, 0.5f, 0.f, 1.f, srgb);
+	color_manipulation::color_converter::rgb_deep_to_xyz(orange);
+	EXPECT_FLOAT_EQ(0.5f, orange.green());
+}
@@ -0,0 +1,105 @@
+#include "gtest\gtest.h"
+#include "pch.h"
+#include "..\ColorMagic\spaces\rgb_truecolor.h"
+#include "..\ColorMagic\spaces\rgb_deepcolor.h"
+#include "..\ColorMagic\spaces\hsv.h"
+#include "..\ColorMagic\manipulation\color_histogram.h"
+
+using namespace color_space;
+
+class ColorHistogram_Test : public ::testing::Test {
+protected:
+	float avg_error = 0.001f;
+
+	rgb_color_space_definition* srgb;
+
+	virtual void SetUp()
+	{
+		srgb = rgb_color_space_definition_presets().sRGB();
+	}
+
+	virtual void TearDown()
+	{
+		delete srgb;
+	}
+};
+
+TEST_F(ColorHistogram_Test, Binning_Tests)
+{
+	color_manipulation::color_histogram histogram(color_type::RGB_TRUE, { 4, 4, 4 }, srgb);
+	ASSERT_EQ(64, histogram.bin_count());
+
+	color_buffer colors(color_type::RGB_TRUE, srgb);
+	for (int i = 0; i < 300000; ++i)
+	{
+		colors.push_back(rgb_truecolor(i % 3 == 0 ? 255.f : 10.f, 10.f, 200.f, 255.f, srgb));
+	}
+	histogram.add(colors);
+	histogram.add(rgb_truecolor(300.f, -5.f, 64.f, 255.f, srgb));
+
+	EXPECT_EQ(300001, histogram.total());
+	EXPECT_EQ(200000, histogram.count(0 * 16 + 0 * 4 + 3));
+	EXPECT_EQ(100000, histogram.count(3 * 16 + 0 * 4 + 3));
+	EXPECT_EQ(1, histogram.count(3 * 16 + 0 * 4 + 1));
+
+	auto dominant = histogram.dominant_bins(5);
+	ASSERT_EQ(3, dominant.size());
+	EXPECT_EQ(3, dominant[0]);
+	EXPECT_EQ(51, dominant[1]);
+
+	auto center = static_cast<rgb_truecolor*>(histogram.bin_center(dominant[0]));
+	EXPECT_NEAR(31.875f, center->red(), avg_error);
+	EXPECT_NEAR(31.875f, center->green(), avg_error);
+	EXPECT_NEAR(223.125f, center->blue(), avg_error);
+	delete center;
+
+	histogram.clear();
+	EXPECT_EQ(0, histogram.total());
+	EXPECT_TRUE(histogram.dominant_bins(3).empty());
+}
+
+TEST_F(ColorHistogram_Test, Conversion_Tests)
+{
+	color_buffer colors(color_type::RGB_DEEP, srgb);
+	colors.push_back(rgb_deepcolor(1.f, 0.f, 0.f, 1.f, srgb));
+	colors.push_back(rgb_deepcolor(1.f, 0.f, 0.05f, 1.f, srgb));
+	colors.push_back(rgb_deepcolor(0.f, 0.f, 1.f, 1.f, srgb));
+
+	color_manipulation::color_histogram fused(color_type::HSV, { 12, 2, 2 }, srgb);
+	fused.add(colors);
+	EXPECT_EQ(1, fused.count(0 * 4 + 1 * 2 + 1));
+	EXPECT_EQ(1, fused.count(11 * 4 + 1 * 2 + 1));
+	EXPECT_EQ(1, fused.count(8 * 4 + 1 * 2 + 1));
+
+	color_manipulation::color_histogram converted(color_type::HSV, { 12, 2, 2 }, srgb);
+	for (size_t i = 0; i < colors.size(); ++i)
+	{
+		std::unique_ptr<color_base> color(colors.create_color(i));
+		converted.add(*color);
+	}
+	EXPECT_EQ(fused.counts(), converted.counts());
+	EXPECT_NEAR(1.f, color_manipulation::color_histogram::intersection(fused, converted), avg_error);
+
+	color_manipulation::color_histogram blues(color_type::HSV, { 12, 2, 2 }, srgb);
+	blues.add(hsv(240.f, 1.f, 1.f, 1.f, srgb));
+	EXPECT_NEAR(1.f / 3.f, color_manipulation::color_histogram::intersection(fused, blues), avg_error);
+
+	fused.merge(blues);
+	EXPECT_EQ(4, fused.total());
+	EXPECT_EQ(2, fused.count(8 * 4 + 1 * 2 + 1));
+
+	// Hues wrap around.
+	fused.add(hsv(375.f, 1.f, 1.f, 1.f, srgb));
+	fused.add(hsv(-15.f, 1.f, 1.f, 1.f, srgb));
+	EXPECT_EQ(2, fused.count(0 * 4 + 1 * 2 + 1));
+	EXPECT_EQ(2, fused.count(11 * 4 + 1 * 2 + 1));
+
+	color_manipulation::color_histogram lab(color_type::LAB, { 10, 8, 8 }, srgb);
+	lab.add(colors);
+	EXPECT_EQ(3, lab.total());
+
+	EXPECT_ANY_THROW(fused.merge(lab));
+	EXPECT_ANY_THROW(color_manipulation::color_histogram(color_type::XYZ, { 4, 4, 4 }, srgb));
+	EXPECT_ANY_THROW(color_manipulation::color_histogram(color_type::HSV, { 4, 4 }, srgb));
+	EXPECT_NO_THROW(color_manipulation::color_histogram(color_type::XYZ, { 4, 4, 4 }, { 0.f, 0.f, 0.f }, { 96.f, 100.f, 109.f }, srgb));
+}
@@ -0,0 +1,147 @@
+#include "gtest\gtest.h"
+#include "pch.h"
+#include "..\ColorMagic\spaces\rgb_deepcolor.h"
+#include "..\ColorMagic\spaces\rgb_truecolor.h"
+#include "..\ColorMagic\utils\color_parser.h"
+
+#include <cstring>
+#include <random>
+#include <string>
+
+using namespace color_space;
+
+class ColorParser_Test : public ::testing::Test {
+protected:
+	float avg_error = 0.001f;
+
+	rgb_color_space_definition* srgb;
+
+	virtual void SetUp()
+	{
+		srgb = rgb_color_space_definition_presets().sRGB();
+	}
+
+	virtual void TearDown()
+	{
+		delete srgb;
+	}
+
+	void expect_color(const char* text, float r, float g, float b, float a)
+	{
+		float rgba[4];
+		ASSERT_TRUE(color_parser::parse(text, strlen(text), rgba)) << text;
+		EXPECT_NEAR(r, rgba[0], avg_error) << text;
+		EXPECT_NEAR(g, rgba[1], avg_error) << text;
+		EXPECT_NEAR(b, rgba[2], avg_error) << text;
+		EXPECT_NEAR(a, rgba[3], avg_error) << text;
+	}
+
+	bool is_valid(const char* text)
+	{
+		float rgba[4];
+		return color_parser::parse(text, strlen(text), rgba);
+	}
+};
+
+TEST_F(ColorParser_Test, Hex_Tests)
+{
+	expect_color("#FF8000", 255.f, 128.f, 0.f, 255.f);
+	expect_color("ff8000", 255.f, 128.f, 0.f, 255.f);
+	expect_color("#80ff8000", 255.f, 128.f, 0.f, 128.f);
+	expect_color("#f80", 255.f, 136.f, 0.f, 255.f);
+	expect_color("  #0a0B0c \r", 10.f, 11.f, 12.f, 255.f);
+	expect_color("#09afAF", 9.f, 175.f, 175.f, 255.f);
+
+	// Every character next to the hex digits is rejected.
+	const char* invalid[] = { "#GG0000", "#0000:0", "#0000@0", "#0000`0", "#0000g0", "#00 000", "#0000/0", "f80", "#ff80", "#", "" };
+	for (const char* text : invalid) EXPECT_FALSE(is_valid(text)) << text;
+	for (int c = 1; c < 256; ++c)
+	{
+		const bool hex = (c >= '0' && c <= '9') || (c >= 'a' && c <= 'f') || (c >= 'A' && c <= 'F');
+		char text[] = "#123456";
+		text[4] = (char)c;
+		float rgba[4];
+		EXPECT_EQ(hex, color_parser::parse_hex(text, 7, rgba)) << c;
+	}
+
+	// The rgb true color constructor uses the same decoder.
+	rgb_truecolor color("#7F102030", srgb);
+	EXPECT_EQ(16.f, color.red());
+	EXPECT_EQ(32.f, color.green());
+	EXPECT_EQ(48.f, color.blue());
+	EXPECT_EQ(127.f, color.alpha());
+}
+
+TEST_F(ColorParser_Test, Css_Tests)
+{
+	expect_color("rgb(255, 128, 0)", 255.f, 128.f, 0.f, 255.f);
+	expect_color("RGB(255 128 0)", 255.f, 128.f, 0.f, 255.f);
+	expect_color("rgba(255, 128, 0, 0.5)", 255.f, 128.f, 0.f, 128.f);
+	expect_color("rgb(255 128 0 / 50%)", 255.f, 128.f, 0.f, 128.f);
+	expect_color("rgb(100%, 50%, 0%)", 255.f, 128.f, 0.f, 255.f);
+	expect_color("rgb(300, -5, 10.4)", 255.f, 0.f, 10.f, 255.f);
+	expect_color("hsl(120, 100%, 50%)", 0.f, 255.f, 0.f, 255.f);
+	expect_color("hsl(0deg 100% 25%)", 128.f, 0.f, 0.f, 255.f);
+	expect_color("hsla(240, 100%, 50%, 0.25)", 0.f, 0.f, 255.f, 64.f);
+	expect_color("hsl(-120, 100%, 50%)", 0.f, 0.f, 255.f, 255.f);
+	expect_color("hsl(30, 50%, 60%)", 204.f, 153.f, 102.f, 255.f);
+
+	const char* invalid[] = { "rgb(255, 0)", "rgb(255, 0, 0", "rgb(255, 0, 0))", "rgb(a, 0, 0)", "rgb(1, 2, 3, 4, 5)", "hsl()" };
+	for (const char* text : invalid) EXPECT_FALSE(is_valid(text)) << text;
+}
+
+TEST_F(ColorParser_Test, Name_Tests)
+{
+	expect_color("AliceBlue", 240.f, 248.f, 255.f, 255.f);
+	expect_color("yellowgreen", 154.f, 205.f, 50.f, 255.f);
+	expect_color(" RED ", 255.f, 0.f, 0.f, 255.f);
+	EXPECT_FALSE(is_valid("Reddish"));
+	EXPECT_FALSE(is_valid("Re"));
+}
+
+TEST_F(ColorParser_Test, Bulk_Tests)
+{
+	const std::string text = "#FF0000\r\nlime\n\nrgba(0, 0, 255, 0.5)\nnot a color\n  #80808080  \n#12";
+	std::vector<size_t> invalid_lines;
+	color_buffer colors = color_parser::parse_lines(text.data(), text.size(), srgb, &invalid_lines);
+	ASSERT_EQ(color_type::RGB_TRUE, colors.get_color_type());
+	ASSERT_EQ(4u, colors.size());
+	EXPECT_EQ(std::vector<size_t>({ 4, 6 }), invalid_lines);
+	EXPECT_EQ(255.f, colors.pixel(0)[0]);
+	EXPECT_EQ(255.f, colors.pixel(1)[1]);
+	EXPECT_EQ(128.f, colors.pixel(2)[3]);
+	EXPECT_EQ(128.f, colors.pixel(3)[3]);
+	EXPECT_ANY_THROW(color_parser::parse_lines(text.data(), text.size(), srgb));
+
+	// Formatting and parsing many random colors gives the same colors.
+	std::mt19937 random(7);
+	std::uniform_int_distribution<int> distribution(0, 255);
+	color_buffer original(color_type::RGB_TRUE, srgb);
+	for (int i = 0; i < 20000; ++i)
+	{
+		original.push_back(rgb_truecolor((float)distribution(random), (float)distribution(random), (float)distribution(random), (float)distribution(random), srgb));
+	}
+
+	for (color_text_format format : { HEX_AARRGGBB, CSS_RGB })
+	{
+		const std::string formatted = color_parser::format(original, format);
+		color_buffer parsed = color_parser::parse_lines(formatted.data(), formatted.size(), srgb);
+		ASSERT_EQ(original.size(), parsed.size());
+		for (size_t i = 0; i < original.size(); ++i)
+		{
+			for (size_t c = 0; c < 3; ++c) ASSERT_EQ(original.pixel(i)[c], parsed.pixel(i)[c]);
+			ASSERT_EQ(original.pixel(i)[3], parsed.pixel(i)[3]) << format;
+		}
+	}
+
+	const float rgba[4] = { 255.f, 128.f, 0.f, 128.f };
+	char formatted[color_parser::max_text_length];
+	EXPECT_EQ("#FF8000", std::string(formatted, color_parser::format(rgba, HEX_RRGGBB, formatted)));
+	EXPECT_EQ("#80FF8000", std::string(formatted, color_parser::format(rgba, HEX_AARRGGBB, formatted)));
+	EXPECT_EQ("rgba(255, 128, 0, 0.502)", std::string(formatted, color_parser::format(rgba, CSS_RGB, formatted)));
+
+	// Other color types are converted.
+	color_buffer deep(color_type::RGB_DEEP, srgb);
+	deep.push_back(rgb_deepcolor(1.f, 0.5f, 0.f, 1.f, srgb));
+	EXPECT_EQ("rgb(255, 128, 0);", color_parser::format(deep, CSS_RGB, ';'));
+}
@@ -0,0 +1,195 @@
+#include "gtest\gtest.h"
+#include "pch.h"
+#include "..\ColorMagic\spaces\rgb_deepcolor.h"
+#include "..\ColorMagic\manipulation\color_quantization.h"
+#include "..\ColorMagic\manipulation\color_distance.h"
+#include "..\ColorMagic\utils\parallel.h"
+
+#include <numeric>
+#include <random>
+
+using namespace color_space;
+
+class ColorQuantization_Test : public ::testing::Test {
+protected:
+	float avg_error = 0.001f;
+
+	rgb_color_space_definition* srgb;
+
+	virtual void SetUp()
+	{
+		srgb = rgb_color_space_definition_presets().sRGB();
+	}
+
+	virtual void TearDown()
+	{
+		delete srgb;
+	}
+
+	//! Three noisy clusters around red, green and blue with 50%, 30% and 20% of the pixels.
+	color_buffer create_image(size_t size)
+	{
+		std::mt19937 random(42);
+		std::uniform_int_distribution<int> distribution(0, 69);
+		color_buffer colors(color_type::RGB_DEEP, srgb);
+		for (size_t i = 0; i < size; ++i)
+		{
+			int value = distribution(random);
+			float noise = (value % 7) * 0.005f;
+			int cluster = value / 7;
+			if (cluster < 5) colors.push_back(rgb_deepcolor(0.9f + noise, noise, noise, 1.f, srgb));
+			else if (cluster < 8) colors.push_back(rgb_deepcolor(noise, 0.8f + noise, noise, 1.f, srgb));
+			else colors.push_back(rgb_deepcolor(noise, noise, 0.9f + noise, 1.f, srgb));
+		}
+		return colors;
+	}
+
+	template<class T>
+	void check_palette(const std::vector<T*>& palette, const std::vector<float>& shares, float error)
+	{
+		ASSERT_EQ(3, palette.size());
+		EXPECT_NEAR(0.5f, shares[0], 0.02f);
+		EXPECT_NEAR(0.3f, shares[1], 0.02f);
+		EXPECT_NEAR(0.2f, shares[2], 0.02f);
+
+		rgb_deepcolor red = color_manipulation::color_converter::to_rgb_deep(*palette[0]);
+		rgb_deepcolor green = color_manipulation::color_converter::to_rgb_deep(*palette[1]);
+		rgb_deepcolor blue = color_manipulation::color_converter::to_rgb_deep(*palette[2]);
+		EXPECT_NEAR(0.915f, red.red(), error);
+		EXPECT_NEAR(0.815f, green.green(), error);
+		EXPECT_NEAR(0.915f, blue.blue(), error);
+	}
+};
+
+TEST_F(ColorQuantization_Test, K_Means_Tests)
+{
+	color_buffer colors = create_image(100000);
+
+	std::vector<float> shares;
+	auto palette = color_manipulation::color_quantization::k_means(colors, 3, color_manipulation::k_means_settings(), &shares);
+	check_palette(palette, shares, 0.02f);
+
+	// The result does not depend on the number of threads.
+	parallel::set_thread_count(1);
+	auto single = color_manipulation::color_quantization::k_means(colors, 3);
+	parallel::set_thread_count(0);
+	for (size_t i = 0; i < palette.size(); ++i)
+	{
+		EXPECT_EQ(palette[i]->luminance(), single[i]->luminance());
+		EXPECT_EQ(palette[i]->a(), single[i]->a());
+		EXPECT_EQ(palette[i]->b(), single[i]->b());
+		delete palette[i];
+		delete single[i];
+	}
+
+	// Fewer distinct colors than requested.
+	color_buffer two(color_type::RGB_DEEP, srgb);
+	two.push_back(rgb_deepcolor(1.f, 1.f, 1.f, 1.f, srgb));
+	two.push_back(rgb_deepcolor(0.f, 0.f, 0.f, 1.f, srgb));
+	two.push_back(rgb_deepcolor(1.f, 1.f, 1.f, 1.f, srgb));
+	palette = color_manipulation::color_quantization::k_means(two, 5, color_manipulation::k_means_settings(), &shares);
+	ASSERT_EQ(2, palette.size());
+	EXPECT_NEAR(100.f, palette[0]->luminance(), 0.01f);
+	EXPECT_NEAR(2.f / 3.f, shares[0], avg_error);
+	for (auto color : palette) delete color;
+
+	EXPECT_ANY_THROW(color_manipulation::color_quantization::k_means(color_buffer(color_type::RGB_DEEP, srgb), 3));
+	EXPECT_ANY_THROW(color_manipulation::color_quantization::k_means(two, 0));
+}
+
+TEST_F(ColorQuantization_Test, K_Means_Large_Input_Tests)
+{
+	color_buffer colors = create_image(200000);
+	std::vector<float> shares;
+
+	color_manipulation::k_means_settings settings;
+	settings.batch_size = 1024;
+	settings.max_iterations = 100;
+	auto palette = color_manipulation::color_quantization::k_means(colors, 3, settings, &shares);
+	check_palette(palette, shares, 0.03f);
+	for (auto color : palette) delete color;
+
+	settings = color_manipulation::k_means_settings();
+	settings.max_samples = 5000;
+	palette = color_manipulation::color_quantization::k_means(colors, 3, settings, &shares);
+	check_palette(palette, shares, 0.03f);
+	for (auto color : palette) delete color;
+
+	color_manipulation::color_histogram histogram(color_type::RGB_DEEP, { 16, 16, 16 }, srgb);
+	histogram.add(colors);
+	palette = color_manipulation::color_quantization::k_means(histogram, 3, color_manipulation::k_means_settings(), &shares);
+	check_palette(palette, shares, 0.05f);
+	for (auto color : palette) delete color;
+}
+
+TEST_F(ColorQuantization_Test, Median_Cut_Tests)
+{
+	color_buffer colors = create_image(100000);
+
+	std::vector<float> shares;
+	auto palette = color_manipulation::color_quantization::median_cut(colors, 16, color_type::RGB_DEEP, &shares);
+	ASSERT_GE(16, palette.size());
+	ASSERT_LE(3, palette.size());
+	EXPECT_NEAR(1.f, std::accumulate(shares.begin(), shares.end(), 0.f), avg_error);
+	EXPECT_TRUE(std::is_sorted(shares.rbegin(), shares.rend()));
+
+	// Every cluster is represented by a palette color.
+	std::vector<rgb_deepcolor> clusters = { rgb_deepcolor(0.915f, 0.015f, 0.015f, 1.f, srgb), rgb_deepcolor(0.015f, 0.815f, 0.015f, 1.f, srgb), rgb_deepcolor(0.015f, 0.015f, 0.915f, 1.f, srgb) };
+	for (auto& cluster : clusters)
+	{
+		float nearest = 1.f;
+		for (auto color : palette) nearest = std::min(nearest, color_manipulation::color_distance::euclidean_distance(&cluster, color));
+		EXPECT_GT(0.05f, nearest);
+	}
+	for (auto color : palette) delete color;
+
+	// Fewer distinct colors than requested, in lab.
+	color_buffer two(color_type::RGB_DEEP, srgb);
+	two.push_back(rgb_deepcolor(1.f, 1.f, 1.f, 1.f, srgb));
+	two.push_back(rgb_deepcolor(0.f, 0.f, 0.f, 1.f, srgb));
+	two.push_back(rgb_deepcolor(1.f, 1.f, 1.f, 1.f, srgb));
+	palette = color_manipulation::color_quantization::median_cut(two, 256, color_type::LAB, &shares);
+	ASSERT_EQ(2, palette.size());
+	EXPECT_EQ(color_type::LAB, palette[0]->get_color_type());
+	EXPECT_NEAR(2.f / 3.f, shares[0], avg_error);
+	EXPECT_LT(95.f, static_cast<lab*>(palette[0])->luminance());
+	for (auto color : palette) delete color;
+
+	EXPECT_ANY_THROW(color_manipulation::color_quantization::median_cut(color_buffer(color_type::RGB_DEEP, srgb), 3));
+}
+
+TEST_F(ColorQuantization_Test, Octree_Tests)
+{
+	color_buffer colors = create_image(100000);
+
+	std::vector<float> shares;
+	auto palette = color_manipulation::color_quantization::octree(colors, 3, color_type::RGB_DEEP, &shares);
+	check_palette(palette, shares, 0.02f);
+	for (auto color : palette) delete color;
+
+	// Uniformly distributed colors fill the whole palette.
+	std::mt19937 random(7);
+	std::uniform_real_distribution<float> distribution(0.f, 1.f);
+	color_buffer noise(color_type::RGB_DEEP, srgb);
+	for (int i = 0; i < 50000; ++i) noise.push_back(rgb_deepcolor(distribution(random), distribution(random), distribution(random), 1.f, srgb));
+
+	palette = color_manipulation::color_quantization::octree(noise, 256, color_type::RGB_DEEP, &shares);
+	EXPECT_GE(256, palette.size());
+	EXPECT_LT(200, palette.size());
+	EXPECT_NEAR(1.f, std::accumulate(shares.begin(), shares.end(), 0.f), avg_error);
+	for (auto color : palette) delete color;
+
+	palette = color_manipulation::color_quantization::median_cut(noise, 256);
+	EXPECT_EQ(256, palette.size());
+	for (auto color : palette) delete color;
+
+	// A single color is the mean of all colors.
+	palette = color_manipulation::color_quantization::octree(noise, 1, color_type::RGB_DEEP, &shares);
+	ASSERT_EQ(1, palette.size());
+	EXPECT_NEAR(0.5f, static_cast<rgb_deepcolor*>(palette[0])->green(), 0.01f);
+	EXPECT_NEAR(1.f, shares[0], avg_error);
+	for (auto color : palette) delete color;
+
+	EXPECT_ANY_THROW(color_manipulation::color_quantization::octree(colors, 3, color_type::CMYK));
+	EXPECT_ANY_THROW(color_manipulation::color_quantization::octree(colors, 0));
+}
@@ -0,0 +1,213 @@
+#include "gtest\gtest.h"
+#include "pch.h"
+#include "..\ColorMagic\spaces\rgb_deepcolor.h"
+#include "..\ColorMagic\spaces\rgb_truecolor.h"
+#include "..\ColorMagic\manipulation\palette_search.h"
+#include "..\ColorMagic\manipulation\error_diffusion.h"
+#include "..\ColorMagic\manipulation\ordered_dither.h"
+
+#include <cmath>
+#include <memory>
+#include <numeric>
+#include <random>
+
+using namespace color_space;
+
+class Dithering_Test : public ::testing::Test {
+protected:
+	float avg_error = 0.001f;
+
+	rgb_color_space_definition* srgb;
+	std::vector<color_base*> palette;
+
+	virtual void SetUp()
+	{
+		srgb = rgb_color_space_definition_presets().sRGB();
+
+		std::mt19937 random(3);
+		std::uniform_real_distribution<float> distribution(0.f, 1.f);
+		for (int i = 0; i < 64; ++i) palette.push_back(new rgb_deepcolor(distribution(random), distribution(random), distribution(random), 1.f, srgb));
+	}
+
+	virtual void TearDown()
+	{
+		for (auto color : palette) delete color;
+		delete srgb;
+	}
+
+	float distance(color_manipulation::distance_metric metric, color_base* color1, color_base* color2)
+	{
+		switch (metric)
+		{
+		case color_manipulation::EUCLIDEAN_WEIGHTED: return color_manipulation::color_distance::euclidean_distance_weighted(color1, color2);
+		case color_manipulation::DELTA_E_CIE76: return color_manipulation::color_distance::cielab_delta_e_cie76(color1, color2);
+		case color_manipulation::DELTA_E_CIE94: return color_manipulation::color_distance::cielab_delta_e_cie94(color1, color2);
+		case color_manipulation::DELTA_E_CIE00: return color_manipulation::color_distance::cielab_delta_e_cie00(color1, color2);
+		case color_manipulation::DELTA_E_CMC: return color_manipulation::color_distance::cmc_delta_e_lc84(color1, color2);
+		default: return color_manipulation::color_distance::euclidean_distance(color1, color2);
+		}
+	}
+};
+
+TEST_F(Dithering_Test, Palette_Search_Tests)
+{
+	std::mt19937 random(11);
+	std::uniform_real_distribution<float> distribution(0.f, 1.f);
+
+	for (int metric = color_manipulation::EUCLIDEAN_RGB; metric <= color_manipulation::DELTA_E_CMC; ++metric)
+	{
+		color_manipulation::palette_search search(palette, (color_manipulation::distance_metric)metric);
+		ASSERT_EQ(64, search.size());
+
+		for (int i = 0; i < 100; ++i)
+		{
+			rgb_truecolor color(distribution(random) * 255.f, distribution(random) * 255.f, distribution(random) * 255.f, 255.f, srgb);
+			size_t found = search.nearest(color);
+
+			float best = distance((color_manipulation::distance_metric)metric, &color, palette[found]);
+			for (auto entry : palette)
+			{
+				// cielab_delta_e_cie00() is not defined for some pairs, the search skips them.
+				float d = distance((color_manipulation::distance_metric)metric, &color, entry);
+				if (!std::isnan(d)) EXPECT_LE(best, d + avg_error);
+			}
+		}
+	}
+
+	EXPECT_ANY_THROW(color_manipulation::palette_search(std::vector<color_base*>()));
+}
+
+TEST_F(Dithering_Test, Error_Diffusion_Tests)
+{
+	rgb_deepcolor black(0.f, 0.f, 0.f, 1.f, srgb), white(1.f, 1.f, 1.f, 1.f, srgb);
+	color_manipulation::palette_search search({ &black, &white });
+
+	// A flat grey keeps its mean brightness.
+	const size_t width = 64, height = 32;
+	color_buffer image(color_type::RGB_DEEP, srgb);
+	for (size_t i = 0; i < width * height; ++i) image.push_back(rgb_deepcolor(0.25f, 0.25f, 0.25f, 1.f, srgb));
+
+	const color_manipulation::diffusion_kernel kernels[] = { color_manipulation::FLOYD_STEINBERG, color_manipulation::SIERRA, color_manipulation::SIERRA_LITE, color_manipulation::ATKINSON };
+	for (auto kernel : kernels)
+	{
+		for (bool serpentine : { false, true })
+		{
+			auto indices = color_manipulation::error_diffusion::dither(image, width, search, kernel, serpentine);
+			ASSERT_EQ(width * height, indices.size());
+
+			size_t white_pixels = 0;
+			for (auto index : indices) white_pixels += index;
+			EXPECT_NEAR(0.25f, white_pixels / (float)indices.size(), kernel == color_manipulation::ATKINSON ? 0.1f : 0.02f);
+		}
+	}
+
+	// Streaming row by row gives the same result as the whole image.
+	auto expected = color_manipulation::error_diffusion::dither(image, width, search, color_manipulation::SIERRA);
+	color_manipulation::error_diffusion diffusion(search, width, color_manipulation::SIERRA);
+	color_buffer row(color_type::RGB_DEEP, srgb, width);
+	std::vector<uint8_t> indices(width);
+	for (size_t y = 0; y < height; ++y)
+	{
+		std::copy(image.pixel(y * width), image.pixel((y + 1) * width), row.data());
+		diffusion.dither_row(row, 0, indices.data());
+		EXPECT_TRUE(std::equal(indices.begin(), indices.end(), expected.begin() + y * width));
+	}
+
+	// Other color types are converted.
+	color_buffer true_image(color_type::RGB_TRUE, srgb);
+	for (size_t i = 0; i < width * height; ++i) true_image.push_back(rgb_truecolor(63.75f, 63.75f, 63.75f, 255.f, srgb));
+	EXPECT_EQ(expected, color_manipulation::error_diffusion::dither(true_image, width, search, color_manipulation::SIERRA));
+
+	EXPECT_ANY_THROW(color_manipulation::error_diffusion::dither(image, width + 1, search));
+}
+
+TEST_F(Dithering_Test, Ordered_Dither_Matrix_Tests)
+{
+	const color_manipulation::dither_matrix matrices[] = { color_manipulation::BAYER_2, color_manipulation::BAYER_4, color_manipulation::BAYER_8, color_manipulation::BAYER_16, color_manipulation::BLUE_NOISE };
+	const size_t sizes[] = { 2, 4, 8, 16, 64 };
+	for (size_t m = 0; m < 5; ++m)
+	{
+		color_manipulation::ordered_dither dither(matrices[m]);
+		ASSERT_EQ(sizes[m], dither.size());
+
+		// Every threshold occurs exactly once.
+		std::vector<float> thresholds;
+		for (size_t y = 0; y < dither.size(); ++y)
+		{
+			for (size_t x = 0; x < dither.size(); ++x) thresholds.push_back(dither.threshold(x, y));
+		}
+		std::sort(thresholds.begin(), thresholds.end());
+		const float count = (float)thresholds.size();
+		for (size_t i = 0; i < thresholds.size(); ++i) EXPECT_NEAR((i + 0.5f) / count - 0.5f, thresholds[i], 1e-6f);
+
+		EXPECT_EQ(dither.threshold(1, 0), dither.threshold(1 + dither.size(), 2 * dither.size()));
+	}
+
+	color_manipulation::ordered_dither bayer(color_manipulation::BAYER_2);
+	EXPECT_NEAR(-0.375f, bayer.threshold(0, 0), avg_error);
+	EXPECT_NEAR(0.125f, bayer.threshold(1, 0), avg_error);
+	EXPECT_NEAR(0.375f, bayer.threshold(0, 1), avg_error);
+	EXPECT_NEAR(-0.125f, bayer.threshold(1, 1), avg_error);
+
+	// Blue noise has no low frequencies: the thresholds of every 8x8 block average close to 0.
+	color_manipulation::ordered_dither blue_noise(color_manipulation::BLUE_NOISE);
+	for (size_t by = 0; by < 64; by += 8)
+	{
+		for (size_t bx = 0; bx < 64; bx += 8)
+		{
+			float sum = 0.f;
+			for (size_t y = by; y < by + 8; ++y)
+			{
+				for (size_t x = bx; x < bx + 8; ++x) sum += blue_noise.threshold(x, y);
+			}
+			EXPECT_NEAR(0.f, sum / 64.f, 0.1f);
+		}
+	}
+}
+
+TEST_F(Dithering_Test, Ordered_Dither_Tests)
+{
+	// A value between two 8-bit levels keeps its average instead of being rounded.
+	const size_t width = 64, height = 64;
+	color_buffer image(color_type::RGB_DEEP, srgb);
+	for (size_t i = 0; i < width * height; ++i) image.push_back(rgb_deepcolor(100.25f / 255.f, 0.5f, 1.f, 1.f, srgb));
+
+	for (auto matrix : { color_manipulation::BAYER_8, color_manipulation::BLUE_NOISE })
+	{
+		color_manipulation::ordered_dither dither(matrix);
+		color_buffer result = dither.to_rgb_true(image, width);
+		ASSERT_EQ(color_type::RGB_TRUE, result.get_color_type());
+		ASSERT_EQ(image.size(), result.size());
+
+		float red = 0.f;
+		for (size_t i = 0; i < result.size(); ++i)
+		{
+			red += result.pixel(i)[0];
+			EXPECT_TRUE(result.pixel(i)[0] == 100.f || result.pixel(i)[0] == 101.f);
+			EXPECT_TRUE(result.pixel(i)[1] == 127.f || result.pixel(i)[1] == 128.f);
+			EXPECT_EQ(255.f, result.pixel(i)[2]);
+			EXPECT_EQ(255.f, result.pixel(i)[3]);
+		}
+		EXPECT_NEAR(100.25f, red / result.size(), 0.01f);
+	}
+
+	// Other color types are converted and the raw output matches the buffer output.
+	color_manipulation::ordered_dither dither;
+	color_buffer lab_image = color_manipulation::color_converter::convert_buffer(image, color_type::LAB);
+	color_buffer expected = dither.to_rgb_true(image, width);
+	std::vector<uint8_t> rgba(image.size() * 4);
+	dither.to_rgba8(lab_image, width, rgba.data());
+	size_t differences = 0;
+	for (size_t i = 0; i < rgba.size(); ++i) differences += std::abs(expected.data()[i] - rgba[i]) > 1.f;
+	EXPECT_EQ(0, differences);
+
+	// Palette output.
+	rgb_deepcolor black(0.f, 0.f, 0.f, 1.f, srgb), white(1.f, 1.f, 1.f, 1.f, srgb);
+	color_manipulation::palette_search search({ &black, &white });
+	color_buffer grey(color_type::RGB_DEEP, srgb);
+	for (size_t i = 0; i < width * height; ++i) grey.push_back(rgb_deepcolor(0.25f, 0.25f, 0.25f, 1.f, srgb));
+	auto indices = dither.to_palette(grey, width, search);
+	EXPECT_NEAR(0.25f, std::accumulate(indices.begin(), indices.end(), 0.f) / indices.size(), avg_error);
+
+	EXPECT_ANY_THROW(dither.to_rgb_true(image, width + 1));
+}
@@ -0,0 +1,123 @@
+#include "gtest\gtest.h"
+#include "pch.h"
+#include "..\ColorMagic\spaces\rgb_truecolor.h"
+#include "..\ColorMagic\manipulation\fixed_point_blend.h"
+
+#include <cmath>
+#include <memory>
+#include <vector>
+
+using namespace color_space;
+
+class FixedPointBlend_Test : public ::testing::Test {
+protected:
+	rgb_color_space_definition* srgb;
+
+	virtual void SetUp()
+	{
+		srgb = rgb_color_space_definition_presets().sRGB();
+	}
+
+	virtual void TearDown()
+	{
+		delete srgb;
+	}
+
+	// Pseudo random colors, every 8th color is transparent and every 4th one opaque.
+	std::vector<uint8_t> create_colors(size_t count, uint32_t seed)
+	{
+		std::vector<uint8_t> colors(count * 4);
+		uint32_t state = seed;
+		for (size_t i = 0; i < colors.size(); ++i)
+		{
+			state = state * 1664525u + 1013904223u;
+			colors[i] = (uint8_t)(state >> 24);
+		}
+		for (size_t i = 0; i < count; i += 4) colors[i * 4 + 3] = i % 8 == 0 ? 0 : 255;
+		return colors;
+	}
+
+	rgb_truecolor create_color(const std::vector<uint8_t>& colors, size_t index)
+	{
+		const uint8_t* p = colors.data() + index * 4;
+		return rgb_truecolor(p[0], p[1], p[2], p[3], srgb);
+	}
+
+	void expect_colors_near(const color_base& expected, const uint8_t* actual)
+	{
+		EXPECT_NEAR(expected.alpha(), actual[3], 1.f);
+		for (size_t c = 0; c < 3; ++c) EXPECT_NEAR(expected.get_components()[c], actual[c], 1.f);
+	}
+};
+
+TEST_F(FixedPointBlend_Test, Div255_Tests)
+{
+	for (uint32_t value = 0; value <= 65535; ++value)
+	{
+		ASSERT_EQ((uint32_t)std::floor(value / 255.0 + 0.5), color_manipulation::fixed_point_blend::div255(value));
+	}
+}
+
+TEST_F(FixedPointBlend_Test, Composite_Tests)
+{
+	typedef color_base* (*scalar_operator)(color_base*, color_base*);
+	const scalar_operator operators[] =
+	{
+		color_manipulation::porter_duff::src, color_manipulation::porter_duff::dest, color_manipulation::porter_duff::atop,
+		color_manipulation::porter_duff::dest_atop, color_manipulation::porter_duff::over, color_manipulation::porter_duff::dest_over,
+		color_manipulation::porter_duff::in, color_manipulation::porter_duff::dest_in, color_manipulation::porter_duff::out,
+		color_manipulation::porter_duff::dest_out, color_manipulation::porter_duff::x_or, color_manipulation::porter_duff::clear
+	};
+
+	const size_t count = 500;
+	const std::vector<uint8_t> sources = create_colors(count, 1), destinations = create_colors(count, 2);
+	std::vector<uint8_t> result(count * 4);
+
+	for (int op = color_manipulation::SRC_OPERATOR; op <= color_manipulation::CLEAR_OPERATOR; ++op)
+	{
+		color_manipulation::fixed_point_blend::composite(sources.data(), destinations.data(), result.data(), count, static_cast<color_manipulation::porter_duff_operator>(op));
+		for (size_t i = 0; i < count; ++i)
+		{
+			rgb_truecolor s = create_color(sources, i), d = create_color(destinations, i);
+			std::unique_ptr<color_base> expected(operators[op](&s, &d));
+			expect_colors_near(*expected, result.data() + i * 4);
+		}
+	}
+
+	// The result may replace the destination.
+	std::vector<uint8_t> in_place = destinations;
+	color_manipulation::fixed_point_blend::composite(sources.data(), in_place.data(), in_place.data(), count, color_manipulation::OVER_OPERATOR);
+	color_manipulation::fixed_point_blend::composite(sources.data(), destinations.data(), result.data(), count, color_manipulation::OVER_OPERATOR);
+	EXPECT_EQ(result, in_place);
+}
+
+TEST_F(FixedPointBlend_Test, Blend_Tests)
+{
+	typedef color_base* (*scalar_blend)(color_base*, color_base*, bool, bool);
+	const scalar_blend blends[] =
+	{
+		color_manipulation::color_blend::normal, color_manipulation::color_blend::multiply, color_manipulation::color_blend::screen,
+		color_manipulation::color_blend::darken, color_manipulation::color_blend::lighten, color_manipulation::color_blend::linear_dodge,
+		color_manipulation::color_blend::linear_burn, color_manipulation::color_blend::difference, color_manipulation::color_blend::subtract,
+		color_manipulation::color_blend::exclusion
+	};
+
+	const size_t count = 500;
+	const std::vector<uint8_t> sources = create_colors(count, 3), destinations = create_colors(count, 4);
+	std::vector<uint8_t> result(count * 4);
+
+	for (int mode = color_manipulation::NORMAL_BLEND; mode <= color_manipulation::EXCLUSION_BLEND; ++mode)
+	{
+		for (int regions = 0; regions < 4; ++regions)
+		{
+			const bool use_source = (regions & 1) != 0, use_destination = (regions & 2) != 0;
+			color_manipulation::fixed_point_blend::blend(sources.data(), destinations.data(), result.data(), count, static_cast<color_manipulation::premultiplied_blend_mode>(mode), use_source, use_destination);
+			for (size_t i = 0; i < count; ++i)
+			{
+				rgb_truecolor s = create_color(sources, i), d = create_color(destinations, i);
+				std::unique_ptr<color_base> expected(blends[mode](&s, &d, use_source, use_destination));
+				expect_colors_near(*expected, result.data() + i * 4);
+			}
+		}
+	}
+}
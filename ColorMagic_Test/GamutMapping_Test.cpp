@@ -0,0 +1,180 @@
+#include "gtest\gtest.h"
+#include "pch.h"
+#include "..\ColorMagic\spaces\rgb_deepcolor.h"
+#include "..\ColorMagic\spaces\lab.h"
+#include "..\ColorMagic\spaces\lch_ab.h"
+#include "..\ColorMagic\manipulation\color_converter.h"
+#include "..\ColorMagic\manipulation\gamut_mapping.h"
+
+using namespace color_space;
+
+class GamutMapping_Test : public ::testing::Test {
+protected:
+	float avg_error = 0.001f;
+
+	rgb_color_space_definition* srgb;
+
+	virtual void SetUp()
+	{
+		srgb = rgb_color_space_definition_presets().sRGB();
+	}
+
+	virtual void TearDown()
+	{
+		delete srgb;
+	}
+
+	float chroma(const lab& color)
+	{
+		return sqrtf(color.a() * color.a() + color.b() * color.b());
+	}
+
+	float hue(const lab& color)
+	{
+		float degrees = atan2f(color.b(), color.a()) * 180.f / (float)M_PI;
+		return degrees < 0.f ? degrees + 360.f : degrees;
+	}
+};
+
+TEST_F(GamutMapping_Test, Boundary_Tests)
+{
+	color_manipulation::gamut_boundary boundary(srgb);
+
+	// The primaries lie on the boundary.
+	const rgb_deepcolor primaries[] = { rgb_deepcolor(1.f, 0.f, 0.f, 1.f, srgb), rgb_deepcolor(0.f, 1.f, 0.f, 1.f, srgb), rgb_deepcolor(0.f, 0.f, 1.f, 1.f, srgb) };
+	for (const auto& primary : primaries)
+	{
+		lab color = color_manipulation::color_converter::to_lab(primary);
+		EXPECT_NEAR(chroma(color), boundary.max_chroma(color.luminance(), hue(color)), 0.03f * chroma(color));
+	}
+
+	EXPECT_TRUE(boundary.contains(50.f, 0.f, 0.f));
+	EXPECT_TRUE(boundary.contains(50.f, 20.f, -20.f));
+	EXPECT_FALSE(boundary.contains(50.f, -90.f, -20.f));
+	EXPECT_FALSE(boundary.contains(101.f, 0.f, 0.f));
+	EXPECT_NEAR(0.f, boundary.max_chroma(100.f, 90.f), avg_error);
+	EXPECT_NEAR(0.f, boundary.max_chroma(0.f, 270.f), avg_error);
+
+	// Sampled boundary points are in gamut, points slightly outside are not.
+	for (float L = 10.f; L <= 90.f; L += 20.f)
+	{
+		for (float h = 0.f; h < 360.f; h += 30.f)
+		{
+			float c = boundary.max_chroma(L, h);
+			float angle = h * (float)M_PI / 180.f;
+			EXPECT_TRUE(boundary.contains(L, 0.99f * c * cosf(angle), 0.99f * c * sinf(angle)));
+			EXPECT_FALSE(boundary.contains(L, (1.01f * c + 0.5f) * cosf(angle), (1.01f * c + 0.5f) * sinf(angle)));
+		}
+	}
+}
+
+TEST_F(GamutMapping_Test, Mapping_Tests)
+{
+	color_manipulation::gamut_mapping clip(srgb);
+
+	// A saturated cyan far outside of sRGB keeps lightness and hue.
+	lch_ab outside(60.f, 90.f, 200.f, 1.f, srgb);
+	rgb_deepcolor mapped = clip.to_rgb_deep(outside);
+	lab result = color_manipulation::color_converter::to_lab(mapped);
+	EXPECT_NEAR(60.f, result.luminance(), 0.5f);
+	EXPECT_NEAR(200.f, hue(result), 1.f);
+	EXPECT_NEAR(clip.get_boundary().max_chroma(60.f, 200.f), chroma(result), 0.5f);
+
+	// Channel clamping shifts the hue.
+	lab clamped = color_manipulation::color_converter::to_lab(color_manipulation::color_converter::to_rgb_deep(outside));
+	EXPECT_LT(2.f, fabsf(hue(clamped) - 200.f));
+
+	// In gamut colors are unchanged.
+	rgb_deepcolor inside(0.3f, 0.5f, 0.7f, 0.5f, srgb);
+	mapped = clip.to_rgb_deep(inside);
+	EXPECT_NEAR(0.3f, mapped.red(), avg_error);
+	EXPECT_NEAR(0.5f, mapped.green(), avg_error);
+	EXPECT_NEAR(0.7f, mapped.blue(), avg_error);
+	EXPECT_NEAR(0.5f, mapped.alpha(), avg_error);
+
+	// The soft knee keeps colors below the knee and keeps the order of chroma above it.
+	color_manipulation::gamut_mapping soft(srgb, color_manipulation::SOFT_KNEE, 0.7f);
+	float max_chroma = soft.get_boundary().max_chroma(60.f, 200.f);
+	EXPECT_NEAR(0.5f * max_chroma, soft.map_chroma(60.f, 0.5f * max_chroma, 200.f), avg_error);
+	float previous = 0.f;
+	for (float chroma = 0.75f * max_chroma; chroma < 3.f * max_chroma; chroma += 5.f)
+	{
+		float value = soft.map_chroma(60.f, chroma, 200.f);
+		EXPECT_LT(previous, value);
+		EXPECT_GE(max_chroma, value);
+		previous = value;
+	}
+
+	// The buffer version gives the same result.
+	color_buffer colors(color_type::LCH_AB, srgb);
+	for (float h = 0.f; h < 360.f; h += 15.f) colors.push_back(lch_ab(50.f, 100.f, h, 1.f, srgb));
+	color_buffer rgb = soft.to_rgb_deep(colors);
+	ASSERT_EQ(color_type::RGB_DEEP, rgb.get_color_type());
+	for (size_t i = 0; i < colors.size(); ++i)
+	{
+		std::unique_ptr<color_base> color(colors.create_color(i));
+		rgb_deepcolor expected = soft.to_rgb_deep(*color);
+		EXPECT_NEAR(expected.red(), rgb.pixel(i)[0], avg_error);
+		EXPECT_NEAR(expected.green(), rgb.pixel(i)[1], avg_error);
+		EXPECT_NEAR(expected.blue(), rgb.pixel(i)[2], avg_error);
+	}
+
+	EXPECT_ANY_THROW(color_manipulation::gamut_mapping(srgb, color_manipulation::SOFT_KNEE, 1.f));
+}
+
+TEST_F(GamutMapping_Test, Cached_Boundary_Tests)
+{
+	// The boundary is built once per rgb color space definition and shared.
+	auto boundary = srgb->get_gamut_boundary();
+	ASSERT_NE(nullptr, boundary.get());
+	EXPECT_EQ(boundary.get(), srgb->get_gamut_boundary().get());
+
+	color_manipulation::gamut_mapping mapping(srgb);
+	EXPECT_EQ(boundary.get(), &mapping.get_boundary());
+
+	rgb_color_space_definition copy(*srgb);
+	EXPECT_EQ(boundary.get(), copy.get_gamut_boundary().get());
+
+	// A new white point moves the gamut, the boundary is built again.
+	copy.set_white_point(white_point_presets().D50_2Degree());
+	auto d50 = copy.get_gamut_boundary();
+	EXPECT_NE(boundary.get(), d50.get());
+	EXPECT_EQ(d50.get(), copy.get_gamut_boundary().get());
+	EXPECT_NEAR(boundary->max_chroma(50.f, 0.f), srgb->get_gamut_boundary()->max_chroma(50.f, 0.f), avg_error);
+}
+
+TEST_F(GamutMapping_Test, Batch_Tests)
+{
+	auto boundary = srgb->get_gamut_boundary();
+
+	color_buffer colors(color_type::LCH_AB, srgb);
+	for (float L = 5.f; L < 100.f; L += 10.f)
+	{
+		for (float h = 0.f; h < 360.f; h += 20.f)
+		{
+			// The chroma of lch_ab is limited to 100.
+			float c = boundary->max_chroma(L, h);
+			if (1.1f * c + 1.f > 100.f) continue;
+			colors.push_back(lch_ab(L, 0.9f * c, h, 1.f, srgb));
+			colors.push_back(lch_ab(L, 1.1f * c + 1.f, h, 1.f, srgb));
+		}
+	}
+
+	std::vector<uint8_t> inside = boundary->contains(colors);
+	std::vector<float> max_chroma = boundary->max_chroma(colors);
+	ASSERT_EQ(colors.size(), inside.size());
+	ASSERT_EQ(colors.size(), max_chroma.size());
+	for (size_t i = 0; i < colors.size(); ++i)
+	{
+		const float* pixel = colors.pixel(i);
+		EXPECT_EQ(i % 2 == 0 ? 1 : 0, inside[i]);
+		EXPECT_NEAR(boundary->max_chroma(pixel[0], pixel[2]), max_chroma[i], 0.5f);
+	}
+
+	// Rgb colors are always inside their own gamut.
+	color_buffer rgb(color_type::RGB_DEEP, srgb);
+	rgb.push_back(rgb_deepcolor(0.f, 0.f, 0.f, 1.f, srgb));
+	rgb.push_back(rgb_deepcolor(0.2f, 0.9f, 0.4f, 1.f, srgb));
+	rgb.push_back(rgb_deepcolor(0.99f, 0.99f, 0.99f, 1.f, srgb));
+	for (uint8_t value : boundary->contains(rgb)) EXPECT_EQ(1, value);
+}
@@ -0,0 +1,119 @@
+#include "gtest\gtest.h"
+#include "pch.h"
+#include "..\ColorMagic\spaces\rgb_deepcolor.h"
+#include "..\ColorMagic\utils\half_buffer.h"
+#include "..\ColorMagic\manipulation\adjustment_chain.h"
+#include "..\ColorMagic\manipulation\color_converter.h"
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+using namespace color_space;
+
+class HalfBuffer_Test : public ::testing::Test {
+protected:
+	rgb_color_space_definition* srgb;
+
+	virtual void SetUp()
+	{
+		srgb = rgb_color_space_definition_presets().sRGB();
+	}
+
+	virtual void TearDown()
+	{
+		delete srgb;
+	}
+
+	color_buffer create_colors(size_t count)
+	{
+		color_buffer colors(color_type::RGB_DEEP, srgb);
+		for (size_t i = 0; i < count; ++i) colors.push_back(rgb_deepcolor((i * 37 % 101) / 100.f, (i * 53 % 101) / 100.f, (i * 19 % 101) / 100.f, (i % 11) / 10.f, srgb));
+		return colors;
+	}
+};
+
+TEST_F(HalfBuffer_Test, Conversion_Tests)
+{
+	// Every half float survives the round trip, NaN stays NaN.
+	for (uint32_t half = 0; half <= 0xffff; ++half)
+	{
+		const float value = half_buffer::to_float((uint16_t)half);
+		if ((half & 0x7c00) == 0x7c00 && (half & 0x3ff) != 0) ASSERT_TRUE(std::isnan(value));
+		else ASSERT_EQ(half, half_buffer::to_half(value));
+	}
+
+	EXPECT_EQ(0x3c00, half_buffer::to_half(1.f));
+	EXPECT_EQ(0xc000, half_buffer::to_half(-2.f));
+	EXPECT_EQ(0x7bff, half_buffer::to_half(65504.f));
+	EXPECT_EQ(0x7c00, half_buffer::to_half(65520.f));
+	EXPECT_EQ(0xfc00, half_buffer::to_half(-std::numeric_limits<float>::infinity()));
+	EXPECT_EQ(0x0001, half_buffer::to_half(std::ldexp(1.f, -24)));
+	EXPECT_EQ(0x0003, half_buffer::to_half(std::ldexp(11.f, -26)));
+	EXPECT_FLOAT_EQ(std::ldexp(1.f, -24), half_buffer::to_float(0x0001));
+
+	// Ties round to the even mantissa.
+	EXPECT_EQ(0x3c00, half_buffer::to_half(1.f + std::ldexp(1.f, -11)));
+	EXPECT_EQ(0x3c02, half_buffer::to_half(1.f + std::ldexp(3.f, -11)));
+	EXPECT_EQ(0x0000, half_buffer::to_half(std::ldexp(1.f, -25)));
+	EXPECT_EQ(0x0002, half_buffer::to_half(std::ldexp(3.f, -25)));
+
+	// Every other float becomes the nearest half float, the buffer functions give the results of the scalar ones.
+	std::vector<float> values;
+	for (int i = 0; i < 2003; ++i) values.push_back(std::ldexp((float)(i * 7919 % 2003) - 1001.5f, i % 24 - 20) * 1.0001f);
+	std::vector<uint16_t> halves(values.size());
+	std::vector<float> results(values.size());
+	half_buffer::to_half(values.data(), halves.data(), values.size());
+	half_buffer::to_float(halves.data(), results.data(), halves.size());
+	for (size_t i = 0; i < values.size(); ++i)
+	{
+		ASSERT_EQ(half_buffer::to_half(values[i]), halves[i]);
+		ASSERT_EQ(half_buffer::to_float(halves[i]), results[i]);
+		const double error = std::fabs((double)results[i] - values[i]);
+		EXPECT_LE(error, std::fabs((double)half_buffer::to_float(halves[i] + 1) - values[i]));
+		if ((halves[i] & 0x7fff) != 0) EXPECT_LE(error, std::fabs((double)half_buffer::to_float(halves[i] - 1) - values[i]));
+	}
+}
+
+TEST_F(HalfBuffer_Test, Buffer_Tests)
+{
+	const color_buffer colors = create_colors(3000);
+	half_buffer halves(colors);
+	EXPECT_EQ(colors.size(), halves.size());
+	EXPECT_EQ(colors.channels(), halves.channels());
+	EXPECT_EQ(color_type::RGB_DEEP, halves.get_color_type());
+
+	// Half floats keep 11 significant bits.
+	color_buffer result = halves.to_color_buffer();
+	for (size_t i = 0; i < colors.size() * colors.channels(); ++i) EXPECT_NEAR(colors.data()[i], result.data()[i], 0.0005f);
+
+	// A transform sees the float values of every color once.
+	halves.transform([](float* values, size_t first, size_t count)
+	{
+		for (size_t i = 0; i < count; ++i) values[i * 4 + 3] = (first + i) % 2 == 0 ? 1.f : 0.5f;
+	});
+	float color[4];
+	halves.load(2999, 1, color);
+	EXPECT_EQ(0.5f, color[3]);
+	halves.load(2998, 1, color);
+	EXPECT_EQ(1.f, color[3]);
+	EXPECT_ANY_THROW(halves.load(2999, 2, color));
+}
+
+TEST_F(HalfBuffer_Test, Pass_Tests)
+{
+	const color_buffer colors = create_colors(3000);
+	const half_buffer halves(colors);
+
+	// Conversion to lab gives the float results within the precision of half floats.
+	const color_buffer lab = color_manipulation::color_converter::convert_buffer(colors, color_type::LAB);
+	const color_buffer half_lab = color_manipulation::color_converter::convert_buffer(halves, color_type::LAB).to_color_buffer();
+	ASSERT_EQ(color_type::LAB, half_lab.get_color_type());
+	for (size_t i = 0; i < lab.size() * lab.channels(); ++i) EXPECT_NEAR(lab.data()[i], half_lab.data()[i], 0.1f);
+
+	color_manipulation::adjustment_chain chain(srgb);
+	chain.white_balance(white_point_presets().D50_2Degree()).saturation(0.2f);
+	const color_buffer adjusted = chain.apply(colors);
+	const color_buffer half_adjusted = chain.apply(halves).to_color_buffer();
+	for (size_t i = 0; i < adjusted.size() * adjusted.channels(); ++i) EXPECT_NEAR(adjusted.data()[i], half_adjusted.data()[i], 0.002f);
+}
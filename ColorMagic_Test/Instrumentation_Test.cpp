@@ -0,0 +1,74 @@
+#include "gtest\gtest.h"
+#include "pch.h"
+#include "..\ColorMagic\utils\instrumentation.h"
+#include "..\ColorMagic\spaces\rgb_deepcolor.h"
+#include "..\ColorMagic\manipulation\color_converter.h"
+#include "..\ColorMagic\manipulation\color_blend.h"
+#include "..\ColorMagic\manipulation\color_distance.h"
+
+using namespace color_space;
+
+class Instrumentation_Test : public ::testing::Test {
+protected:
+	rgb_color_space_definition* srgb;
+	rgb_deepcolor* orange;
+	rgb_deepcolor* blue;
+
+	virtual void SetUp()
+	{
+		srgb = rgb_color_space_definition_presets().sRGB();
+		orange = new rgb_deepcolor(1.f, 0.5f, 0.f, 1.f, srgb);
+		blue = new rgb_deepcolor(0.f, 0.f, 1.f, 1.f, srgb);
+		instrumentation::reset();
+	}
+
+	virtual void TearDown()
+	{
+		delete orange;
+		delete blue;
+		delete srgb;
+	}
+
+	instrumentation_record find(const std::string& name)
+	{
+		for (auto record : instrumentation::snapshot())
+		{
+			if (record.name == name) return record;
+		}
+		return instrumentation_record();
+	}
+};
+
+TEST_F(Instrumentation_Test, Counter_Tests)
+{
+	for (int i = 0; i < 3; ++i)
+	{
+		delete color_manipulation::color_converter::convertTo(orange, color_type::LAB);
+	}
+	delete color_manipulation::color_blend::multiply(orange, blue);
+	color_manipulation::color_distance::cielab_delta_e_cie76(orange, blue);
+
+	if (!instrumentation::enabled())
+	{
+		EXPECT_TRUE(instrumentation::snapshot().empty());
+		return;
+	}
+
+	auto convert = find("color_converter::convertTo");
+	EXPECT_EQ(3, convert.calls);
+	EXPECT_EQ(3, convert.allocations);
+	EXPECT_EQ(9, convert.gamma_evaluations);
+	EXPECT_EQ(3, convert.matrix_multiplies);
+
+	auto multiply = find("color_blend::multiply");
+	EXPECT_EQ(1, multiply.calls);
+	EXPECT_EQ(1, multiply.allocations);
+
+	auto distance = find("color_distance::cielab_delta_e_cie76");
+	EXPECT_EQ(1, distance.calls);
+	EXPECT_EQ(0, distance.allocations);
+	EXPECT_EQ(2, distance.matrix_multiplies);
+
+	instrumentation::reset();
+	EXPECT_TRUE(instrumentation::snapshot().empty());
+}
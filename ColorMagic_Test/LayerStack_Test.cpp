@@ -0,0 +1,126 @@
+#include "gtest\gtest.h"
+#include "pch.h"
+#include "..\ColorMagic\spaces\rgb_deepcolor.h"
+#include "..\ColorMagic\manipulation\layer_stack.h"
+#include "..\ColorMagic\manipulation\porter_duff.h"
+#include "..\ColorMagic\manipulation\color_blend.h"
+
+#include <memory>
+
+using namespace color_space;
+
+class LayerStack_Test : public ::testing::Test {
+protected:
+	float avg_error = 0.002f;
+
+	rgb_color_space_definition* srgb;
+
+	virtual void SetUp()
+	{
+		srgb = rgb_color_space_definition_presets().sRGB();
+	}
+
+	virtual void TearDown()
+	{
+		delete srgb;
+	}
+
+	color_buffer create_colors(size_t count, int seed, bool opaque)
+	{
+		color_buffer colors(color_type::RGB_DEEP, srgb);
+		for (size_t i = 0; i < count; ++i)
+		{
+			const float alpha = opaque ? 1.f : ((i * 7 + seed) % 11) / 10.f;
+			colors.push_back(rgb_deepcolor(((i * 37 + seed) % 101) / 100.f, ((i * 53 + seed * 3) % 101) / 100.f, ((i * 19 + seed * 7) % 101) / 100.f, alpha, srgb));
+		}
+		return colors;
+	}
+
+	void expect_buffers_equal(const premultiplied_buffer& expected, const premultiplied_buffer& actual)
+	{
+		ASSERT_EQ(expected.size(), actual.size());
+		for (size_t i = 0; i < expected.size() * premultiplied_buffer::channels; ++i) EXPECT_NEAR(expected.data()[i], actual.data()[i], 1e-5f);
+	}
+};
+
+TEST_F(LayerStack_Test, Composite_Tests)
+{
+	const size_t width = 20, height = 10;
+	color_manipulation::layer_stack stack(srgb, width, height, 8);
+	EXPECT_EQ(6, stack.tile_count());
+
+	color_buffer layers[] = { create_colors(width * height, 1, true), create_colors(width * height, 2, false), create_colors(width * height, 3, false), create_colors(width * height, 4, false) };
+	stack.add_layer();
+	stack.add_layer(color_manipulation::MULTIPLY_BLEND);
+	stack.add_layer(color_manipulation::SCREEN_BLEND, 0.5f);
+	stack.add_layer(color_manipulation::NORMAL_BLEND, 1.f, color_manipulation::ATOP_OPERATOR);
+	for (size_t l = 0; l < 4; ++l) stack.set_pixels(l, 0, 0, layers[l], width);
+
+	color_buffer result = stack.to_color_buffer();
+	EXPECT_EQ(0, stack.dirty_tile_count());
+	for (size_t i = 0; i < result.size(); ++i)
+	{
+		std::unique_ptr<color_base> expected(layers[0].create_color(i));
+		std::unique_ptr<color_base> layer(layers[1].create_color(i));
+		expected.reset(color_manipulation::color_blend::multiply(layer.get(), expected.get()));
+		layer.reset(layers[2].create_color(i));
+		layer->alpha(layer->alpha() * 0.5f);
+		expected.reset(color_manipulation::color_blend::screen(layer.get(), expected.get()));
+		layer.reset(layers[3].create_color(i));
+		expected.reset(color_manipulation::porter_duff::atop(layer.get(), expected.get()));
+
+		EXPECT_NEAR(expected->alpha(), result.pixel(i)[3], avg_error);
+		for (size_t c = 0; c < 3; ++c) EXPECT_NEAR(expected->get_components()[c], result.pixel(i)[c], avg_error);
+	}
+}
+
+TEST_F(LayerStack_Test, Incremental_Tests)
+{
+	const size_t width = 40, height = 24, layer_count = 6;
+	color_manipulation::layer_stack stack(srgb, width, height, 8, 2);
+	for (size_t l = 0; l < layer_count; ++l)
+	{
+		stack.add_layer(static_cast<color_manipulation::premultiplied_blend_mode>(l % 4), 0.9f);
+		stack.set_pixels(l, 0, 0, create_colors(width * height, (int)l, l == 0), width);
+	}
+	EXPECT_EQ(15, stack.dirty_tile_count());
+	stack.evaluate();
+	EXPECT_EQ(0, stack.dirty_tile_count());
+
+	// A rectangle across the border of four tiles only makes these tiles dirty.
+	const color_buffer patch = create_colors(4 * 3, 9, false);
+	stack.set_pixels(3, 14, 6, patch, 4);
+	EXPECT_EQ(4, stack.dirty_tile_count());
+	const premultiplied_buffer& incremental = stack.evaluate();
+
+	// A new stack with the same layers composites everything.
+	color_manipulation::layer_stack full(srgb, width, height, 16);
+	for (size_t l = 0; l < layer_count; ++l)
+	{
+		full.add_layer(stack.get_blend_mode(l), stack.get_opacity(l), stack.get_operator(l));
+		full.set_pixels(l, 0, 0, create_colors(width * height, (int)l, l == 0), width);
+	}
+	full.set_pixels(3, 14, 6, patch, 4);
+	expect_buffers_equal(full.evaluate(), incremental);
+
+	// Changing a layer property makes every tile dirty, unchanged properties do not.
+	stack.set_opacity(1, 0.9f);
+	EXPECT_EQ(0, stack.dirty_tile_count());
+	stack.set_opacity(1, 0.4f);
+	full.set_opacity(1, 0.4f);
+	stack.set_operator(5, color_manipulation::DEST_OVER_OPERATOR);
+	full.set_operator(5, color_manipulation::DEST_OVER_OPERATOR);
+	EXPECT_EQ(15, stack.dirty_tile_count());
+	expect_buffers_equal(full.evaluate(), stack.evaluate());
+
+	// Removing a layer recomposites from its index.
+	stack.remove_layer(4);
+	full.remove_layer(4);
+	EXPECT_EQ(5, stack.layer_count());
+	expect_buffers_equal(full.evaluate(), stack.evaluate());
+
+	EXPECT_ANY_THROW(stack.set_pixels(0, 38, 0, patch, 4));
+	EXPECT_ANY_THROW(stack.set_pixels(0, 0, 0, patch, 5));
+	EXPECT_ANY_THROW(stack.invalidate(5, 0, 0, 1, 1));
+	EXPECT_ANY_THROW(color_manipulation::layer_stack(srgb, 0, 10));
+}
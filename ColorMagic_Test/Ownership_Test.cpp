@@ -0,0 +1,125 @@
+#include "gtest\gtest.h"
+#include "pch.h"
+#include "..\ColorMagic\utils\color_arena.h"
+#include "..\ColorMagic\spaces\rgb_deepcolor.h"
+#include "..\ColorMagic\manipulation\color_converter.h"
+#include "..\ColorMagic\manipulation\color_blend.h"
+#include "..\ColorMagic\manipulation\porter_duff.h"
+#include "..\ColorMagic\manipulation\color_adjustments.h"
+#include "..\ColorMagic\manipulation\color_combinations.h"
+#include "..\ColorMagic\manipulation\chromatic_adaptation.h"
+
+using namespace color_space;
+
+class Ownership_Test : public ::testing::Test {
+protected:
+	rgb_color_space_definition* srgb;
+	white_point* target_d75;
+	std::vector<color_base*> colors;
+
+	virtual void SetUp()
+	{
+		srgb = rgb_color_space_definition_presets().sRGB();
+		target_d75 = white_point_presets().D75_2Degree();
+
+		rgb_deepcolor orange(1.f, 0.5f, 0.f, 0.8f, srgb);
+		for (int type = color_type::RGB_TRUE; type < color_type::UNDEFINED; ++type)
+		{
+			colors.push_back(color_manipulation::color_converter::create_converted(orange, static_cast<color_type>(type)));
+		}
+	}
+
+	virtual void TearDown()
+	{
+		for (auto color : colors) delete color;
+		delete target_d75;
+		delete srgb;
+	}
+};
+
+TEST_F(Ownership_Test, Conversion_Tests)
+{
+	size_t alive = color_arena::heap_objects_alive();
+
+	for (auto color : colors)
+	{
+		rgb_deepcolor rgb_before = color_manipulation::color_converter::to_rgb_deep(*color);
+
+		for (int type = color_type::RGB_TRUE; type < color_type::UNDEFINED; ++type)
+		{
+			auto converted = color_manipulation::color_converter::convertTo(color, static_cast<color_type>(type));
+			ASSERT_NE(color, converted);
+			ASSERT_EQ(type, converted->get_color_type());
+			delete converted;
+
+			converted = color_manipulation::color_converter::create_converted(*color, static_cast<color_type>(type));
+			ASSERT_EQ(type, converted->get_color_type());
+			delete converted;
+		}
+
+		color_manipulation::color_converter::to_rgb_true(*color);
+		color_manipulation::color_converter::to_rgb_deep(*color);
+		color_manipulation::color_converter::to_grey_true(*color);
+		color_manipulation::color_converter::to_grey_deep(*color);
+		color_manipulation::color_converter::to_cmyk(*color);
+		color_manipulation::color_converter::to_hsi(*color);
+		color_manipulation::color_converter::to_hsv(*color);
+		color_manipulation::color_converter::to_hsl(*color);
+		color_manipulation::color_converter::to_hcy(*color);
+		color_manipulation::color_converter::to_xyz(*color);
+		color_manipulation::color_converter::to_xyy(*color);
+		color_manipulation::color_converter::to_cieluv(*color);
+		color_manipulation::color_converter::to_lab(*color);
+		color_manipulation::color_converter::to_lch_ab(*color);
+		color_manipulation::color_converter::to_lch_uv(*color);
+
+		lab out_color(0.f, 0.f, 0.f, 0.f, nullptr);
+		color_manipulation::color_converter::to_lab(*color, out_color);
+
+		// The input color is never modified by a conversion.
+		rgb_deepcolor rgb_after = color_manipulation::color_converter::to_rgb_deep(*color);
+		EXPECT_FLOAT_EQ(rgb_before.red(), rgb_after.red());
+		EXPECT_FLOAT_EQ(rgb_before.green(), rgb_after.green());
+		EXPECT_FLOAT_EQ(rgb_before.blue(), rgb_after.blue());
+	}
+
+	EXPECT_EQ(alive, color_arena::heap_objects_alive());
+}
+
+TEST_F(Ownership_Test, Manipulation_Tests)
+{
+	size_t alive = color_arena::heap_objects_alive();
+
+	for (auto color : colors)
+	{
+		std::vector<color_base*> results;
+
+		results.push_back(color_manipulation::color_blend::multiply(color, colors[1]));
+		results.push_back(color_manipulation::color_blend::hue(color, colors[1]));
+		results.push_back(color_manipulation::color_blend::luminosity(color, colors[1]));
+		results.push_back(color_manipulation::porter_duff::over(color, colors[1]));
+		results.push_back(color_manipulation::porter_duff::clear(color, colors[1]));
+
+		results.push_back(color_manipulation::color_adjustments::saturate_in_rgb_space(color, 0.2f));
+		results.push_back(color_manipulation::color_adjustments::saturate_in_hsl_space(color, 0.f));
+		results.push_back(color_manipulation::color_adjustments::luminate_in_hsl_space(color, -0.2f));
+
+		results.push_back(color_manipulation::color_combinations::create_complimentary(color));
+		for (auto combination_color : color_manipulation::color_combinations::create_quintet(color)) results.push_back(combination_color);
+		for (auto combination_color : color_manipulation::color_combinations::create_monochromatic(color, 2, 0.2f, 4)) results.push_back(combination_color);
+		for (auto combination_color : color_manipulation::color_combinations::create_complimentary_split(color, 30.f)) results.push_back(combination_color);
+
+		results.push_back(color_manipulation::chromatic_adaptation::bradford_adaptation(color, target_d75));
+		results.push_back(color_manipulation::chromatic_adaptation::cat02_adaptation(color, target_d75, 1.f));
+		results.push_back(color_manipulation::chromatic_adaptation::von_kries_adaptation(color, srgb->get_white_point()));
+
+		for (auto result : results)
+		{
+			ASSERT_NE(color, result);
+			ASSERT_EQ(color->get_color_type(), result->get_color_type());
+			delete result;
+		}
+	}
+
+	EXPECT_EQ(alive, color_arena::heap_objects_alive());
+}
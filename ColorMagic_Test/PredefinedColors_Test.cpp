@@ -0,0 +1,97 @@
+#include "gtest\gtest.h"
+#include "pch.h"
+#include "..\ColorMagic\utils\colors.h"
+#include "..\ColorMagic\utils\color_buffer.h"
+#include "..\ColorMagic\utils\predefined_colors.h"
+
+#include <cstring>
+#include <memory>
+#include <string>
+
+using namespace color_space;
+
+class PredefinedColors_Test : public ::testing::Test {
+protected:
+	float avg_error = 0.0001f;
+
+	rgb_color_space_definition* srgb;
+
+	virtual void SetUp()
+	{
+		srgb = rgb_color_space_definition_presets().sRGB();
+	}
+
+	virtual void TearDown()
+	{
+		delete srgb;
+	}
+};
+
+TEST_F(PredefinedColors_Test, Lookup_Tests)
+{
+	for (size_t i = 0; i < predefined_colors::count; ++i)
+	{
+		std::string name = predefined_colors::name(i);
+		EXPECT_EQ(i, predefined_colors::find(name.data(), name.size())) << name;
+		for (auto& c : name) c = (char)toupper(c);
+		EXPECT_EQ(i, predefined_colors::find(name.data(), name.size())) << name;
+
+		// Colors with the same hex code (e.g. Aqua and Cyan) find the first one.
+		const size_t index = predefined_colors::find(predefined_colors::argb(i));
+		ASSERT_NE(predefined_colors::not_found, index);
+		EXPECT_LE(index, i);
+		EXPECT_EQ(predefined_colors::argb(i), predefined_colors::argb(index));
+	}
+
+	EXPECT_EQ(predefined_colors::not_found, predefined_colors::find("Blu", 3));
+	EXPECT_EQ(predefined_colors::not_found, predefined_colors::find("Bluee", 5));
+	EXPECT_EQ(predefined_colors::not_found, predefined_colors::find("", 0));
+	EXPECT_EQ(predefined_colors::not_found, predefined_colors::find(0xFF123456u));
+	EXPECT_EQ(std::string("Red"), predefined_colors::name(predefined_colors::find(HexcodeColors::Red)));
+}
+
+TEST_F(PredefinedColors_Test, Table_Tests)
+{
+	ASSERT_TRUE(predefined_colors::is_table_space(srgb));
+	rgb_color_space_definition* adobe = rgb_color_space_definition_presets().adobeRGB();
+	EXPECT_FALSE(predefined_colors::is_table_space(adobe));
+	rgb_color_space_definition* apple = rgb_color_space_definition_presets().appleRGB();
+	EXPECT_FALSE(predefined_colors::is_table_space(apple));
+
+	// Every value equals the runtime conversion.
+	for (size_t i = 0; i < predefined_colors::count; ++i)
+	{
+		const uint32_t argb = predefined_colors::argb(i);
+		const float rgba[4] = { (float)((argb >> 16) & 0xFF), (float)((argb >> 8) & 0xFF), (float)(argb & 0xFF), (float)(argb >> 24) };
+		for (int type = color_type::RGB_TRUE; type < color_type::UNDEFINED; ++type)
+		{
+			float expected[5];
+			color_manipulation::color_converter::convert_values(color_type::RGB_TRUE, rgba, srgb, (color_type)type, expected);
+			const float* values = predefined_colors::values(i, (color_type)type);
+			for (size_t c = 0; c <= color_buffer::component_count((color_type)type); ++c)
+			{
+				EXPECT_NEAR(expected[c], values[c], avg_error * std::max(1.f, fabsf(expected[c]))) << predefined_colors::name(i) << " " << type;
+			}
+		}
+	}
+
+	// predefined_color uses the table for sRGB and converts for other rgb color spaces.
+	for (auto space : { srgb, adobe })
+	{
+		predefined_color color(HexcodeColors::Chocolate, space);
+		std::unique_ptr<lab> expected(color_manipulation::color_converter::to_lab(color.get_rgb_true()));
+		std::unique_ptr<lab> result(color.get_lab());
+		EXPECT_NEAR(expected->luminance(), result->luminance(), avg_error);
+		EXPECT_NEAR(expected->a(), result->a(), avg_error);
+		EXPECT_NEAR(expected->b(), result->b(), avg_error);
+		EXPECT_EQ(space, result->get_rgb_color_space());
+
+		std::unique_ptr<cmyk> expected_cmyk(color_manipulation::color_converter::to_cmyk(color.get_rgb_true()));
+		std::unique_ptr<cmyk> result_cmyk(color.get_cmyk());
+		EXPECT_NEAR(expected_cmyk->black(), result_cmyk->black(), avg_error);
+		EXPECT_NEAR(expected_cmyk->cyan(), result_cmyk->cyan(), avg_error);
+	}
+
+	delete adobe;
+	delete apple;
+}
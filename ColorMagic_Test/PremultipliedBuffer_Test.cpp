@@ -0,0 +1,171 @@
+#include "gtest\gtest.h"
+#include "pch.h"
+#include "..\ColorMagic\spaces\rgb_deepcolor.h"
+#include "..\ColorMagic\spaces\rgb_truecolor.h"
+#include "..\ColorMagic\utils\premultiplied_buffer.h"
+#include "..\ColorMagic\manipulation\porter_duff.h"
+#include "..\ColorMagic\manipulation\color_blend.h"
+
+#include <memory>
+
+using namespace color_space;
+
+class PremultipliedBuffer_Test : public ::testing::Test {
+protected:
+	float avg_error = 0.001f;
+
+	rgb_color_space_definition* srgb;
+
+	virtual void SetUp()
+	{
+		srgb = rgb_color_space_definition_presets().sRGB();
+	}
+
+	virtual void TearDown()
+	{
+		delete srgb;
+	}
+
+	color_buffer create_colors(size_t count, int seed, bool opaque)
+	{
+		color_buffer colors(color_type::RGB_DEEP, srgb);
+		for (size_t i = 0; i < count; ++i)
+		{
+			const float alpha = opaque ? 1.f : ((i * 7 + seed) % 11) / 10.f;
+			colors.push_back(rgb_deepcolor(((i * 37 + seed) % 101) / 100.f, ((i * 53 + seed * 3) % 101) / 100.f, ((i * 19 + seed * 7) % 101) / 100.f, alpha, srgb));
+		}
+		return colors;
+	}
+
+	// The colors of nearly transparent results are not meaningful, only their alpha is compared.
+	void expect_colors_near(const color_base& expected, const float* actual, float error)
+	{
+		EXPECT_NEAR(expected.alpha(), actual[3], error);
+		if (expected.alpha() < 0.05f) return;
+		EXPECT_NEAR(expected.get_components()[0], actual[0], error);
+		EXPECT_NEAR(expected.get_components()[1], actual[1], error);
+		EXPECT_NEAR(expected.get_components()[2], actual[2], error);
+	}
+};
+
+TEST_F(PremultipliedBuffer_Test, Conversion_Tests)
+{
+	color_buffer colors(color_type::RGB_TRUE, srgb);
+	colors.push_back(rgb_truecolor(255, 128, 0, 255, srgb));
+	colors.push_back(rgb_truecolor(40, 80, 120, 128, srgb));
+	colors.push_back(rgb_truecolor(200, 100, 50, 0, srgb));
+
+	premultiplied_buffer premultiplied(colors);
+	ASSERT_EQ(3, premultiplied.size());
+	EXPECT_NEAR(80.f / 255.f * 128.f / 255.f, premultiplied.pixel(1)[1], avg_error);
+	EXPECT_NEAR(128.f / 255.f, premultiplied.pixel(1)[3], avg_error);
+	EXPECT_EQ(0.f, premultiplied.pixel(2)[0]);
+
+	// The round trip keeps the colors, transparent colors become black.
+	color_buffer result = premultiplied.to_color_buffer(color_type::RGB_TRUE);
+	ASSERT_EQ(color_type::RGB_TRUE, result.get_color_type());
+	for (size_t c = 0; c < 4; ++c)
+	{
+		EXPECT_NEAR(colors.pixel(0)[c], result.pixel(0)[c], 0.5f);
+		EXPECT_NEAR(colors.pixel(1)[c], result.pixel(1)[c], 0.5f);
+		EXPECT_EQ(0.f, result.pixel(2)[c]);
+	}
+
+	premultiplied_buffer empty(srgb);
+	EXPECT_TRUE(empty.empty());
+	empty.resize(2);
+	EXPECT_EQ(2, empty.size());
+	EXPECT_EQ(0.f, empty.pixel(1)[3]);
+}
+
+TEST_F(PremultipliedBuffer_Test, Composite_Tests)
+{
+	typedef color_base* (*scalar_operator)(color_base*, color_base*);
+	const scalar_operator operators[] =
+	{
+		color_manipulation::porter_duff::src, color_manipulation::porter_duff::dest, color_manipulation::porter_duff::atop,
+		color_manipulation::porter_duff::dest_atop, color_manipulation::porter_duff::over, color_manipulation::porter_duff::dest_over,
+		color_manipulation::porter_duff::in, color_manipulation::porter_duff::dest_in, color_manipulation::porter_duff::out,
+		color_manipulation::porter_duff::dest_out, color_manipulation::porter_duff::x_or, color_manipulation::porter_duff::clear
+	};
+
+	color_buffer sources = create_colors(100, 1, false);
+	color_buffer destinations = create_colors(100, 2, false);
+	const premultiplied_buffer source(sources);
+
+	for (int op = color_manipulation::SRC_OPERATOR; op <= color_manipulation::CLEAR_OPERATOR; ++op)
+	{
+		premultiplied_buffer destination(destinations);
+		color_manipulation::porter_duff::composite(source, destination, static_cast<color_manipulation::porter_duff_operator>(op));
+		color_buffer result = destination.to_color_buffer();
+
+		for (size_t i = 0; i < sources.size(); ++i)
+		{
+			std::unique_ptr<color_base> s(sources.create_color(i)), d(destinations.create_color(i));
+			std::unique_ptr<color_base> expected(operators[op](s.get(), d.get()));
+			expect_colors_near(*expected, result.pixel(i), avg_error);
+		}
+	}
+
+	premultiplied_buffer smaller(srgb, 10);
+	EXPECT_ANY_THROW(color_manipulation::porter_duff::composite(source, smaller, color_manipulation::OVER_OPERATOR));
+}
+
+TEST_F(PremultipliedBuffer_Test, Chain_Tests)
+{
+	// Three layers composited over a background stay premultiplied until the end.
+	color_buffer layers[] = { create_colors(64, 3, true), create_colors(64, 4, false), create_colors(64, 5, false), create_colors(64, 6, false) };
+
+	premultiplied_buffer result(layers[0]);
+	color_manipulation::porter_duff::composite(premultiplied_buffer(layers[1]), result, color_manipulation::OVER_OPERATOR);
+	color_manipulation::color_blend::blend(premultiplied_buffer(layers[2]), result, color_manipulation::MULTIPLY_BLEND);
+	color_manipulation::color_blend::blend(premultiplied_buffer(layers[3]), result, color_manipulation::SCREEN_BLEND);
+	color_buffer output = result.to_color_buffer();
+
+	for (size_t i = 0; i < output.size(); ++i)
+	{
+		std::unique_ptr<color_base> expected(layers[0].create_color(i));
+		std::unique_ptr<color_base> layer(layers[1].create_color(i));
+		expected.reset(color_manipulation::porter_duff::over(layer.get(), expected.get()));
+		layer.reset(layers[2].create_color(i));
+		expected.reset(color_manipulation::color_blend::multiply(layer.get(), expected.get()));
+		layer.reset(layers[3].create_color(i));
+		expected.reset(color_manipulation::color_blend::screen(layer.get(), expected.get()));
+		expect_colors_near(*expected, output.pixel(i), 0.002f);
+	}
+}
+
+TEST_F(PremultipliedBuffer_Test, Blend_Tests)
+{
+	typedef color_base* (*scalar_blend)(color_base*, color_base*, bool, bool);
+	const scalar_blend blends[] =
+	{
+		color_manipulation::color_blend::normal, color_manipulation::color_blend::multiply, color_manipulation::color_blend::screen,
+		color_manipulation::color_blend::darken, color_manipulation::color_blend::lighten, color_manipulation::color_blend::linear_dodge,
+		color_manipulation::color_blend::linear_burn, color_manipulation::color_blend::difference, color_manipulation::color_blend::subtract,
+		color_manipulation::color_blend::exclusion
+	};
+
+	for (int mode = color_manipulation::NORMAL_BLEND; mode <= color_manipulation::EXCLUSION_BLEND; ++mode)
+	{
+		// The limited modes clamp the blended value instead of the composited one, they only match when opaque.
+		const bool opaque = mode == color_manipulation::LINEAR_DODGE_BLEND || mode == color_manipulation::LINEAR_BURN_BLEND || mode == color_manipulation::SUBTRACT_BLEND;
+		color_buffer sources = create_colors(100, 7, opaque);
+		color_buffer destinations = create_colors(100, 8, opaque);
+
+		for (int regions = 0; regions < 4; ++regions)
+		{
+			const bool use_source = (regions & 1) != 0, use_destination = (regions & 2) != 0;
+			premultiplied_buffer destination(destinations);
+			color_manipulation::color_blend::blend(premultiplied_buffer(sources), destination, static_cast<color_manipulation::premultiplied_blend_mode>(mode), use_source, use_destination);
+			color_buffer result = destination.to_color_buffer();
+
+			for (size_t i = 0; i < sources.size(); ++i)
+			{
+				std::unique_ptr<color_base> s(sources.create_color(i)), d(destinations.create_color(i));
+				std::unique_ptr<color_base> expected(blends[mode](s.get(), d.get(), use_source, use_destination));
+				expect_colors_near(*expected, result.pixel(i), avg_error);
+			}
+		}
+	}
+}
@@ -0,0 +1,75 @@
+#include "gtest\gtest.h"
+#include "pch.h"
+#include "..\ColorMagic\spaces\typed_colors.h"
+#include "..\ColorMagic\spaces\rgb_deepcolor.h"
+#include "..\ColorMagic\manipulation\color_converter.h"
+
+#include <type_traits>
+
+using namespace color_space;
+
+static_assert(!std::is_polymorphic<typed::rgb<float>>::value, "Typed colors must not have a vtable.");
+static_assert(std::is_trivially_copyable<typed::lab<float>>::value, "Typed colors must be trivially copyable.");
+static_assert(sizeof(typed::hsl<float>) == 4 * sizeof(float), "Typed colors must only store their components.");
+
+class TypedColors_Test : public ::testing::Test {
+protected:
+	float avg_error = 0.05f;
+
+	rgb_color_space_definition* srgb;
+
+	virtual void SetUp()
+	{
+		srgb = rgb_color_space_definition_presets().sRGB();
+	}
+
+	virtual void TearDown()
+	{
+		delete srgb;
+	}
+};
+
+TEST_F(TypedColors_Test, Conversion_Tests)
+{
+	typed::rgb<float> orange{ 1.f, 0.5f, 0.f, 0.8f };
+	rgb_deepcolor orange_class(1.f, 0.5f, 0.f, 0.8f, srgb);
+
+	auto typed_xyz = typed::convert<typed::xyz<float>>(orange);
+	auto class_xyz = color_manipulation::color_converter::to_xyz(orange_class);
+	EXPECT_NEAR(class_xyz.x(), typed_xyz.x, avg_error);
+	EXPECT_NEAR(class_xyz.y(), typed_xyz.y, avg_error);
+	EXPECT_NEAR(class_xyz.z(), typed_xyz.z, avg_error);
+	EXPECT_FLOAT_EQ(0.8f, typed_xyz.alpha);
+
+	auto typed_lab = typed::convert<typed::lab<float>>(orange);
+	auto class_lab = color_manipulation::color_converter::to_lab(orange_class);
+	EXPECT_NEAR(class_lab.luminance(), typed_lab.luminance, avg_error);
+	EXPECT_NEAR(class_lab.a(), typed_lab.a, avg_error);
+	EXPECT_NEAR(class_lab.b(), typed_lab.b, avg_error);
+
+	auto typed_hsl = typed::convert<typed::hsl<float>>(orange);
+	auto class_hsl = color_manipulation::color_converter::to_hsl(orange_class);
+	EXPECT_NEAR(class_hsl.hue(), typed_hsl.hue, avg_error);
+	EXPECT_NEAR(class_hsl.saturation(), typed_hsl.saturation, avg_error);
+	EXPECT_NEAR(class_hsl.lightness(), typed_hsl.lightness, avg_error);
+
+	auto typed_hsv = typed::convert<typed::hsv<float>>(typed_hsl);
+	auto class_hsv = color_manipulation::color_converter::to_hsv(orange_class);
+	EXPECT_NEAR(class_hsv.hue(), typed_hsv.hue, avg_error);
+	EXPECT_NEAR(class_hsv.saturation(), typed_hsv.saturation, avg_error);
+	EXPECT_NEAR(class_hsv.value(), typed_hsv.value, avg_error);
+
+	// Chains through xyz return to the input color.
+	auto round_trip = typed::convert<typed::rgb<float>>(typed::convert<typed::hsv<float>>(typed_lab));
+	EXPECT_NEAR(orange.red, round_trip.red, avg_error);
+	EXPECT_NEAR(orange.green, round_trip.green, avg_error);
+	EXPECT_NEAR(orange.blue, round_trip.blue, avg_error);
+	EXPECT_FLOAT_EQ(orange.alpha, round_trip.alpha);
+
+	auto same = typed::convert<typed::rgb<float>>(orange);
+	EXPECT_FLOAT_EQ(orange.green, same.green);
+
+	typed::rgb<double> orange_double{ 1.0, 0.5, 0.0, 1.0 };
+	auto lab_double = typed::convert<typed::lab<double>>(orange_double);
+	EXPECT_NEAR(class_lab.luminance(), lab_double.luminance, avg_error);
+}